@@ -12,45 +12,97 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <unordered_set>
 
 #include "chrono/collision/ChConvexDecomposition.h"
+#include "chrono/utils/ChOpenMP.h"
+
 #include "chrono_thirdparty/HACDv2/wavefront.h"
+#include "chrono_thirdparty/filesystem/path.h"
 
 namespace chrono {
 
 //
 // Utility functions to process bad topology in meshes with repeated vertices
-//  (to be optimized for performance; in future it is better to use hash lookup)
 //
 
-int GetIndex(ChVector3d vertex, std::vector<ChVector3d>& vertexOUT, double tol) {
-    // Suboptimal: search vertexes with same position and reuse, (in future: adopt hash map..)
-    for (unsigned int iv = 0; iv < vertexOUT.size(); iv++) {
-        if (vertex.Equals(vertexOUT[iv], tol)) {
-            return iv;
-        }
+// Hash of the integer coordinates of a grid cell.
+struct GridCellHash {
+    size_t operator()(const std::array<int64_t, 3>& c) const {
+        uint64_t h = (uint64_t)c[0] * 73856093ULL ^ (uint64_t)c[1] * 19349663ULL ^ (uint64_t)c[2] * 83492791ULL;
+        return (size_t)(h ^ (h >> 32));
     }
-    // not found, so add it to new vertexes
-    vertexOUT.push_back(vertex);
-    return ((int)vertexOUT.size() - 1);
-}
+};
 
-void FuseMesh(std::vector<ChVector3d>& vertexIN,
-              std::vector<ChVector3i>& triangleIN,
-              std::vector<ChVector3d>& vertexOUT,
-              std::vector<ChVector3i>& triangleOUT,
-              double tol = 0.0) {
+// Fuse repeated vertices, i.e. vertices that differ by less than 'tol' in each coordinate.
+// As with a linear search over the already processed vertices, each vertex is merged with the first matching vertex.
+// Candidates are looked up in a hash grid with cell size 'tol', so matching vertices are in the same or adjacent cells.
+static void FuseMesh(const std::vector<ChVector3d>& vertexIN,
+                     const std::vector<ChVector3i>& triangleIN,
+                     std::vector<ChVector3d>& vertexOUT,
+                     std::vector<ChVector3i>& triangleOUT,
+                     double tol = 0.0) {
     vertexOUT.clear();
     triangleOUT.clear();
-    for (unsigned int it = 0; it < triangleIN.size(); it++) {
-        unsigned int i1 = GetIndex(vertexIN[triangleIN[it].x()], vertexOUT, tol);
-        unsigned int i2 = GetIndex(vertexIN[triangleIN[it].y()], vertexOUT, tol);
-        unsigned int i3 = GetIndex(vertexIN[triangleIN[it].z()], vertexOUT, tol);
-
-        ChVector3i merged_triangle(i1, i2, i3);
+    triangleOUT.reserve(triangleIN.size());
+
+    // Vertices are compared with a strict inequality, so nothing is fused with a zero tolerance
+    if (!(tol > 0)) {
+        for (const auto& t : triangleIN) {
+            int i0 = (int)vertexOUT.size();
+            vertexOUT.push_back(vertexIN[t.x()]);
+            vertexOUT.push_back(vertexIN[t.y()]);
+            vertexOUT.push_back(vertexIN[t.z()]);
+            triangleOUT.push_back(ChVector3i(i0, i0 + 1, i0 + 2));
+        }
+        return;
+    }
 
-        triangleOUT.push_back(merged_triangle);
+    // Cell coordinates are clamped (far away vertices may share a cell, which is slower but still correct)
+    auto cell_coord = [tol](double x) {
+        double c = std::floor(x / tol);
+        return (int64_t)std::max(-1e18, std::min(1e18, c));
+    };
+
+    std::unordered_map<std::array<int64_t, 3>, std::vector<int>, GridCellHash> grid;
+    auto get_index = [&](const ChVector3d& vertex) {
+        std::array<int64_t, 3> cell = {cell_coord(vertex.x()), cell_coord(vertex.y()), cell_coord(vertex.z())};
+        int found = -1;
+        for (int64_t dx = -1; dx <= 1; dx++) {
+            for (int64_t dy = -1; dy <= 1; dy++) {
+                for (int64_t dz = -1; dz <= 1; dz++) {
+                    auto it = grid.find({cell[0] + dx, cell[1] + dy, cell[2] + dz});
+                    if (it == grid.end())
+                        continue;
+                    for (int iv : it->second) {
+                        if ((found < 0 || iv < found) && vertex.Equals(vertexOUT[iv], tol))
+                            found = iv;
+                    }
+                }
+            }
+        }
+        if (found >= 0)
+            return found;
+        // not found, so add it to new vertexes
+        vertexOUT.push_back(vertex);
+        grid[cell].push_back((int)vertexOUT.size() - 1);
+        return (int)vertexOUT.size() - 1;
+    };
+
+    for (const auto& t : triangleIN) {
+        int i1 = get_index(vertexIN[t.x()]);
+        int i2 = get_index(vertexIN[t.y()]);
+        int i3 = get_index(vertexIN[t.z()]);
+        triangleOUT.push_back(ChVector3i(i1, i2, i3));
     }
 }
 
@@ -287,6 +339,7 @@ ChConvexDecompositionHACDv2::ChConvexDecompositionHACDv2() {
     gHACD = HACD::createHACD_API();
 
     this->fuse_tol = 1e-9;
+    this->verbose = true;
 }
 
 /// Destructor
@@ -340,12 +393,20 @@ void ChConvexDecompositionHACDv2::SetParameters(unsigned int mmMaxHullCount,
 
 class MyCallback : public hacd::ICallback {
   public:
+    MyCallback(bool verbose) : m_verbose(verbose) {}
+
     virtual bool Cancelled() {
         // Don't have a cancel button in the test console app.
         return false;
     }
 
-    virtual void ReportProgress(const char* message, hacd::HaF32 progress) { std::cout << message; }
+    virtual void ReportProgress(const char* message, hacd::HaF32 progress) {
+        if (m_verbose)
+            std::cout << message;
+    }
+
+  private:
+    bool m_verbose;
 };
 
 int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
@@ -375,7 +436,8 @@ int ChConvexDecompositionHACDv2::ComputeConvexDecomposition() {
         ((hacd::HaU32*)descriptor.mIndices)[mt * 3 + 2] = triangles_FUSED[mt].z();
     }
 
-    MyCallback callback;
+    // Note: HACDv2 requires a callback (for cancellation checks), also when not reporting progress
+    MyCallback callback(verbose);
     descriptor.mCallback = static_cast<hacd::ICallback*>(&callback);
 
     // Perform the decomposition!
@@ -411,6 +473,29 @@ bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, st
     return false;
 }
 
+bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, Hull& hull) {
+    hull.vertices.clear();
+    hull.faces.clear();
+    if (hullIndex >= this->gHACD->getHullCount())
+        return false;
+
+    const HACD::HACD_API::Hull* hacd_hull = gHACD->getHull(hullIndex);
+    if (!hacd_hull)
+        return false;
+
+    hull.vertices.reserve(hacd_hull->mVertexCount);
+    for (hacd::HaU32 i = 0; i < hacd_hull->mVertexCount; i++) {
+        const hacd::HaF32* p = &hacd_hull->mVertices[i * 3];
+        hull.vertices.push_back(ChVector3d(p[0], p[1], p[2]));
+    }
+    hull.faces.reserve(hacd_hull->mTriangleCount);
+    for (hacd::HaU32 i = 0; i < hacd_hull->mTriangleCount; i++) {
+        const hacd::HaU32* t = &hacd_hull->mIndices[i * 3];
+        hull.faces.push_back(ChVector3i(t[0], t[1], t[2]));
+    }
+    return true;
+}
+
 /// Get the n-th computed convex hull, by filling a ChTriangleMesh object
 /// that is passed as a parameter.
 bool ChConvexDecompositionHACDv2::GetConvexHullResult(unsigned int hullIndex, ChTriangleMesh& convextrimesh) {
@@ -471,4 +556,371 @@ void ChConvexDecompositionHACDv2::WriteConvexHullsAsWavefrontObj(std::ostream& m
     delete[] baseVertex;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+//
+//  ChConvexDecompositionCache
+//
+
+// Header of a binary convex hulls file.
+// The header is followed, for each hull, by the number of vertices and faces (uint64_t) and by the vertex and face
+// arrays.
+struct HullCacheHeader {
+    char magic[8];       // "CHHULLS"
+    uint32_t version;    // file format version
+    uint32_t reserved;   // unused
+    uint64_t key;        // hash of the decomposition input
+    uint64_t num_hulls;  // number of hulls
+};
+
+static const char hull_cache_magic[8] = "CHHULLS";
+static const uint32_t hull_cache_version = 1;
+
+static_assert(sizeof(ChVector3d) == 3 * sizeof(double), "Unexpected ChVector3d layout");
+static_assert(sizeof(ChVector3i) == 3 * sizeof(int), "Unexpected ChVector3i layout");
+
+// 64-bit FNV-1a hash, processed in 8-byte words.
+static uint64_t HashWords(uint64_t hash, const void* data, size_t size) {
+    const uint64_t prime = 0x100000001b3ULL;
+    const char* bytes = static_cast<const char*>(data);
+    size_t nwords = size / 8;
+    for (size_t i = 0; i < nwords; i++) {
+        uint64_t word;
+        std::memcpy(&word, bytes + 8 * i, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = 8 * nwords; i < size; i++)
+        hash = (hash ^ (unsigned char)bytes[i]) * prime;
+    return hash;
+}
+
+// Input of a single decomposition: a mesh, or a connected component of a mesh, with fused vertices.
+struct DecompositionJob {
+    size_t slot;                                 // index of the decomposed mesh
+    std::vector<ChVector3d> vertices;            // input vertices
+    std::vector<ChVector3i> faces;               // input triangles
+    ChConvexDecompositionCache::HullList hulls;  // resulting hulls
+};
+
+// Split a mesh with fused vertices in its connected components (ordered by their first triangle).
+static void SplitComponents(const std::vector<ChVector3d>& vertices,
+                            const std::vector<ChVector3i>& faces,
+                            std::vector<DecompositionJob>& components) {
+    // Union-find on the mesh vertices
+    std::vector<int> parent(vertices.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    for (const auto& f : faces) {
+        int r0 = find(f.x());
+        for (int r : {find(f.y()), find(f.z())}) {
+            if (r != r0) {
+                parent[std::max(r, r0)] = std::min(r, r0);
+                r0 = std::min(r, r0);
+            }
+        }
+    }
+
+    // Distribute faces (and their vertices, renumbered) to the components
+    std::vector<int> component(vertices.size(), -1);
+    std::vector<int> local_index(vertices.size(), -1);
+    for (const auto& f : faces) {
+        int root = find(f.x());
+        if (component[root] < 0) {
+            component[root] = (int)components.size();
+            components.emplace_back();
+        }
+        auto& comp = components[component[root]];
+        ChVector3i local;
+        for (int k = 0; k < 3; k++) {
+            int iv = f[k];
+            if (local_index[iv] < 0) {
+                local_index[iv] = (int)comp.vertices.size();
+                comp.vertices.push_back(vertices[iv]);
+            }
+            local[k] = local_index[iv];
+        }
+        comp.faces.push_back(local);
+    }
+}
+
+ChConvexDecompositionCache::ChConvexDecompositionCache()
+    : m_num_threads(ChOMP::GetNumProcs()), m_split_components(false), m_num_hits(0), m_num_misses(0) {
+    SetParameters();
+}
+
+void ChConvexDecompositionCache::SetCacheDirectory(const std::string& dir) {
+    m_cache_dir = dir;
+    if (!m_cache_dir.empty() && !filesystem::create_subdirectory(filesystem::path(m_cache_dir)))
+        std::cerr << "Warning: cannot create convex decomposition cache directory " << m_cache_dir << std::endl;
+}
+
+void ChConvexDecompositionCache::SetParameters(unsigned int mMaxHullCount,
+                                               unsigned int mMaxMergeHullCount,
+                                               unsigned int mMaxHullVertices,
+                                               float mConcavity,
+                                               float mSmallClusterThreshold,
+                                               float mFuseTolerance) {
+    m_max_hull_count = mMaxHullCount;
+    m_max_merge_hull_count = mMaxMergeHullCount;
+    m_max_hull_vertices = mMaxHullVertices;
+    m_concavity = mConcavity;
+    m_small_cluster_threshold = mSmallClusterThreshold;
+    m_fuse_tolerance = mFuseTolerance;
+}
+
+uint64_t ChConvexDecompositionCache::ComputeKey(const ChTriangleMesh& mesh) const {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    // Decomposition settings
+    const uint32_t uparams[5] = {hull_cache_version, m_max_hull_count, m_max_merge_hull_count, m_max_hull_vertices,
+                                 m_split_components ? 1U : 0U};
+    const float fparams[3] = {m_concavity, m_small_cluster_threshold, m_fuse_tolerance};
+    hash = HashWords(hash, uparams, sizeof(uparams));
+    hash = HashWords(hash, fparams, sizeof(fparams));
+
+    // Input triangles
+    unsigned int num_triangles = mesh.GetNumTriangles();
+    hash = HashWords(hash, &num_triangles, sizeof(num_triangles));
+    for (unsigned int i = 0; i < num_triangles; i++) {
+        auto tri = mesh.GetTriangle(i);
+        const double coords[9] = {tri.p1.x(), tri.p1.y(), tri.p1.z(), tri.p2.x(), tri.p2.y(),
+                                  tri.p2.z(), tri.p3.x(), tri.p3.y(), tri.p3.z()};
+        hash = HashWords(hash, coords, sizeof(coords));
+    }
+
+    return hash;
+}
+
+std::string ChConvexDecompositionCache::GetCacheFilename(uint64_t key) const {
+    std::ostringstream name;
+    name << "hulls_" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return (filesystem::path(m_cache_dir) / filesystem::path(name.str())).str();
+}
+
+void ChConvexDecompositionCache::ClearMemoryCache() {
+    m_memory.clear();
+    m_num_hits = 0;
+    m_num_misses = 0;
+}
+
+bool ChConvexDecompositionCache::WriteHulls(const std::string& filename, uint64_t key, const HullList& hulls) {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile.is_open())
+        return false;
+
+    HullCacheHeader header = {};
+    std::memcpy(header.magic, hull_cache_magic, sizeof(header.magic));
+    header.version = hull_cache_version;
+    header.key = key;
+    header.num_hulls = hulls.size();
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& hull : hulls) {
+        const uint64_t sizes[2] = {hull.vertices.size(), hull.faces.size()};
+        ofile.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+        if (!hull.vertices.empty())
+            ofile.write(reinterpret_cast<const char*>(hull.vertices.data()), hull.vertices.size() * sizeof(ChVector3d));
+        if (!hull.faces.empty())
+            ofile.write(reinterpret_cast<const char*>(hull.faces.data()), hull.faces.size() * sizeof(ChVector3i));
+    }
+
+    return ofile.good();
+}
+
+bool ChConvexDecompositionCache::ReadHulls(const std::string& filename, uint64_t key, HullList& hulls) {
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile.is_open())
+        return false;
+    uint64_t file_size = (uint64_t)ifile.tellg();
+    ifile.seekg(0, std::ios::beg);
+
+    HullCacheHeader header;
+    if (file_size < sizeof(header) || !ifile.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+    if (std::memcmp(header.magic, hull_cache_magic, sizeof(header.magic)) != 0 ||
+        header.version != hull_cache_version || header.key != key)
+        return false;
+
+    // Check all sizes against the remaining file size (truncated or corrupted file)
+    uint64_t remaining = file_size - sizeof(header);
+    if (header.num_hulls > remaining / (2 * sizeof(uint64_t)))
+        return false;
+
+    HullList result(header.num_hulls);
+    for (auto& hull : result) {
+        uint64_t sizes[2];
+        if (remaining < sizeof(sizes) || !ifile.read(reinterpret_cast<char*>(sizes), sizeof(sizes)))
+            return false;
+        remaining -= sizeof(sizes);
+        if (sizes[0] > remaining / sizeof(ChVector3d) || sizes[1] > remaining / sizeof(ChVector3i) ||
+            sizes[0] * sizeof(ChVector3d) + sizes[1] * sizeof(ChVector3i) > remaining)
+            return false;
+        remaining -= sizes[0] * sizeof(ChVector3d) + sizes[1] * sizeof(ChVector3i);
+
+        hull.vertices.resize((size_t)sizes[0]);
+        hull.faces.resize((size_t)sizes[1]);
+        if (sizes[0] > 0 &&
+            !ifile.read(reinterpret_cast<char*>(hull.vertices.data()), hull.vertices.size() * sizeof(ChVector3d)))
+            return false;
+        if (sizes[1] > 0 &&
+            !ifile.read(reinterpret_cast<char*>(hull.faces.data()), hull.faces.size() * sizeof(ChVector3i)))
+            return false;
+    }
+    if (remaining != 0)
+        return false;
+
+    hulls = std::move(result);
+    return true;
+}
+
+bool ChConvexDecompositionCache::Decompose(const ChTriangleMesh& mesh, HullList& hulls) {
+    std::vector<HullList> results;
+    bool success = DecomposeMeshes({&mesh}, results);
+    hulls = std::move(results[0]);
+    return success;
+}
+
+bool ChConvexDecompositionCache::Decompose(const std::vector<std::shared_ptr<ChTriangleMesh>>& meshes,
+                                           std::vector<HullList>& hulls) {
+    std::vector<const ChTriangleMesh*> mesh_ptrs;
+    for (const auto& mesh : meshes)
+        mesh_ptrs.push_back(mesh.get());
+    return DecomposeMeshes(mesh_ptrs, hulls);
+}
+
+bool ChConvexDecompositionCache::DecomposeMeshes(const std::vector<const ChTriangleMesh*>& meshes,
+                                                 std::vector<HullList>& hulls) {
+    int num_meshes = (int)meshes.size();
+    int num_threads = std::max(1, m_num_threads);
+
+    std::vector<uint64_t> keys(num_meshes);
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < num_meshes; i++)
+        keys[i] = ComputeKey(*meshes[i]);
+
+    // Meshes not in the memory cache (only the first of meshes with the same key)
+    std::vector<int> pending;
+    std::unordered_set<uint64_t> pending_keys;
+    for (int i = 0; i < num_meshes; i++) {
+        if (m_memory.find(keys[i]) != m_memory.end() || !pending_keys.insert(keys[i]).second)
+            m_num_hits++;
+        else
+            pending.push_back(i);
+    }
+    int num_pending = (int)pending.size();
+
+    // Look up the cache files
+    std::vector<HullList> results(num_pending);
+    std::vector<char> found(num_pending, 0);
+    if (!m_cache_dir.empty()) {
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+        for (int k = 0; k < num_pending; k++) {
+            uint64_t key = keys[pending[k]];
+            found[k] = ReadHulls(GetCacheFilename(key), key, results[k]);
+        }
+    }
+
+    // Collect the inputs of the decompositions to be performed: fuse repeated vertices and optionally split the
+    // meshes in their connected components
+    std::vector<int> missing;
+    for (int k = 0; k < num_pending; k++) {
+        if (found[k])
+            m_num_hits++;
+        else
+            missing.push_back(k);
+    }
+    int num_missing = (int)missing.size();
+    m_num_misses += num_missing;
+
+    std::vector<std::vector<DecompositionJob>> mesh_jobs(num_missing);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (int m = 0; m < num_missing; m++) {
+        const auto& mesh = *meshes[pending[missing[m]]];
+        std::vector<ChVector3d> points;
+        std::vector<ChVector3i> triangles;
+        for (unsigned int i = 0; i < mesh.GetNumTriangles(); i++) {
+            auto tri = mesh.GetTriangle(i);
+            int i0 = (int)points.size();
+            points.push_back(tri.p1);
+            points.push_back(tri.p2);
+            points.push_back(tri.p3);
+            triangles.push_back(ChVector3i(i0, i0 + 1, i0 + 2));
+        }
+        DecompositionJob job;
+        FuseMesh(points, triangles, job.vertices, job.faces, m_fuse_tolerance);
+        if (m_split_components)
+            SplitComponents(job.vertices, job.faces, mesh_jobs[m]);
+        else
+            mesh_jobs[m].push_back(std::move(job));
+        for (auto& j : mesh_jobs[m])
+            j.slot = missing[m];
+    }
+
+    // Perform the decompositions, largest first for better load balancing
+    std::vector<DecompositionJob*> jobs;
+    for (auto& mj : mesh_jobs) {
+        for (auto& j : mj)
+            jobs.push_back(&j);
+    }
+    std::stable_sort(jobs.begin(), jobs.end(), [](const DecompositionJob* a, const DecompositionJob* b) {
+        return a->faces.size() > b->faces.size();
+    });
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (int j = 0; j < (int)jobs.size(); j++) {
+        auto& job = *jobs[j];
+        ChConvexDecompositionHACDv2 decomposition;
+        decomposition.SetVerbose(false);
+        for (const auto& f : job.faces)
+            decomposition.AddTriangle(job.vertices[f.x()], job.vertices[f.y()], job.vertices[f.z()]);
+        decomposition.SetParameters(m_max_hull_count, m_max_merge_hull_count, m_max_hull_vertices, m_concavity,
+                                    m_small_cluster_threshold, m_fuse_tolerance);
+        decomposition.ComputeConvexDecomposition();
+
+        for (unsigned int h = 0; h < decomposition.GetHullCount(); h++) {
+            ChConvexDecomposition::Hull hull;
+            if (decomposition.GetConvexHullResult(h, hull) && !hull.vertices.empty())
+                job.hulls.push_back(std::move(hull));
+        }
+        job.vertices.clear();
+        job.faces.clear();
+    }
+
+    // Gather the hulls of all components of a mesh and write the cache files
+    for (auto& mj : mesh_jobs) {
+        for (auto& j : mj) {
+            auto& hull_list = results[j.slot];
+            std::move(j.hulls.begin(), j.hulls.end(), std::back_inserter(hull_list));
+        }
+    }
+    if (!m_cache_dir.empty()) {
+        for (int k : missing) {
+            uint64_t key = keys[pending[k]];
+            if (!WriteHulls(GetCacheFilename(key), key, results[k]))
+                std::cerr << "Warning: cannot write convex decomposition cache file " << GetCacheFilename(key)
+                          << std::endl;
+        }
+    }
+
+    for (int k = 0; k < num_pending; k++)
+        m_memory[keys[pending[k]]] = std::move(results[k]);
+
+    // Copy the results to the output
+    bool success = true;
+    hulls.resize(num_meshes);
+    for (int i = 0; i < num_meshes; i++) {
+        hulls[i] = m_memory[keys[i]];
+        success &= !hulls[i].empty();
+    }
+
+    return success;
+}
+
 }  // end namespace chrono
@@ -15,6 +15,12 @@
 #ifndef CH_CONVEX_DECOMPOSITION_H
 #define CH_CONVEX_DECOMPOSITION_H
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/geometry/ChTriangleMeshSoup.h"
 
@@ -29,6 +35,12 @@ namespace chrono {
 /// Base interface class for convex decomposition.
 class ChApi ChConvexDecomposition {
   public:
+    /// Vertices and triangular faces of a convex hull.
+    struct Hull {
+        std::vector<ChVector3d> vertices;  ///< hull vertices
+        std::vector<ChVector3i> faces;     ///< triangular faces (indices in the vertex list)
+    };
+
     /// Basic constructor
     ChConvexDecomposition();
 
@@ -194,6 +206,12 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
     /// that is passed as a parameter.
     virtual bool GetConvexHullResult(unsigned int hullIndex, std::vector<ChVector3d>& convexhull);
 
+    /// Get the n-th computed convex hull, as vertices and triangular faces.
+    bool GetConvexHullResult(unsigned int hullIndex, Hull& hull);
+
+    /// Enable/disable printing the progress of the decomposition to the console (default: true).
+    void SetVerbose(bool verbose) { this->verbose = verbose; }
+
     /// Save the computed convex hulls as a Wavefront file using the
     /// '.obj' fileformat, with each hull as a separate group.
     /// May throw exceptions if file locked etc.
@@ -205,6 +223,92 @@ class ChApi ChConvexDecompositionHACDv2 : public ChConvexDecomposition {
     std::vector<ChVector3d> points;
     std::vector<ChVector3i> triangles;
     double fuse_tol;
+    bool verbose;
+};
+
+/// Driver for the HACDv2 convex decomposition of multiple meshes, with a cache of the results.
+/// The results are keyed by a hash of the input triangles and of the decomposition parameters, and are kept in memory
+/// and, if a cache directory is set, in binary files in that directory. A mesh is therefore decomposed only once, also
+/// across program runs; meshes missing from the cache are decomposed concurrently with OpenMP.
+/// Note: the same cache directory can be shared by different meshes and parameter sets.
+class ChApi ChConvexDecompositionCache {
+  public:
+    /// List of the convex hulls of a decomposed mesh.
+    typedef std::vector<ChConvexDecomposition::Hull> HullList;
+
+    ChConvexDecompositionCache();
+
+    /// Set the directory for the cache files. If empty (default), the results are only cached in memory.
+    /// The directory is created if it does not exist.
+    void SetCacheDirectory(const std::string& dir);
+
+    /// Get the directory of the cache files.
+    const std::string& GetCacheDirectory() const { return m_cache_dir; }
+
+    /// Set the number of threads used to decompose meshes (default: number of available processors).
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Set the parameters of the HACDv2 decomposition (see ChConvexDecompositionHACDv2::SetParameters).
+    void SetParameters(unsigned int mMaxHullCount = 256,
+                       unsigned int mMaxMergeHullCount = 256,
+                       unsigned int mMaxHullVertices = 64,
+                       float mConcavity = 0.2f,
+                       float mSmallClusterThreshold = 0.0f,
+                       float mFuseTolerance = 1e-9f);
+
+    /// Enable/disable the separate decomposition of the connected components of a mesh (default: false).
+    /// If enabled, the disjoint parts of a mesh are decomposed independently (and concurrently), which is usually much
+    /// faster for meshes made of many parts. Note that the hull count limits then apply to each component.
+    void SetSplitComponents(bool split) { m_split_components = split; }
+
+    /// Decompose a mesh, or retrieve its decomposition from the cache.
+    /// Return false if the decomposition has no hulls.
+    bool Decompose(const ChTriangleMesh& mesh, HullList& hulls);
+
+    /// Decompose multiple meshes, or retrieve their decompositions from the cache.
+    /// Meshes missing from the cache (and duplicate meshes only once) are decomposed in parallel.
+    /// Return false if the decomposition of any of the meshes has no hulls.
+    bool Decompose(const std::vector<std::shared_ptr<ChTriangleMesh>>& meshes, std::vector<HullList>& hulls);
+
+    /// Compute the cache key of a mesh with the current decomposition settings.
+    uint64_t ComputeKey(const ChTriangleMesh& mesh) const;
+
+    /// Get the name of the cache file for the given key.
+    std::string GetCacheFilename(uint64_t key) const;
+
+    /// Number of meshes found in the (memory or disk) cache, or duplicate of another mesh in the same batch.
+    unsigned int GetNumCacheHits() const { return m_num_hits; }
+
+    /// Number of meshes that were decomposed.
+    unsigned int GetNumCacheMisses() const { return m_num_misses; }
+
+    /// Clear the in-memory cache (cache files are not affected) and reset the hit/miss counters.
+    void ClearMemoryCache();
+
+    /// Write a list of convex hulls to a binary file, tagged with the given key.
+    static bool WriteHulls(const std::string& filename, uint64_t key, const HullList& hulls);
+
+    /// Read a list of convex hulls from a binary file.
+    /// Return false if the file does not exist, is corrupted, or was written with a different key.
+    static bool ReadHulls(const std::string& filename, uint64_t key, HullList& hulls);
+
+  private:
+    bool DecomposeMeshes(const std::vector<const ChTriangleMesh*>& meshes, std::vector<HullList>& hulls);
+
+    std::string m_cache_dir;
+    int m_num_threads;
+    bool m_split_components;
+
+    unsigned int m_max_hull_count;
+    unsigned int m_max_merge_hull_count;
+    unsigned int m_max_hull_vertices;
+    float m_concavity;
+    float m_small_cluster_threshold;
+    float m_fuse_tolerance;
+
+    std::unordered_map<uint64_t, HullList> m_memory;
+    unsigned int m_num_hits;
+    unsigned int m_num_misses;
 };
 
 /// @} chrono_collision
@@ -527,6 +527,12 @@ public:
 	virtual void parallelFor(int iBegin, int iEnd, int grainSize, const cbtIParallelForBody& body) BT_OVERRIDE
 	{
 		BT_PROFILE("parallelFor_OpenMP");
+		/* ***CHRONO*** Run serially with a single thread (an OMP parallel region allocates a thread team) */
+		if (m_numThreads == 1)
+		{
+			body.forLoop(iBegin, iEnd);
+			return;
+		}
 		cbtPushThreadsAreRunning();
         /* ***CHRONO*** Explicitly set number of threads in OMP for loop */
 #pragma omp parallel for schedule(static, 1) num_threads(m_numThreads)
@@ -540,6 +546,9 @@ public:
 	virtual cbtScalar parallelSum(int iBegin, int iEnd, int grainSize, const cbtIParallelSumBody& body) BT_OVERRIDE
 	{
 		BT_PROFILE("parallelFor_OpenMP");
+		/* ***CHRONO*** Run serially with a single thread (an OMP parallel region allocates a thread team) */
+		if (m_numThreads == 1)
+			return body.sumLoop(iBegin, iEnd);
 		cbtPushThreadsAreRunning();
 		cbtScalar sum = cbtScalar(0);
         /* ***CHRONO*** Explicitly set number of threads in OMP for loop */
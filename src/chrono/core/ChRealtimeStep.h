@@ -15,6 +15,7 @@
 #ifndef CHREALTIMESTEP_H
 #define CHREALTIMESTEP_H
 
+#include <algorithm>
 #include <limits>
 
 #include "chrono/core/ChTimer.h"
@@ -22,21 +23,53 @@
 namespace chrono {
 
 /// Class for a timer which attempts to enforce soft real-time.
+/// The timer also keeps track of the steps which missed their deadline (i.e., took longer than the step size).
+/// See ChRealtimeStepper for real-time execution with deadline scheduling and degradation of the simulation fidelity.
 class ChRealtimeStepTimer : public ChTimer {
   public:
     /// Create the timer (outside the simulation loop, preferably just before beginning the loop)
-    ChRealtimeStepTimer() { start(); }
+    ChRealtimeStepTimer() : m_num_steps(0), m_num_missed(0), m_max_overrun(0) { start(); }
 
     /// Call this function INSIDE the simulation loop, just ONCE per loop (preferably as the last call in the loop),
     /// passing it the integration step size used at this step. If the time elapsed over the last step (i.e., from
     /// the last call to Spin) is small than the integration step size, this function will spin in place until real time
     /// catches up with the simulation time, thus providing soft real-time capabilities.
-    void Spin(double step) {
+    /// Otherwise, the step is recorded as a missed deadline and the function returns false.
+    bool Spin(double step) {
+        double elapsed = GetTimeSeconds();
+        bool on_time = elapsed <= step;
+        m_num_steps++;
+        if (!on_time) {
+            m_num_missed++;
+            m_max_overrun = std::max(m_max_overrun, elapsed - step);
+        }
         while (GetTimeSeconds() < step) {
         }
         reset();
         start();
+        return on_time;
     }
+
+    /// Return the number of calls to Spin.
+    size_t GetNumSteps() const { return m_num_steps; }
+
+    /// Return the number of steps which missed their deadline.
+    size_t GetNumMissedDeadlines() const { return m_num_missed; }
+
+    /// Return the maximum overrun of a step over its deadline [s].
+    double GetMaxOverrun() const { return m_max_overrun; }
+
+    /// Reset the deadline statistics.
+    void ResetStats() {
+        m_num_steps = 0;
+        m_num_missed = 0;
+        m_max_overrun = 0;
+    }
+
+  private:
+    size_t m_num_steps;    ///< number of steps
+    size_t m_num_missed;   ///< number of missed deadlines
+    double m_max_overrun;  ///< maximum overrun [s]
 };
 
 }  // end namespace chrono
@@ -44,6 +44,9 @@ class ChTimer {
     /// Reset the total accumulated time (when repeating multiple start/stop).
     void reset() { m_total = std::chrono::duration<double>(0); }
 
+    /// Add the total accumulated time of another timer to this one (e.g. to merge timers used by different threads).
+    void add(const ChTimer& other) { m_total += other.m_total; }
+
     /// Return the time in milliseconds.
     /// If the timer was started but not stopped, this function returns the intermediate value and the timer keeps running.
     /// Otherwise, it returns the total accumulated time when the timer was last stopped.
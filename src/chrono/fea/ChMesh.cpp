@@ -18,13 +18,33 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
 
+#include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
 
+#include "chrono/fea/ChElementBar.h"
+#include "chrono/fea/ChElementBeamANCF_3243.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementBeamEuler.h"
+#include "chrono/fea/ChElementBeamIGA.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChElementHexaCorot_20.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChElementShellANCF_3443.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChElementShellBST.h"
+#include "chrono/fea/ChElementShellReissner4.h"
+#include "chrono/fea/ChElementSpring.h"
 #include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChElementTetraCorot_10.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
@@ -32,6 +52,305 @@
 namespace chrono {
 namespace fea {
 
+// -----------------------------------------------------------------------------
+// Element loop kernels
+// -----------------------------------------------------------------------------
+
+// True if the element type T uses the ChElementGeneric implementation of the element loop function F (i.e., neither
+// T nor any of its bases between ChElementGeneric and T override it). Member pointers to inherited functions have the
+// type of the class declaring the function.
+#define CH_ELEMENT_USES_GENERIC(T, F)                  \
+    (std::is_base_of<ChElementGeneric, T>::value && \
+     std::is_same<decltype(&T::F), decltype(&ChElementGeneric::F)>::value)
+
+// Calls to the element functions for elements whose dynamic type is exactly T.
+// All calls are qualified, hence statically dispatched. For element types relying on the ChElementGeneric
+// implementations of the loop functions, these are replaced by direct calls to the element computations
+// (T::ComputeInternalForces, T::ComputeKRMmatricesGlobal, ...) with the assembly written inline. This removes the
+// virtual calls in the per-element and per-node code, and the per-element allocation of temporaries (the work
+// vectors and matrices are provided by the caller and reused over the loop).
+template <class T>
+struct ChElementCall {
+    using DirectF = std::integral_constant<bool, CH_ELEMENT_USES_GENERIC(T, EleIntLoadResidual_F)>;
+    using DirectMv = std::integral_constant<bool, CH_ELEMENT_USES_GENERIC(T, EleIntLoadResidual_Mv)>;
+    using DirectMd = std::integral_constant<bool, CH_ELEMENT_USES_GENERIC(T, EleIntLoadLumpedMass_Md)>;
+    using DirectKRM = std::integral_constant<bool, CH_ELEMENT_USES_GENERIC(T, LoadKRMMatrices)>;
+    using DirectM = std::integral_constant<bool, CH_ELEMENT_USES_GENERIC(T, ComputeMmatrixGlobal)>;
+
+    static T* Cast(ChElementBase* e) { return static_cast<T*>(e); }
+
+    static void Update(ChElementBase* e) { Cast(e)->T::Update(); }
+    static void DoIntegration(ChElementBase* e) { Cast(e)->T::EleDoIntegration(); }
+    static void LoadResidual_F(ChElementBase* e, ChVectorDynamic<>& R, double c, ChVectorDynamic<>& Fi) {
+        LoadResidual_F(Cast(e), R, c, Fi, DirectF());
+    }
+    static void LoadResidual_F_gravity(ChElementBase* e, ChVectorDynamic<>& R, const ChVector3d& G, double c) {
+        Cast(e)->T::EleIntLoadResidual_F_gravity(R, G, c);
+    }
+    static void LoadResidual_Mv(ChElementBase* e,
+                                ChVectorDynamic<>& R,
+                                const ChVectorDynamic<>& w,
+                                double c,
+                                ChMatrixDynamic<>& Mi,
+                                ChVectorDynamic<>& wi) {
+        LoadResidual_Mv(Cast(e), R, w, c, Mi, wi, DirectMv());
+    }
+    static void LoadLumpedMass_Md(ChElementBase* e,
+                                  ChVectorDynamic<>& Md,
+                                  double& err,
+                                  double c,
+                                  ChMatrixDynamic<>& Mi) {
+        LoadLumpedMass_Md(Cast(e), Md, err, c, Mi, DirectMd());
+    }
+    static void LoadKRMMatrices(ChElementBase* e, double Kfactor, double Rfactor, double Mfactor) {
+        LoadKRMMatrices(Cast(e), Kfactor, Rfactor, Mfactor, DirectKRM());
+    }
+
+  private:
+    // Add c*Fe to R at the element node offsets, skipping fixed nodes (see ChElementGeneric::EleIntLoadResidual_F).
+    // Called from within parallel loops: use atomic updates of R.
+    static void ScatterAtomic(T* e, const ChVectorDynamic<>& Fe, double c, ChVectorDynamic<>& R) {
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < e->T::GetNumNodes(); in++) {
+            auto node = e->T::GetNode(in);
+            if (!node->IsFixed()) {
+                unsigned int offset = node->NodeGetOffsetVelLevel();
+                unsigned int node_dofs = e->T::GetNodeNumCoordsPosLevelActive(in);
+                for (unsigned int j = 0; j < node_dofs; j++)
+#pragma omp atomic
+                    R(offset + j) += c * Fe(stride + j);
+            }
+            stride += e->T::GetNodeNumCoordsPosLevel(in);
+        }
+    }
+
+    // Add c*Fe to R at the element node offsets, skipping fixed nodes (serial loops).
+    template <class V>
+    static void Scatter(T* e, const V& Fe, double c, ChVectorDynamic<>& R) {
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < e->T::GetNumNodes(); in++) {
+            auto node = e->T::GetNode(in);
+            if (!node->IsFixed()) {
+                unsigned int node_dofs = e->T::GetNodeNumCoordsPosLevelActive(in);
+                R.segment(node->NodeGetOffsetVelLevel(), node_dofs) += c * Fe.segment(stride, node_dofs);
+            }
+            stride += e->T::GetNodeNumCoordsPosLevel(in);
+        }
+    }
+
+    // Element mass matrix (see ChElementGeneric::ComputeMmatrixGlobal).
+    static void ComputeMmatrix(T* e, ChMatrixDynamic<>& Mi, std::true_type) {
+        e->T::ComputeKRMmatricesGlobal(Mi, 0, 0, 1.0);
+    }
+    static void ComputeMmatrix(T* e, ChMatrixDynamic<>& Mi, std::false_type) { e->T::ComputeMmatrixGlobal(Mi); }
+
+    static void LoadResidual_F(T* e, ChVectorDynamic<>& R, double c, ChVectorDynamic<>& Fi, std::true_type) {
+        Fi.resize(e->T::GetNumCoordsPosLevel());
+        e->T::ComputeInternalForces(Fi);
+        ScatterAtomic(e, Fi, c, R);
+    }
+    static void LoadResidual_F(T* e, ChVectorDynamic<>& R, double c, ChVectorDynamic<>&, std::false_type) {
+        e->T::EleIntLoadResidual_F(R, c);
+    }
+
+    static void LoadResidual_Mv(T* e,
+                                ChVectorDynamic<>& R,
+                                const ChVectorDynamic<>& w,
+                                double c,
+                                ChMatrixDynamic<>& Mi,
+                                ChVectorDynamic<>& wi,
+                                std::true_type) {
+        unsigned int n = e->T::GetNumCoordsPosLevel();
+        Mi.resize(n, n);
+        ComputeMmatrix(e, Mi, DirectM());
+
+        wi.setZero(n);
+        unsigned int stride = 0;
+        for (unsigned int in = 0; in < e->T::GetNumNodes(); in++) {
+            auto node = e->T::GetNode(in);
+            if (!node->IsFixed()) {
+                unsigned int node_dofs = e->T::GetNodeNumCoordsPosLevelActive(in);
+                wi.segment(stride, node_dofs) = w.segment(node->NodeGetOffsetVelLevel(), node_dofs);
+            }
+            stride += e->T::GetNodeNumCoordsPosLevel(in);
+        }
+
+        Scatter(e, Mi * wi, c, R);
+    }
+    static void LoadResidual_Mv(T* e,
+                                ChVectorDynamic<>& R,
+                                const ChVectorDynamic<>& w,
+                                double c,
+                                ChMatrixDynamic<>&,
+                                ChVectorDynamic<>&,
+                                std::false_type) {
+        e->T::EleIntLoadResidual_Mv(R, w, c);
+    }
+
+    static void LoadLumpedMass_Md(T* e,
+                                  ChVectorDynamic<>& Md,
+                                  double& err,
+                                  double c,
+                                  ChMatrixDynamic<>& Mi,
+                                  std::true_type) {
+        unsigned int n = e->T::GetNumCoordsPosLevel();
+        Mi.resize(n, n);
+        ComputeMmatrix(e, Mi, DirectM());
+        err = Mi.sum() - Mi.diagonal().sum();
+        Scatter(e, Mi.diagonal(), c, Md);
+    }
+    static void LoadLumpedMass_Md(T* e,
+                                  ChVectorDynamic<>& Md,
+                                  double& err,
+                                  double c,
+                                  ChMatrixDynamic<>&,
+                                  std::false_type) {
+        e->T::EleIntLoadLumpedMass_Md(Md, err, c);
+    }
+
+    static void LoadKRMMatrices(T* e, double Kfactor, double Rfactor, double Mfactor, std::true_type) {
+        e->T::ComputeKRMmatricesGlobal(e->Kstiffness().GetMatrix(), Kfactor, Rfactor, Mfactor);
+    }
+    static void LoadKRMMatrices(T* e, double Kfactor, double Rfactor, double Mfactor, std::false_type) {
+        e->T::LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    }
+};
+
+#undef CH_ELEMENT_USES_GENERIC
+
+// Fallback: virtual calls, for element types without specialized kernels.
+template <>
+struct ChElementCall<ChElementBase> {
+    static void Update(ChElementBase* e) { e->Update(); }
+    static void DoIntegration(ChElementBase* e) { e->EleDoIntegration(); }
+    static void LoadResidual_F(ChElementBase* e, ChVectorDynamic<>& R, double c, ChVectorDynamic<>&) {
+        e->EleIntLoadResidual_F(R, c);
+    }
+    static void LoadResidual_F_gravity(ChElementBase* e, ChVectorDynamic<>& R, const ChVector3d& G, double c) {
+        e->EleIntLoadResidual_F_gravity(R, G, c);
+    }
+    static void LoadResidual_Mv(ChElementBase* e,
+                                ChVectorDynamic<>& R,
+                                const ChVectorDynamic<>& w,
+                                double c,
+                                ChMatrixDynamic<>&,
+                                ChVectorDynamic<>&) {
+        e->EleIntLoadResidual_Mv(R, w, c);
+    }
+    static void LoadLumpedMass_Md(ChElementBase* e, ChVectorDynamic<>& Md, double& err, double c, ChMatrixDynamic<>&) {
+        e->EleIntLoadLumpedMass_Md(Md, err, c);
+    }
+    static void LoadKRMMatrices(ChElementBase* e, double Kfactor, double Rfactor, double Mfactor) {
+        e->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    }
+};
+
+struct ChMesh::ElementKernels {
+    bool specialized;
+    void (*Update)(ChElementBase* const* elems, int n);
+    void (*DoIntegration)(ChElementBase* const* elems, int n);
+    void (*LoadResidual_F)(ChElementBase* const* elems, int n, ChVectorDynamic<>& R, double c, int nthreads);
+    void (*LoadResidual_F_gravity)(ChElementBase* const* elems,
+                                   int n,
+                                   ChVectorDynamic<>& R,
+                                   const ChVector3d& G,
+                                   double c,
+                                   int nthreads);
+    void (*LoadResidual_Mv)(ChElementBase* const* elems,
+                            int n,
+                            ChVectorDynamic<>& R,
+                            const ChVectorDynamic<>& w,
+                            double c);
+    void (*LoadLumpedMass_Md)(ChElementBase* const* elems, int n, ChVectorDynamic<>& Md, double& err, double c);
+    void (*LoadKRMMatrices)(ChElementBase* const* elems,
+                            int n,
+                            double Kfactor,
+                            double Rfactor,
+                            double Mfactor,
+                            int nthreads);
+
+    template <class T>
+    static ElementKernels Make() {
+        using Call = ChElementCall<T>;
+        ElementKernels k;
+        k.specialized = !std::is_same<T, ChElementBase>::value;
+        k.Update = [](ChElementBase* const* elems, int n) {
+            for (int ie = 0; ie < n; ie++)
+                Call::Update(elems[ie]);
+        };
+        k.DoIntegration = [](ChElementBase* const* elems, int n) {
+            for (int ie = 0; ie < n; ie++)
+                Call::DoIntegration(elems[ie]);
+        };
+        k.LoadResidual_F = [](ChElementBase* const* elems, int n, ChVectorDynamic<>& R, double c, int nthreads) {
+            // Element contributions are added to R with atomic updates (see ChElementGeneric)
+#pragma omp parallel num_threads(nthreads)
+            {
+                ChVectorDynamic<> Fi;  // per-thread work vector
+#pragma omp for schedule(dynamic, 4)
+                for (int ie = 0; ie < n; ie++)
+                    Call::LoadResidual_F(elems[ie], R, c, Fi);
+            }
+        };
+        k.LoadResidual_F_gravity = [](ChElementBase* const* elems, int n, ChVectorDynamic<>& R, const ChVector3d& G,
+                                      double c, int nthreads) {
+            // Element contributions are added to R with atomic updates (see ChElementGeneric)
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+            for (int ie = 0; ie < n; ie++)
+                Call::LoadResidual_F_gravity(elems[ie], R, G, c);
+        };
+        k.LoadResidual_Mv = [](ChElementBase* const* elems, int n, ChVectorDynamic<>& R, const ChVectorDynamic<>& w,
+                               double c) {
+            ChMatrixDynamic<> Mi;
+            ChVectorDynamic<> wi;
+            for (int ie = 0; ie < n; ie++)
+                Call::LoadResidual_Mv(elems[ie], R, w, c, Mi, wi);
+        };
+        k.LoadLumpedMass_Md = [](ChElementBase* const* elems, int n, ChVectorDynamic<>& Md, double& err, double c) {
+            ChMatrixDynamic<> Mi;
+            for (int ie = 0; ie < n; ie++)
+                Call::LoadLumpedMass_Md(elems[ie], Md, err, c, Mi);
+        };
+        k.LoadKRMMatrices = [](ChElementBase* const* elems, int n, double Kfactor, double Rfactor, double Mfactor,
+                               int nthreads) {
+#pragma omp parallel for num_threads(nthreads)
+            for (int ie = 0; ie < n; ie++)
+                Call::LoadKRMMatrices(elems[ie], Kfactor, Rfactor, Mfactor);
+        };
+        return k;
+    }
+
+    // Get the kernels for the given element type.
+    // Element types listed here use specialized (statically dispatched) loops; all other types use virtual calls.
+    // Only element types with public overrides of the element loop functions can be listed here.
+    static const ElementKernels& Get(const std::type_index& type) {
+        static const std::unordered_map<std::type_index, ElementKernels> specialized = {
+            {typeid(ChElementBar), Make<ChElementBar>()},
+            {typeid(ChElementSpring), Make<ChElementSpring>()},
+            {typeid(ChElementTetraCorot_4), Make<ChElementTetraCorot_4>()},
+            {typeid(ChElementTetraCorot_10), Make<ChElementTetraCorot_10>()},
+            {typeid(ChElementHexaCorot_8), Make<ChElementHexaCorot_8>()},
+            {typeid(ChElementHexaCorot_20), Make<ChElementHexaCorot_20>()},
+            {typeid(ChElementHexaANCF_3843), Make<ChElementHexaANCF_3843>()},
+            {typeid(ChElementBeamEuler), Make<ChElementBeamEuler>()},
+            {typeid(ChElementBeamIGA), Make<ChElementBeamIGA>()},
+            {typeid(ChElementCableANCF), Make<ChElementCableANCF>()},
+            {typeid(ChElementBeamANCF_3243), Make<ChElementBeamANCF_3243>()},
+            {typeid(ChElementBeamANCF_3333), Make<ChElementBeamANCF_3333>()},
+            {typeid(ChElementShellANCF_3423), Make<ChElementShellANCF_3423>()},
+            {typeid(ChElementShellANCF_3443), Make<ChElementShellANCF_3443>()},
+            {typeid(ChElementShellANCF_3833), Make<ChElementShellANCF_3833>()},
+            {typeid(ChElementShellReissner4), Make<ChElementShellReissner4>()},
+            {typeid(ChElementShellBST), Make<ChElementShellBST>()}};
+        static const ElementKernels generic = Make<ChElementBase>();
+
+        auto k = specialized.find(type);
+        return (k != specialized.end()) ? k->second : generic;
+    }
+};
+
+// -----------------------------------------------------------------------------
+
 ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     vnodes = other.vnodes;
     velements = other.velements;
@@ -47,6 +366,8 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    elem_buckets_valid = false;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +388,59 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    BuildElementBuckets();
+}
+
+void ChMesh::BuildElementBuckets() {
+    elem_buckets.clear();
+    std::unordered_map<std::type_index, size_t> bucket_index;
+
+    // Elements of the same type are kept in their original relative order
+    for (const auto& elem : velements) {
+        std::type_index type = typeid(*elem);
+        auto found = bucket_index.find(type);
+        if (found == bucket_index.end()) {
+            ElementBucket bucket;
+            bucket.kernels = &ElementKernels::Get(type);
+            bucket.type_id = type.name();
+            bucket.type_name = ChClassFactory::IsClassRegistered(type) ? ChClassFactory::GetClassTagName(type)
+                                                                       : std::string(type.name());
+            found = bucket_index.emplace(type, elem_buckets.size()).first;
+            elem_buckets.push_back(std::move(bucket));
+        }
+        elem_buckets[found->second].elements.push_back(elem.get());
+    }
+
+    elem_buckets_valid = true;
+}
+
+utils::ChTrace* ChMesh::GetElementsTrace() const {
+    utils::ChTrace* trace = system ? system->GetTrace() : nullptr;
+    return (trace && trace->IsItemsEnabled()) ? trace : nullptr;
+}
+
+void ChMesh::ResetTimers() {
+    timer_internal_forces.reset();
+    timer_KRMload.reset();
+    for (auto& bucket : elem_buckets) {
+        bucket.timer_internal_forces.reset();
+        bucket.timer_KRMload.reset();
+    }
+}
+
+std::vector<ChMesh::ElementBucketStats> ChMesh::GetElementBucketStats() const {
+    std::vector<ElementBucketStats> stats;
+    for (const auto& bucket : elem_buckets) {
+        ElementBucketStats s;
+        s.type_name = bucket.type_name;
+        s.num_elements = (unsigned int)bucket.elements.size();
+        s.specialized = bucket.kernels->specialized;
+        s.time_internal_forces = bucket.timer_internal_forces();
+        s.time_KRMload = bucket.timer_KRMload();
+        stats.push_back(s);
+    }
+    return stats;
 }
 
 void ChMesh::Relax() {
@@ -96,6 +470,7 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     velements.push_back(elem);
+    elem_buckets_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -106,6 +481,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 
 void ChMesh::ClearElements() {
     velements.clear();
+    elem_buckets_valid = false;
     vcontactsurfaces.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
@@ -116,6 +492,7 @@ void ChMesh::ClearElements() {
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    elem_buckets_valid = false;
     vnodes.clear();
     vcontactsurfaces.clear();
 
@@ -163,9 +540,11 @@ void ChMesh::Update(double m_time, bool update_assets) {
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
-    for (unsigned int i = 0; i < velements.size(); i++) {
-        //    - update auxiliary stuff, ex. update element's rotation matrices if corotational..
-        velements[i]->Update();
+    //    - update auxiliary stuff, ex. update element's rotation matrices if corotational..
+    auto trace = GetElementsTrace();
+    for (auto& bucket : GetElementBuckets()) {
+        utils::ChTraceScope scope(trace, bucket.type_id, utils::ChTrace::ItemsCategory());
+        bucket.kernels->Update(bucket.elements.data(), (int)bucket.elements.size());
     }
 }
 
@@ -257,9 +636,8 @@ void ChMesh::IntStateIncrement(const unsigned int off_x,
             local_off_v += vnodes[j]->GetNumCoordsVelLevelActive();
         }
     }
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleDoIntegration();
-    }
+    for (auto& bucket : GetElementBuckets())
+        bucket.kernels->DoIntegration(bucket.elements.data(), (int)bucket.elements.size());
 }
 
 void ChMesh::IntStateGetIncrement(const unsigned int off_x,
@@ -290,23 +668,24 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
-    // elements internal forces
+    // elements internal forces (parallel loop within each element type)
+    auto trace = GetElementsTrace();
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+    for (auto& bucket : GetElementBuckets()) {
+        utils::ChTraceScope scope(trace, bucket.type_id, utils::ChTrace::ItemsCategory());
+        bucket.timer_internal_forces.start();
+        bucket.kernels->LoadResidual_F(bucket.elements.data(), (int)bucket.elements.size(), R, c, nthreads);
+        bucket.timer_internal_forces.stop();
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
-        }
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+        for (auto& bucket : GetElementBuckets())
+            bucket.kernels->LoadResidual_F_gravity(bucket.elements.data(), (int)bucket.elements.size(), R, G_acc, c,
+                                                   nthreads);
     }
 
     // nodes gravity forces
@@ -416,9 +795,8 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
-    }
+    for (auto& bucket : GetElementBuckets())
+        bucket.kernels->LoadResidual_Mv(bucket.elements.data(), (int)bucket.elements.size(), R, w, c);
 }
 
 void ChMesh::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, double& err, const double c) {
@@ -432,9 +810,8 @@ void ChMesh::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md,
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadLumpedMass_Md(Md, err, c);
-    }
+    for (auto& bucket : GetElementBuckets())
+        bucket.kernels->LoadLumpedMass_Md(bucket.elements.data(), (int)bucket.elements.size(), Md, err, c);
 }
 
 void ChMesh::IntToDescriptor(const unsigned int off_v,
@@ -475,10 +852,15 @@ void ChMesh::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 void ChMesh::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
     int nthreads = GetSystem()->nthreads_chrono;
 
+    auto trace = GetElementsTrace();
     timer_KRMload.start();
-#pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    for (auto& bucket : GetElementBuckets()) {
+        utils::ChTraceScope scope(trace, bucket.type_id, utils::ChTrace::ItemsCategory());
+        bucket.timer_KRMload.start();
+        bucket.kernels->LoadKRMMatrices(bucket.elements.data(), (int)bucket.elements.size(), Kfactor, Rfactor, Mfactor,
+                                        nthreads);
+        bucket.timer_KRMload.stop();
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -17,8 +17,10 @@
 
 #include <cstdlib>
 #include <cmath>
+#include <string>
 
 #include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChTrace.h"
 #include "chrono/physics/ChIndexedNodes.h"
 #include "chrono/fea/ChContinuumMaterial.h"
 #include "chrono/fea/ChContactSurface.h"
@@ -44,7 +46,8 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          elem_buckets_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -94,16 +97,29 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative number of calls to load Jacobian information.
     unsigned int GetNumCallsJacobianLoad() { return ncalls_KRMload; }
 
-    /// Reset timers for internal force and Jacobian evaluations.
-    void ResetTimers() {
-        timer_internal_forces.reset();
-        timer_KRMload.reset();
-    }
+    /// Reset timers for internal force and Jacobian evaluations (including the per-type timers).
+    void ResetTimers();
     /// Get cumulative time for internal force evaluation.
     double GetTimeInternalForces() { return timer_internal_forces(); }
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Statistics for a group of mesh elements of the same concrete type.
+    struct ElementBucketStats {
+        std::string type_name;        ///< element class name (registered tag name, if available)
+        unsigned int num_elements;    ///< number of elements of this type in the mesh
+        bool specialized;             ///< true if the element loops for this type are statically dispatched
+        double time_internal_forces;  ///< cumulative time for internal force evaluation (s)
+        double time_KRMload;          ///< cumulative time for Jacobian load calls (s)
+    };
+
+    /// Get per-element-type statistics.
+    /// Elements are grouped by concrete type (at SetupInitial, or at the first evaluation after the element list was
+    /// modified) and all loops over elements process one type group at a time. For the common Chrono element types,
+    /// these loops call the element computations (internal forces, stiffness and mass matrices) directly, without
+    /// virtual dispatch, and assemble the results inline using work vectors reused over the loop.
+    std::vector<ElementBucketStats> GetElementBucketStats() const;
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -276,6 +292,32 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Set of loop kernels over elements of a given concrete type.
+    struct ElementKernels;
+
+    /// Group of elements with the same concrete type.
+    struct ElementBucket {
+        std::string type_name;
+        const char* type_id;  ///< type identifier (std::type_info name), used for trace events
+        const ElementKernels* kernels;
+        std::vector<ChElementBase*> elements;
+        ChTimer timer_internal_forces;
+        ChTimer timer_KRMload;
+    };
+
+    /// Group the mesh elements by concrete type.
+    void BuildElementBuckets();
+
+    /// Return the trace recorder of the system, if recording individual items (nullptr otherwise).
+    utils::ChTrace* GetElementsTrace() const;
+
+    /// Access the element buckets, rebuilding them if the element list was modified.
+    std::vector<ElementBucket>& GetElementBuckets() {
+        if (!elem_buckets_valid)
+            BuildElementBuckets();
+        return elem_buckets;
+    }
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -293,6 +335,9 @@ class ChApi ChMesh : public ChIndexedNodes {
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
 
+    std::vector<ElementBucket> elem_buckets;  ///< elements grouped by concrete type
+    bool elem_buckets_valid;                  ///< false if the buckets must be rebuilt
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include <memory>
+#include <cassert>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -84,6 +85,43 @@ double ChFunction::GetDerN(double x, int der_order) const {
     }
 }
 
+void ChFunction::GetValBatch(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == y.size());
+    for (Eigen::Index i = 0; i < x.size(); i++)
+        y(i) = GetVal(x(i));
+}
+
+void ChFunction::GetDerBatch(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == y.size());
+    for (Eigen::Index i = 0; i < x.size(); i++)
+        y(i) = GetDer(x(i));
+}
+
+void ChFunction::GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == y.size());
+    for (Eigen::Index i = 0; i < x.size(); i++)
+        y(i) = GetDer2(x(i));
+}
+
+void ChFunction::GetDerNBatch(ChVectorConstRef x, ChVectorRef y, int der_order) const {
+    switch (der_order) {
+        case 1:
+            GetDerBatch(x, y);
+            break;
+        case 2:
+            GetDer2Batch(x, y);
+            break;
+        case 3:
+            assert(x.size() == y.size());
+            for (Eigen::Index i = 0; i < x.size(); i++)
+                y(i) = GetDer3(x(i));
+            break;
+        default:
+            GetValBatch(x, y);
+            break;
+    }
+}
+
 // some analysis functions
 double ChFunction::GetMax(double xmin, double xmax, double sampling_step, int derivative) const {
     double mret = std::numeric_limits<double>::min();
@@ -170,14 +208,18 @@ ChMatrixDynamic<> ChFunction::SampleUpToDerN(double xmin, double xmax, double st
     ChMatrixDynamic<> data;
     int num_samples = (xmax - xmin) / step;
     data.resize(num_samples, derN + 2);  // data = [x, y(x), y_dx(x), ...]
+    ChVectorDynamic<> xs(num_samples);
+    ChVectorDynamic<> ys(num_samples);
     double x = xmin;
     for (int i = 0; i < num_samples; ++i) {
-        data(i, 0) = x;
-        for (int j = 0; j < derN + 1; ++j) {
-            data(i, j + 1) = GetDerN(x, j);
-        }
+        xs(i) = x;
         x += step;
     }
+    data.col(0) = xs;
+    for (int j = 0; j < derN + 1; ++j) {
+        GetDerNBatch(xs, ys, j);
+        data.col(j + 1) = ys;
+    }
     return data;
 }
 
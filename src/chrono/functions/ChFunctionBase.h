@@ -90,6 +90,23 @@ class ChApi ChFunction {
     /// Alias for other GetDerX functions.
     virtual double GetDerN(double x, int der_order) const;
 
+    /// Evaluate the function at all values in \a x and store the results in \a y (of the same size).
+    /// Default implementation calls GetVal for each value.
+    /// Inherited classes may override this method with a more efficient (e.g. vectorized) implementation.
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const;
+
+    /// Evaluate the first derivative at all values in \a x and store the results in \a y (of the same size).
+    /// Default implementation calls GetDer for each value.
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const;
+
+    /// Evaluate the second derivative at all values in \a x and store the results in \a y (of the same size).
+    /// Default implementation calls GetDer2 for each value.
+    virtual void GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const;
+
+    /// Evaluate the Nth derivative (up to 3rd derivative) at all values in \a x.
+    /// Alias for other GetDerXBatch functions.
+    void GetDerNBatch(ChVectorConstRef x, ChVectorRef y, int der_order) const;
+
     /// Return the weight of the function.
     /// (useful for applications where you need to mix different weighted ChFunctions)
     virtual double GetWeight(double x) const { return 1.0; }
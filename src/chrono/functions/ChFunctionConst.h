@@ -46,6 +46,10 @@ class ChApi ChFunctionConst : public ChFunction {
     /// Returns the function second derivative (i.e. 0)
     virtual double GetDer2(double x) const override { return 0; }
 
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const override { y.setConstant(m_constant); }
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const override { y.setZero(); }
+    virtual void GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const override { y.setZero(); }
+
     /// Set the constant value of the function.
     void SetConstant(double y_constant) { m_constant = y_constant; }
 
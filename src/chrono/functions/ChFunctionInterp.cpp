@@ -12,15 +12,25 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+
 #include "chrono/functions/ChFunctionInterp.h"
 
 namespace chrono {
 
 CH_FACTORY_REGISTER(ChFunctionInterp)
 
-ChFunctionInterp::ChFunctionInterp(const ChFunctionInterp& other) {
+// Relative tolerance on the spacing of x values for a table to be considered uniform
+static const double uniform_tol = 1e-9;
+
+ChFunctionInterp::ChFunctionInterp(const ChFunctionInterp& other) : ChFunction(other) {
     m_table = other.m_table;
-    m_last_greater = m_table.end();
+    m_x = other.m_x;
+    m_y = other.m_y;
+    m_uniform = other.m_uniform;
+    m_inv_dx = other.m_inv_dx;
+    m_extrapolate = other.m_extrapolate;
 }
 
 void ChFunctionInterp::AddPoint(double x, double y, bool overwrite_if_existing) {
@@ -30,95 +40,137 @@ void ChFunctionInterp::AddPoint(double x, double y, bool overwrite_if_existing)
         // no insertion took place, so the point already exists
         if (overwrite_if_existing) {
             ret.first->second = y;
+            m_y[std::lower_bound(m_x.begin(), m_x.end(), x) - m_x.begin()] = y;
+            return;
         } else {
             throw std::invalid_argument("Point already exists and overwrite flag was not set.");
         }
     }
-}
 
-double ChFunctionInterp::GetVal(double x) const {
-    if (m_table.empty()) {
-        return 0.0;
+    // Points are usually added in increasing order of x, in which case they are simply appended
+    if (m_x.empty() || x > m_x.back()) {
+        m_x.push_back(x);
+        m_y.push_back(y);
+        size_t n = m_x.size();
+        if (n <= 2 || (m_uniform && std::abs((m_x[n - 1] - m_x[n - 2]) - (m_x[1] - m_x[0])) <=
+                                        uniform_tol * (m_x[1] - m_x[0]))) {
+            m_uniform = n >= 2;
+            m_inv_dx = m_uniform ? (n - 1) / (m_x[n - 1] - m_x[0]) : 0;
+        } else {
+            m_uniform = false;
+        }
+        return;
     }
 
-    if (x <= m_table.begin()->first) {
-        // if the extrapolation is not allowed, the derivative will be zero
-        return m_table.begin()->second - GetDer(x) * (m_table.begin()->first - x);
-    }
+    size_t i = std::upper_bound(m_x.begin(), m_x.end(), x) - m_x.begin();
+    m_x.insert(m_x.begin() + i, x);
+    m_y.insert(m_y.begin() + i, y);
+    UpdateUniform();
+}
 
-    if (x >= m_table.rbegin()->first) {
-        // if the extrapolation is not allowed, the derivative will be zero
-        return m_table.rbegin()->second + GetDer(x) * (x - m_table.rbegin()->first);
-    }
+void ChFunctionInterp::Reset() {
+    m_table.clear();
+    m_x.clear();
+    m_y.clear();
+    m_uniform = false;
+    m_inv_dx = 0;
+}
 
-    if (m_last_greater == m_table.end()) {
-        m_last_greater = std::next(m_table.begin());
+void ChFunctionInterp::UpdateArrays() {
+    m_x.clear();
+    m_y.clear();
+    m_x.reserve(m_table.size());
+    m_y.reserve(m_table.size());
+    for (const auto& p : m_table) {
+        m_x.push_back(p.first);
+        m_y.push_back(p.second);
     }
+    UpdateUniform();
+}
 
-    // there shouldn't be any case in which this happens, but if it does add a check if m_last_greater==m_table.begin
-    // and then set it to ++m_table.begin()
-    assert(m_last_greater != m_table.begin());
-
-    //// Find the pair of points for which 'x' is in between
-    // - the point is surely bigger than m_table.begin()->first and smaller than m_table.rbegin()->first
-
-    // if m_last_greater is not valid anymore make a full search
-    if (!(x > std::prev(m_last_greater)->first && x <= m_last_greater->first)) {
-        m_last_greater = m_table.upper_bound(x);
+void ChFunctionInterp::UpdateUniform() {
+    size_t n = m_x.size();
+    m_uniform = false;
+    m_inv_dx = 0;
+    if (n < 2)
+        return;
+
+    // Compare all spacings with the first one (so that the index computed in FindInterval is off by at most one)
+    double h0 = m_x[1] - m_x[0];
+    for (size_t i = 2; i < n; i++) {
+        if (std::abs((m_x[i] - m_x[i - 1]) - h0) > uniform_tol * h0)
+            return;
     }
+    m_uniform = true;
+    m_inv_dx = (n - 1) / (m_x[n - 1] - m_x[0]);
+}
 
-    double x_prev = std::prev(m_last_greater)->first;
-    double y_prev = std::prev(m_last_greater)->second;
-    double val = y_prev + (m_last_greater->second - y_prev) * (x - x_prev) / (m_last_greater->first - x_prev);
+size_t ChFunctionInterp::FindInterval(double x) const {
+    const size_t n = m_x.size();
+
+    if (m_uniform) {
+        // Direct computation, corrected for round-off
+        size_t i = std::min((size_t)((x - m_x[0]) * m_inv_dx), n - 2);
+        if (x < m_x[i])
+            i--;
+        else if (i + 2 < n && x >= m_x[i + 1])
+            i++;
+        return i;
+    }
 
-    return val;
+    // Branch-free binary search for the last of x_0,...,x_{n-2} not greater than x
+    const double* base = m_x.data();
+    size_t len = n - 1;
+    while (len > 1) {
+        size_t half = len / 2;
+        base += (base[half] <= x) ? half : 0;
+        len -= half;
+    }
+    return base - m_x.data();
 }
 
-double ChFunctionInterp::GetDer(double x) const {
-    if (m_table.empty()) {
+double ChFunctionInterp::GetEndSlope(bool last) const {
+    size_t n = m_x.size();
+    if (!m_extrapolate || n < 2)
         return 0.0;
-    }
+    if (last)
+        return (m_y[n - 1] - m_y[n - 2]) / (m_x[n - 1] - m_x[n - 2]);
+    return (m_y[1] - m_y[0]) / (m_x[1] - m_x[0]);
+}
 
-    if (x <= m_table.begin()->first) {
-        if (m_extrapolate && m_table.size() > 1) {
-            double der_first = (std::next(m_table.begin())->second - m_table.begin()->second) /
-                               (std::next(m_table.begin())->first - m_table.begin()->first);
-            return der_first;
-        } else {
-            return 0.0;
-        }
+double ChFunctionInterp::GetVal(double x) const {
+    if (m_x.empty()) {
+        return 0.0;
     }
 
-    if (x >= m_table.rbegin()->first) {
-        if (m_extrapolate && m_table.size() > 1) {
-            double der_last = (m_table.rbegin()->second - std::next(m_table.rbegin())->second) /
-                              (m_table.rbegin()->first - std::next(m_table.rbegin())->first);
-            return der_last;
-        } else {
-            return 0.0;
-        }
+    // if the extrapolation is not allowed, the end slopes are zero
+    if (x <= m_x.front()) {
+        return m_y.front() - GetEndSlope(false) * (m_x.front() - x);
     }
 
-    if (m_last_greater == m_table.end()) {
-        m_last_greater = std::next(m_table.begin());
+    if (x >= m_x.back()) {
+        return m_y.back() + GetEndSlope(true) * (x - m_x.back());
     }
 
-    // there shouldn't be any case in which this happens, but if it does add a check if m_last_greater==m_table.begin
-    // and then set it to ++m_table.begin()
-    assert(m_last_greater != m_table.begin());
+    size_t i = FindInterval(x);
+    return m_y[i] + (m_y[i + 1] - m_y[i]) * (x - m_x[i]) / (m_x[i + 1] - m_x[i]);
+}
 
-    //// Find the pair of points for which 'x' is in between
-    // - the point is surely bigger than m_table.begin()->first and smaller than m_table.rbegin()->first
+double ChFunctionInterp::GetDer(double x) const {
+    if (m_x.empty()) {
+        return 0.0;
+    }
 
-    // if m_last_greater is not valid anymore make a full search
-    if (!(x >= std::prev(m_last_greater)->first && x < m_last_greater->first)) {
-        m_last_greater = m_table.upper_bound(x);
+    if (x <= m_x.front()) {
+        return GetEndSlope(false);
     }
 
-    double der = (m_last_greater->second - std::prev(m_last_greater)->second) /
-                 (m_last_greater->first - std::prev(m_last_greater)->first);
+    if (x >= m_x.back()) {
+        return GetEndSlope(true);
+    }
 
-    return der;
+    size_t i = FindInterval(x);
+    return (m_y[i + 1] - m_y[i]) / (m_x[i + 1] - m_x[i]);
 }
 
 double ChFunctionInterp::GetDer2(double x) const {
@@ -126,18 +178,24 @@ double ChFunctionInterp::GetDer2(double x) const {
     return ChFunction::GetDer2(x);
 }
 
+void ChFunctionInterp::GetValBatch(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == y.size());
+    for (Eigen::Index k = 0; k < x.size(); k++)
+        y(k) = GetVal(x(k));
+}
+
+void ChFunctionInterp::GetDerBatch(ChVectorConstRef x, ChVectorRef y) const {
+    assert(x.size() == y.size());
+    for (Eigen::Index k = 0; k < x.size(); k++)
+        y(k) = GetDer(x(k));
+}
+
 double ChFunctionInterp::GetMax() const {
-    using pType = std::pair<double, double>;
-    auto ptr = std::max_element(m_table.begin(), m_table.end(),
-                                [](const pType& p1, const pType& p2) { return p1.second < p2.second; });
-    return ptr->second;
+    return *std::max_element(m_y.begin(), m_y.end());
 }
 
 double ChFunctionInterp::GetMin() const {
-    using pType = std::pair<double, double>;
-    auto ptr = std::min_element(m_table.begin(), m_table.end(),
-                                [](const pType& p1, const pType& p2) { return p1.second < p2.second; });
-    return ptr->second;
+    return *std::min_element(m_y.begin(), m_y.end());
 }
 
 void ChFunctionInterp::ArchiveOut(ChArchiveOut& archive_out) {
@@ -159,7 +217,7 @@ void ChFunctionInterp::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(m_table);
     archive_in >> CHNVP(m_extrapolate);
 
-    m_last_greater = m_table.end();
+    UpdateArrays();
 }
 
 }  // end namespace chrono
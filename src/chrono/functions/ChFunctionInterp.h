@@ -15,8 +15,8 @@
 #ifndef CHFUNCT_INTERP_H
 #define CHFUNCT_INTERP_H
 
-#include <iterator>
 #include <map>
+#include <vector>
 
 #include "chrono/functions/ChFunctionBase.h"
 
@@ -27,14 +27,20 @@ namespace chrono {
 
 /// Interpolation function.
 /// Linear interpolation `y=f(x)` given a list of points `(x,y)`.
+/// The points are stored in flat sorted arrays. The interval containing a given \a x is found with a branch-free binary
+/// search or, if the points are uniformly spaced, computed directly. Evaluation does not modify the object, so the same
+/// function can be evaluated concurrently from multiple threads.
 class ChApi ChFunctionInterp : public ChFunction {
   private:
-    std::map<double, double> m_table;                                 ///< map with x-y points
-    mutable std::map<double, double>::const_iterator m_last_greater;  ///< pointer to element greater than last 'x'
-    bool m_extrapolate = false;  ///< enable linear extrapolation for out-of-range values
+    std::map<double, double> m_table;  ///< map with x-y points
+    std::vector<double> m_x;           ///< sorted x values (same as the keys of m_table)
+    std::vector<double> m_y;           ///< y values corresponding to m_x
+    bool m_uniform;                    ///< true if the x values are uniformly spaced
+    double m_inv_dx;                   ///< inverse of the spacing of uniformly spaced x values
+    bool m_extrapolate;                ///< enable linear extrapolation for out-of-range values
 
   public:
-    ChFunctionInterp() : m_last_greater(m_table.end()), m_extrapolate(false) {}
+    ChFunctionInterp() : m_uniform(false), m_inv_dx(0), m_extrapolate(false) {}
     ChFunctionInterp(const ChFunctionInterp& other);
     ~ChFunctionInterp() {}
 
@@ -47,24 +53,32 @@ class ChApi ChFunctionInterp : public ChFunction {
     virtual double GetDer(double x) const override;
     virtual double GetDer2(double x) const override;
 
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const override;
+
     /// Add a point to the table.
     /// By default, adding a point with an \a x value that already exists in the table will lead to an exception.
     /// If \a overwrite_if_existing is set to \c true, the existing point will be overwritten instead.
     void AddPoint(double x, double y, bool overwrite_if_existing = false);
 
-    void Reset() {
-        m_table.clear();
-        m_last_greater = m_table.end();
-    }
+    /// Remove all points from the table.
+    void Reset();
 
     /// Retrieve the underlying table of points.
     const std::map<double, double>& GetTable() { return m_table; }
 
+    /// Return the number of points in the table.
+    size_t GetNumPoints() const { return m_x.size(); }
+
+    /// Return true if the x values in the table are uniformly spaced.
+    /// In this case, the interval containing a given \a x is computed directly instead of searched for.
+    bool IsUniform() const { return m_uniform; }
+
     /// Return the smallest value of x in the table.
-    double GetStart() const { return m_table.begin()->first; }
+    double GetStart() const { return m_x.front(); }
 
     /// Return the biggest value of x in the table.
-    double GetEnd() const { return m_table.rbegin()->first; }
+    double GetEnd() const { return m_x.back(); }
 
     /// Return the maximum function value in the table.
     double GetMax() const;
@@ -83,6 +97,20 @@ class ChApi ChFunctionInterp : public ChFunction {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// Rebuild the flat arrays from the table of points.
+    void UpdateArrays();
+
+    /// Check whether the x values are uniformly spaced.
+    void UpdateUniform();
+
+    /// Return the index i of the interval [x_i, x_{i+1}) containing \a x.
+    /// Assumes at least two points and x_0 <= x < x_{n-1}.
+    size_t FindInterval(double x) const;
+
+    /// Return the slope at the first (\a last = false) or last (\a last = true) point, used for extrapolation.
+    double GetEndSlope(bool last) const;
 };
 
 /// @} chrono_functions
@@ -29,7 +29,7 @@ ChFunctionPoly::ChFunctionPoly(const ChFunctionPoly& other) {
 
 double ChFunctionPoly::GetVal(double x) const {
     double total = 0;
-    for (int i = 0; i <= m_coeffs.size(); i++) {
+    for (int i = 0; i < m_coeffs.size(); i++) {
         total += (m_coeffs[i] * pow(x, (double)i));
     }
     return total;
@@ -37,7 +37,7 @@ double ChFunctionPoly::GetVal(double x) const {
 
 double ChFunctionPoly::GetDer(double x) const {
     double total = 0;
-    for (int i = 1; i <= m_coeffs.size(); i++) {
+    for (int i = 1; i < m_coeffs.size(); i++) {
         total += ((double)i * m_coeffs[i] * pow(x, ((double)(i - 1))));
     }
     return total;
@@ -45,12 +45,32 @@ double ChFunctionPoly::GetDer(double x) const {
 
 double ChFunctionPoly::GetDer2(double x) const {
     double total = 0;
-    for (int i = 2; i <= m_coeffs.size(); i++) {
+    for (int i = 2; i < m_coeffs.size(); i++) {
         total += ((double)(i * (i - 1)) * m_coeffs[i] * pow(x, ((double)(i - 2))));
     }
     return total;
 }
 
+// Batch evaluations use the Horner scheme on all input values at once
+
+void ChFunctionPoly::GetValBatch(ChVectorConstRef x, ChVectorRef y) const {
+    y.setZero();
+    for (size_t i = m_coeffs.size(); i-- > 0;)
+        y.array() = y.array() * x.array() + m_coeffs[i];
+}
+
+void ChFunctionPoly::GetDerBatch(ChVectorConstRef x, ChVectorRef y) const {
+    y.setZero();
+    for (size_t i = m_coeffs.size(); i-- > 1;)
+        y.array() = y.array() * x.array() + (double)i * m_coeffs[i];
+}
+
+void ChFunctionPoly::GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const {
+    y.setZero();
+    for (size_t i = m_coeffs.size(); i-- > 2;)
+        y.array() = y.array() * x.array() + (double)(i * (i - 1)) * m_coeffs[i];
+}
+
 void ChFunctionPoly::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChFunctionPoly>();
@@ -41,6 +41,10 @@ class ChApi ChFunctionPoly : public ChFunction {
     virtual double GetDer(double x) const override;
     virtual double GetDer2(double x) const override;
 
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const override;
+
     /// Set the polynomial coefficients.
     /// The order of the polynome is equal to the size of the provided vector of coefficients
     void SetCoefficients(const std::vector<double>& coeffs) {
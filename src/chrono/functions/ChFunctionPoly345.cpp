@@ -72,6 +72,24 @@ double ChFunctionPoly345::GetDer3(double x) const {
     return ret;
 }
 
+// Batch evaluations clamp the normalized argument to [0,1], where the polynomial takes the constant end values and its
+// derivatives vanish
+
+void ChFunctionPoly345::GetValBatch(ChVectorConstRef x, ChVectorRef y) const {
+    auto a = (x.array() / m_width).max(0.0).min(1.0);
+    y.array() = m_height * a.cube() * (10.0 + a * (-15.0 + 6.0 * a));
+}
+
+void ChFunctionPoly345::GetDerBatch(ChVectorConstRef x, ChVectorRef y) const {
+    auto a = (x.array() / m_width).max(0.0).min(1.0);
+    y.array() = (m_height / m_width) * a.square() * (30.0 + a * (-60.0 + 30.0 * a));
+}
+
+void ChFunctionPoly345::GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const {
+    auto a = (x.array() / m_width).max(0.0).min(1.0);
+    y.array() = (m_height / (m_width * m_width)) * a * (60.0 + a * (-180.0 + 120.0 * a));
+}
+
 void ChFunctionPoly345::SetWidth(double width) {
     if (width <= 0)
         throw std::invalid_argument("Invalid width. Must be positive.");
@@ -50,6 +50,10 @@ class ChApi ChFunctionPoly345 : public ChFunction {
     virtual double GetDer2(double x) const override;
     virtual double GetDer3(double x) const override;
 
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const override;
+
     void SetWidth(double width);
 
     double GetWidth() const { return m_width; }
@@ -44,6 +44,12 @@ class ChApi ChFunctionRamp : public ChFunction {
     virtual double GetDer(double x) const override { return (m_ang_coeff); }
     virtual double GetDer2(double x) const override { return 0; }
 
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const override {
+        y.array() = m_y0 + m_ang_coeff * x.array();
+    }
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const override { y.setConstant(m_ang_coeff); }
+    virtual void GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const override { y.setZero(); }
+
     /// Set the initial value.
     void SetStartVal(double y0) { m_y0 = y0; }
 
@@ -37,6 +37,18 @@ double ChFunctionSine::GetDer2(double x) const {
     return m_ampl * -m_angular_rate * m_angular_rate * (sin(m_phase + m_angular_rate * x));
 }
 
+void ChFunctionSine::GetValBatch(ChVectorConstRef x, ChVectorRef y) const {
+    y.array() = m_ampl * (m_phase + m_angular_rate * x.array()).sin();
+}
+
+void ChFunctionSine::GetDerBatch(ChVectorConstRef x, ChVectorRef y) const {
+    y.array() = m_ampl * m_angular_rate * (m_phase + m_angular_rate * x.array()).cos();
+}
+
+void ChFunctionSine::GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const {
+    y.array() = m_ampl * -m_angular_rate * m_angular_rate * (m_phase + m_angular_rate * x.array()).sin();
+}
+
 void ChFunctionSine::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChFunctionSine>();
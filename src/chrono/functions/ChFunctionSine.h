@@ -47,6 +47,10 @@ class ChApi ChFunctionSine : public ChFunction {
     virtual double GetDer(double x) const override;
     virtual double GetDer2(double x) const override;
 
+    virtual void GetValBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDerBatch(ChVectorConstRef x, ChVectorRef y) const override;
+    virtual void GetDer2Batch(ChVectorConstRef x, ChVectorRef y) const override;
+
     void SetPhase(double phase) { m_phase = phase; };
 
     void SetFrequency(double freq) { m_angular_rate = 2.0 * CH_PI * freq; }
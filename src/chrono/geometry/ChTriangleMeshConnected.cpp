@@ -20,11 +20,17 @@
 //     This could be implemented such that the two new faces point to the same material.
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <map>
+#include <tuple>
 
 #include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
 #include "chrono_thirdparty/tinyobjloader/tiny_obj_loader.h"
@@ -254,6 +260,359 @@ void ChTriangleMeshConnected::ComputeMassProperties(bool bodyCoords,
     }
 }
 
+// -----------------------------------------------------------------------------
+// Parallel Wavefront OBJ parser and binary mesh cache
+// -----------------------------------------------------------------------------
+
+// Read the entire content of a file, followed by a terminating null character.
+static bool ReadFileContent(const std::string& filename, std::vector<char>& buffer) {
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile.is_open())
+        return false;
+    std::streamsize size = ifile.tellg();
+    ifile.seekg(0, std::ios::beg);
+    buffer.resize((size_t)size + 1);
+    if (size > 0 && !ifile.read(buffer.data(), size))
+        return false;
+    buffer[(size_t)size] = '\0';
+    return true;
+}
+
+// 64-bit FNV-1a hash of the file content (processed in 8-byte words).
+static uint64_t HashFileContent(const std::vector<char>& buffer) {
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    size_t size = buffer.size() - 1;
+    size_t nwords = size / 8;
+    for (size_t i = 0; i < nwords; i++) {
+        uint64_t word;
+        std::memcpy(&word, buffer.data() + 8 * i, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (size_t i = 8 * nwords; i < size; i++)
+        hash = (hash ^ (unsigned char)buffer[i]) * prime;
+    return hash;
+}
+
+// Data parsed from a contiguous range of lines of an OBJ file.
+// Face indices are 0-based, -1 if not specified. Relative (negative) indices are resolved within the chunk, and the
+// positions of these indices in the face lists are recorded so that they can be shifted by the chunk offsets.
+struct ObjChunk {
+    std::vector<float> v;   // vertex positions (3 per vertex)
+    std::vector<float> vn;  // normals (3 per normal)
+    std::vector<float> vt;  // texture coordinates (2 per vertex)
+    std::vector<int> fv;    // vertex indices (3 per face)
+    std::vector<int> fn;    // normal indices (3 per face)
+    std::vector<int> fvt;   // texture coordinate indices (3 per face)
+    std::vector<size_t> rel_v;
+    std::vector<size_t> rel_vn;
+    std::vector<size_t> rel_vt;
+    bool ok = true;  // false if the chunk contains data not handled by this parser
+};
+
+static inline bool IsBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+static inline void SkipBlanks(const char*& p, const char* eol) {
+    while (p < eol && IsBlank(*p))
+        p++;
+}
+
+// Parse a sequence of n real values. Values are stored in single precision, as done by tinyobjloader.
+static bool ParseObjReals(const char* p, const char* eol, int n, std::vector<float>& out) {
+    for (int i = 0; i < n; i++) {
+        SkipBlanks(p, eol);
+        char* q;
+        double val = std::strtod(p, &q);
+        // the value must be followed by a blank (this also rejects values not parsed because of the locale)
+        if (q == p || q > eol || (q < eol && !IsBlank(*q) && *q != '\r'))
+            return false;
+        out.push_back((float)val);
+        p = q;
+    }
+    return true;
+}
+
+// Parse an integer index (without leading blanks).
+static bool ParseObjIndex(const char*& p, const char* eol, int& idx) {
+    bool neg = false;
+    if (p < eol && *p == '-') {
+        neg = true;
+        p++;
+    }
+    if (p >= eol || *p < '0' || *p > '9')
+        return false;
+    long long val = 0;
+    while (p < eol && *p >= '0' && *p <= '9')
+        val = 10 * val + (*p++ - '0');
+    if (val == 0 || val > std::numeric_limits<int>::max())
+        return false;
+    idx = neg ? -(int)val : (int)val;
+    return true;
+}
+
+// Convert a (1-based or relative) OBJ index to a 0-based index.
+static inline int ResolveObjIndex(int idx, size_t count, std::vector<int>& list, std::vector<size_t>& rel) {
+    if (idx > 0)
+        return idx - 1;
+    rel.push_back(list.size());
+    return (int)count + idx;
+}
+
+// Parse a triangular face "f v[/vt][/vn] v[/vt][/vn] v[/vt][/vn]".
+static bool ParseObjFace(const char* p, const char* eol, ObjChunk& chunk) {
+    for (int k = 0; k < 3; k++) {
+        SkipBlanks(p, eol);
+        int iv = 0, ivt = 0, ivn = 0;
+        if (!ParseObjIndex(p, eol, iv))
+            return false;
+        if (p < eol && *p == '/') {
+            p++;
+            if (p < eol && *p != '/' && !ParseObjIndex(p, eol, ivt))
+                return false;
+            if (p < eol && *p == '/') {
+                p++;
+                if (!ParseObjIndex(p, eol, ivn))
+                    return false;
+            }
+        }
+        if (p < eol && !IsBlank(*p) && *p != '\r')
+            return false;
+
+        chunk.fv.push_back(ResolveObjIndex(iv, chunk.v.size() / 3, chunk.fv, chunk.rel_v));
+        chunk.fvt.push_back(ivt == 0 ? -1 : ResolveObjIndex(ivt, chunk.vt.size() / 2, chunk.fvt, chunk.rel_vt));
+        chunk.fn.push_back(ivn == 0 ? -1 : ResolveObjIndex(ivn, chunk.vn.size() / 3, chunk.fn, chunk.rel_vn));
+    }
+
+    // Only triangular faces are handled
+    SkipBlanks(p, eol);
+    return p == eol || *p == '\r' || *p == '#';
+}
+
+static void ParseObjChunk(const char* begin, const char* end, ObjChunk& chunk) {
+    const char* p = begin;
+    while (p < end && chunk.ok) {
+        const char* eol = (const char*)std::memchr(p, '\n', end - p);
+        if (!eol)
+            eol = end;
+        SkipBlanks(p, eol);
+        if (eol - p > 2 && p[0] == 'v' && IsBlank(p[1])) {
+            chunk.ok = ParseObjReals(p + 2, eol, 3, chunk.v);
+        } else if (eol - p > 3 && p[0] == 'v' && p[1] == 'n' && IsBlank(p[2])) {
+            chunk.ok = ParseObjReals(p + 3, eol, 3, chunk.vn);
+        } else if (eol - p > 3 && p[0] == 'v' && p[1] == 't' && IsBlank(p[2])) {
+            chunk.ok = ParseObjReals(p + 3, eol, 2, chunk.vt);
+        } else if (eol - p > 2 && p[0] == 'f' && IsBlank(p[1])) {
+            chunk.ok = ParseObjFace(p + 2, eol, chunk);
+        } else if (p < eol && *p == '\\') {
+            // line continuation, not handled
+            chunk.ok = false;
+        }
+        p = eol + 1;
+    }
+}
+
+// Parse the content of an OBJ file with triangular faces, split in chunks of lines processed concurrently.
+// Return false if the file contains data not handled by this parser.
+static bool ParseWavefront(const std::vector<char>& buffer,
+                           bool load_normals,
+                           bool load_uv,
+                           ChTriangleMeshConnected& mesh) {
+    const char* data = buffer.data();
+    size_t size = buffer.size() - 1;
+
+    // Split the file in chunks at line boundaries (about 1 MB per chunk)
+    size_t num_chunks = std::max<size_t>(1, std::min<size_t>(size >> 20, 16 * (size_t)ChOMP::GetMaxThreads()));
+    std::vector<size_t> bounds(num_chunks + 1, size);
+    bounds[0] = 0;
+    for (size_t c = 1; c < num_chunks; c++) {
+        size_t pos = std::max(bounds[c - 1], c * (size / num_chunks));
+        const char* eol = (const char*)std::memchr(data + pos, '\n', size - pos);
+        bounds[c] = eol ? (size_t)(eol - data) + 1 : size;
+    }
+
+    std::vector<ObjChunk> chunks(num_chunks);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int c = 0; c < (int)num_chunks; c++)
+        ParseObjChunk(data + bounds[c], data + bounds[c + 1], chunks[c]);
+
+    // Offsets of the chunk data in the mesh arrays
+    std::vector<size_t> off_v(num_chunks + 1, 0);
+    std::vector<size_t> off_vn(num_chunks + 1, 0);
+    std::vector<size_t> off_vt(num_chunks + 1, 0);
+    std::vector<size_t> off_f(num_chunks + 1, 0);
+    for (size_t c = 0; c < num_chunks; c++) {
+        if (!chunks[c].ok)
+            return false;
+        off_v[c + 1] = off_v[c] + chunks[c].v.size() / 3;
+        off_vn[c + 1] = off_vn[c] + chunks[c].vn.size() / 3;
+        off_vt[c + 1] = off_vt[c] + chunks[c].vt.size() / 2;
+        off_f[c + 1] = off_f[c] + chunks[c].fv.size() / 3;
+    }
+
+    mesh.Clear();
+
+    load_normals = load_normals && off_vn[num_chunks] > 0;
+    load_uv = load_uv && off_vt[num_chunks] > 0;
+    mesh.m_vertices.resize(off_v[num_chunks]);
+    mesh.m_normals.resize(load_normals ? off_vn[num_chunks] : 0);
+    mesh.m_UV.resize(load_uv ? off_vt[num_chunks] : 0);
+    mesh.m_face_v_indices.resize(off_f[num_chunks]);
+    mesh.m_face_n_indices.resize(load_normals ? off_f[num_chunks] : 0);
+    mesh.m_face_uv_indices.resize(load_uv ? off_f[num_chunks] : 0);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int c = 0; c < (int)num_chunks; c++) {
+        ObjChunk& chunk = chunks[c];
+        for (size_t idx : chunk.rel_v)
+            chunk.fv[idx] += (int)off_v[c];
+        for (size_t idx : chunk.rel_vn)
+            chunk.fn[idx] += (int)off_vn[c];
+        for (size_t idx : chunk.rel_vt)
+            chunk.fvt[idx] += (int)off_vt[c];
+
+        for (size_t i = 0; i < chunk.v.size() / 3; i++)
+            mesh.m_vertices[off_v[c] + i] = ChVector3d(chunk.v[3 * i + 0], chunk.v[3 * i + 1], chunk.v[3 * i + 2]);
+        for (size_t i = 0; load_normals && i < chunk.vn.size() / 3; i++)
+            mesh.m_normals[off_vn[c] + i] = ChVector3d(chunk.vn[3 * i + 0], chunk.vn[3 * i + 1], chunk.vn[3 * i + 2]);
+        for (size_t i = 0; load_uv && i < chunk.vt.size() / 2; i++)
+            mesh.m_UV[off_vt[c] + i] = ChVector2d(chunk.vt[2 * i + 0], chunk.vt[2 * i + 1]);
+
+        for (size_t i = 0; i < chunk.fv.size() / 3; i++) {
+            size_t j = off_f[c] + i;
+            mesh.m_face_v_indices[j] = ChVector3i(chunk.fv[3 * i + 0], chunk.fv[3 * i + 1], chunk.fv[3 * i + 2]);
+            if (load_normals)
+                mesh.m_face_n_indices[j] = ChVector3i(chunk.fn[3 * i + 0], chunk.fn[3 * i + 1], chunk.fn[3 * i + 2]);
+            if (load_uv)
+                mesh.m_face_uv_indices[j] =
+                    ChVector3i(chunk.fvt[3 * i + 0], chunk.fvt[3 * i + 1], chunk.fvt[3 * i + 2]);
+        }
+    }
+
+    return true;
+}
+
+// Header of a binary mesh cache file.
+// The header is followed by the arrays of vertices, normals, UV coordinates, vertex/normal/UV face indices, and
+// neighboring triangle map, in this order and with the sizes listed in the header.
+struct MeshCacheHeader {
+    char magic[8];           // "CHMESHC"
+    uint32_t version;        // cache format version
+    uint32_t options;        // load options (bit 0: normals, bit 1: UV)
+    uint64_t source_size;    // size of the source file (0 if none)
+    uint64_t source_hash;    // hash of the source file content (0 if none)
+    uint64_t num_items[7];   // number of items in each array
+};
+
+static const char mesh_cache_magic[8] = "CHMESHC";
+static const uint32_t mesh_cache_version = 1;
+
+static_assert(sizeof(ChVector3d) == 3 * sizeof(double), "Unexpected ChVector3d layout");
+static_assert(sizeof(ChVector2d) == 2 * sizeof(double), "Unexpected ChVector2d layout");
+static_assert(sizeof(ChVector3i) == 3 * sizeof(int), "Unexpected ChVector3i layout");
+
+template <typename T>
+static void WriteCacheArray(std::ofstream& ofile, const std::vector<T>& v) {
+    if (!v.empty())
+        ofile.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+}
+
+template <typename T>
+static bool ReadCacheArray(std::ifstream& ifile, std::vector<T>& v, uint64_t n) {
+    v.resize((size_t)n);
+    return n == 0 || ifile.read(reinterpret_cast<char*>(v.data()), v.size() * sizeof(T));
+}
+
+static bool WriteMeshCache(const std::string& filename,
+                           const MeshCacheHeader& key,
+                           const ChTriangleMeshConnected& mesh,
+                           const std::vector<std::array<int, 4>>& tri_map) {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile.is_open())
+        return false;
+
+    MeshCacheHeader header = key;
+    std::memcpy(header.magic, mesh_cache_magic, sizeof(header.magic));
+    header.version = mesh_cache_version;
+    header.num_items[0] = mesh.m_vertices.size();
+    header.num_items[1] = mesh.m_normals.size();
+    header.num_items[2] = mesh.m_UV.size();
+    header.num_items[3] = mesh.m_face_v_indices.size();
+    header.num_items[4] = mesh.m_face_n_indices.size();
+    header.num_items[5] = mesh.m_face_uv_indices.size();
+    header.num_items[6] = tri_map.size();
+
+    ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    WriteCacheArray(ofile, mesh.m_vertices);
+    WriteCacheArray(ofile, mesh.m_normals);
+    WriteCacheArray(ofile, mesh.m_UV);
+    WriteCacheArray(ofile, mesh.m_face_v_indices);
+    WriteCacheArray(ofile, mesh.m_face_n_indices);
+    WriteCacheArray(ofile, mesh.m_face_uv_indices);
+    WriteCacheArray(ofile, tri_map);
+
+    return ofile.good();
+}
+
+// Read a mesh cache file. If a key is provided, the cache is only read if it matches the key source and options.
+static bool ReadMeshCache(const std::string& filename,
+                          const MeshCacheHeader* key,
+                          ChTriangleMeshConnected& mesh,
+                          std::vector<std::array<int, 4>>* tri_map) {
+    std::ifstream ifile(filename, std::ios::binary | std::ios::ate);
+    if (!ifile.is_open())
+        return false;
+    uint64_t file_size = (uint64_t)ifile.tellg();
+    ifile.seekg(0, std::ios::beg);
+
+    MeshCacheHeader header;
+    if (file_size < sizeof(header) || !ifile.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+    if (std::memcmp(header.magic, mesh_cache_magic, sizeof(header.magic)) != 0 || header.version != mesh_cache_version)
+        return false;
+    if (key && (header.options != key->options || header.source_size != key->source_size ||
+                header.source_hash != key->source_hash))
+        return false;
+
+    // Check that the file size is consistent with the array sizes (truncated or corrupted cache)
+    const uint64_t item_size[7] = {sizeof(ChVector3d), sizeof(ChVector3d), sizeof(ChVector2d), sizeof(ChVector3i),
+                                   sizeof(ChVector3i), sizeof(ChVector3i), sizeof(std::array<int, 4>)};
+    uint64_t expected_size = sizeof(header);
+    for (int i = 0; i < 7; i++) {
+        if (header.num_items[i] > file_size / item_size[i])
+            return false;
+        expected_size += header.num_items[i] * item_size[i];
+    }
+    if (expected_size != file_size)
+        return false;
+
+    mesh.Clear();
+    std::vector<std::array<int, 4>> cached_map;
+    bool ok = ReadCacheArray(ifile, mesh.m_vertices, header.num_items[0]) &&
+              ReadCacheArray(ifile, mesh.m_normals, header.num_items[1]) &&
+              ReadCacheArray(ifile, mesh.m_UV, header.num_items[2]) &&
+              ReadCacheArray(ifile, mesh.m_face_v_indices, header.num_items[3]) &&
+              ReadCacheArray(ifile, mesh.m_face_n_indices, header.num_items[4]) &&
+              ReadCacheArray(ifile, mesh.m_face_uv_indices, header.num_items[5]) &&
+              ReadCacheArray(ifile, cached_map, tri_map ? header.num_items[6] : 0);
+    if (!ok) {
+        mesh.Clear();
+        return false;
+    }
+
+    if (tri_map) {
+        if (cached_map.size() == mesh.m_face_v_indices.size())
+            *tri_map = std::move(cached_map);
+        else
+            mesh.ComputeNeighbouringTriangleMap(*tri_map);
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
 std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromWavefrontFile(const std::string& filename,
                                                                                           bool load_normals,
                                                                                           bool load_uv) {
@@ -266,6 +625,15 @@ std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromWave
 bool ChTriangleMeshConnected::LoadWavefrontMesh(const std::string& filename, bool load_normals, bool load_uv) {
     assert(filesystem::path(filename).is_file());
 
+    // Parse the file in parallel if possible, otherwise use tinyobjloader
+    std::vector<char> buffer;
+    if (ReadFileContent(filename, buffer) && ParseWavefront(buffer, load_normals, load_uv, *this)) {
+        m_filename = filename;
+        return true;
+    }
+    buffer.clear();
+    buffer.shrink_to_fit();
+
     std::vector<tinyobj::shape_t> shapes;
     tinyobj::attrib_t att;
     std::vector<tinyobj::material_t> materials;
@@ -319,6 +687,61 @@ bool ChTriangleMeshConnected::LoadWavefrontMesh(const std::string& filename, boo
     return true;
 }
 
+bool ChTriangleMeshConnected::LoadWavefrontMeshCached(const std::string& filename,
+                                                      const std::string& cache_filename,
+                                                      bool load_normals,
+                                                      bool load_uv,
+                                                      std::vector<std::array<int, 4>>* tri_map) {
+    std::vector<char> buffer;
+    if (!ReadFileContent(filename, buffer)) {
+        std::cerr << "Error loading OBJ file " << filename << std::endl;
+        return false;
+    }
+
+    MeshCacheHeader key = {};
+    key.options = (load_normals ? 1 : 0) | (load_uv ? 2 : 0);
+    key.source_size = buffer.size() - 1;
+    key.source_hash = HashFileContent(buffer);
+
+    if (ReadMeshCache(cache_filename, &key, *this, tri_map)) {
+        m_filename = filename;
+        return true;
+    }
+
+    // Cache miss: load the OBJ file and (re)write the cache
+    bool success = ParseWavefront(buffer, load_normals, load_uv, *this);
+    buffer.clear();
+    buffer.shrink_to_fit();
+    if (success)
+        m_filename = filename;
+    else if (!LoadWavefrontMesh(filename, load_normals, load_uv))
+        return false;
+
+    std::vector<std::array<int, 4>> map;
+    ComputeNeighbouringTriangleMap(map);
+    if (!WriteMeshCache(cache_filename, key, *this, map))
+        std::cerr << "Warning: cannot write mesh cache file " << cache_filename << std::endl;
+    if (tri_map)
+        *tri_map = std::move(map);
+
+    return true;
+}
+
+bool ChTriangleMeshConnected::WriteBinaryCache(const std::string& filename, bool store_tri_map) const {
+    MeshCacheHeader key = {};
+    std::vector<std::array<int, 4>> map;
+    if (store_tri_map)
+        ComputeNeighbouringTriangleMap(map);
+    return WriteMeshCache(filename, key, *this, map);
+}
+
+bool ChTriangleMeshConnected::LoadBinaryCache(const std::string& filename, std::vector<std::array<int, 4>>* tri_map) {
+    if (!ReadMeshCache(filename, nullptr, *this, tri_map))
+        return false;
+    m_filename.clear();
+    return true;
+}
+
 std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromSTLFile(const std::string& filename,
                                                                                     bool load_normals) {
     auto trimesh = chrono_types::make_shared<ChTriangleMeshConnected>();
@@ -522,69 +945,57 @@ void ChTriangleMeshConnected::Transform(const ChVector3d displ, const ChMatrix33
 bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
     bool pathological_edges = false;
 
-    std::multimap<std::pair<int, int>, int> edge_map;
-
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        edge_map.insert({medgeA, it});
-        edge_map.insert({medgeB, it});
-        edge_map.insert({medgeC, it});
+    // List of edges = pairs of vertexes indexes, with the triangle and the edge number in the triangle.
+    // Vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
+    struct TriangleEdge {
+        int a;
+        int b;
+        int it;
+        int ie;
+    };
+    int num_tris = (int)m_face_v_indices.size();
+    std::vector<TriangleEdge> edges(3 * (size_t)num_tris);
+
+#pragma omp parallel for
+    for (int it = 0; it < num_tris; ++it) {
+        const ChVector3i& face = m_face_v_indices[it];
+        for (int ie = 0; ie < 3; ++ie) {
+            int va = face[ie];
+            int vb = face[(ie + 1) % 3];
+            edges[3 * (size_t)it + ie] = {std::min(va, vb), std::max(va, vb), it, ie};
+        }
     }
 
+    // Sort the edges, so that the triangles sharing an edge are contiguous and in increasing order
+    std::sort(edges.begin(), edges.end(), [](const TriangleEdge& e1, const TriangleEdge& e2) {
+        return std::tie(e1.a, e1.b, e1.it, e1.ie) < std::tie(e2.a, e2.b, e2.it, e2.ie);
+    });
+
     // Create a map of neighboring triangles, vector of:
     // [Ti TieA TieB TieC]
-    tri_map.resize(this->m_face_v_indices.size());
-    for (int it = 0; it < this->m_face_v_indices.size(); ++it) {
-        tri_map[it][0] = it;
-        tri_map[it][1] = -1;  // default no neighbour
-        tri_map[it][2] = -1;  // default no neighbour
-        tri_map[it][3] = -1;  // default no neighbour
-        // edges = pairs of vertexes indexes
-        std::pair<int, int> medgeA(this->m_face_v_indices[it].x(), this->m_face_v_indices[it].y());
-        std::pair<int, int> medgeB(this->m_face_v_indices[it].y(), this->m_face_v_indices[it].z());
-        std::pair<int, int> medgeC(this->m_face_v_indices[it].z(), this->m_face_v_indices[it].x());
-        // vertex indexes in edges: always in increasing order to avoid ambiguous duplicated edges
-        if (medgeA.first > medgeA.second)
-            medgeA = std::pair<int, int>(medgeA.second, medgeA.first);
-        if (medgeB.first > medgeB.second)
-            medgeB = std::pair<int, int>(medgeB.second, medgeB.first);
-        if (medgeC.first > medgeC.second)
-            medgeC = std::pair<int, int>(medgeC.second, medgeC.first);
-        if (edge_map.count(medgeA) > 2 || edge_map.count(medgeB) > 2 || edge_map.count(medgeC) > 2) {
+    tri_map.resize(num_tris);
+    for (int it = 0; it < num_tris; ++it)
+        tri_map[it] = {it, -1, -1, -1};  // default no neighbour
+
+    // For each edge, the neighbour is the first other triangle sharing it
+    size_t i = 0;
+    while (i < edges.size()) {
+        size_t j = i + 1;
+        while (j < edges.size() && edges[j].a == edges[i].a && edges[j].b == edges[i].b)
+            ++j;
+        if (j - i > 2) {
             pathological_edges = true;
             // std::cerr << "Warning, edge shared with more than two triangles!" << std::endl;
         }
-        auto retA = edge_map.equal_range(medgeA);
-        for (auto fedge = retA.first; fedge != retA.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][1] = fedge->second;
-                break;
-            }
-        }
-        auto retB = edge_map.equal_range(medgeB);
-        for (auto fedge = retB.first; fedge != retB.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][2] = fedge->second;
-                break;
-            }
-        }
-        auto retC = edge_map.equal_range(medgeC);
-        for (auto fedge = retC.first; fedge != retC.second; ++fedge) {
-            if (fedge->second != it) {
-                tri_map[it][3] = fedge->second;
-                break;
+        for (size_t k = i; k < j; ++k) {
+            for (size_t l = i; l < j; ++l) {
+                if (edges[l].it != edges[k].it) {
+                    tri_map[edges[k].it][1 + edges[k].ie] = edges[l].it;
+                    break;
+                }
             }
         }
+        i = j;
     }
 
     // Return true on success, false if pathological edges exist
@@ -18,6 +18,8 @@
 #include <array>
 #include <cmath>
 #include <map>
+#include <string>
+#include <vector>
 
 #include "chrono/assets/ChColor.h"
 #include "chrono/core/ChVector2.h"
@@ -84,8 +86,31 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
                                                                             bool load_uv = false);
 
     /// Load a Wavefront OBJ file into this triangle mesh.
+    /// Files with only triangular faces are parsed in parallel. Other files (e.g., with polygonal faces) are loaded
+    /// with tinyobjloader.
     bool LoadWavefrontMesh(const std::string& filename, bool load_normals = true, bool load_uv = false);
 
+    /// Load a Wavefront OBJ file into this triangle mesh, using a binary cache file.
+    /// If \a cache_filename was generated from an OBJ file with the same content and with the same options, the mesh
+    /// is read from the cache. Otherwise, the OBJ file is parsed and the cache file is (re)written. If \a tri_map is
+    /// provided, it is set to the map of neighboring triangles (see ComputeNeighbouringTriangleMap), also stored in the
+    /// cache.
+    bool LoadWavefrontMeshCached(const std::string& filename,
+                                 const std::string& cache_filename,
+                                 bool load_normals = true,
+                                 bool load_uv = false,
+                                 std::vector<std::array<int, 4>>* tri_map = nullptr);
+
+    /// Write this mesh to a binary cache file.
+    /// The cache stores vertices, normals, UV coordinates, face indices and, optionally, the map of neighboring
+    /// triangles. It uses the native byte order and is meant as a fast local cache, not as a portable file format.
+    bool WriteBinaryCache(const std::string& filename, bool store_tri_map = true) const;
+
+    /// Load this mesh from a binary cache file written with WriteBinaryCache.
+    /// If \a tri_map is provided, it is set to the map of neighboring triangles (read from the cache if stored there,
+    /// computed otherwise). Return false if the file does not exist or is not a valid cache file.
+    bool LoadBinaryCache(const std::string& filename, std::vector<std::array<int, 4>>* tri_map = nullptr);
+
     /// Create and return a ChTriangleMeshConnected from an STL file.
     /// If an error occurrs during loading, an empty shared pointer is returned.
     static std::shared_ptr<ChTriangleMeshConnected> CreateFromSTLFile(const std::string& filename,
@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <typeinfo>
+#include <unordered_map>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/physics/ChAssembly.h"
@@ -40,7 +42,8 @@ ChAssembly::ChAssembly()
       m_num_coords_vel(0),
       m_num_constr(0),
       m_num_constr_bil(0),
-      m_num_constr_uni(0) {}
+      m_num_constr_uni(0),
+      m_parallel_update(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_bodies_active = other.m_num_bodies_active;
@@ -57,6 +60,7 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     m_num_constr = other.m_num_constr;
     m_num_constr_bil = other.m_num_constr_bil;
     m_num_constr_uni = other.m_num_constr_uni;
+    m_parallel_update = other.m_parallel_update;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, shaftlist, linklist, meshlist,  otherphysicslist)
@@ -94,6 +98,10 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.m_num_constr, second.m_num_constr);
     swap(first.m_num_constr_bil, second.m_num_constr_bil);
     swap(first.m_num_constr_uni, second.m_num_constr_uni);
+    swap(first.m_parallel_update, second.m_parallel_update);
+    swap(first.m_link_color_key, second.m_link_color_key);
+    swap(first.m_link_order, second.m_link_order);
+    swap(first.m_link_color_start, second.m_link_color_start);
 
     //// RADU
     //// TODO: deal with all other member variables...
@@ -635,8 +643,163 @@ void ChAssembly::Setup() {
             m_num_constr_uni += item->GetNumConstraintsUnilateral();
         }
     }
+
+    SetupLinkColors();
+}
+
+// -----------------------------------------------------------------------------
+// Parallel processing of the assembly items
+// -----------------------------------------------------------------------------
+
+// Minimum number of items for processing a list in parallel
+static const int parallel_min_items = 64;
+
+// Call func(i) for all i in [begin, end), in parallel if there are enough items.
+// The serial case does not enter an OpenMP parallel region at all (the OpenMP runtime allocates a thread team even
+// for an inactive region).
+template <class Func>
+static void ParallelFor(int begin, int end, int nthreads, Func func) {
+    if (nthreads < 2 || end - begin < parallel_min_items) {
+        for (int i = begin; i < end; i++)
+            func(i);
+        return;
+    }
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = begin; i < end; i++)
+        func(i);
+}
+
+// Return the body, if its variables are active (i.e., if a link can load this body)
+static ChBodyFrame* ActiveBody(ChBodyFrame* body) {
+    return (body && body->Variables().IsActive()) ? body : nullptr;
+}
+
+// Return the trace recorder of the system, if recording events (nullptr otherwise)
+static utils::ChTrace* ActiveTrace(ChSystem* system) {
+    utils::ChTrace* trace = system ? system->GetTrace() : nullptr;
+    return (trace && trace->IsEnabled()) ? trace : nullptr;
+}
+
+// Return the trace recorder, if recording individual items (nullptr otherwise)
+static utils::ChTrace* ItemsTrace(utils::ChTrace* trace) {
+    return (trace && trace->IsItemsEnabled()) ? trace : nullptr;
 }
 
+// Call func() for the given item, recording an event named after the item type if recording individual items
+template <class Item, class Func>
+static void TraceItem(utils::ChTrace* items_trace, Item* item, Func func) {
+    utils::ChTraceScope scope(items_trace, items_trace ? typeid(*item).name() : nullptr,
+                              utils::ChTrace::ItemsCategory());
+    func();
+}
+
+int ChAssembly::GetNumThreadsUpdate() const {
+    return (m_parallel_update && system) ? (int)system->GetNumThreadsChrono() : 1;
+}
+
+void ChAssembly::SetupLinkColors() {
+    if (GetNumThreadsUpdate() == 1) {
+        m_link_color_key.clear();
+        m_link_order.clear();
+        m_link_color_start.clear();
+        return;
+    }
+
+    // Nothing to do if the links and their active bodies did not change since the last coloring
+    bool changed = m_link_color_key.size() != linklist.size();
+    for (size_t i = 0; i < linklist.size() && !changed; i++) {
+        const auto& key = m_link_color_key[i];
+        changed = key.link != linklist[i].get() ||
+                  (key.chlink && (key.body1 != ActiveBody(key.chlink->GetBody1()) ||
+                                  key.body2 != ActiveBody(key.chlink->GetBody2())));
+    }
+    if (!changed)
+        return;
+
+    // Greedy coloring: each link gets the first color not used by previous links acting on the same bodies.
+    // Only links without states of their own (which could be coupled to other items) and acting on at most two bodies
+    // are colored; all other links are processed serially.
+    size_t num_links = linklist.size();
+    m_link_color_key.resize(num_links);
+    std::vector<int> color(num_links, -1);
+    std::unordered_map<ChBodyFrame*, uint64_t> used_colors;
+    int num_colors = 0;
+    for (size_t i = 0; i < num_links; i++) {
+        auto& key = m_link_color_key[i];
+        key.link = linklist[i].get();
+        key.chlink = dynamic_cast<ChLink*>(key.link);
+        if (key.chlink && key.chlink->GetNumCoordsVelLevel() > 0)
+            key.chlink = nullptr;
+        key.body1 = key.chlink ? ActiveBody(key.chlink->GetBody1()) : nullptr;
+        key.body2 = key.chlink ? ActiveBody(key.chlink->GetBody2()) : nullptr;
+        if (!key.chlink)
+            continue;
+
+        uint64_t used = 0;
+        if (key.body1)
+            used |= used_colors[key.body1];
+        if (key.body2)
+            used |= used_colors[key.body2];
+        if (~used == 0)
+            continue;
+        int c = 0;
+        while (used & (uint64_t(1) << c))
+            c++;
+        if (key.body1)
+            used_colors[key.body1] |= uint64_t(1) << c;
+        if (key.body2)
+            used_colors[key.body2] |= uint64_t(1) << c;
+        color[i] = c;
+        num_colors = std::max(num_colors, c + 1);
+    }
+
+    // Sort the links by color (stable), with uncolored links last
+    m_link_color_start.assign(num_colors + 2, 0);
+    for (size_t i = 0; i < num_links; i++)
+        m_link_color_start[(color[i] < 0 ? num_colors : color[i]) + 1]++;
+    for (int c = 0; c <= num_colors; c++)
+        m_link_color_start[c + 1] += m_link_color_start[c];
+    m_link_order.resize(num_links);
+    std::vector<unsigned int> next(m_link_color_start.begin(), m_link_color_start.end() - 1);
+    for (size_t i = 0; i < num_links; i++)
+        m_link_order[next[color[i] < 0 ? num_colors : color[i]]++] = (unsigned int)i;
+    m_link_color_start.pop_back();
+}
+
+template <class Func>
+void ChAssembly::ForEachLinkColored(int nthreads, Func func) {
+    if (nthreads == 1 || m_link_order.size() != linklist.size()) {
+        for (auto& link : linklist)
+            func(link.get());
+        return;
+    }
+
+    int num_colors = (int)m_link_color_start.size() - 1;
+    for (int c = 0; c < num_colors; c++) {
+        ParallelFor(m_link_color_start[c], m_link_color_start[c + 1], nthreads,
+                    [&](int i) { func(linklist[m_link_order[i]].get()); });
+    }
+    for (size_t i = m_link_color_start.back(); i < m_link_order.size(); i++)
+        func(linklist[m_link_order[i]].get());
+}
+
+void ChAssembly::UpdateItemsVisual() {
+    auto update = [](ChPhysicsItem* item) {
+        item->UpdateVisualModel();
+        for (auto& camera : item->GetCameras())
+            camera->Update();
+    };
+    for (auto& body : bodylist)
+        update(body.get());
+    for (auto& shaft : shaftlist)
+        update(shaft.get());
+    for (auto& link : linklist)
+        update(link.get());
+}
+
+// -----------------------------------------------------------------------------
+
 // Update assembly's own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -648,24 +811,50 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
-        body->Update(ChTime, update_assets);
-    }
-    for (auto& shaft : shaftlist) {
-        shaft->Update(ChTime, update_assets);
-    }
-    for (auto& mesh : meshlist) {
-        mesh->Update(ChTime, update_assets);
+    // When processing items in parallel, visual models (which may share shapes) are updated in a final serial pass
+    int nthreads = GetNumThreadsUpdate();
+    bool update_item_assets = update_assets && nthreads == 1;
+    auto trace = ActiveTrace(system);
+    auto items_trace = ItemsTrace(trace);
+
+    {
+        utils::ChTraceScope scope(trace, "Update", "bodies");
+        ParallelFor(0, (int)bodylist.size(), nthreads, [&](int i) {
+            auto body = bodylist[i].get();
+            TraceItem(items_trace, body, [&]() { body->Update(ChTime, update_item_assets); });
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "Update", "shafts");
+        ParallelFor(0, (int)shaftlist.size(), nthreads, [&](int i) {
+            auto shaft = shaftlist[i].get();
+            TraceItem(items_trace, shaft, [&]() { shaft->Update(ChTime, update_item_assets); });
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "Update", "meshes");
+        for (auto& mesh : meshlist) {
+            TraceItem(items_trace, mesh.get(), [&]() { mesh->Update(ChTime, update_assets); });
+        }
     }
-    for (auto& otherphysics : otherphysicslist) {
-        otherphysics->Update(ChTime, update_assets);
+    {
+        utils::ChTraceScope scope(trace, "Update", "other");
+        for (auto& otherphysics : otherphysicslist) {
+            TraceItem(items_trace, otherphysics.get(), [&]() { otherphysics->Update(ChTime, update_assets); });
+        }
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
-    for (auto& link : linklist) {
-        link->Update(ChTime, update_assets);
+    {
+        utils::ChTraceScope scope(trace, "Update", "links");
+        ParallelFor(0, (int)linklist.size(), nthreads, [&](int i) {
+            auto link = linklist[i].get();
+            TraceItem(items_trace, link, [&]() { link->Update(ChTime, update_item_assets); });
+        });
     }
+
+    if (update_assets && !update_item_assets)
+        UpdateItemsVisual();
 }
 
 void ChAssembly::ForceToRest() {
@@ -729,43 +918,73 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // 2. Order below is *important*
     //    - in particular, bodies and meshes must be processed *before* links, so that links can use
     //      up-to-date body and node information
+    // 3. When processing items in parallel, visual models are updated in a final serial pass.
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
-        else
-            body->Update(T, full_update);
-    }
-    for (auto& shaft : shaftlist) {
-        if (shaft->IsActive())
-            shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
-                                   full_update);
-        else
-            shaft->Update(T, full_update);
-    }
-    for (auto& mesh : meshlist) {
-        mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T, full_update);
+    int nthreads = GetNumThreadsUpdate();
+    bool update_item_assets = full_update && nthreads == 1;
+    auto trace = ActiveTrace(system);
+
+    {
+        utils::ChTraceScope scope(trace, "Update", "bodies");
+        ParallelFor(0, (int)bodylist.size(), nthreads, [&](int i) {
+            auto& body = bodylist[i];
+            if (body->IsActive())
+                body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T,
+                                      update_item_assets);
+            else
+                body->Update(T, update_item_assets);
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "Update", "shafts");
+        ParallelFor(0, (int)shaftlist.size(), nthreads, [&](int i) {
+            auto& shaft = shaftlist[i];
+            if (shaft->IsActive())
+                shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
+                                       update_item_assets);
+            else
+                shaft->Update(T, update_item_assets);
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "Update", "meshes");
+        for (auto& mesh : meshlist) {
+            mesh->IntStateScatter(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T,
+                                  full_update);
+        }
     }
-    for (auto& item : otherphysicslist) {
-        if (item->IsActive())
-            item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T, full_update);
-        else
-            item->Update(T, full_update);
+    {
+        utils::ChTraceScope scope(trace, "Update", "other");
+        for (auto& item : otherphysicslist) {
+            if (item->IsActive())
+                item->IntStateScatter(displ_x + item->GetOffset_x(), x, displ_v + item->GetOffset_w(), v, T,
+                                      full_update);
+            else
+                item->Update(T, full_update);
+        }
     }
     // Because the Update() of ChLink() depends on the frames of Body1 and Body2, the state scatter of linklist
     // must be behind of bodylist,shaftlist,meshlist,otherphysicslist; otherwise, the Update() of ChLink() would
     // use the old (un-updated) status of bodylist,shaftlist,meshlist, resulting in a delay of Update() of ChLink()
     // for one time step, then the simulation might diverge!
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
-        else
-            link->Update(T, full_update);
+    {
+        utils::ChTraceScope scope(trace, "Update", "links");
+        ParallelFor(0, (int)linklist.size(), nthreads, [&](int i) {
+            auto& link = linklist[i];
+            if (link->IsActive())
+                link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T,
+                                      update_item_assets);
+            else
+                link->Update(T, update_item_assets);
+        });
     }
 
+    if (full_update && !update_item_assets)
+        UpdateItemsVisual();
+
     SetChTime(T);
 }
 
@@ -863,10 +1082,11 @@ void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVect
             item->IntStateScatterReactions(displ_L + item->GetOffset_L(), L);
     }
     // The state scatter of reactions of link depends on Body1 and Body2, thus it must be at the end.
-    for (auto& link : linklist) {
+    ParallelFor(0, (int)linklist.size(), GetNumThreadsUpdate(), [&](int i) {
+        auto& link = linklist[i];
         if (link->IsActive())
             link->IntStateScatterReactions(displ_L + link->GetOffset_L(), L);
-    }
+    });
 }
 
 void ChAssembly::IntStateIncrement(const unsigned int off_x,
@@ -940,25 +1160,50 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
-
-    for (auto& body : bodylist) {
-        if (body->IsActive())
-            body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
-    }
-    for (auto& shaft : shaftlist) {
-        if (shaft->IsActive())
-            shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
-    }
-    for (auto& link : linklist) {
-        if (link->IsActive())
-            link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c);
-    }
-    for (auto& mesh : meshlist) {
-        mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c);
+    int nthreads = GetNumThreadsUpdate();
+    auto trace = ActiveTrace(system);
+    auto items_trace = ItemsTrace(trace);
+
+    {
+        utils::ChTraceScope scope(trace, "LoadResidual_F", "bodies");
+        ParallelFor(0, (int)bodylist.size(), nthreads, [&](int i) {
+            auto body = bodylist[i].get();
+            if (body->IsActive())
+                TraceItem(items_trace, body,
+                          [&]() { body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c); });
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "LoadResidual_F", "shafts");
+        ParallelFor(0, (int)shaftlist.size(), nthreads, [&](int i) {
+            auto shaft = shaftlist[i].get();
+            if (shaft->IsActive())
+                TraceItem(items_trace, shaft,
+                          [&]() { shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c); });
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "LoadResidual_F", "links");
+        ForEachLinkColored(nthreads, [&](ChLinkBase* link) {
+            if (link->IsActive())
+                TraceItem(items_trace, link,
+                          [&]() { link->IntLoadResidual_F(displ_v + link->GetOffset_w(), R, c); });
+        });
+    }
+    {
+        utils::ChTraceScope scope(trace, "LoadResidual_F", "meshes");
+        for (auto& mesh : meshlist) {
+            TraceItem(items_trace, mesh.get(),
+                      [&]() { mesh->IntLoadResidual_F(displ_v + mesh->GetOffset_w(), R, c); });
+        }
     }
-    for (auto& item : otherphysicslist) {
-        if (item->IsActive())
-            item->IntLoadResidual_F(displ_v + item->GetOffset_w(), R, c);
+    {
+        utils::ChTraceScope scope(trace, "LoadResidual_F", "other");
+        for (auto& item : otherphysicslist) {
+            if (item->IsActive())
+                TraceItem(items_trace, item.get(),
+                          [&]() { item->IntLoadResidual_F(displ_v + item->GetOffset_w(), R, c); });
+        }
     }
 }
 
@@ -968,19 +1213,22 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     const double c               ///< a scaling factor
 ) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreadsUpdate();
 
-    for (auto& body : bodylist) {
+    ParallelFor(0, (int)bodylist.size(), nthreads, [&](int i) {
+        auto& body = bodylist[i];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
-    }
-    for (auto& shaft : shaftlist) {
+    });
+    ParallelFor(0, (int)shaftlist.size(), nthreads, [&](int i) {
+        auto& shaft = shaftlist[i];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
-    }
-    for (auto& link : linklist) {
+    });
+    ForEachLinkColored(nthreads, [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_Mv(displ_v + link->GetOffset_w(), R, w, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_Mv(displ_v + mesh->GetOffset_w(), R, w, c);
     }
@@ -1029,10 +1277,10 @@ void ChAssembly::IntLoadResidual_CqL(const unsigned int off_L,    ///< offset in
         if (shaft->IsActive())
             shaft->IntLoadResidual_CqL(displ_L + shaft->GetOffset_L(), R, L, c);
     }
-    for (auto& link : linklist) {
+    ForEachLinkColored(GetNumThreadsUpdate(), [&](ChLinkBase* link) {
         if (link->IsActive())
             link->IntLoadResidual_CqL(displ_L + link->GetOffset_L(), R, L, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadResidual_CqL(displ_L + mesh->GetOffset_L(), R, L, c);
     }
@@ -1058,10 +1306,12 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& link : linklist) {
+    // Links only load their own constraint residuals, so they can all be processed concurrently
+    ParallelFor(0, (int)linklist.size(), GetNumThreadsUpdate(), [&](int i) {
+        auto& link = linklist[i];
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadConstraint_C(displ_L + mesh->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1085,10 +1335,11 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
     }
-    for (auto& link : linklist) {
+    ParallelFor(0, (int)linklist.size(), GetNumThreadsUpdate(), [&](int i) {
+        auto& link = linklist[i];
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
-    }
+    });
     for (auto& mesh : meshlist) {
         mesh->IntLoadConstraint_Ct(displ_L + mesh->GetOffset_L(), Qc, c);
     }
@@ -1401,20 +1652,37 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::LoadConstraintJacobians() {
-    for (auto& body : bodylist) {
-        body->LoadConstraintJacobians();
+    auto trace = ActiveTrace(system);
+
+    {
+        utils::ChTraceScope scope(trace, "LoadConstraintJacobians", "bodies");
+        for (auto& body : bodylist) {
+            body->LoadConstraintJacobians();
+        }
     }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadConstraintJacobians();
+    {
+        utils::ChTraceScope scope(trace, "LoadConstraintJacobians", "shafts");
+        for (auto& shaft : shaftlist) {
+            shaft->LoadConstraintJacobians();
+        }
     }
-    for (auto& link : linklist) {
-        link->LoadConstraintJacobians();
+    {
+        utils::ChTraceScope scope(trace, "LoadConstraintJacobians", "links");
+        for (auto& link : linklist) {
+            link->LoadConstraintJacobians();
+        }
     }
-    for (auto& mesh : meshlist) {
-        mesh->LoadConstraintJacobians();
+    {
+        utils::ChTraceScope scope(trace, "LoadConstraintJacobians", "meshes");
+        for (auto& mesh : meshlist) {
+            mesh->LoadConstraintJacobians();
+        }
     }
-    for (auto& item : otherphysicslist) {
-        item->LoadConstraintJacobians();
+    {
+        utils::ChTraceScope scope(trace, "LoadConstraintJacobians", "other");
+        for (auto& item : otherphysicslist) {
+            item->LoadConstraintJacobians();
+        }
     }
 }
 
@@ -1455,20 +1723,38 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
-    for (auto& body : bodylist) {
-        body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    auto trace = ActiveTrace(system);
+    auto items_trace = ItemsTrace(trace);
+
+    {
+        utils::ChTraceScope scope(trace, "LoadKRMMatrices", "bodies");
+        for (auto& body : bodylist) {
+            TraceItem(items_trace, body.get(), [&]() { body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor); });
+        }
     }
-    for (auto& shaft : shaftlist) {
-        shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        utils::ChTraceScope scope(trace, "LoadKRMMatrices", "shafts");
+        for (auto& shaft : shaftlist) {
+            TraceItem(items_trace, shaft.get(), [&]() { shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor); });
+        }
     }
-    for (auto& link : linklist) {
-        link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        utils::ChTraceScope scope(trace, "LoadKRMMatrices", "links");
+        for (auto& link : linklist) {
+            TraceItem(items_trace, link.get(), [&]() { link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor); });
+        }
     }
-    for (auto& mesh : meshlist) {
-        mesh->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        utils::ChTraceScope scope(trace, "LoadKRMMatrices", "meshes");
+        for (auto& mesh : meshlist) {
+            TraceItem(items_trace, mesh.get(), [&]() { mesh->LoadKRMMatrices(Kfactor, Rfactor, Mfactor); });
+        }
     }
-    for (auto& item : otherphysicslist) {
-        item->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
+    {
+        utils::ChTraceScope scope(trace, "LoadKRMMatrices", "other");
+        for (auto& item : otherphysicslist) {
+            TraceItem(items_trace, item.get(), [&]() { item->LoadKRMMatrices(Kfactor, Rfactor, Mfactor); });
+        }
     }
 }
 
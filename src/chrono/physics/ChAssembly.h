@@ -223,6 +223,17 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Set zero speed (and zero accelerations) in state, without changing the position.
     virtual void ForceToRest() override;
 
+    /// Enable/disable the parallel processing of the assembly items (default: disabled).
+    /// If enabled and the system uses more than one Chrono thread (see ChSystem::SetNumThreads), the state scatter,
+    /// update, and residual/constraint load functions process bodies, shafts, and links concurrently. Links which add
+    /// loads to the same bodies are never processed concurrently, and the results do not depend on the number of
+    /// threads; they differ from the serial results only by the order of the load summations.
+    /// Only enable if all items (including callbacks of custom items, e.g. force functors) are thread safe.
+    void EnableParallelUpdate(bool val) { m_parallel_update = val; }
+
+    /// Return true if parallel processing of the assembly items is enabled.
+    bool IsParallelUpdateEnabled() const { return m_parallel_update; }
+
     // (override/implement interfaces for global state vectors, see ChPhysicsItem for comments.)
     virtual void IntStateGather(const unsigned int off_x,
                                 ChState& x,
@@ -323,6 +334,20 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Number of threads for processing the assembly items (1 if parallel processing is disabled).
+    int GetNumThreadsUpdate() const;
+
+    /// Partition the links in groups (colors) of links which do not share bodies.
+    /// Called at each Setup; the partition is recomputed only if the links or their bodies changed.
+    void SetupLinkColors();
+
+    /// Process the links, in parallel over each group of links which do not share bodies.
+    template <class Func>
+    void ForEachLinkColored(int nthreads, Func func);
+
+    /// Update the visual models and cameras of the bodies, shafts, and links.
+    void UpdateItemsVisual();
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -347,6 +372,19 @@ class ChApi ChAssembly : public ChPhysicsItem {
     unsigned int m_num_constr_bil;  ///< number of scalar bilateral constraints
     unsigned int m_num_constr_uni;  ///< number of scalar unilateral constraints
 
+    // Parallel processing:
+    struct LinkColorKey {
+        ChLinkBase* link;    ///< link at this position in the link list
+        ChLink* chlink;      ///< same link, if it only acts on its two bodies (null otherwise)
+        ChBodyFrame* body1;  ///< first connected active body (if any)
+        ChBodyFrame* body2;  ///< second connected active body (if any)
+    };
+
+    bool m_parallel_update;                        ///< enable parallel processing of the assembly items
+    std::vector<LinkColorKey> m_link_color_key;    ///< links and bodies used to compute the link colors
+    std::vector<unsigned int> m_link_order;        ///< link indices, sorted by color (uncolored links last)
+    std::vector<unsigned int> m_link_color_start;  ///< start of each color in m_link_order (plus uncolored links)
+
     friend class ChSystem;
     friend class ChSystemMulticore;
 };
@@ -135,6 +135,7 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     struct ForceTorque {
         ChVector3d force;
         ChVector3d torque;
+        bool in_contact;  ///< true if the contactable was in contact at the last accumulation
     };
 
     std::shared_ptr<AddContactCallback> add_contact_callback;
@@ -170,8 +171,9 @@ class ChApi ChContactContainer : public ChPhysicsItem {
             if (entry1 != contactforces.end()) {
                 entry1->second.force -= force;
                 entry1->second.torque += torque1;
+                entry1->second.in_contact = true;
             } else {
-                ForceTorque ft{-force, torque1};
+                ForceTorque ft{-force, torque1, true};
                 contactforces.insert(std::make_pair((*contact)->GetObjA(), ft));
             }
 
@@ -188,12 +190,31 @@ class ChApi ChContactContainer : public ChPhysicsItem {
             if (entry2 != contactforces.end()) {
                 entry2->second.force += force;
                 entry2->second.torque += torque2;
+                entry2->second.in_contact = true;
             } else {
-                ForceTorque ft{force, torque2};
+                ForceTorque ft{force, torque2, true};
                 contactforces.insert(std::make_pair((*contact)->GetObjB(), ft));
             }
         }
     }
+
+    /// Utility function to reset the accumulated contact forces before a call to SumAllContactForces.
+    /// Existing entries are zeroed (rather than removed), so that their storage is reused across steps.
+    static void ResetContactForces(std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
+        for (auto& entry : contactforces)
+            entry.second = {VNULL, VNULL, false};
+    }
+
+    /// Utility function to remove the entries of objects which were not in contact at the last accumulation.
+    /// This prevents the map from keeping objects no longer in contact (or no longer existing).
+    static void PurgeContactForces(std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
+        for (auto entry = contactforces.begin(); entry != contactforces.end();) {
+            if (entry->second.in_contact)
+                ++entry;
+            else
+                entry = contactforces.erase(entry);
+        }
+    }
 };
 
 CH_CLASS_VERSION(ChContactContainer, 0)
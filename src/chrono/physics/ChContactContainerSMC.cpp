@@ -55,7 +55,11 @@ void ChContactContainerSMC::Update(double mytime, bool update_assets) {
 }
 
 template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
+void _RemoveAllContacts(std::list<Tcont*>& contactlist,
+                        std::list<Tcont*>& contactpool,
+                        Titer& lastcontact,
+                        int& n_added) {
+    contactlist.splice(contactlist.end(), contactpool);
     typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         delete (*itercontact);
@@ -67,18 +71,26 @@ void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int&
     n_added = 0;
 }
 
+template <class Tcont, class Titer>
+void _ReleaseContacts(std::list<Tcont*>& contactlist, std::list<Tcont*>& contactpool, Titer& lastcontact) {
+    // move the contacts beyond the last contact to the pool (no deallocation)
+    contactpool.splice(contactpool.end(), contactlist, lastcontact, contactlist.end());
+    lastcontact = contactlist.end();
+}
+
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
+    _RemoveAllContacts(contactlist_3_3, contactpool_3_3, lastcontact_3_3, n_added_3_3);
+    _RemoveAllContacts(contactlist_6_3, contactpool_6_3, lastcontact_6_3, n_added_6_3);
+    _RemoveAllContacts(contactlist_6_6, contactpool_6_6, lastcontact_6_6, n_added_6_6);
+    _RemoveAllContacts(contactlist_333_3, contactpool_333_3, lastcontact_333_3, n_added_333_3);
+    _RemoveAllContacts(contactlist_333_6, contactpool_333_6, lastcontact_333_6, n_added_333_6);
+    _RemoveAllContacts(contactlist_333_333, contactpool_333_333, lastcontact_333_333, n_added_333_333);
+    _RemoveAllContacts(contactlist_666_3, contactpool_666_3, lastcontact_666_3, n_added_666_3);
+    _RemoveAllContacts(contactlist_666_6, contactpool_666_6, lastcontact_666_6, n_added_666_6);
+    _RemoveAllContacts(contactlist_666_333, contactpool_666_333, lastcontact_666_333, n_added_666_333);
+    _RemoveAllContacts(contactlist_666_666, contactpool_666_666, lastcontact_666_666, n_added_666_666);
     //**TODO*** cont. roll.
+    contact_forces.clear();
 }
 
 void ChContactContainerSMC::BeginAddContact() {
@@ -118,46 +130,16 @@ void ChContactContainerSMC::BeginAddContact() {
 
 void ChContactContainerSMC::EndAddContact() {
     // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
+    _ReleaseContacts(contactlist_3_3, contactpool_3_3, lastcontact_3_3);
+    _ReleaseContacts(contactlist_6_3, contactpool_6_3, lastcontact_6_3);
+    _ReleaseContacts(contactlist_6_6, contactpool_6_6, lastcontact_6_6);
+    _ReleaseContacts(contactlist_333_3, contactpool_333_3, lastcontact_333_3);
+    _ReleaseContacts(contactlist_333_6, contactpool_333_6, lastcontact_333_6);
+    _ReleaseContacts(contactlist_333_333, contactpool_333_333, lastcontact_333_333);
+    _ReleaseContacts(contactlist_666_3, contactpool_666_3, lastcontact_666_3);
+    _ReleaseContacts(contactlist_666_6, contactpool_666_6, lastcontact_666_6);
+    _ReleaseContacts(contactlist_666_333, contactpool_666_333, lastcontact_666_333);
+    _ReleaseContacts(contactlist_666_666, contactpool_666_666, lastcontact_666_666);
 
     // while (lastcontact_roll != contactlist_roll.end()) {
     //    delete (*lastcontact_roll);
@@ -167,6 +149,7 @@ void ChContactContainerSMC::EndAddContact() {
 
 template <class Tcont, class Titer, class Ta, class Tb>
 void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
+                           std::list<Tcont*>& contactpool,            // released contacts
                            Titer& lastcontact,                        // last contact acquired
                            int& n_added,                              // number of contacts inserted
                            ChContactContainerSMC* container,          // contact container
@@ -179,6 +162,11 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact
         // reuse old contacts
         (*lastcontact)->Reset(objA, objB, cinfo, cmat);
         lastcontact++;
+    } else if (!contactpool.empty()) {
+        // reuse a contact released in a previous pass
+        contactlist.splice(contactlist.end(), contactpool, contactpool.begin());
+        contactlist.back()->Reset(objA, objB, cinfo, cmat);
+        lastcontact = contactlist.end();
     } else {
         // add new contact
         Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
@@ -273,25 +261,26 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, contactpool_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB,
+                                      cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, contactpool_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA,
+                                      swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, contactpool_333_3, lastcontact_333_3, n_added_333_3, this,
+                                      objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, contactpool_666_3, lastcontact_666_3, n_added_666_3, this,
+                                      objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -300,23 +289,25 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, contactpool_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB,
+                                      cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, contactpool_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB,
+                                      cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, contactpool_333_6, lastcontact_333_6, n_added_333_6, this,
+                                      objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, contactpool_666_6, lastcontact_666_6, n_added_666_6, this,
+                                      objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -325,24 +316,24 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, contactpool_333_3, lastcontact_333_3, n_added_333_3, this,
+                                      objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, contactpool_333_6, lastcontact_333_6, n_added_333_6, this,
+                                      objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, contactpool_333_333, lastcontact_333_333, n_added_333_333,
+                                      this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, contactpool_666_333, lastcontact_666_333, n_added_666_333,
+                                      this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -351,23 +342,23 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, contactpool_666_3, lastcontact_666_3, n_added_666_3, this,
+                                      objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, contactpool_666_6, lastcontact_666_6, n_added_666_6, this,
+                                      objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, contactpool_666_333, lastcontact_666_333, n_added_666_333,
+                                      this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, contactpool_666_666, lastcontact_666_666, n_added_666_666,
+                                      this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -379,7 +370,8 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
 }
 
 void ChContactContainerSMC::ComputeContactForces() {
-    contact_forces.clear();
+    // reset the existing entries rather than clearing the map, to reuse its nodes across steps
+    ResetContactForces(contact_forces);
     SumAllContactForces(contactlist_3_3, contact_forces);
     SumAllContactForces(contactlist_6_3, contact_forces);
     SumAllContactForces(contactlist_6_6, contact_forces);
@@ -390,6 +382,7 @@ void ChContactContainerSMC::ComputeContactForces() {
     SumAllContactForces(contactlist_666_6, contact_forces);
     SumAllContactForces(contactlist_666_333, contact_forces);
     SumAllContactForces(contactlist_666_666, contact_forces);
+    PurgeContactForces(contact_forces);
 }
 
 ChVector3d ChContactContainerSMC::GetContactableForce(ChContactable* contactable) {
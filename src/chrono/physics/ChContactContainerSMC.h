@@ -52,6 +52,18 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     std::list<ChContactSMC_666_333*> contactlist_666_333;
     std::list<ChContactSMC_666_666*> contactlist_666_666;
 
+    // Contacts released by EndAddContact, kept for reuse in later collision detection passes
+    std::list<ChContactSMC_3_3*> contactpool_3_3;
+    std::list<ChContactSMC_6_3*> contactpool_6_3;
+    std::list<ChContactSMC_6_6*> contactpool_6_6;
+    std::list<ChContactSMC_333_3*> contactpool_333_3;
+    std::list<ChContactSMC_333_6*> contactpool_333_6;
+    std::list<ChContactSMC_333_333*> contactpool_333_333;
+    std::list<ChContactSMC_666_3*> contactpool_666_3;
+    std::list<ChContactSMC_666_6*> contactpool_666_6;
+    std::list<ChContactSMC_666_333*> contactpool_666_333;
+    std::list<ChContactSMC_666_666*> contactpool_666_666;
+
     int n_added_3_3;
     int n_added_6_3;
     int n_added_6_6;
@@ -124,9 +136,12 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void Update(double mtime, bool update_assets = true) override;
 
     /// Compute contact forces on all contactable objects in this container.
-    /// This function caches contact forces in a map.
+    /// This function caches contact forces in a map (only for the objects currently in contact).
     virtual void ComputeContactForces() override;
 
+    /// Return the number of contactable objects with cached contact forces.
+    size_t GetNumContactForces() const { return contact_forces.size(); }
+
     /// Return the resultant contact force acting on the specified contactable object.
     virtual ChVector3d GetContactableForce(ChContactable* contactable) override;
 
@@ -12,14 +12,26 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChExternalDynamics.h"
+#include "chrono/physics/ChSystem.h"
 
 namespace chrono {
 
 // Perturbation for finite-difference Jacobian approximation
 const double ChExternalDynamics::m_FD_delta = 1e-8;
 
-ChExternalDynamics::ChExternalDynamics() {}
+ChExternalDynamics::ChExternalDynamics()
+    : m_nstates(0),
+      m_variables(nullptr),
+      m_jac_coloring(false),
+      m_jac_parallel(false),
+      m_jac_max_age(0),
+      m_jac_max_change(1e-2),
+      m_jac_age(-1),
+      m_num_jac_evals(0),
+      m_num_jac_rhs_evals(0) {}
 ChExternalDynamics::~ChExternalDynamics() {
     delete m_variables;
 }
@@ -36,6 +48,11 @@ void ChExternalDynamics::Initialize() {
 
     if (IsStiff()) {
         m_jac.resize(m_nstates, m_nstates);
+        m_jac_age = -1;
+        m_jac_cols.resize(m_nstates);
+        for (int i = 0; i < m_nstates; i++)
+            m_jac_cols[i] = {i};
+        ResetJacPattern();
 
         std::vector<ChVariables*> vars;
         vars.push_back(m_variables);
@@ -55,37 +72,126 @@ ChVectorDynamic<> ChExternalDynamics::GetInitialStates() {
 
 // -----------------------------------------------------------------------------
 
+void ChExternalDynamics::SetJacReuse(int max_age, double max_change) {
+    m_jac_max_age = std::max(0, max_age);
+    m_jac_max_change = max_change;
+}
+
+void ChExternalDynamics::ResetJacPattern() {
+    m_jac_rows.clear();
+    m_jac_colors.clear();
+}
+
+bool ChExternalDynamics::IsJacStale() const {
+    if (m_jac_age < 0 || m_jac_age >= m_jac_max_age)
+        return true;
+    double scale = std::max(1.0, m_jac_states.lpNorm<Eigen::Infinity>());
+    return (m_states - m_jac_states).lpNorm<Eigen::Infinity>() > m_jac_max_change * scale;
+}
+
 void ChExternalDynamics::ComputeJac(double time) {
     m_jac.setZero();
+    m_jac_states = m_states;
+    m_jac_age = 0;
+    m_num_jac_evals++;
 
     // Invoke Jacobian function
     bool has_jac = CalculateJac(time, m_states, m_rhs, m_jac);
+    if (has_jac)
+        return;
 
     // If Jacobian not provided, estimate with finite differences
-    if (!has_jac) {
+    if (!m_jac_coloring) {
+        ComputeJacFD(time, m_jac_cols, false);
+        return;
+    }
+
+    // Colored finite differences; load or detect the sparsity pattern if needed
+    if (m_jac_colors.empty()) {
+        ChMatrixDynamic<bool> pattern = ChMatrixDynamic<bool>::Constant(m_nstates, m_nstates, false);
+        if (!CalculateJacPattern(pattern)) {
+            ComputeJacFD(time, m_jac_cols, false);
+            SetupJacColors(m_jac.array() != 0.0);
+            return;
+        }
+        SetupJacColors(pattern);
+    }
+    ComputeJacFD(time, m_jac_colors, true);
+}
+
+void ChExternalDynamics::ComputeJacFD(double time, const std::vector<std::vector<int>>& groups, bool use_pattern) {
+    int num_groups = (int)groups.size();
+    int nthreads = (m_jac_parallel && system) ? (int)system->GetNumThreadsChrono() : 1;
+
+    // Each group of columns writes to different entries of the Jacobian
+#pragma omp parallel num_threads(nthreads) if (nthreads > 1 && num_groups > 1)
+    {
+        ChVectorDynamic<> y = m_states;
         ChVectorDynamic<> rhs1(m_nstates);
-        ChVectorDynamic<> Jcolumn(m_nstates);
-        for (int i = 0; i < m_nstates; i++) {
-            m_states(i) += m_FD_delta;
-            CalculateRHS(time, m_states, rhs1);
-            Jcolumn = (rhs1 - m_rhs) * (1 / m_FD_delta);
-            m_jac.col(i) = Jcolumn;
-            m_states(i) -= m_FD_delta;
+
+#pragma omp for schedule(dynamic)
+        for (int g = 0; g < num_groups; g++) {
+            for (int i : groups[g])
+                y(i) += m_FD_delta;
+            CalculateRHS(time, y, rhs1);
+            for (int i : groups[g]) {
+                y(i) = m_states(i);
+                if (use_pattern) {
+                    for (int r : m_jac_rows[i])
+                        m_jac(r, i) = (rhs1(r) - m_rhs(r)) * (1 / m_FD_delta);
+                } else {
+                    m_jac.col(i) = (rhs1 - m_rhs) * (1 / m_FD_delta);
+                }
+            }
         }
     }
+
+    m_num_jac_rhs_evals += num_groups;
+}
+
+void ChExternalDynamics::SetupJacColors(const ChMatrixDynamic<bool>& pattern) {
+    // Non-zero rows of each column and non-zero columns of each row
+    std::vector<std::vector<int>> cols(m_nstates);
+    m_jac_rows.assign(m_nstates, {});
+    for (int r = 0; r < m_nstates; r++) {
+        for (int c = 0; c < m_nstates; c++) {
+            if (pattern(r, c)) {
+                m_jac_rows[c].push_back(r);
+                cols[r].push_back(c);
+            }
+        }
+    }
+
+    // Greedy coloring: assign each column the first group without columns with non-zeros in the same rows
+    std::vector<int> color(m_nstates, -1);
+    std::vector<int> forbidden;  // last column for which each group was forbidden
+    m_jac_colors.clear();
+    for (int c = 0; c < m_nstates; c++) {
+        for (int r : m_jac_rows[c]) {
+            for (int c2 : cols[r]) {
+                if (color[c2] >= 0)
+                    forbidden[color[c2]] = c;
+            }
+        }
+        int k = 0;
+        while (k < (int)m_jac_colors.size() && forbidden[k] == c)
+            k++;
+        if (k == (int)m_jac_colors.size()) {
+            m_jac_colors.push_back({});
+            forbidden.push_back(-1);
+        }
+        color[c] = k;
+        m_jac_colors[k].push_back(c);
+    }
 }
 
 void ChExternalDynamics::Update(double time, bool update_assets) {
     ChTime = time;
 
     // Compute forcing terms at current states
+    // (the Jacobian, if needed, is evaluated only when loading the KRM matrices)
     CalculateRHS(time, m_states, m_rhs);
 
-    // Compute Jacobian (if needed)
-    if (IsStiff()) {
-        ComputeJac(time);
-    }
-
     // Update assets
     ChPhysicsItem::Update(ChTime, update_assets);
 }
@@ -203,6 +309,12 @@ void ChExternalDynamics::IntFromDescriptor(const unsigned int off_v,  // offset
 
 void ChExternalDynamics::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
     if (IsStiff()) {
+        // Re-evaluate the Jacobian at the current states, unless it can be reused
+        if (IsJacStale())
+            ComputeJac(ChTime);
+        else
+            m_jac_age++;
+
         // Recall to flip sign to load R = -dQ/dv (K is zero here)
         m_KRM.GetMatrix() = Mfactor * ChMatrixDynamic<>::Identity(m_nstates, m_nstates) - Rfactor * m_jac;
     }
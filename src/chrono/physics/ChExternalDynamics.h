@@ -54,6 +54,47 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
     /// Get current RHS.
     const ChVectorDynamic<>& GetRHS() const { return m_rhs; }
 
+    /// Get the current Jacobian of the RHS with respect to the states (only available if the physics item is stiff).
+    const ChMatrixDynamic<>& GetJac() const { return m_jac; }
+
+    /// Enable/disable colored finite differences for the Jacobian approximation (default: false).
+    /// Only used if the physics item is stiff and no analytical Jacobian is provided (see CalculateJac). If enabled,
+    /// structurally orthogonal columns of the Jacobian (columns without non-zeros in the same row) are perturbed
+    /// together, which requires one RHS evaluation per group of columns instead of one per state. The sparsity pattern
+    /// is obtained from CalculateJacPattern or, if not provided, detected from a full finite-difference Jacobian.
+    /// WARNING: a detected pattern only contains the entries which are non-zero at the state of the first Jacobian
+    /// evaluation. Entries which happen to vanish there (e.g., d(x*y)/dx at y=0) are then dropped from all later
+    /// Jacobians. Unless the structure of the Jacobian does not depend on the states, implement CalculateJacPattern
+    /// (or call ResetJacPattern to re-detect the pattern at a representative state).
+    void EnableColoredJac(bool val) { m_jac_coloring = val; }
+
+    /// Enable/disable the parallel evaluation of the finite-difference Jacobian (default: false).
+    /// If enabled, the RHS evaluations for the perturbed states are performed concurrently, using the number of
+    /// Chrono threads of the containing system (see ChSystem::SetNumThreads). Enable only if CalculateRHS is thread
+    /// safe, i.e., if it does not modify shared data.
+    void EnableParallelJac(bool val) { m_jac_parallel = val; }
+
+    /// Set the policy for reusing the Jacobian (default: max_age=0, i.e., always re-evaluate).
+    /// A Jacobian is re-evaluated if it was already used for 'max_age' updates of the solver matrices (e.g., Newton
+    /// iterations) or if the states changed (relative to their values at the last Jacobian evaluation) by more than
+    /// 'max_change' (infinity norm, relative to the infinity norm of the states, or absolute if this is below 1).
+    void SetJacReuse(int max_age, double max_change = 1e-2);
+
+    /// Force a re-evaluation of the Jacobian the next time it is needed.
+    void ForceJacUpdate() { m_jac_age = -1; }
+
+    /// Discard the current Jacobian sparsity pattern (re-detected or re-loaded at the next Jacobian evaluation).
+    void ResetJacPattern();
+
+    /// Get the number of Jacobian evaluations so far.
+    unsigned int GetNumJacEvaluations() const { return m_num_jac_evals; }
+
+    /// Get the number of RHS evaluations performed for finite-difference Jacobian approximations so far.
+    unsigned int GetNumJacRHSEvaluations() const { return m_num_jac_rhs_evals; }
+
+    /// Get the number of column groups used for the colored finite-difference Jacobian (0 if not available).
+    unsigned int GetNumJacColors() const { return (unsigned int)m_jac_colors.size(); }
+
   protected:
     ChExternalDynamics();
 
@@ -81,6 +122,12 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
         return false;
     }
 
+    /// Provide the sparsity pattern of the Jacobian of the ODE right-hand side with respect to the ODE states.
+    /// Only used with colored finite-difference Jacobians (see EnableColoredJac). If provided, set to 'true' all
+    /// entries of 'pattern' (already set to 'false' before the call) which may be non-zero and return 'true'.
+    /// Otherwise, the pattern is detected from a full finite-difference Jacobian.
+    virtual bool CalculateJacPattern(ChMatrixDynamic<bool>& pattern) { return false; }
+
     virtual void Update(double time, bool update_assets = true) override;
 
     virtual unsigned int GetNumCoordsPosLevel() override { return m_nstates; }
@@ -139,6 +186,16 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
     void ComputeJac(double time);
 
   private:
+    /// Return true if the Jacobian must be re-evaluated, according to the reuse policy.
+    bool IsJacStale() const;
+
+    /// Estimate the Jacobian with finite differences, perturbing the states in the given groups of columns together.
+    /// If a pattern is given, only its entries are loaded; otherwise, each group must contain a single column.
+    void ComputeJacFD(double time, const std::vector<std::vector<int>>& groups, bool use_pattern);
+
+    /// Set the Jacobian sparsity pattern and group its columns (greedy coloring).
+    void SetupJacColors(const ChMatrixDynamic<bool>& pattern);
+
     int m_nstates;                                ///< number of internal ODE states
     ChVectorDynamic<> m_states;                   ///< vector of internal ODE states
     ChVariablesGenericDiagonalMass* m_variables;  ///< carrier for internal dynamics states
@@ -148,6 +205,18 @@ class ChApi ChExternalDynamics : public ChPhysicsItem {
 
     ChKRMBlock m_KRM;  ///< linear combination of K, R, M for the variables associated with item
 
+    bool m_jac_coloring;                         ///< use colored finite differences
+    bool m_jac_parallel;                         ///< evaluate the finite-difference Jacobian in parallel
+    int m_jac_max_age;                           ///< maximum number of Jacobian reuses
+    double m_jac_max_change;                     ///< maximum relative state change for Jacobian reuse
+    int m_jac_age;                               ///< number of reuses of the current Jacobian (-1: no Jacobian)
+    ChVectorDynamic<> m_jac_states;              ///< states at the last Jacobian evaluation
+    std::vector<std::vector<int>> m_jac_rows;    ///< Jacobian sparsity pattern (row indices of each column)
+    std::vector<std::vector<int>> m_jac_colors;  ///< groups of structurally orthogonal columns
+    std::vector<std::vector<int>> m_jac_cols;    ///< single-column groups (full finite differences)
+    unsigned int m_num_jac_evals;                ///< number of Jacobian evaluations
+    unsigned int m_num_jac_rhs_evals;            ///< number of RHS evaluations for finite-difference Jacobians
+
     static const double m_FD_delta;  ///< perturbation for finite-difference Jacobian approximation
 };
 
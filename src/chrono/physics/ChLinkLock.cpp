@@ -807,7 +807,7 @@ void ChLinkLock::IntStateScatterReactions(const unsigned int off_L, const ChVect
     //// The reaction torque is then rotated to the local frame of Marker2 (frame2, F2, master frame of link)
 
     // Cqw2.T is used directly to avoid computing the above complex Ts to improve performance.
-    ChMatrixDynamic<> Cqw2T = Cqw2.transpose();
+    // (the entries of Cqw2.T are read from Cqw2, without forming the transpose in a temporary matrix)
 
     // Translational constraint reaction force = -lambda_translational
     // Translational constraint reaction torque = -d~''(t)*lambda_translational
@@ -836,21 +836,21 @@ void ChLinkLock::IntStateScatterReactions(const unsigned int off_L, const ChVect
 
     ChVector3d m_torque_L;  // = Cqw2.T * lambda, reaction torque in local frame of m_body2
     if (mask.Constr_E1().IsActive()) {
-        m_torque_L.x() += Cqw2T(3, local_off) * (react(local_off));
-        m_torque_L.y() += Cqw2T(4, local_off) * (react(local_off));
-        m_torque_L.z() += Cqw2T(5, local_off) * (react(local_off));
+        m_torque_L.x() += Cqw2(local_off, 3) * (react(local_off));
+        m_torque_L.y() += Cqw2(local_off, 4) * (react(local_off));
+        m_torque_L.z() += Cqw2(local_off, 5) * (react(local_off));
         local_off++;
     }
     if (mask.Constr_E2().IsActive()) {
-        m_torque_L.x() += Cqw2T(3, local_off) * (react(local_off));
-        m_torque_L.y() += Cqw2T(4, local_off) * (react(local_off));
-        m_torque_L.z() += Cqw2T(5, local_off) * (react(local_off));
+        m_torque_L.x() += Cqw2(local_off, 3) * (react(local_off));
+        m_torque_L.y() += Cqw2(local_off, 4) * (react(local_off));
+        m_torque_L.z() += Cqw2(local_off, 5) * (react(local_off));
         local_off++;
     }
     if (mask.Constr_E3().IsActive()) {
-        m_torque_L.x() += Cqw2T(3, local_off) * (react(local_off));
-        m_torque_L.y() += Cqw2T(4, local_off) * (react(local_off));
-        m_torque_L.z() += Cqw2T(5, local_off) * (react(local_off));
+        m_torque_L.x() += Cqw2(local_off, 3) * (react(local_off));
+        m_torque_L.y() += Cqw2(local_off, 4) * (react(local_off));
+        m_torque_L.z() += Cqw2(local_off, 5) * (react(local_off));
         local_off++;
     }
     react_torque += marker2->GetRotMat().transpose() * m_torque_L;
@@ -1739,24 +1739,23 @@ void ChLinkLock::ConstraintsFetch_react(double factor) {
     }
 
     // Cqw2.T*lambda is the reaction torque acting on m_body2, expressed in the local frame of m_body2
-    ChMatrixDynamic<> Cqw2T = Cqw2.transpose();
     ChVector3d m_torque_L;  // = Cqw2.T * lambda
     if (mask.Constr_E1().IsActive()) {
-        m_torque_L.x() += Cqw2T(3, n_constraint) * (react(n_constraint));
-        m_torque_L.y() += Cqw2T(4, n_constraint) * (react(n_constraint));
-        m_torque_L.z() += Cqw2T(5, n_constraint) * (react(n_constraint));
+        m_torque_L.x() += Cqw2(n_constraint, 3) * (react(n_constraint));
+        m_torque_L.y() += Cqw2(n_constraint, 4) * (react(n_constraint));
+        m_torque_L.z() += Cqw2(n_constraint, 5) * (react(n_constraint));
         n_constraint++;
     }
     if (mask.Constr_E2().IsActive()) {
-        m_torque_L.x() += Cqw2T(3, n_constraint) * (react(n_constraint));
-        m_torque_L.y() += Cqw2T(4, n_constraint) * (react(n_constraint));
-        m_torque_L.z() += Cqw2T(5, n_constraint) * (react(n_constraint));
+        m_torque_L.x() += Cqw2(n_constraint, 3) * (react(n_constraint));
+        m_torque_L.y() += Cqw2(n_constraint, 4) * (react(n_constraint));
+        m_torque_L.z() += Cqw2(n_constraint, 5) * (react(n_constraint));
         n_constraint++;
     }
     if (mask.Constr_E3().IsActive()) {
-        m_torque_L.x() += Cqw2T(3, n_constraint) * (react(n_constraint));
-        m_torque_L.y() += Cqw2T(4, n_constraint) * (react(n_constraint));
-        m_torque_L.z() += Cqw2T(5, n_constraint) * (react(n_constraint));
+        m_torque_L.x() += Cqw2(n_constraint, 3) * (react(n_constraint));
+        m_torque_L.y() += Cqw2(n_constraint, 4) * (react(n_constraint));
+        m_torque_L.z() += Cqw2(n_constraint, 5) * (react(n_constraint));
         n_constraint++;
     }
     // The reaction torque is rotated to the local frame of Marker2 (frame2, F2, master frame of link)
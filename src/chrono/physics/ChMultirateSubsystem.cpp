@@ -0,0 +1,260 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Physics element for multirate integration: a subsystem with fast dynamics,
+// modeled in a separate ChSystem, is sub-cycled with a smaller step size
+// inside each step of the containing system.
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChMultirateSubsystem.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// Motion function driving a subsystem shaft: interpolated motion of the coupled shaft over the current macro step.
+class ChMultirateSubsystem::MotionFunction : public ChFunction {
+  public:
+    MotionFunction(double q, double v, double t) : interp{t, t, q, q, v, v} {}
+
+    virtual MotionFunction* Clone() const override { return new MotionFunction(*this); }
+
+    virtual double GetVal(double t) const override {
+        double q, v;
+        interp.Eval(t, q, v);
+        return q;
+    }
+
+    virtual double GetDer(double t) const override {
+        double q, v;
+        interp.Eval(t, q, v);
+        return v;
+    }
+
+    Interpolant interp;
+};
+
+void ChMultirateSubsystem::Interpolant::Eval(double t, double& q, double& v) const {
+    double H = t1 - t0;
+    if (H <= 0) {
+        q = q1 + v1 * (t - t1);
+        v = v1;
+        return;
+    }
+
+    double s = std::min(std::max((t - t0) / H, 0.0), 1.0);
+    double s2 = s * s;
+    double s3 = s2 * s;
+
+    q = (2 * s3 - 3 * s2 + 1) * q0 + (s3 - 2 * s2 + s) * H * v0 + (-2 * s3 + 3 * s2) * q1 + (s3 - s2) * H * v1;
+    v = (6 * s2 - 6 * s) * q0 / H + (3 * s2 - 4 * s + 1) * v0 + (-6 * s2 + 6 * s) * q1 / H + (3 * s2 - 2 * s) * v1;
+}
+
+// -----------------------------------------------------------------------------
+
+ChMultirateSubsystem::ChMultirateSubsystem(std::shared_ptr<ChSystem> subsystem)
+    : m_subsystem(subsystem), m_num_substeps(10), m_initialized(false), m_time(0), m_num_substeps_total(0) {}
+
+int ChMultirateSubsystem::AddShaftCoupling(std::shared_ptr<ChShaft> shaft, std::shared_ptr<ChShaft> sub_shaft) {
+    // Fixed reference for the shaft motors in the subsystem
+    if (!m_ground) {
+        m_ground = chrono_types::make_shared<ChShaft>();
+        m_ground->SetFixed(true);
+        m_subsystem->Add(m_ground);
+    }
+
+    // Start the subsystem shaft from the current state of the coupled shaft
+    sub_shaft->SetPos(shaft->GetPos());
+    sub_shaft->SetPosDt(shaft->GetPosDt());
+
+    ShaftCoupling coupling;
+    coupling.shaft = shaft;
+    coupling.motion = chrono_types::make_shared<MotionFunction>(shaft->GetPos(), shaft->GetPosDt(), m_time);
+    coupling.motor = chrono_types::make_shared<ChShaftsMotorPosition>();
+    coupling.motor->Initialize(sub_shaft, m_ground);
+    coupling.motor->SetPositionFunction(coupling.motion);
+    coupling.torque = 0;
+    m_subsystem->Add(coupling.motor);
+
+    m_shaft_couplings.push_back(coupling);
+    m_initialized = false;
+
+    return (int)m_shaft_couplings.size() - 1;
+}
+
+int ChMultirateSubsystem::AddActuatorCoupling(std::shared_ptr<ChHydraulicActuatorBase> actuator,
+                                              std::shared_ptr<ChBody> body1,
+                                              std::shared_ptr<ChBody> body2,
+                                              bool local,
+                                              ChVector3d loc1,
+                                              ChVector3d loc2) {
+    ActuatorCoupling coupling;
+    coupling.actuator = actuator;
+    coupling.body1 = body1.get();
+    coupling.body2 = body2.get();
+    coupling.loc1 = local ? loc1 : body1->TransformPointParentToLocal(loc1);
+    coupling.loc2 = local ? loc2 : body2->TransformPointParentToLocal(loc2);
+    coupling.Qforce.setZero(12);
+
+    // Initial actuator force, at the current actuator length
+    double s, sd;
+    GetActuatorLength(coupling, s, sd);
+    coupling.length = {m_time, m_time, s, s, sd, sd};
+    actuator->SetActuatorLength(s, sd);
+    coupling.force = actuator->GetActuatorForce();
+
+    m_actuator_couplings.push_back(coupling);
+    m_initialized = false;
+
+    return (int)m_actuator_couplings.size() - 1;
+}
+
+void ChMultirateSubsystem::GetActuatorLength(const ActuatorCoupling& coupling, double& s, double& sd) const {
+    auto aloc1 = coupling.body1->TransformPointLocalToParent(coupling.loc1);
+    auto aloc2 = coupling.body2->TransformPointLocalToParent(coupling.loc2);
+    auto avel1 = coupling.body1->PointSpeedLocalToParent(coupling.loc1);
+    auto avel2 = coupling.body2->PointSpeedLocalToParent(coupling.loc2);
+
+    ChVector3d dir = (aloc1 - aloc2).GetNormalized();
+    s = (aloc1 - aloc2).Length();
+    sd = Vdot(dir, avel1 - avel2);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChMultirateSubsystem::Setup() {
+    double time = system->GetChTime();
+
+    // (Re)start the multirate integration from the current states if needed
+    if (!m_initialized || time < m_time) {
+        CaptureStates(time);
+        return;
+    }
+
+    if (time > m_time)
+        Advance(time);
+}
+
+void ChMultirateSubsystem::CaptureStates(double time) {
+    m_time = time;
+    m_subsystem->SetChTime(time);
+
+    for (auto& coupling : m_shaft_couplings) {
+        double q = coupling.shaft->GetPos();
+        double v = coupling.shaft->GetPosDt();
+        coupling.motion->interp = {time, time, q, q, v, v};
+    }
+
+    for (auto& coupling : m_actuator_couplings) {
+        double s, sd;
+        GetActuatorLength(coupling, s, sd);
+        coupling.length = {time, time, s, s, sd, sd};
+    }
+
+    m_initialized = true;
+}
+
+void ChMultirateSubsystem::Advance(double time) {
+    double h = (time - m_time) / m_num_substeps;
+
+    // Interpolate the motion of the coupled items over the macro step, from the states at the end of the previous
+    // macro step to the current states
+    for (auto& coupling : m_shaft_couplings) {
+        auto& interp = coupling.motion->interp;
+        interp = {m_time, time, interp.q1, coupling.shaft->GetPos(), interp.v1, coupling.shaft->GetPosDt()};
+        coupling.torque = 0;
+    }
+
+    for (auto& coupling : m_actuator_couplings) {
+        double s, sd;
+        GetActuatorLength(coupling, s, sd);
+        coupling.length = {m_time, time, coupling.length.q1, s, coupling.length.v1, sd};
+        coupling.force = 0;
+    }
+
+    // Sub-cycle the subsystem and accumulate the coupling loads
+    for (int i = 0; i < m_num_substeps; i++) {
+        double t = m_time + (i + 1) * h;
+        for (auto& coupling : m_actuator_couplings) {
+            double s, sd;
+            coupling.length.Eval(t, s, sd);
+            coupling.actuator->SetActuatorLength(s, sd);
+        }
+
+        m_subsystem->DoStepDynamics(h);
+
+        for (auto& coupling : m_shaft_couplings)
+            coupling.torque -= coupling.motor->GetMotorLoad();
+        for (auto& coupling : m_actuator_couplings)
+            coupling.force += coupling.actuator->GetActuatorForce();
+    }
+
+    // Average coupling loads over the macro step
+    for (auto& coupling : m_shaft_couplings)
+        coupling.torque /= m_num_substeps;
+    for (auto& coupling : m_actuator_couplings)
+        coupling.force /= m_num_substeps;
+
+    m_time = time;
+    m_subsystem->SetChTime(time);
+    m_num_substeps_total += m_num_substeps;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChMultirateSubsystem::Update(double time, bool update_assets) {
+    ChPhysicsItem::Update(time, update_assets);
+
+    // Generalized forces of the actuator couplings, along the current actuator directions
+    for (auto& coupling : m_actuator_couplings) {
+        auto aloc1 = coupling.body1->TransformPointLocalToParent(coupling.loc1);
+        auto aloc2 = coupling.body2->TransformPointLocalToParent(coupling.loc2);
+        ChVector3d force = coupling.force * (aloc1 - aloc2).GetNormalized();
+
+        auto atorque1 = Vcross(aloc1 - coupling.body1->GetPos(), force);
+        auto atorque2 = Vcross(aloc2 - coupling.body2->GetPos(), -force);
+        coupling.Qforce.segment(0, 3) = force.eigen();
+        coupling.Qforce.segment(3, 3) = coupling.body1->TransformDirectionParentToLocal(atorque1).eigen();
+        coupling.Qforce.segment(6, 3) = -force.eigen();
+        coupling.Qforce.segment(9, 3) = coupling.body2->TransformDirectionParentToLocal(atorque2).eigen();
+    }
+}
+
+void ChMultirateSubsystem::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    if (!IsActive())
+        return;
+
+    for (const auto& coupling : m_shaft_couplings) {
+        if (coupling.shaft->IsActive())
+            R(coupling.shaft->GetOffset_w()) += c * coupling.torque;
+    }
+
+    for (const auto& coupling : m_actuator_couplings) {
+        if (coupling.body1->Variables().IsActive())
+            R.segment(coupling.body1->Variables().GetOffset(), 6) += c * coupling.Qforce.segment(0, 6);
+        if (coupling.body2->Variables().IsActive())
+            R.segment(coupling.body2->Variables().GetOffset(), 6) += c * coupling.Qforce.segment(6, 6);
+    }
+}
+
+void ChMultirateSubsystem::VariablesFbLoadForces(double factor) {
+    for (const auto& coupling : m_shaft_couplings)
+        coupling.shaft->Variables().Force()(0) += factor * coupling.torque;
+
+    for (const auto& coupling : m_actuator_couplings) {
+        coupling.body1->Variables().Force() += factor * coupling.Qforce.segment(0, 6);
+        coupling.body2->Variables().Force() += factor * coupling.Qforce.segment(6, 6);
+    }
+}
+
+}  // end namespace chrono
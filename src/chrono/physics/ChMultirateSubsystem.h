@@ -0,0 +1,156 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Physics element for multirate integration: a subsystem with fast dynamics,
+// modeled in a separate ChSystem, is sub-cycled with a smaller step size
+// inside each step of the containing system.
+// =============================================================================
+
+#ifndef CH_MULTIRATE_SUBSYSTEM_H
+#define CH_MULTIRATE_SUBSYSTEM_H
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChPhysicsItem.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/physics/ChShaftsMotorPosition.h"
+#include "chrono/physics/ChHydraulicActuator.h"
+
+namespace chrono {
+
+class ChSystem;
+
+/// Physics element for multirate integration of a subsystem with time scales faster than those of the containing
+/// system (e.g., a powertrain shaft network or a hydraulic actuator).
+/// The fast subsystem is modeled in a separate ChSystem, with its own solver and timestepper, and is advanced with
+/// a number of sub-steps for each step of the containing system. The coupling between the two systems is explicit:
+/// - the subsystem is driven by the motion of the coupled items of the containing system, interpolated (cubic Hermite
+///   interpolation of positions and velocities) over the macro step;
+/// - the coupling loads, averaged over the sub-steps, are applied to the containing system over the next macro step.
+/// The subsystem is advanced at the beginning of each step of the containing system (see ChSystem::Setup), over the
+/// previous macro step. As such, after a call to ChSystem::DoStepDynamics, the subsystem lags one step behind.
+class ChApi ChMultirateSubsystem : public ChPhysicsItem {
+  public:
+    /// Create a multirate element for the specified subsystem.
+    /// The subsystem must be populated (and its solver and timestepper set) by the caller.
+    ChMultirateSubsystem(std::shared_ptr<ChSystem> subsystem);
+
+    ~ChMultirateSubsystem() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChMultirateSubsystem* Clone() const override { return new ChMultirateSubsystem(*this); }
+
+    /// Get the subsystem.
+    ChSystem& GetSubsystem() const { return *m_subsystem; }
+
+    /// Set the number of sub-steps of the subsystem for each step of the containing system (default: 10).
+    void SetNumSubsteps(int num_substeps) { m_num_substeps = std::max(1, num_substeps); }
+
+    /// Get the number of sub-steps of the subsystem for each step of the containing system.
+    int GetNumSubsteps() const { return m_num_substeps; }
+
+    /// Couple a shaft of the containing system with a shaft of the subsystem.
+    /// The subsystem shaft is driven (through a position motor to a fixed shaft in the subsystem) to follow the
+    /// motion of the shaft in the containing system, and the motor torque is applied back to that shaft. As such,
+    /// the inertia of the subsystem shaft is lumped with that of the shaft in the containing system.
+    /// Return the index of the coupling.
+    int AddShaftCoupling(std::shared_ptr<ChShaft> shaft,     ///< shaft in containing system
+                         std::shared_ptr<ChShaft> sub_shaft  ///< shaft in subsystem
+    );
+
+    /// Couple a hydraulic actuator of the subsystem to two bodies of the containing system.
+    /// The actuator must be initialized stand-alone (not attached to bodies). Its length and rate are set from the
+    /// relative motion of the connection points on the two bodies, and the actuator force is applied back to the
+    /// bodies.
+    /// Return the index of the coupling.
+    int AddActuatorCoupling(std::shared_ptr<ChHydraulicActuatorBase> actuator,  ///< actuator in subsystem
+                            std::shared_ptr<ChBody> body1,  ///< first connected body in containing system
+                            std::shared_ptr<ChBody> body2,  ///< second connected body in containing system
+                            bool local,                     ///< true if locations given in body local frames
+                            ChVector3d loc1,                ///< location of connection point on body 1
+                            ChVector3d loc2                 ///< location of connection point on body 2
+    );
+
+    /// Get the torque currently applied to the shaft of the specified shaft coupling.
+    double GetShaftCouplingTorque(int i) const { return m_shaft_couplings[i].torque; }
+
+    /// Get the force currently applied along the specified actuator coupling.
+    double GetActuatorCouplingForce(int i) const { return m_actuator_couplings[i].force; }
+
+    /// Get the time of the subsystem at the end of the last sub-cycle.
+    double GetSubsystemTime() const { return m_time; }
+
+    /// Get the cumulative number of sub-steps taken by the subsystem.
+    unsigned int GetNumSubstepsTotal() const { return m_num_substeps_total; }
+
+    // PHYSICS ITEM INTERFACE
+
+    /// Advance the subsystem to the current time of the containing system.
+    virtual void Setup() override;
+
+    virtual void Update(double time, bool update_assets = true) override;
+
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+
+    virtual void VariablesFbLoadForces(double factor = 1) override;
+
+  private:
+    /// Cubic Hermite interpolation of a scalar quantity over a macro step.
+    struct Interpolant {
+        double t0, t1;
+        double q0, q1;
+        double v0, v1;
+
+        void Eval(double t, double& q, double& v) const;
+    };
+
+    /// Motion function of the subsystem shaft motors.
+    class MotionFunction;
+
+    struct ShaftCoupling {
+        std::shared_ptr<ChShaft> shaft;
+        std::shared_ptr<ChShaftsMotorPosition> motor;
+        std::shared_ptr<MotionFunction> motion;
+        double torque;
+    };
+
+    struct ActuatorCoupling {
+        std::shared_ptr<ChHydraulicActuatorBase> actuator;
+        ChBody* body1;
+        ChBody* body2;
+        ChVector3d loc1;
+        ChVector3d loc2;
+        Interpolant length;
+        double force;
+        ChVectorDynamic<> Qforce;
+    };
+
+    void CaptureStates(double time);
+    void Advance(double time);
+    void GetActuatorLength(const ActuatorCoupling& coupling, double& s, double& sd) const;
+
+    std::shared_ptr<ChSystem> m_subsystem;
+    std::shared_ptr<ChShaft> m_ground;
+    int m_num_substeps;
+    bool m_initialized;
+    double m_time;
+    unsigned int m_num_substeps_total;
+
+    std::vector<ShaftCoupling> m_shaft_couplings;
+    std::vector<ActuatorCoupling> m_actuator_couplings;
+};
+
+}  // end namespace chrono
+
+#endif
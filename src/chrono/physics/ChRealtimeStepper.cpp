@@ -0,0 +1,228 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <thread>
+
+#include "chrono/physics/ChRealtimeStepper.h"
+#include "chrono/solver/ChIterativeSolver.h"
+
+namespace chrono {
+
+// Default clock: steady wall clock, with times measured from the construction of the clock
+class ChRealtimeSteadyClock : public ChRealtimeStepper::Clock {
+  public:
+    ChRealtimeSteadyClock() : m_start(std::chrono::steady_clock::now()) {}
+
+    virtual double GetTime() override {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+    }
+
+    virtual void WaitUntil(double time) override {
+        using std::chrono::steady_clock;
+        auto offset = std::chrono::duration_cast<steady_clock::duration>(std::chrono::duration<double>(time));
+        std::this_thread::sleep_until(m_start + offset);
+    }
+
+  private:
+    std::chrono::steady_clock::time_point m_start;
+};
+
+ChRealtimeStepper::Settings::Settings()
+    : risk_fraction(0.8),
+      recover_fraction(0.5),
+      recover_steps(50),
+      min_solver_iterations(10),
+      max_collision_interval(4),
+      reserve_factor(2.0) {}
+
+ChRealtimeStepper::ChRealtimeStepper(ChSystem* sys, double step)
+    : m_system(sys),
+      m_step(step),
+      m_initialized(false),
+      m_nominal_iterations(0),
+      m_nominal_collision_interval(1),
+      m_solver_levels(0),
+      m_max_level(0),
+      m_level(0),
+      m_slack_steps(0),
+      m_deadline(std::numeric_limits<double>::lowest()),
+      m_running(false) {
+    m_clock = chrono_types::make_shared<ChRealtimeSteadyClock>();
+    ResetStats();
+}
+
+ChRealtimeStepper::~ChRealtimeStepper() {
+    Stop();
+    if (m_initialized) {
+        m_level = 0;
+        ApplyLevel();
+    }
+}
+
+void ChRealtimeStepper::SetClock(std::shared_ptr<Clock> clock) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_clock = clock;
+    m_deadline = std::numeric_limits<double>::lowest();
+}
+
+void ChRealtimeStepper::Initialize() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Nominal settings
+    auto solver = m_system->GetSolver();
+    m_nominal_iterations = solver && solver->AsIterative() ? solver->AsIterative()->GetMaxIterations() : 0;
+    m_nominal_collision_interval = m_system->GetCollisionDetectionInterval();
+
+    m_solver_levels = 0;
+    while ((m_nominal_iterations >> m_solver_levels) > m_settings.min_solver_iterations)
+        m_solver_levels++;
+    int collision_levels = std::max(0, (int)m_settings.max_collision_interval - (int)m_nominal_collision_interval);
+    m_max_level = m_solver_levels + collision_levels;
+    m_level = 0;
+    m_slack_steps = 0;
+
+    // Fill the contact storage and the system descriptor at the current state, as done at the beginning of a step,
+    // without advancing the system
+    auto descriptor = m_system->GetSystemDescriptor();
+    m_system->Initialize();
+    m_system->ComputeCollisions();
+    m_system->Setup();
+    m_system->Update(false);
+    m_system->DescriptorPrepareInject(*descriptor);
+
+    // Leave room in the system descriptor for a larger number of contacts
+    double factor = std::max(1.0, m_settings.reserve_factor);
+    descriptor->Reserve((size_t)(factor * descriptor->GetVariables().size()),
+                        (size_t)(factor * descriptor->GetConstraints().size()),
+                        (size_t)(factor * descriptor->GetKRMBlocks().size()));
+
+    m_initialized = true;
+}
+
+void ChRealtimeStepper::ExecuteStep() {
+    double start = m_clock->GetTime();
+
+    if (m_callback)
+        m_callback->OnStep(m_system);
+    m_system->DoStepDynamics(m_step);
+
+    double step_time = m_clock->GetTime() - start;
+
+    m_stats.num_steps++;
+    m_stats.last_step_time = step_time;
+    m_stats.max_step_time = std::max(m_stats.max_step_time, step_time);
+    m_total_step_time += step_time;
+    m_stats.average_step_time = m_total_step_time / m_stats.num_steps;
+
+    // Degrade fidelity if the deadline is at risk, restore it after enough steps with slack
+    if (step_time > m_settings.risk_fraction * m_step) {
+        m_slack_steps = 0;
+        if (m_level < m_max_level) {
+            m_level++;
+            ApplyLevel();
+        }
+    } else if (step_time < m_settings.recover_fraction * m_step) {
+        if (m_level > 0 && ++m_slack_steps >= m_settings.recover_steps) {
+            m_slack_steps = 0;
+            m_level--;
+            ApplyLevel();
+        }
+    } else {
+        m_slack_steps = 0;
+    }
+    m_stats.level = m_level;
+}
+
+void ChRealtimeStepper::ApplyLevel() {
+    int solver_level = std::min(m_level, m_solver_levels);
+    if (m_nominal_iterations > 0 && m_system->GetSolver()->AsIterative()) {
+        int iterations = std::max(m_nominal_iterations >> solver_level, m_settings.min_solver_iterations);
+        m_system->GetSolver()->AsIterative()->SetMaxIterations(std::min(iterations, m_nominal_iterations));
+    }
+
+    int collision_level = m_level - solver_level;
+    m_system->SetCollisionDetectionInterval(m_nominal_collision_interval + collision_level);
+}
+
+bool ChRealtimeStepper::DoStep() {
+    if (!m_initialized)
+        Initialize();
+
+    bool on_time;
+    double deadline;
+    std::shared_ptr<Clock> clock;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        // Deadline of this step (re-synchronized if the previous step was late or if the caller was idle)
+        double now = m_clock->GetTime();
+        if (m_deadline < now)
+            m_deadline = now;
+        m_deadline += m_step;
+
+        ExecuteStep();
+
+        on_time = m_clock->GetTime() <= m_deadline;
+        if (!on_time)
+            m_stats.num_missed++;
+        deadline = m_deadline;
+        clock = m_clock;
+    }
+
+    if (on_time)
+        clock->WaitUntil(deadline);
+
+    return on_time;
+}
+
+void ChRealtimeStepper::Start() {
+    if (m_running)
+        return;
+    if (!m_initialized)
+        Initialize();
+
+    m_running = true;
+    m_thread = std::thread(&ChRealtimeStepper::Run, this);
+}
+
+void ChRealtimeStepper::Stop() {
+    if (!m_running)
+        return;
+    m_running = false;
+    m_thread.join();
+}
+
+void ChRealtimeStepper::Run() {
+    while (m_running)
+        DoStep();
+}
+
+ChRealtimeStepper::Stats ChRealtimeStepper::GetStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void ChRealtimeStepper::ResetStats() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.num_steps = 0;
+    m_stats.num_missed = 0;
+    m_stats.max_step_time = 0;
+    m_stats.average_step_time = 0;
+    m_stats.last_step_time = 0;
+    m_stats.level = m_level;
+    m_total_step_time = 0;
+}
+
+}  // end namespace chrono
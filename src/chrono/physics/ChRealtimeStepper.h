@@ -0,0 +1,177 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_REALTIME_STEPPER_H
+#define CH_REALTIME_STEPPER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+/// Real-time execution of a Chrono system with deadline scheduling.
+/// Each step of size h must complete within h of wall-clock time; a step that completes early waits for its deadline,
+/// a step that overruns it is recorded as a missed deadline (and the schedule is re-synchronized with the wall clock,
+/// rather than attempting to catch up). Steps can be executed synchronously (DoStep) or on a dedicated stepping thread
+/// (Start / Stop). Intended for hardware-in-the-loop and driving-simulator applications.
+///
+/// When a deadline is at risk (the computation time of a step exceeds a given fraction of the step size), the stepper
+/// degrades the fidelity of the simulation, one level at a time:
+/// - first, the maximum number of iterations of an iterative solver is halved at each level (down to a minimum);
+/// - then, the collision detection is performed only every 2, 3, ... steps (up to a maximum interval).
+/// The nominal settings are restored, one level at a time, after a number of consecutive steps with enough slack.
+///
+/// Initialize() pre-allocates the per-step buffers at the initial state (without advancing the system), so that the
+/// contact storage and the system descriptor are already sized when the real-time stepping begins.
+///
+/// Deadlines and step computation times are measured with a Clock, by default the steady wall clock. A different clock
+/// (e.g., an external synchronization signal, or a simulated clock for testing) can be set with SetClock().
+class ChApi ChRealtimeStepper {
+  public:
+    /// Settings for the deadline monitoring and degradation policy.
+    struct Settings {
+        Settings();
+
+        double risk_fraction;                 ///< step at risk if computation time > risk_fraction * step
+        double recover_fraction;              ///< step with slack if computation time < recover_fraction * step
+        int recover_steps;                    ///< consecutive steps with slack before restoring one level
+        int min_solver_iterations;            ///< lower bound for the iterations of an iterative solver
+        unsigned int max_collision_interval;  ///< upper bound for the collision detection interval
+        double reserve_factor;                ///< capacity of the system descriptor, relative to the initial state
+    };
+
+    /// Statistics of the real-time execution.
+    struct Stats {
+        size_t num_steps;          ///< number of steps executed
+        size_t num_missed;         ///< number of steps which missed their deadline
+        double max_step_time;      ///< maximum computation time of a step [s]
+        double average_step_time;  ///< average computation time of a step [s]
+        double last_step_time;     ///< computation time of the last step [s]
+        int level;                 ///< current degradation level (0: nominal fidelity)
+    };
+
+    /// Class to be used as a callback interface for operations executed before each step, on the stepping thread.
+    /// For example, this can be used to exchange data with hardware in the loop.
+    class ChApi StepCallback {
+      public:
+        virtual ~StepCallback() {}
+
+        /// Called before each step, with the system locked.
+        virtual void OnStep(ChSystem* sys) = 0;
+    };
+
+    /// Class to be used as a clock interface, for measuring the step times and waiting for the step deadlines.
+    class ChApi Clock {
+      public:
+        virtual ~Clock() {}
+
+        /// Return the current time [s].
+        virtual double GetTime() = 0;
+
+        /// Wait until the specified time [s].
+        virtual void WaitUntil(double time) = 0;
+    };
+
+    /// Create a real-time stepper for the given system, with a fixed step size.
+    ChRealtimeStepper(ChSystem* sys, double step);
+
+    /// Stop the stepping thread (if running) and restore the nominal settings of the system.
+    ~ChRealtimeStepper();
+
+    /// Access the settings of the degradation policy.
+    /// Must be modified before Initialize().
+    Settings& GetSettings() { return m_settings; }
+
+    /// Set a callback to be invoked before each step.
+    void SetStepCallback(std::shared_ptr<StepCallback> callback) { m_callback = callback; }
+
+    /// Set the clock used for measuring the step times and scheduling the deadlines (default: steady wall clock).
+    /// Must be set while the stepping thread is not running.
+    void SetClock(std::shared_ptr<Clock> clock);
+
+    /// Record the nominal solver and collision settings and pre-allocate the per-step buffers.
+    /// The system is not advanced: the collision detection is performed and the system descriptor is filled at the
+    /// current state (as at the beginning of a step), and storage for a larger number of contacts is reserved in the
+    /// system descriptor (see Settings::reserve_factor). The state, time, and integrator of the system are unchanged.
+    /// The vectors of the solver and of the integrator are sized by the first step.
+    /// This function is called automatically by the first call to DoStep() or Start().
+    void Initialize();
+
+    /// Execute one step and wait until its deadline, measured from the previous call to DoStep().
+    /// Return false if the step missed its deadline.
+    bool DoStep();
+
+    /// Start the real-time execution on a dedicated stepping thread.
+    void Start();
+
+    /// Stop the stepping thread (waiting for the current step to complete).
+    void Stop();
+
+    /// Return true if the stepping thread is running.
+    bool IsRunning() const { return m_running; }
+
+    /// Lock the system against concurrent stepping.
+    /// The host program must hold this lock while accessing the system during the execution on the stepping thread.
+    std::unique_lock<std::mutex> Lock() { return std::unique_lock<std::mutex>(m_mutex); }
+
+    /// Get the statistics of the real-time execution.
+    Stats GetStats();
+
+    /// Reset the statistics (but not the degradation level).
+    void ResetStats();
+
+    /// Get the maximum degradation level.
+    int GetMaxLevel() const { return m_max_level; }
+
+    /// Get the step size.
+    double GetStep() const { return m_step; }
+
+  private:
+    /// Execute a step and update the statistics and the degradation level (with the system locked).
+    void ExecuteStep();
+
+    /// Apply the solver and collision settings for the current degradation level.
+    void ApplyLevel();
+
+    /// Loop executed on the stepping thread.
+    void Run();
+
+    ChSystem* m_system;
+    double m_step;
+    Settings m_settings;
+    std::shared_ptr<StepCallback> m_callback;
+    std::shared_ptr<Clock> m_clock;
+
+    bool m_initialized;
+    int m_nominal_iterations;                   ///< nominal iterations of the iterative solver (0 if none)
+    unsigned int m_nominal_collision_interval;  ///< nominal collision detection interval
+    int m_solver_levels;                        ///< number of levels which reduce the solver iterations
+    int m_max_level;                            ///< maximum degradation level
+    int m_level;                                ///< current degradation level
+    int m_slack_steps;                          ///< consecutive steps with slack
+
+    Stats m_stats;
+    double m_total_step_time;
+    double m_deadline;
+
+    std::mutex m_mutex;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+};
+
+}  // end namespace chrono
+
+#endif
@@ -60,6 +60,7 @@ ChSystem::ChSystem()
       solvecount(0),
       write_matrix(false),
       ncontacts(0),
+      collision_interval(1),
       composition_strategy(new ChContactMaterialCompositionStrategy),
       collision_system(nullptr),
       visual_system(nullptr),
@@ -108,6 +109,7 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     use_sleeping = other.use_sleeping;
 
     ncontacts = other.ncontacts;
+    collision_interval = other.collision_interval;
 
     collision_callbacks = other.collision_callbacks;
 }
@@ -246,12 +248,21 @@ void ChSystem::Remove(std::shared_ptr<ChPhysicsItem> item) {
 
 // -----------------------------------------------------------------------------
 
+// Invalidate the Newton matrix which an implicit timestepper may reuse across steps.
+// Must be called whenever the solver is replaced or set up outside of the timestepper (e.g., by an assembly or static
+// analysis).
+static void ForceTimestepperJacobianUpdate(std::shared_ptr<ChTimestepper> timestepper) {
+    if (auto ts = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(timestepper))
+        ts->ForceJacobianUpdate();
+}
+
 void ChSystem::SetSolverType(ChSolver::Type type) {
     // Do nothing if changing to a CUSTOM solver.
     if (type == ChSolver::Type::CUSTOM)
         return;
 
     descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+    descriptor->SetNumThreads(nthreads_chrono);
 
     switch (type) {
         case ChSolver::Type::PSOR:
@@ -289,6 +300,8 @@ void ChSystem::SetSolverType(ChSolver::Type type) {
             std::cout << "Use SetSolver()." << std::endl;
             break;
     }
+
+    ForceTimestepperJacobianUpdate(timestepper);
 }
 
 void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
@@ -296,6 +309,16 @@ void ChSystem::EnableSolverMatrixWrite(bool val, const std::string& out_dir) {
     output_dir = out_dir;
 }
 
+void ChSystem::EnableTrace(bool val, bool items) {
+    if (!trace) {
+        if (!val)
+            return;
+        trace = chrono_types::make_unique<utils::ChTrace>();
+    }
+    trace->Enable(val);
+    trace->EnableItems(items);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChSystem::RegisterCustomCollisionCallback(std::shared_ptr<CustomCollisionCallback> callback) {
@@ -314,11 +337,13 @@ void ChSystem::UnregisterCustomCollisionCallback(std::shared_ptr<CustomCollision
 void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor) {
     assert(newdescriptor);
     descriptor = newdescriptor;
+    descriptor->SetNumThreads(nthreads_chrono);
 }
 
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    ForceTimestepperJacobianUpdate(timestepper);
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystem::Type type) {
@@ -377,6 +402,8 @@ void ChSystem::SetNumThreads(int num_threads_chrono, int num_threads_collision,
 
     if (collision_system)
         collision_system->SetNumThreads(nthreads_collision);
+    if (descriptor)
+        descriptor->SetNumThreads(nthreads_chrono);
 }
 
 // -----------------------------------------------------------------------------
@@ -619,6 +646,7 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor) {
 
 void ChSystem::Setup() {
     CH_PROFILE("Setup");
+    utils::ChTraceScope trace_setup(trace.get(), "Setup", "system");
 
     timer_setup.start();
 
@@ -699,6 +727,7 @@ void ChSystem::Update(double mytime, bool update_assets) {
 
 void ChSystem::Update(bool update_assets) {
     CH_PROFILE("Update");
+    utils::ChTraceScope trace_update(trace.get(), "Update", "system");
 
     Initialize();
 
@@ -708,7 +737,10 @@ void ChSystem::Update(bool update_assets) {
     assembly.Update(update_assets);
 
     // Update all contacts, if any
-    contact_container->Update(ch_time, update_assets);
+    {
+        utils::ChTraceScope trace_contacts(trace.get(), "Update", "contacts");
+        contact_container->Update(ch_time, update_assets);
+    }
 
     // Update any attached visualization system only when also updating assets
     if (visual_system && update_assets)
@@ -862,6 +894,7 @@ void ChSystem::LoadConstraintJacobians() {
     assembly.LoadConstraintJacobians();
 
     // Use also on contact container:
+    utils::ChTraceScope trace_contacts(trace.get(), "LoadConstraintJacobians", "contacts");
     contact_container->LoadConstraintJacobians();
 }
 
@@ -886,6 +919,7 @@ void ChSystem::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
     assembly.LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
 
     // Use also on contact container:
+    utils::ChTraceScope trace_contacts(trace.get(), "LoadKRMMatrices", "contacts");
     contact_container->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
 }
 
@@ -912,6 +946,8 @@ void ChSystem::StateGather(ChState& x, ChStateDelta& v, double& T) {
 
 // From state Y={x,v} to system.
 void ChSystem::StateScatter(const ChState& x, const ChStateDelta& v, const double T, bool full_update) {
+    utils::ChTraceScope trace_update(trace.get(), "Update", "system");
+
     unsigned int off_x = 0;
     unsigned int off_v = 0;
 
@@ -922,9 +958,12 @@ void ChSystem::StateScatter(const ChState& x, const ChStateDelta& v, const doubl
     // Use also on contact container:
     unsigned int displ_x = off_x - assembly.offset_x;
     unsigned int displ_v = off_v - assembly.offset_w;
-    contact_container->IntStateScatter(displ_x + contact_container->GetOffset_x(), x,  //
-                                       displ_v + contact_container->GetOffset_w(), v,  //
-                                       T, full_update);
+    {
+        utils::ChTraceScope trace_contacts(trace.get(), "Update", "contacts");
+        contact_container->IntStateScatter(displ_x + contact_container->GetOffset_x(), x,  //
+                                           displ_v + contact_container->GetOffset_w(), v,  //
+                                           T, full_update);
+    }
 
     ch_time = T;
 }
@@ -1030,6 +1069,7 @@ bool ChSystem::StateSolveCorrection(
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        utils::ChTraceScope trace_jacobian(trace.get(), "LoadJacobians", "solver");
         timer_jacobian.start();
 
         // Cq  matrix
@@ -1070,6 +1110,7 @@ bool ChSystem::StateSolveCorrection(
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        utils::ChTraceScope trace_ls_setup(trace.get(), "SolverSetup", "solver");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1080,9 +1121,12 @@ bool ChSystem::StateSolveCorrection(
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    {
+        utils::ChTraceScope trace_ls_solve(trace.get(), "SolverSolve", "solver");
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
 
     // Dv and Dl vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, Dl);
@@ -1147,6 +1191,7 @@ void ChSystem::LoadResidual_F(ChVectorDynamic<>& R, const double c) {
     assembly.IntLoadResidual_F(off, R, c);
 
     // Use also on contact container:
+    utils::ChTraceScope trace_contacts(trace.get(), "LoadResidual_F", "contacts");
     unsigned int displ_v = off - assembly.offset_w;
     contact_container->IntLoadResidual_F(displ_v + contact_container->GetOffset_w(), R, c);
 }
@@ -1231,6 +1276,7 @@ unsigned int ChSystem::GetNumContacts() {
 
 double ChSystem::ComputeCollisions() {
     CH_PROFILE("ComputeCollisions");
+    utils::ChTraceScope trace_collision(trace.get(), "ComputeCollisions", "system");
 
     double mretC = 0.0;
 
@@ -1552,6 +1598,7 @@ unsigned int ChSystem::RemoveRedundantConstraints(bool remove_links, double qr_t
 
 bool ChSystem::AdvanceDynamics() {
     CH_PROFILE("AdvanceDynamics");
+    utils::ChTraceScope trace_step(trace.get(), "Step", "system");
 
     ResetTimers();
 
@@ -1565,9 +1612,9 @@ bool ChSystem::AdvanceDynamics() {
     if (visual_system)
         visual_system->OnSetup(this);
 
-    // Compute contacts and create contact constraints
+    // Compute contacts and create contact constraints (if not reusing the contacts of a previous step)
     unsigned int ncontacts_old = ncontacts;
-    if (collision_system)
+    if (collision_system && (stepcount - 1) % collision_interval == 0)
         ComputeCollisions();
 
     // Declare an NSC system as "out of date" if there are contacts
@@ -1605,6 +1652,7 @@ bool ChSystem::AdvanceDynamics() {
     // Advance system state by one step
     {
         CH_PROFILE("Advance");
+        utils::ChTraceScope trace_advance(trace.get(), "Advance", "system");
         timer_advance.start();
         timestepper->Advance(step);
         timer_advance.stop();
@@ -1678,6 +1726,7 @@ bool ChSystem::DoAssembly(int action, int max_num_iterations) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceTimestepperJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1772,6 +1821,7 @@ bool ChSystem::DoStaticAnalysis(ChStaticAnalysis& analysis) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceTimestepperJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1794,6 +1844,7 @@ bool ChSystem::DoStaticLinear() {
 
     solvecount = 0;
     setupcount = 0;
+    ForceTimestepperJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1854,6 +1905,7 @@ bool ChSystem::DoStaticNonlinear(int nsteps, bool verbose) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceTimestepperJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1898,6 +1950,7 @@ bool ChSystem::DoStaticNonlinearRheonomic(
 
     solvecount = 0;
     setupcount = 0;
+    ForceTimestepperJacobianUpdate(timestepper);
 
     Setup();
     Update();
@@ -1942,6 +1995,7 @@ bool ChSystem::DoStaticRelaxing(double step_size, int num_iterations) {
 
     solvecount = 0;
     setupcount = 0;
+    ForceTimestepperJacobianUpdate(timestepper);
 
     if (m_num_coords_pos == 0 || m_num_coords_pos < m_num_constr)
         return false;
@@ -28,6 +28,7 @@
 #include "chrono/core/ChTimer.h"
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChTrace.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/solver/ChSystemDescriptor.h"
@@ -250,7 +251,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in the update of bodies, shafts, and links (if enabled, see EnableParallelUpdate),
+    ///                           in the matrix-vector products of the system descriptor (used by iterative
+    ///                           solvers, see ChSystemDescriptor::EnableParallelProducts), and
     ///                           in SCM deformable terrain calculations.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
@@ -270,6 +274,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     unsigned int GetNumThreadsCollision() const { return nthreads_collision; }
     unsigned int GetNumThreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable/disable the parallel processing of bodies, shafts, and links of the system assembly (default: disabled).
+    /// Only used if num_threads_chrono > 1. See ChAssembly::EnableParallelUpdate.
+    void EnableParallelUpdate(bool val) { assembly.EnableParallelUpdate(val); }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -430,6 +438,15 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// This is mostly called automatically by time integration.
     double ComputeCollisions();
 
+    /// Set the interval (number of steps) between collision detection passes (default: 1, i.e., at each step).
+    /// With an interval n > 1, the collision detection is performed only every n steps and the contacts found by the
+    /// last collision detection are reused in the intermediate steps. This trades accuracy for speed, e.g. when a
+    /// real-time deadline is at risk (see ChRealtimeStepper).
+    void SetCollisionDetectionInterval(unsigned int interval) { collision_interval = interval > 0 ? interval : 1; }
+
+    /// Get the interval (number of steps) between collision detection passes.
+    unsigned int GetCollisionDetectionInterval() const { return collision_interval; }
+
     /// Class to be used as a callback interface for user defined actions performed
     /// at each collision detection step.  For example, additional contact points can
     /// be added to the underlying contact container.
@@ -515,6 +532,17 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Resets the timers.
     void ResetTimers();
 
+    /// Enable/disable recording of timing events (default: disabled).
+    /// When enabled, the simulation phases (collision detection, setup, update, loading of Jacobians, solver setup and
+    /// solve) and the processing of each category of physics items (bodies, shafts, links, meshes, other items, and
+    /// contacts) are recorded, together with the recording thread. If 'items' is true, individual physics items and
+    /// FEA element types are also recorded (with larger overhead). Events accumulate over steps and can be summarized
+    /// or exported as a Chrome trace timeline through GetTrace(). When disabled, the cost is that of a test per phase.
+    void EnableTrace(bool val, bool items = false);
+
+    /// Access the recorder of timing events (nullptr if recording was never enabled).
+    utils::ChTrace* GetTrace() const { return trace.get(); }
+
     /// DEBUGGING
 
     /// Enable/disable debug output of system matrices.
@@ -821,7 +849,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     bool write_matrix;       ///< write current system matrix to file(s); for debugging
     std::string output_dir;  ///< output directory for writing system matrices
 
-    unsigned int ncontacts;  ///< total number of contacts
+    unsigned int ncontacts;           ///< total number of contacts
+    unsigned int collision_interval;  ///< number of steps between collision detection passes
 
     std::shared_ptr<ChCollisionSystem> collision_system;                         ///< collision engine
     std::vector<std::shared_ptr<CustomCollisionCallback>> collision_callbacks;   ///< user-defined collision callbacks
@@ -845,6 +874,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     ChTimer timer_update;     ///< timer for system update
     double m_RTF;             ///< real-time factor (simulation time / simulated time)
 
+    std::unique_ptr<utils::ChTrace> trace;  ///< recorder of timing events (optional)
+
     std::shared_ptr<ChTimestepper> timestepper;  ///< time-stepper object
 
     ChVectorDynamic<> applied_forces;  ///< system-wide vector of applied forces (lazy evaluation)
@@ -863,6 +894,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     friend class ChCollisionSystem;
 
     friend class modal::ChModalAssembly;
+
+    friend class ChRealtimeStepper;
 };
 
 CH_CLASS_VERSION(ChSystem, 0)
@@ -35,6 +35,17 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_solve_call(0),
       m_setup_call(0) {}
 
+void ChDirectSolverLS::CopySettings(const ChDirectSolverLS& other) {
+    m_lock = other.m_lock;
+    m_use_learner = other.m_use_learner;
+    m_sparsity = other.m_sparsity;
+    m_symmetry = other.m_symmetry;
+    m_use_perm = other.m_use_perm;
+    m_use_rhs_sparsity = other.m_use_rhs_sparsity;
+    m_null_pivot_detection = other.m_null_pivot_detection;
+    verbose = other.verbose;
+}
+
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
@@ -274,6 +285,12 @@ void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
 
 // ---------------------------------------------------------------------------
 
+ChSolverSparseLU* ChSolverSparseLU::Clone() const {
+    auto solver = new ChSolverSparseLU();
+    solver->CopySettings(*this);
+    return solver;
+}
+
 bool ChSolverSparseLU::FactorizeMatrix() {
     m_engine.compute(m_mat);
     return (m_engine.info() == Eigen::Success);
@@ -303,6 +320,12 @@ void ChSolverSparseLU::PrintErrorMessage() {
 
 // ---------------------------------------------------------------------------
 
+ChSolverSparseQR* ChSolverSparseQR::Clone() const {
+    auto solver = new ChSolverSparseQR();
+    solver->CopySettings(*this);
+    return solver;
+}
+
 bool ChSolverSparseQR::FactorizeMatrix() {
     m_engine.compute(m_mat);
     return (m_engine.info() == Eigen::Success);
@@ -111,6 +111,11 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// A concrete direct sparse solver may or may not support this feature.
     virtual void EnableNullPivotDetection(bool val, double threshold = 0) { m_null_pivot_detection = val; }
 
+    /// Create a new solver of the same type and with the same settings as this one.
+    /// The matrix, factorization, counters, and timers are not copied: the new solver can be used to set up and solve
+    /// a different problem concurrently with this one. Return nullptr if not supported by the concrete solver.
+    virtual ChDirectSolverLS* Clone() const { return nullptr; }
+
     /// Reset timers for internal phases in Solve and Setup.
     void ResetTimers();
 
@@ -176,6 +181,9 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     virtual bool IsDirect() const override { return true; }
     virtual ChDirectSolverLS* AsDirect() override { return this; }
 
+    /// Copy the user settings of another direct solver (used when cloning a solver).
+    void CopySettings(const ChDirectSolverLS& other);
+
     /// Factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() = 0;
 
@@ -230,6 +238,7 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     ChSolverSparseLU() {}
     ~ChSolverSparseLU() {}
     virtual Type GetType() const override { return Type::SPARSE_LU; }
+    virtual ChSolverSparseLU* Clone() const override;
 
   private:
     /// Factorize the current sparse matrix and return true if successful.
@@ -255,6 +264,7 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     ChSolverSparseQR() {}
     ~ChSolverSparseQR() {}
     virtual Type GetType() const override { return Type::SPARSE_QR; }
+    virtual ChSolverSparseQR* Clone() const override;
 
   private:
     /// Factorize the current sparse matrix and return true if successful.
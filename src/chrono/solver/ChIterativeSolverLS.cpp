@@ -15,7 +15,8 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a diagonal, block-Jacobi, incomplete LDL', or
+// constraint-aware block preconditioner.
 //
 // Available solvers:
 //   GMRES
@@ -24,6 +25,9 @@
 //
 // =============================================================================
 
+#include <cmath>
+#include <vector>
+
 #include "chrono/solver/ChIterativeSolverLS.h"
 
 // =============================================================================
@@ -80,58 +84,281 @@ class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
     chrono::ChVectorDynamic<> m_vect;    // workspace for the result of the SPMV operation
 };
 
-/// Simple diagonal preconditioner
-class ChDiagonalPreconditioner {
+// Preconditioners for the iterative linear solvers.
+// The system matrix is Z = [H, Cq'; Cq, E], with H=[M+K] and unknowns x = {q, -l}.
+class ChPreconditionerLS {
+  public:
+    typedef ChIterativeSolverLS::PreconditionerType Type;
+
+    ChPreconditionerLS() : m_type(Type::NONE), m_N(0), m_nq(0) {}
+
+    Type GetType() const { return m_type; }
+    Eigen::Index GetSize() const { return m_N; }
+
+    // Set up the preconditioner of given type for the current problem.
+    // If spd=true, the preconditioner is made symmetric positive definite.
+    void Setup(Type type, ChSystemDescriptor& sysd, bool spd) {
+        m_type = type;
+        m_nq = sysd.CountActiveVariables();
+        m_N = m_nq + sysd.CountActiveConstraints();
+
+        switch (m_type) {
+            case Type::NONE:
+                break;
+            case Type::DIAGONAL:
+                SetupDiagonal(sysd);
+                break;
+            case Type::BLOCK_JACOBI:
+            case Type::CONSTRAINT_BLOCK:
+                sysd.BuildSystemMatrix(&m_Z, nullptr);
+                SetupBlocks(sysd);
+                SetupConstraintDiagonal(m_type == Type::CONSTRAINT_BLOCK);
+                break;
+            case Type::ILDLT:
+                sysd.BuildSystemMatrix(&m_Z, nullptr);
+                SetupILDLT(spd);
+                break;
+        }
+    }
+
+    // Apply the preconditioner: x = P^(-1) * b.
+    void Apply(ChVectorConstRef b, ChVectorRef x) const {
+        switch (m_type) {
+            case Type::NONE:
+                x = b;
+                break;
+            case Type::DIAGONAL:
+                x = m_invdiag.array() * b.array();
+                break;
+            case Type::BLOCK_JACOBI:
+            case Type::CONSTRAINT_BLOCK:
+                for (const auto& block : m_blocks) {
+                    Eigen::Map<const ChMatrixDynamic<>> Hinv(&m_block_data[block.start], block.size, block.size);
+                    x.segment(block.offset, block.size) = Hinv * b.segment(block.offset, block.size);
+                }
+                x.tail(m_N - m_nq) = m_invdiag.array() * b.tail(m_N - m_nq).array();
+                break;
+            case Type::ILDLT:
+                SolveILDLT(b, x);
+                break;
+        }
+    }
+
+  private:
+    // Inverse of a diagonal entry (1 for zero entries, as for rigid constraints).
+    static double InvertDiagonal(double d) { return std::abs(d) > 1e-9 ? 1.0 / d : 1.0; }
+
+    void SetupDiagonal(ChSystemDescriptor& sysd) {
+        m_invdiag.resize(m_N);
+        sysd.BuildDiagonalVector(m_invdiag);
+        for (Eigen::Index i = 0; i < m_N; i++)
+            m_invdiag(i) = InvertDiagonal(m_invdiag(i));
+    }
+
+    // Extract and invert the diagonal blocks of H, one per active ChVariables.
+    void SetupBlocks(ChSystemDescriptor& sysd) {
+        m_blocks.clear();
+        m_block_data.clear();
+        m_var_block.assign(m_nq, -1);
+        for (const auto& var : sysd.GetVariables()) {
+            if (!var->IsActive() || var->GetDOF() == 0)
+                continue;
+            Block block{var->GetOffset(), var->GetDOF(), m_block_data.size()};
+
+            ChMatrixDynamic<> H = ChMatrixDynamic<>::Zero(block.size, block.size);
+            for (unsigned int r = 0; r < block.size; r++) {
+                for (ChSparseMatrix::InnerIterator it(m_Z, block.offset + r); it; ++it) {
+                    if (it.col() >= (int)block.offset && it.col() < (int)(block.offset + block.size))
+                        H(r, it.col() - block.offset) = it.value();
+                }
+            }
+
+            // Fall back to the inverse diagonal for singular blocks
+            ChMatrixDynamic<> Hinv;
+            Eigen::FullPivLU<ChMatrixDynamic<>> lu(H);
+            if (lu.isInvertible()) {
+                Hinv = lu.inverse();
+            } else {
+                Hinv.setZero(block.size, block.size);
+                for (unsigned int r = 0; r < block.size; r++)
+                    Hinv(r, r) = InvertDiagonal(H(r, r));
+            }
+
+            m_block_data.insert(m_block_data.end(), Hinv.data(), Hinv.data() + Hinv.size());
+            for (unsigned int r = 0; r < block.size; r++)
+                m_var_block[block.offset + r] = (int)m_blocks.size();
+            m_blocks.push_back(block);
+        }
+    }
+
+    // Inverse diagonal for the constraint rows: the compliance terms E or, if schur=true, the diagonal of
+    // Cq*inv(H)*Cq' + |E| (with the block-Jacobi approximation of inv(H)).
+    void SetupConstraintDiagonal(bool schur) {
+        auto n_c = m_N - m_nq;
+        m_invdiag.resize(n_c);
+        ChVectorDynamic<> c;
+        for (Eigen::Index i = 0; i < n_c; i++) {
+            double E = 0;
+            double S = 0;
+            int current = -1;
+            c.setZero(0);
+            // Row entries are sorted by column, so entries of the same variable block are contiguous
+            for (ChSparseMatrix::InnerIterator it(m_Z, m_nq + i);; ++it) {
+                int b = (it && it.col() < (int)m_nq) ? m_var_block[it.col()] : -1;
+                if (current >= 0 && (!it || b != current)) {
+                    const auto& block = m_blocks[current];
+                    Eigen::Map<const ChMatrixDynamic<>> Hinv(&m_block_data[block.start], block.size, block.size);
+                    S += c.dot(Hinv * c);
+                    current = -1;
+                }
+                if (!it)
+                    break;
+                if (it.col() == m_nq + i)
+                    E = it.value();
+                if (!schur || b < 0)
+                    continue;
+                if (current < 0) {
+                    current = b;
+                    c.setZero(m_blocks[b].size);
+                }
+                c(it.col() - m_blocks[b].offset) = it.value();
+            }
+            m_invdiag(i) = schur ? InvertDiagonal(S + std::abs(E)) : InvertDiagonal(E);
+        }
+    }
+
+    // Incomplete LDL' factorization of Z with no fill-in (L has the sparsity pattern of the lower triangle of Z).
+    // Pivots which vanish (e.g., decoupled rigid constraints) are replaced by 1. If spd=true, the absolute values of
+    // the pivots are used, which gives a positive definite preconditioner for the indefinite system matrix.
+    void SetupILDLT(bool spd) {
+        int n = (int)m_N;
+        m_L_start.assign(n + 1, 0);
+        m_L_col.clear();
+        m_L_val.clear();
+        m_invD.resize(n);
+
+        std::vector<double> D(n);
+        for (int i = 0; i < n; i++) {
+            double d = 0;
+            for (ChSparseMatrix::InnerIterator it(m_Z, i); it; ++it) {
+                if (it.col() < i) {
+                    m_L_col.push_back(it.col());
+                    m_L_val.push_back(it.value());
+                } else if (it.col() == i) {
+                    d = it.value();
+                }
+            }
+            m_L_start[i + 1] = (int)m_L_col.size();
+
+            // L(i,j) = (Z(i,j) - sum_k L(i,k) D(k) L(j,k)) / D(j), over the common pattern k < j of rows i and j
+            for (int p = m_L_start[i]; p < m_L_start[i + 1]; p++) {
+                int j = m_L_col[p];
+                double sum = m_L_val[p];
+                int q = m_L_start[j];
+                for (int r = m_L_start[i]; r < p; r++) {
+                    int k = m_L_col[r];
+                    while (q < m_L_start[j + 1] && m_L_col[q] < k)
+                        q++;
+                    if (q == m_L_start[j + 1])
+                        break;
+                    if (m_L_col[q] == k)
+                        sum -= m_L_val[r] * D[k] * m_L_val[q];
+                }
+                m_L_val[p] = sum / D[j];
+                d -= m_L_val[p] * m_L_val[p] * D[j];
+            }
+
+            if (std::abs(d) < 1e-12)
+                d = 1.0;
+            D[i] = d;
+            m_invD(i) = spd ? 1.0 / std::abs(d) : 1.0 / d;
+        }
+    }
+
+    // Solve L*D*L'*x = b, using the incomplete factorization.
+    void SolveILDLT(ChVectorConstRef b, ChVectorRef x) const {
+        int n = (int)m_N;
+        x = b;
+        for (int i = 0; i < n; i++) {
+            for (int p = m_L_start[i]; p < m_L_start[i + 1]; p++)
+                x(i) -= m_L_val[p] * x(m_L_col[p]);
+        }
+        x.array() *= m_invD.array();
+        for (int i = n - 1; i >= 0; i--) {
+            for (int p = m_L_start[i]; p < m_L_start[i + 1]; p++)
+                x(m_L_col[p]) -= m_L_val[p] * x(i);
+        }
+    }
+
+    struct Block {
+        unsigned int offset;  // offset of the variables in the system
+        unsigned int size;    // number of variables
+        size_t start;         // start of the inverse block in m_block_data
+    };
+
+    Type m_type;          // preconditioner type
+    Eigen::Index m_N;     // problem dimension
+    Eigen::Index m_nq;    // number of variables
+    ChSparseMatrix m_Z;   // assembled system matrix (workspace)
+
+    ChVectorDynamic<> m_invdiag;        // inverse diagonal (DIAGONAL) or inverse constraint diagonal (block types)
+    std::vector<Block> m_blocks;        // diagonal blocks of H
+    std::vector<double> m_block_data;   // inverse diagonal blocks of H
+    std::vector<int> m_var_block;       // block index of each variable
+
+    std::vector<int> m_L_start;         // start of each row of L (CSR format)
+    std::vector<int> m_L_col;           // column indices of L
+    std::vector<double> m_L_val;        // values of L
+    ChVectorDynamic<> m_invD;           // inverse pivots
+};
+
+// Adaptor for using a Chrono preconditioner with the Eigen iterative solvers.
+class ChEigenPreconditioner {
     typedef double Scalar;
 
   public:
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChEigenPreconditioner() : m_precond(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
-        m_N = N;
-        m_invdiag = &invdiag;
-        m_diag_precond = (invdiag.size() > 0);
-    }
+    void Setup(const ChPreconditionerLS* precond) { m_precond = precond; }
 
-    Eigen::Index rows() const { return m_N; }
-    Eigen::Index cols() const { return m_N; }
+    Eigen::Index rows() const { return m_precond ? m_precond->GetSize() : 0; }
+    Eigen::Index cols() const { return rows(); }
 
     template <typename MatType>
-    ChDiagonalPreconditioner& analyzePattern(const MatType&) {
+    ChEigenPreconditioner& analyzePattern(const MatType&) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& factorize(const MatType& mat) {
+    ChEigenPreconditioner& factorize(const MatType& mat) {
         return *this;
     }
     template <typename MatType>
-    ChDiagonalPreconditioner& compute(const MatType& mat) {
+    ChEigenPreconditioner& compute(const MatType& mat) {
         return *this;
     }
 
     template <typename Rhs, typename Dest>
     void _solve_impl(const Rhs& b, Dest& x) const {
-        if (m_diag_precond) {
-            x = m_invdiag->array() * b.array();
+        if (m_precond) {
+            x.resize(b.size());
+            m_precond->Apply(b, x);
         } else {
             x = b;
         }
     }
 
     template <typename Rhs>
-    inline const Eigen::Solve<ChDiagonalPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
-        return Eigen::Solve<ChDiagonalPreconditioner, Rhs>(*this, b.derived());
+    inline const Eigen::Solve<ChEigenPreconditioner, Rhs> solve(const Eigen::MatrixBase<Rhs>& b) const {
+        return Eigen::Solve<ChEigenPreconditioner, Rhs>(*this, b.derived());
     }
 
     Eigen::ComputationInfo info() { return Eigen::Success; }
 
   protected:
-    Eigen::Index m_N;                    // problem dimension
-    const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
-    bool m_diag_precond;                 // if false, no preconditioning
+    const ChPreconditionerLS* m_precond;  // pointer to preconditioner (no preconditioning if null)
 };
 
 }  // namespace chrono
@@ -172,12 +399,25 @@ CH_FACTORY_REGISTER(ChSolverGMRES)
 CH_FACTORY_REGISTER(ChSolverBiCGSTAB)
 CH_FACTORY_REGISTER(ChSolverMINRES)
 
-ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
+ChIterativeSolverLS::ChIterativeSolverLS()
+    : ChIterativeSolver(-1, -1.0, true, false),
+      m_precond_type(PreconditionerType::DIAGONAL),
+      m_precond_max_reuse(0),
+      m_precond_num_reuse(0),
+      m_precond_num_updates(0),
+      m_precond_force_update(false) {
     m_spmv = new ChMatrixSPMV();
+    m_precond = new ChPreconditionerLS();
 }
 
 ChIterativeSolverLS::~ChIterativeSolverLS() {
     delete m_spmv;
+    delete m_precond;
+}
+
+void ChIterativeSolverLS::SetPreconditioner(PreconditionerType type) {
+    m_precond_type = type;
+    m_use_precond = (type != PreconditionerType::NONE);
 }
 
 bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
@@ -187,16 +427,16 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     // Set up the SPMV wrapper
     m_spmv->Setup(dim, sysd);
 
-    // If needed, evaluate the inverse diagonal entries
-    if (m_use_precond) {
-        m_invdiag.resize(dim);
-        sysd.BuildDiagonalVector(m_invdiag);
-        for (int i = 0; i < dim; i++) {
-            if (std::abs(m_invdiag(i)) > 1e-9)
-                m_invdiag(i) = 1.0 / m_invdiag(i);
-            else
-                m_invdiag(i) = 1.0;
-        }
+    // Set up the preconditioner, unless the current one can be reused
+    auto type = m_use_precond ? m_precond_type : PreconditionerType::NONE;
+    if (m_precond_force_update || type != m_precond->GetType() || dim != m_precond->GetSize() ||
+        m_precond_num_reuse >= m_precond_max_reuse) {
+        m_precond->Setup(type, sysd, RequiresSPDPreconditioner());
+        m_precond_num_reuse = 0;
+        m_precond_num_updates++;
+        m_precond_force_update = false;
+    } else {
+        m_precond_num_reuse++;
     }
 
     // If needed, evaluate the initial guess
@@ -243,7 +483,7 @@ double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
 // ---------------------------------------------------------------------------
 
 ChSolverGMRES::ChSolverGMRES() {
-    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::GMRES<ChMatrixSPMV, ChEigenPreconditioner>();
 }
 
 ChSolverGMRES::~ChSolverGMRES() {
@@ -251,7 +491,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_precond);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -288,7 +528,7 @@ double ChSolverGMRES::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverBiCGSTAB::ChSolverBiCGSTAB() {
-    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::BiCGSTAB<ChMatrixSPMV, ChEigenPreconditioner>();
 }
 
 ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
@@ -296,7 +536,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_precond);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -334,7 +574,7 @@ double ChSolverBiCGSTAB::GetError() const {
 // ---------------------------------------------------------------------------
 
 ChSolverMINRES::ChSolverMINRES() {
-    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>();
+    m_engine = new Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChEigenPreconditioner>();
 }
 
 ChSolverMINRES::~ChSolverMINRES() {
@@ -342,7 +582,7 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_precond);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -15,7 +15,8 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a diagonal, block-Jacobi, incomplete LDL', or
+// constraint-aware block preconditioner.
 //
 // Available solvers:
 //   GMRES
@@ -30,6 +31,8 @@
 #include "chrono/solver/ChSolverLS.h"
 #include "chrono/solver/ChIterativeSolver.h"
 
+#include <algorithm>
+
 #include <Eigen/IterativeLinearSolvers>
 #include <unsupported/Eigen/IterativeSolvers>
 
@@ -40,9 +43,10 @@ namespace chrono {
 
 // ---------------------------------------------------------------------------
 
-// Forward declarations of wrapper class for SPMV operations and custom preconditioner
+// Forward declarations of wrapper class for SPMV operations and custom preconditioners
 class ChMatrixSPMV;
-class ChDiagonalPreconditioner;
+class ChPreconditionerLS;
+class ChEigenPreconditioner;
 
 // ---------------------------------------------------------------------------
 
@@ -63,11 +67,47 @@ residual error: |Ax - b|/|b|. Default: machine precision.
 
 By default, these solvers use a diagonal preconditioner and no warm start. Recall that the warm start option should
 be used **only** in conjunction with the Euler implicit linearized integrator.
+
+Stronger preconditioners can be selected with #SetPreconditioner, for problems (e.g., FEA with joints) for which the
+diagonal preconditioner leads to a large number of iterations. Their setup requires assembling the system matrix; to
+amortize this cost, a preconditioner can be reused for several solver setups (e.g., for all Newton iterations within a
+step), see #SetPreconditionerReuse.
 */
 class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
   public:
+    /// Preconditioner types.
+    /// With H=[M+K] the upper-left block of the system matrix and Cq the constraint Jacobian:
+    enum class PreconditionerType {
+        NONE,             ///< no preconditioning
+        DIAGONAL,         ///< inverse diagonal of the system matrix
+        BLOCK_JACOBI,     ///< inverse of the diagonal blocks of H (one per ChVariables), diagonal for constraints
+        ILDLT,            ///< incomplete LDL' factorization (no fill-in) of the assembled system matrix
+        CONSTRAINT_BLOCK  ///< block-Jacobi for H and diagonal of the Schur complement Cq*inv(H)*Cq' for constraints
+    };
+
     virtual ~ChIterativeSolverLS();
 
+    /// Set the preconditioner type (default: DIAGONAL).
+    /// Setting a type other than NONE also enables preconditioning (see EnableDiagonalPreconditioner).
+    void SetPreconditioner(PreconditionerType type);
+
+    /// Return the preconditioner type.
+    PreconditionerType GetPreconditioner() const { return m_precond_type; }
+
+    /// Set the number of subsequent solver setups for which the preconditioner is reused (default: 0).
+    /// The setups are counted regardless of step boundaries. For example, with a linearized integrator (one solver
+    /// setup per step), a value of N leads to one preconditioner update every N+1 steps. To obtain one update per step
+    /// with an integrator using a full Newton method, set a value larger than the maximum number of Newton iterations
+    /// and call ForcePreconditionerUpdate before each step. The preconditioner is always updated if the problem size
+    /// changes.
+    void SetPreconditionerReuse(int num_reuse) { m_precond_max_reuse = std::max(0, num_reuse); }
+
+    /// Force an update of the preconditioner at the next solver setup.
+    void ForcePreconditionerUpdate() { m_precond_force_update = true; }
+
+    /// Return the number of preconditioner updates so far.
+    int GetNumPreconditionerUpdates() const { return m_precond_num_updates; }
+
     /// Perform the solver setup operations.\n
     /// Here, sysd is the system description with constraints and variables.
     /// Returns true if successful and false otherwise.
@@ -94,11 +134,20 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     /// Load the solution vector (already of appropriate size) and return true if succesful.
     virtual bool SolveProblem() = 0;
 
+    /// Indicate whether or not the solver requires a symmetric positive definite preconditioner.
+    virtual bool RequiresSPDPreconditioner() const { return false; }
+
     ChMatrixSPMV* m_spmv;                 ///< matrix-like wrapper for SPMV operations
+    ChPreconditionerLS* m_precond;        ///< preconditioner
     ChVectorDynamic<double> m_sol;        ///< solution vector
     ChVectorDynamic<double> m_rhs;        ///< right-hand side vector
-    ChVectorDynamic<double> m_invdiag;    ///< inverse diagonal entries (for preconditioning)
     ChVectorDynamic<double> m_initguess;  ///< initial guess (for warm start)
+
+    PreconditionerType m_precond_type;  ///< preconditioner type
+    int m_precond_max_reuse;            ///< number of solver setups for which the preconditioner is reused
+    int m_precond_num_reuse;            ///< number of solver setups since the last preconditioner update
+    int m_precond_num_updates;          ///< number of preconditioner updates
+    bool m_precond_force_update;        ///< update the preconditioner at the next setup
 };
 
 // ---------------------------------------------------------------------------
@@ -119,7 +168,7 @@ class ChApi ChSolverGMRES : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::GMRES<ChMatrixSPMV, ChDiagonalPreconditioner>* m_engine;
+    Eigen::GMRES<ChMatrixSPMV, ChEigenPreconditioner>* m_engine;
 };
 
 // ---------------------------------------------------------------------------
@@ -139,7 +188,7 @@ class ChApi ChSolverBiCGSTAB : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::BiCGSTAB<ChMatrixSPMV, ChDiagonalPreconditioner>* m_engine;
+    Eigen::BiCGSTAB<ChMatrixSPMV, ChEigenPreconditioner>* m_engine;
 };
 
 // ---------------------------------------------------------------------------
@@ -160,7 +209,9 @@ class ChApi ChSolverMINRES : public ChIterativeSolverLS {
     virtual bool SetupProblem() override;
     virtual bool SolveProblem() override;
 
-    Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChDiagonalPreconditioner>* m_engine;
+    virtual bool RequiresSPDPreconditioner() const override { return true; }
+
+    Eigen::MINRES<ChMatrixSPMV, Eigen::Lower | Eigen::Upper, ChEigenPreconditioner>* m_engine;
 };
 
 /// @} chrono_solver
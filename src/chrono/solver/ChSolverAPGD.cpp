@@ -115,7 +115,6 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
 
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
-    ChVectorDynamic<> Minvk;
     sysd.FromVariablesToVector(Minvk, true);
 
     // (1) gamma_0 = zeros(nc,1)
@@ -51,6 +51,7 @@ class ChApi ChSolverAPGD : public ChIterativeSolverVI {
     double residual;
     int nc;
     ChVectorDynamic<> gamma_hat, gammaNew, g, y, gamma, yNew, r, tmp;
+    ChVectorDynamic<> Minvk;  ///< backup of M^-1 * k
 };
 
 /// @} chrono_solver
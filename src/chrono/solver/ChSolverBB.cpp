@@ -47,24 +47,24 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     double neg_BB2_fallback = 0.12;
 
     m_iterations = 0;
-    // Allocate auxiliary vectors;
+    // Size auxiliary vectors (no reallocation if the number of constraints did not change)
 
     int nc = sysd.CountActiveConstraints();
     if (verbose)
         std::cout << "\n-----Barzilai-Borwein, solving nc=" << nc << "unknowns" << std::endl;
 
-    ChVectorDynamic<> ml(nc);
-    ChVectorDynamic<> ml_candidate(nc);
-    ChVectorDynamic<> mg(nc);
-    ChVectorDynamic<> mg_p(nc);
-    ChVectorDynamic<> ml_p(nc);
-    ChVectorDynamic<> mdir(nc);
-    ChVectorDynamic<> mb(nc);
-    ChVectorDynamic<> mb_tmp(nc);
-    ChVectorDynamic<> ms(nc);
-    ChVectorDynamic<> my(nc);
-    ChVectorDynamic<> mD(nc);
-    ChVectorDynamic<> mDg(nc);
+    ml.resize(nc);
+    ml_candidate.resize(nc);
+    mg.resize(nc);
+    mg_p.resize(nc);
+    ml_p.resize(nc);
+    mdir.resize(nc);
+    mb.resize(nc);
+    mb_tmp.resize(nc);
+    ms.resize(nc);
+    my.resize(nc);
+    mD.resize(nc);
+    mDg.resize(nc);
 
     // Update auxiliary data in all constraints before starting,
     // that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
@@ -126,7 +126,6 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
 
     // Optimization: backup the  q  sparse data computed above,
     // because   (M^-1)*k   will be needed at the end when computing primals.
-    ChVectorDynamic<> mq;
     sysd.FromVariablesToVector(mq, true);
 
     // Initialize lambdas
@@ -155,7 +154,7 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
 
     double mf_p = 0;
     double mf = 1e29;
-    std::vector<double> f_hist;
+    f_hist.clear();
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // Dg = Di*g;
@@ -63,6 +63,22 @@ class ChApi ChSolverBB : public ChIterativeSolverVI {
     int n_armijo;
     int max_armijo_backtrace;
     double lastgoodres;
+
+    // Auxiliary vectors, kept across calls to Solve to avoid reallocations
+    ChVectorDynamic<> ml;
+    ChVectorDynamic<> ml_candidate;
+    ChVectorDynamic<> mg;
+    ChVectorDynamic<> mg_p;
+    ChVectorDynamic<> ml_p;
+    ChVectorDynamic<> mdir;
+    ChVectorDynamic<> mb;
+    ChVectorDynamic<> mb_tmp;
+    ChVectorDynamic<> ms;
+    ChVectorDynamic<> my;
+    ChVectorDynamic<> mD;
+    ChVectorDynamic<> mDg;
+    ChVectorDynamic<> mq;
+    std::vector<double> f_hist;
 };
 
 /// @} chrono_solver
@@ -75,7 +75,6 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
     // 4)  Perform the iteration loops
     //
 
-    std::vector<double> delta_gammas;
     delta_gammas.resize(mconstraints.size());
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
@@ -46,6 +46,7 @@ class ChApi ChSolverPJacobi : public ChIterativeSolverVI {
 
   private:
     double maxviolation;
+    std::vector<double> delta_gammas;  ///< auxiliary vector, kept across calls to Solve to avoid reallocations
 };
 
 /// @} chrono_solver
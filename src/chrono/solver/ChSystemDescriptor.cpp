@@ -18,6 +18,7 @@
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -27,7 +28,8 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : c_a(1.0), m_parallel_products(true), m_num_threads(1), n_q(0), n_c(0), freeze_count(false) {
     m_constraints.clear();
     m_variables.clear();
     m_KRMblocks.clear();
@@ -369,6 +371,22 @@ unsigned int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& m
     return n_q + n_c;
 }
 
+// Minimum number of constraints for evaluating the matrix-vector products in parallel
+static const size_t parallel_min_constraints = 256;
+
+int ChSystemDescriptor::GetNumThreadsProducts() const {
+    if (!m_parallel_products || m_num_threads == 1 || m_constraints.size() < parallel_min_constraints)
+        return 1;
+    return m_num_threads;
+}
+
+void ChSystemDescriptor::ResetThreadBuffers(int nthreads, unsigned int size) {
+    if (m_thread_buffers.size() < (size_t)nthreads)
+        m_thread_buffers.resize(nthreads);
+    for (int t = 0; t < nthreads; t++)
+        m_thread_buffers[t].setZero(size);
+}
+
 void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
                                                 const ChVectorDynamic<>& lvector,
                                                 std::vector<bool>* enabled) {
@@ -378,6 +396,12 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
 
     result.setZero(n_c);
 
+    int nthreads = GetNumThreadsProducts();
+    if (nthreads > 1) {
+        SchurComplementProductParallel(result, lvector, enabled, nthreads);
+        return;
+    }
+
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
     // in different phases:
 
@@ -389,11 +413,10 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     }
 
     // 2 - performs    qb=[M^(-1)][Cq']*l  by
-    //     iterating over all constraints (when implemented in parallel this
-    //     could be non-trivial because race conditions might occur -> reduction buffer etc.)
+    //     iterating over all constraints (see SchurComplementProductParallel for the parallel version,
+    //     which uses per-thread reduction buffers to avoid concurrent writes to the same q).
     //     Also, begin to add the cfm term ( -[E]*l ) to the result.
 
-    // ATTENTION:  this loop cannot be parallelized! Concurrent write to some q may happen
     for (const auto& constr : m_constraints) {
         if (constr->IsActive()) {
             int s_c = constr->GetOffset();
@@ -428,12 +451,73 @@ void ChSystemDescriptor::SchurComplementProduct(ChVectorDynamic<>& result,
     }
 }
 
+void ChSystemDescriptor::SchurComplementProductParallel(ChVectorDynamic<>& result,
+                                                        const ChVectorDynamic<>& lvector,
+                                                        std::vector<bool>* enabled,
+                                                        int nthreads) {
+    int num_constr = (int)m_constraints.size();
+    int num_var = (int)m_variables.size();
+
+    ResetThreadBuffers(nthreads, CountActiveVariables());
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        int nt = ChOMP::GetNumThreads();
+        auto& buffer = m_thread_buffers[ChOMP::GetThreadNum()];
+
+        // 1 - accumulate [Cq']*l in the thread buffer and set the cfm term ( -[E]*l ) in the result
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_constr; i++) {
+            auto constr = m_constraints[i];
+            if (constr->IsActive()) {
+                int s_c = constr->GetOffset();
+                if ((!enabled) || (*enabled)[s_c]) {
+                    double li = lvector(s_c);
+                    constr->AddJacobianTransposedTimesScalarInto(buffer, li);
+                    result(s_c) = constr->GetComplianceTerm() * li;
+                }
+            }
+        }
+
+        // 2 - reduce the thread buffers (in the first buffer) and compute qb=[M^(-1)][Cq']*l, per variable
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_var; i++) {
+            auto var = m_variables[i];
+            if (var->IsActive()) {
+                auto segment = m_thread_buffers[0].segment(var->GetOffset(), var->GetDOF());
+                for (int t = 1; t < nt; t++)
+                    segment += m_thread_buffers[t].segment(var->GetOffset(), var->GetDOF());
+                var->ComputeMassInverseTimesVector(var->State(), segment);
+            }
+        }
+
+        // 3 - result += [Cq]*qb (each constraint writes only its own entry)
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_constr; i++) {
+            auto constr = m_constraints[i];
+            if (constr->IsActive()) {
+                int s_c = constr->GetOffset();
+                if ((!enabled) || (*enabled)[s_c])
+                    result(s_c) += constr->ComputeJacobianTimesState();
+                else
+                    result(s_c) = 0;
+            }
+        }
+    }
+}
+
 void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) {
     n_q = CountActiveVariables();
     n_c = CountActiveConstraints();
 
     result.setZero(n_q + n_c);
 
+    int nthreads = GetNumThreadsProducts();
+    if (nthreads > 1) {
+        SystemProductParallel(result, x, nthreads);
+        return;
+    }
+
     // 1) First row: result.q part =  [M + K]*x.q + [Cq']*x.l
 
     // 1.1)  do  M*x.q
@@ -465,6 +549,56 @@ void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVector
     }
 }
 
+void ChSystemDescriptor::SystemProductParallel(ChVectorDynamic<>& result, const ChVectorDynamic<>& x, int nthreads) {
+    int num_constr = (int)m_constraints.size();
+    int num_var = (int)m_variables.size();
+    int num_krm = (int)m_KRMblocks.size();
+
+    ResetThreadBuffers(nthreads, n_q);
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        int nt = ChOMP::GetNumThreads();
+        auto& buffer = m_thread_buffers[ChOMP::GetThreadNum()];
+
+        // 1.1) accumulate K*x.q in the thread buffer (KRM blocks may share variables)
+#pragma omp for schedule(static) nowait
+        for (int i = 0; i < num_krm; i++)
+            m_KRMblocks[i]->AddMatrixTimesVectorInto(buffer, x);
+
+        // 1.2) accumulate [Cq]'*x.l in the thread buffer
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_constr; i++) {
+            auto constr = m_constraints[i];
+            if (constr->IsActive())
+                constr->AddJacobianTransposedTimesScalarInto(buffer, x(constr->GetOffset() + n_q));
+        }
+
+        // 1.3) result.q = M*x.q + reduction of the thread buffers, per variable
+#pragma omp for schedule(static) nowait
+        for (int i = 0; i < num_var; i++) {
+            auto var = m_variables[i];
+            if (var->IsActive()) {
+                var->AddMassTimesVectorInto(result, x, c_a);
+                auto segment = result.segment(var->GetOffset(), var->GetDOF());
+                for (int t = 0; t < nt; t++)
+                    segment += m_thread_buffers[t].segment(var->GetOffset(), var->GetDOF());
+            }
+        }
+
+        // 2) Second row: result.l part =  [C_q]*x.q + [E]*x.l (each constraint writes only its own entry)
+#pragma omp for schedule(static)
+        for (int i = 0; i < num_constr; i++) {
+            auto constr = m_constraints[i];
+            if (constr->IsActive()) {
+                int s_c = constr->GetOffset() + n_q;
+                constr->AddJacobianTimesVectorInto(result(s_c), x);
+                result(s_c) += constr->GetComplianceTerm() * x(s_c);
+            }
+        }
+    }
+}
+
 void ChSystemDescriptor::ConstraintsProject(ChVectorDynamic<>& multipliers) {
     FromVectorToConstraints(multipliers);
 
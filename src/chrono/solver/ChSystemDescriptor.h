@@ -15,6 +15,7 @@
 #ifndef CHSYSTEMDESCRIPTOR_H
 #define CHSYSTEMDESCRIPTOR_H
 
+#include <algorithm>
 #include <vector>
 
 #include "chrono/solver/ChConstraint.h"
@@ -90,6 +91,14 @@ class ChApi ChSystemDescriptor {
         m_KRMblocks.clear();
     }
 
+    /// Reserve storage for the given numbers of variables, constraints, and KRM blocks.
+    /// This avoids reallocations during insertion (e.g., when the number of contacts grows).
+    void Reserve(size_t num_variables, size_t num_constraints, size_t num_KRMblocks) {
+        m_variables.reserve(num_variables);
+        m_constraints.reserve(num_constraints);
+        m_KRMblocks.reserve(num_KRMblocks);
+    }
+
     /// Insert reference to a ChConstraint object.
     virtual void InsertConstraint(ChConstraint* mc) { m_constraints.push_back(mc); }
 
@@ -127,6 +136,23 @@ class ChApi ChSystemDescriptor {
     /// Get the c_a coefficient (default=1) used for scaling the M masses of the m_variables.
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of OpenMP threads used in SchurComplementProduct() and SystemProduct() (default: 1).
+    /// Set automatically by the owner ChSystem (see ChSystem::SetNumThreads).
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(1, num_threads); }
+
+    /// Get the number of OpenMP threads used in SchurComplementProduct() and SystemProduct().
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Enable/disable the parallel evaluation of SchurComplementProduct() and SystemProduct() (default: enabled).
+    /// Only used with more than one thread and for systems with a large enough number of constraints. The
+    /// contributions of constraints and KRM blocks are accumulated in per-thread buffers, which are then reduced per
+    /// variable. For a given number of threads the results are deterministic, but may differ from the serial products
+    /// by round-off errors.
+    void EnableParallelProducts(bool val) { m_parallel_products = val; }
+
+    /// Return true if the parallel evaluation of the matrix-vector products is enabled.
+    bool IsParallelProductsEnabled() const { return m_parallel_products; }
+
     /// Get a vector with all the 'fb' known terms associated to all variables, ordered into a column vector.
     /// The column vector must be passed as a ChMatrix<> object, which will be automatically reset and resized to the
     /// proper length if necessary.
@@ -372,6 +398,25 @@ class ChApi ChSystemDescriptor {
     double c_a;  ///< coefficient form M mass matrices in m_variables
 
   private:
+    /// Return the number of threads to use in the matrix-vector products (1 if these must be evaluated serially).
+    int GetNumThreadsProducts() const;
+
+    /// Parallel version of SchurComplementProduct(), using per-thread accumulation buffers.
+    void SchurComplementProductParallel(ChVectorDynamic<>& result,
+                                        const ChVectorDynamic<>& lvector,
+                                        std::vector<bool>* enabled,
+                                        int nthreads);
+
+    /// Parallel version of SystemProduct(), using per-thread accumulation buffers.
+    void SystemProductParallel(ChVectorDynamic<>& result, const ChVectorDynamic<>& x, int nthreads);
+
+    /// Resize and zero the per-thread accumulation buffers.
+    void ResetThreadBuffers(int nthreads, unsigned int size);
+
+    bool m_parallel_products;                         ///< enable parallel matrix-vector products
+    int m_num_threads;                                ///< number of threads for the matrix-vector products
+    std::vector<ChVectorDynamic<>> m_thread_buffers;  ///< per-thread accumulation buffers
+
     mutable unsigned int n_q;  ///< number of active variables
     mutable unsigned int n_c;  ///< number of active constraints
     bool freeze_count;         ///< cache the number of active variables and constraints
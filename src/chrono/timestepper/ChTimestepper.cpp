@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
@@ -68,6 +69,20 @@ void ChTimestepper::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+void ChTimestepperIIorder::IncrementX(ChState& x_new, const ChState& x, const ChStateDelta& v, double h) {
+    Dx = v;
+    Dx *= h;
+    x_new.resize(x.size());
+    static_cast<ChIntegrableIIorder*>(integrable)->StateIncrementX(x_new, x, Dx);
+}
+
+void ChTimestepperIIorder::IncrementX(ChState& x, const ChStateDelta& v, double h) {
+    Xtmp = x;
+    IncrementX(x, Xtmp, v, h);
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 CH_UPCASTING(ChTimestepperEulerExpl, ChTimestepperIorder)
@@ -407,6 +422,57 @@ void ChTimestepperLeapfrog::ArchiveIn(ChArchiveIn& archive) {
 
 // -----------------------------------------------------------------------------
 
+bool ChImplicitIterativeTimestepper::JacobianUpdateAtStepStart(double h, unsigned int nv, unsigned int nc) {
+    numsteps_total++;
+    contraction_rate_max = 0;
+    jacobian_current = false;
+
+    if (jacobian_update != JacobianUpdate::AUTOMATIC || !jacobian_valid)
+        return true;
+
+    // The Newton matrix depends on the step size and a stale factorization cannot be used for a different problem size
+    if (h != jacobian_h || nv != jacobian_nv || nc != jacobian_nc)
+        return true;
+
+    if (jacobian_max_age > 0 && jacobian_age >= jacobian_max_age)
+        return true;
+
+    return false;
+}
+
+void ChImplicitIterativeTimestepper::JacobianUpdated(double h, unsigned int nv, unsigned int nc) {
+    numsetups_total++;
+    jacobian_valid = true;
+    jacobian_current = true;
+    jacobian_age = 0;
+    jacobian_h = h;
+    jacobian_nv = nv;
+    jacobian_nc = nc;
+}
+
+bool ChImplicitIterativeTimestepper::JacobianUpdateOnContraction(unsigned int it, double nrm) {
+    if (it == 0) {
+        contraction_rate = 0;
+    } else if (correction_nrm > 0) {
+        contraction_rate = nrm / correction_nrm;
+        contraction_rate_max = std::max(contraction_rate_max, contraction_rate);
+    }
+    correction_nrm = nrm;
+
+    // Update a Newton matrix carried over from a previous step if the iteration does not contract fast enough
+    return jacobian_update == JacobianUpdate::AUTOMATIC && !jacobian_current && contraction_rate > jacobian_max_rate;
+}
+
+void ChImplicitIterativeTimestepper::JacobianStepDone() {
+    jacobian_age++;
+
+    // Do not carry a Newton matrix which led to slow convergence over to the next step
+    if (contraction_rate_max > jacobian_max_rate)
+        jacobian_valid = false;
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 CH_UPCASTING(ChTimestepperEulerImplicit, ChTimestepperIIorder)
@@ -433,7 +499,7 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
 
     // Extrapolate a prediction as warm start
 
-    Xnew = X + V * dt;
+    IncrementX(Xnew, X, V, dt);
     Vnew = V;  //+ A()*dt;
 
     // use Newton Raphson iteration to solve implicit Euler for v_new
@@ -445,13 +511,20 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    // Decide whether the Newton matrix from a previous step can be reused
+    unsigned int nv = mintegrable->GetNumCoordsVelLevel();
+    unsigned int nc = mintegrable->GetNumConstraints();
+    bool call_setup = JacobianUpdateAtStepStart(dt, nv, nc);
+
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R.setZero();
         Qc.setZero();
-        mintegrable->LoadResidual_F(R, dt);                // R  = dt*f
-        mintegrable->LoadResidual_Mv(R, (V - Vnew), 1.0);  // R += M*(v_old - v_new)
-        mintegrable->LoadResidual_CqL(R, L, dt);           // R += dt*Cq'*l
+        mintegrable->LoadResidual_F(R, dt);       // R  = dt*f
+        A = V;                                    // use A as workspace for v_old - v_new
+        A -= Vnew;                                //
+        mintegrable->LoadResidual_Mv(R, A, 1.0);  // R += M*(v_old - v_new)
+        mintegrable->LoadResidual_CqL(R, L, dt);  // R += dt*Cq'*l
         mintegrable->LoadConstraint_C(Qc, 1.0 / dt, Qc_do_clamp,
                                       Qc_clamping);  // Qc= C/dt  (sign flipped later in StateSolveCorrection)
 
@@ -470,23 +543,39 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, nv, nc);
+        }
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
 
         Vnew += Dv;
 
-        Xnew = X + Vnew * dt;
+        IncrementX(Xnew, X, Vnew, dt);
+
+        // Update the Newton matrix at the next iteration if not using modified Newton or if a reused matrix
+        // leads to slow convergence
+        call_setup = (jacobian_update == JacobianUpdate::EVERY_ITERATION);
+        if (JacobianUpdateOnContraction(i, Dv.norm())) {
+            if (verbose)
+                std::cout << " Euler update Newton matrix (contraction rate " << contraction_rate << ")" << std::endl;
+            call_setup = true;
+        }
     }
 
-    mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    JacobianStepDone();
+
+    A = Vnew;
+    A -= V;
+    A *= 1 / dt;
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
     X = Xnew;
     V = Vnew;
@@ -574,10 +663,12 @@ void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
 
     L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
-    mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    A = V;
+    A -= Vold;
+    A *= 1 / dt;
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
-    X += V * dt;
+    IncrementX(X, V, dt);
 
     T += dt;
 
@@ -655,10 +746,12 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
 
     L *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
-    mintegrable->StateScatterAcceleration(
-        (V - Vold) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    A = V;
+    A -= Vold;
+    A *= 1 / dt;
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
-    X += V * dt;
+    IncrementX(X, V, dt);
 
     T += dt;
 
@@ -691,7 +784,7 @@ void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
         true                            // force a call to the solver's Setup() function
     );
 
-    X += Vold;  // here we used 'Vold' as 'dpos' to recycle Vold and avoid allocating a new vector dpos
+    IncrementX(X, Vold, 1.0);  // here we used 'Vold' as 'dpos' to recycle Vold and avoid allocating a new vector dpos
 
     mintegrable->StateScatter(X, V, T, true);  // state -> system
 }
@@ -747,7 +840,7 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
 
     // extrapolate a prediction as a warm start
 
-    Xnew = X + V * dt;
+    IncrementX(Xnew, X, V, dt);
     Vnew = V;  // +A()*dt;
 
     // use Newton Raphson iteration to solve implicit trapezoidal for v_new
@@ -763,6 +856,11 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numsetups = 0;
     numsolves = 0;
 
+    // Decide whether the Newton matrix from a previous step can be reused
+    unsigned int nv = mintegrable->GetNumCoordsVelLevel();
+    unsigned int nc = mintegrable->GetNumConstraints();
+    bool call_setup = JacobianUpdateAtStepStart(dt, nv, nc);
+
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
         R = Rold;
@@ -788,23 +886,42 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
+            call_setup                      // call the solver's Setup?
         );
 
         numiters++;
-        numsetups++;
         numsolves++;
+        if (call_setup) {
+            numsetups++;
+            JacobianUpdated(dt, nv, nc);
+        }
 
         Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
 
         Vnew += Dv;
 
-        Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+        Dx = Vnew;  // Xnew = Xold + h/2(Vnew+Vold)
+        Dx += V;
+        IncrementX(Xnew, X, Dx, dt * 0.5);
+
+        // Update the Newton matrix at the next iteration if not using modified Newton or if a reused matrix
+        // leads to slow convergence
+        call_setup = (jacobian_update == JacobianUpdate::EVERY_ITERATION);
+        if (JacobianUpdateOnContraction(i, Dv.norm())) {
+            if (verbose)
+                std::cout << " Trapezoidal update Newton matrix (contraction rate " << contraction_rate << ")"
+                          << std::endl;
+            call_setup = true;
+        }
     }
 
-    mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    JacobianStepDone();
+
+    A = Vnew;
+    A -= V;
+    A *= 1 / dt;
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
     X = Xnew;
     V = Vnew;
@@ -861,7 +978,7 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
 
     // extrapolate a prediction as a warm start
 
-    Xnew = X + V * dt;
+    IncrementX(Xnew, X, V, dt);
     Vnew = V;
 
     // solve implicit trapezoidal for v_new
@@ -902,7 +1019,9 @@ void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
 
     Vnew += Dv;
 
-    Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+    Dx = Vnew;  // Xnew = Xold + h/2(Vnew+Vold)
+    Dx += V;
+    IncrementX(Xnew, X, Dx, dt * 0.5);
 
     X = Xnew;
     V = Vnew;
@@ -957,7 +1076,7 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
 
     // extrapolate a prediction as a warm start
 
-    Xnew = X + V * dt;
+    IncrementX(Xnew, X, V, dt);
     Vnew = V;
 
     // use Newton Raphson iteration to solve implicit trapezoidal for v_new
@@ -991,10 +1110,14 @@ void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
 
     L *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
 
-    X += ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
+    Dx = Vnew;  // Xnew = Xold + h/2(Vnew+Vold)
+    Dx += V;
+    IncrementX(X, Dx, dt * 0.5);
 
-    mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+    A = Vnew;
+    A -= V;
+    A *= 1 / dt;
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
     V = Vnew;
 
@@ -1066,7 +1189,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
     // extrapolate a prediction as a warm start
 
     Vnew = V;
-    Xnew = X + Vnew * dt;
+    IncrementX(Xnew, X, Vnew, dt);
 
     // use Newton Raphson iteration to solve implicit Newmark for a_new
 
@@ -1129,9 +1252,13 @@ void ChTimestepperNewmark::Advance(const double dt) {
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
 
-        Xnew = X + V * dt + A * (dt * dt * (0.5 - beta)) + Anew * (dt * dt * beta);
+        IncrementX(Xnew, X, V, dt);  // Xnew = X + V*dt + A*dt^2*(0.5-beta) + Anew*dt^2*beta
+        IncrementX(Xnew, A, dt * dt * (0.5 - beta));
+        IncrementX(Xnew, Anew, dt * dt * beta);
 
-        Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
+        Vnew = V;  // Vnew = V + A*dt*(1-gamma) + Anew*dt*gamma
+        Vnew += (dt * (1.0 - gamma)) * A;
+        Vnew += (dt * gamma) * Anew;
     }
 
     X = Xnew;
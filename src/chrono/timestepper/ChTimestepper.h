@@ -158,8 +158,21 @@ class ChApi ChTimestepperIIorder : public ChTimestepper {
         X.setZero(1, intgr);
         V.setZero(1, intgr);
         A.setZero(1, intgr);
+        Dx.setZero(1, intgr);
+        Xtmp.setZero(1, intgr);
     }
 
+  protected:
+    /// Compute x_new = x + v*h through the state increment of the integrable (e.g., for rotations).
+    /// Same as x_new = x + v * h, but without temporary vectors (no heap allocation once the workspaces are sized).
+    void IncrementX(ChState& x_new, const ChState& x, const ChStateDelta& v, double h);
+
+    /// Compute x = x + v*h in place, through the state increment of the integrable.
+    void IncrementX(ChState& x, const ChStateDelta& v, double h);
+
+    ChStateDelta Dx;  ///< workspace for position increments
+    ChState Xtmp;     ///< workspace for in-place position increments
+
   private:
     using ChTimestepper::SetIntegrable;
 };
@@ -230,8 +243,17 @@ class ChApi ChImplicitTimestepper {};
 /// Base properties for implicit solvers.
 /// Such integrators require solution of a nonlinear problem, typically solved
 /// using an iterative process, up to a desired tolerance. At each iteration,
-/// a linear system must be solved.
+/// a linear system must be solved. The Newton matrix (and hence the solver
+/// factorization) can be reused across iterations and steps (see SetJacobianUpdateMethod).
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Strategy for updating the Newton matrix (Jacobian) in the nonlinear solver.
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< full Newton: Jacobian updated at every iteration
+        EVERY_STEP,       ///< modified Newton: Jacobian updated once per step (or on convergence failure)
+        AUTOMATIC         ///< modified Newton: Jacobian reused across steps, updated when convergence slows down
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
@@ -242,9 +264,44 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    JacobianUpdate jacobian_update;     ///< Newton matrix update strategy
+    double jacobian_max_rate;           ///< contraction rate above which a reused Newton matrix is updated
+    unsigned int jacobian_max_age;      ///< maximum number of steps a Newton matrix is reused (0: unlimited)
+    bool jacobian_valid;                ///< is the solver set up with a Newton matrix from this timestepper?
+    bool jacobian_current;              ///< was the Newton matrix evaluated during the current step?
+    unsigned int jacobian_age;          ///< number of steps since the last Newton matrix update
+    double jacobian_h;                  ///< step size used in the last Newton matrix update
+    unsigned int jacobian_nv;           ///< number of velocity-level coordinates at the last Newton matrix update
+    unsigned int jacobian_nc;           ///< number of constraints at the last Newton matrix update
+    double contraction_rate;            ///< last estimate of the Newton contraction rate
+    double contraction_rate_max;        ///< largest contraction rate estimate in the current step
+    double correction_nrm;              ///< norm of the last Newton correction
+    unsigned long long numsteps_total;  ///< cumulative number of steps
+    unsigned long long numsetups_total; ///< cumulative number of calls to the solver's Setup function
+
   public:
     ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+        : maxiters(6),
+          reltol(1e-4),
+          abstolS(1e-10),
+          abstolL(1e-10),
+          numiters(0),
+          numsetups(0),
+          numsolves(0),
+          jacobian_update(JacobianUpdate::EVERY_ITERATION),
+          jacobian_max_rate(0.5),
+          jacobian_max_age(0),
+          jacobian_valid(false),
+          jacobian_current(false),
+          jacobian_age(0),
+          jacobian_h(0),
+          jacobian_nv(0),
+          jacobian_nc(0),
+          contraction_rate(0),
+          contraction_rate_max(0),
+          correction_nrm(0),
+          numsteps_total(0),
+          numsetups_total(0) {}
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -284,6 +341,50 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Set the strategy for updating the Newton matrix.
+    /// With JacobianUpdate::AUTOMATIC, the Newton matrix (and the solver factorization) is kept across steps and
+    /// only updated if the step size or the problem size changes, if the Newton iteration contracts slower than the
+    /// rate set with SetJacobianMaxContractionRate, or if the matrix is older than the limit set with
+    /// SetJacobianMaxAge. Supported by the Euler implicit, trapezoidal, and HHT timesteppers.
+    void SetJacobianUpdateMethod(JacobianUpdate method) { jacobian_update = method; }
+
+    /// Return the strategy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the largest acceptable contraction rate (ratio of successive Newton correction norms) when reusing an
+    /// out-of-date Newton matrix. Used with JacobianUpdate::AUTOMATIC.
+    /// Default: 0.5.
+    void SetJacobianMaxContractionRate(double rate) { jacobian_max_rate = rate; }
+
+    /// Set the maximum number of steps over which a Newton matrix can be reused (0 for no limit).
+    /// Used with JacobianUpdate::AUTOMATIC.
+    /// Default: 0.
+    void SetJacobianMaxAge(unsigned int steps) { jacobian_max_age = steps; }
+
+    /// Force an update of the Newton matrix at the next iteration.
+    /// Must be called if the solver was set up by a different analysis since the last step.
+    void ForceJacobianUpdate() { jacobian_valid = false; }
+
+    /// Return the last estimate of the Newton contraction rate (ratio of successive correction norms).
+    double GetContractionRate() const { return contraction_rate; }
+
+    /// Return the cumulative number of steps taken by this timestepper.
+    unsigned long long GetNumStepsTotal() const { return numsteps_total; }
+
+    /// Return the cumulative number of calls to the solver's Setup function.
+    unsigned long long GetNumSetupCallsTotal() const { return numsetups_total; }
+
+    /// Return the average number of calls to the solver's Setup function per step.
+    double GetNumSetupCallsPerStep() const {
+        return numsteps_total ? (double)numsetups_total / (double)numsteps_total : 0.0;
+    }
+
+    /// Reset the cumulative step and solver setup counters.
+    void ResetStatistics() {
+        numsteps_total = 0;
+        numsetups_total = 0;
+    }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) {
         // version number
@@ -305,6 +406,22 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         archive >> CHNVP(abstolS);
         archive >> CHNVP(abstolL);
     }
+
+  protected:
+    /// Return true if the Newton matrix must be updated at the beginning of a step of size h.
+    /// The matrix is updated at each step (EVERY_ITERATION and EVERY_STEP), or, for AUTOMATIC, if it was never
+    /// evaluated, if the step size or problem size changed, or if it is too old or contracted too slowly before.
+    bool JacobianUpdateAtStepStart(double h, unsigned int nv, unsigned int nc);
+
+    /// Record an update of the Newton matrix for a step of size h.
+    void JacobianUpdated(double h, unsigned int nv, unsigned int nc);
+
+    /// Update the contraction rate estimate with the norm of the Newton correction at iteration it.
+    /// Return true if an out-of-date Newton matrix should be updated at the next iteration (AUTOMATIC only).
+    bool JacobianUpdateOnContraction(unsigned int it, double nrm);
+
+    /// Record the end of a step.
+    void JacobianStepDone();
 };
 
 /// Euler explicit timestepper.
@@ -449,6 +566,8 @@ class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder, public ChExplic
 };
 
 /// Performs a step of Euler implicit for II order systems.
+/// By default, the Newton matrix is updated at each iteration; see SetJacobianUpdateMethod for modified Newton
+/// variants, possibly reusing the Newton matrix across steps.
 class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   protected:
     ChStateDelta Dv;
@@ -33,9 +33,9 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       step_decrease_factor(0.5),
       h_min(1e-10),
       h(1e6),
-      num_successful_steps(0),
-      modified_Newton(true) {
+      num_successful_steps(0) {
     SetAlpha(-0.2);  // default: some dissipation
+    SetJacobianUpdateMethod(JacobianUpdate::EVERY_STEP);
 }
 
 void ChTimestepperHHT::SetAlpha(double val) {
@@ -46,6 +46,9 @@ void ChTimestepperHHT::SetAlpha(double val) {
         alpha = 0;
     gamma = (1.0 - 2.0 * alpha) / 2.0;
     beta = pow((1.0 - alpha), 2) / 4.0;
+
+    // The Newton matrix depends on the method parameters
+    ForceJacobianUpdate();
 }
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
@@ -99,12 +102,13 @@ void ChTimestepperHHT::Advance(const double dt) {
 
     // Monitor flags controlling whther or not the Newton matrix must be updated.
     // If using modified Newton, a matrix update occurs:
-    //   - at the beginning of a step
+    //   - at the beginning of a step (unless reusing the matrix across steps)
     //   - on a stepsize decrease
-    //   - if the Newton iteration does not converge with an out-of-date matrix
+    //   - if the Newton iteration does not converge or converges slowly with an out-of-date matrix
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
-    call_setup = true;
+    unsigned int nv = mintegrable->GetNumCoordsVelLevel();
+    unsigned int nc = mintegrable->GetNumConstraints();
+    call_setup = JacobianUpdateAtStepStart(h, nv, nc);
 
     // Loop until reaching final time
     while (true) {
@@ -117,7 +121,7 @@ void ChTimestepperHHT::Advance(const double dt) {
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
@@ -128,10 +132,17 @@ void ChTimestepperHHT::Advance(const double dt) {
             numsolves++;
             if (call_setup) {
                 numsetups++;
+                JacobianUpdated(h, nv, nc);
             }
 
             // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            // (unless an out-of-date matrix leads to slow convergence)
+            call_setup = (jacobian_update == JacobianUpdate::EVERY_ITERATION);
+            if (JacobianUpdateOnContraction(it, Da.norm())) {
+                if (verbose)
+                    std::cout << " HHT update Newton matrix (contraction rate " << contraction_rate << ")" << std::endl;
+                call_setup = true;
+            }
 
             // Check convergence
             converged = CheckConvergence(it);
@@ -166,20 +177,18 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+        } else if (!jacobian_current) {
+            // ------ NR did not converge but the matrix was carried over from a previous step
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // re-attempt step with updated matrix
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
-                call_setup = true;
-            */
+            call_setup = true;
 
         } else if (!step_control) {
             // ------ NR did not converge and we do not control stepsize
@@ -233,6 +242,8 @@ void ChTimestepperHHT::Advance(const double dt) {
         Anew.setZero(mintegrable->GetNumCoordsVelLevel(), mintegrable);
     }
 
+    JacobianStepDone();
+
     // Scatter state -> system doing a full update
     mintegrable->StateScatter(X, V, T, true);
 
@@ -250,8 +261,10 @@ void ChTimestepperHHT::Advance(const double dt) {
 void ChTimestepperHHT::Prepare(ChIntegrableIIorder* integrable) {
     if (step_control)
         Anew = A;
-    Vnew = V + Anew * h;
-    Xnew = X + Vnew * h + Anew * (h * h);
+    Vnew = V;  // Vnew = V + Anew*h
+    Vnew += h * Anew;
+    IncrementX(Xnew, X, Vnew, h);  // Xnew = X + Vnew*h + Anew*h^2
+    IncrementX(Xnew, Anew, h * h);
     integrable->LoadResidual_F(Rold, -alpha / (1.0 + alpha));       // -alpha/(1.0+alpha) * f_old
     integrable->LoadResidual_CqL(Rold, L, -alpha / (1.0 + alpha));  // -alpha/(1.0+alpha) * Cq'*l_old
     CalcErrorWeights(A, reltol, abstolS, ewtS);
@@ -304,11 +317,12 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable) {
     // Update estimate of state at t+h
     Lnew += Dl;  // not -= Dl because we assume StateSolveCorrection flips sign of Dl
     Anew += Da;
-    Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
-    Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
-
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
+    IncrementX(Xnew, X, V, h);  // Xnew = X + V*h + A*h^2*(0.5-beta) + Anew*h^2*beta
+    IncrementX(Xnew, A, h * h * (0.5 - beta));
+    IncrementX(Xnew, Anew, h * h * beta);
+    Vnew = V;  // Vnew = V + A*h*(1-gamma) + Anew*h*gamma
+    Vnew += (h * (1.0 - gamma)) * A;
+    Vnew += (h * gamma) * Anew;
 }
 
 // Convergence test
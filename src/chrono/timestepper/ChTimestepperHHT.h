@@ -24,7 +24,8 @@ namespace chrono {
 
 /// Implementation of the HHT implicit integrator for II order systems.
 /// This timestepper allows use of an adaptive time-step, as well as optional use of a modified
-/// Newton scheme for the solution of the resulting nonlinear problem.
+/// Newton scheme for the solution of the resulting nonlinear problem, possibly reusing the Newton
+/// matrix across steps (see SetJacobianUpdateMethod).
 class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
   public:
     ChTimestepperHHT(ChIntegrableIIorder* intgr = nullptr);
@@ -72,8 +73,12 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
+    /// This is equivalent to SetJacobianUpdateMethod with JacobianUpdate::EVERY_STEP (enabled)
+    /// or JacobianUpdate::EVERY_ITERATION (disabled).
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    void SetModifiedNewton(bool enable) {
+        SetJacobianUpdateMethod(enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION);
+    }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -123,9 +128,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double h;                           ///< internal stepsize
     unsigned int num_successful_steps;  ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
-    bool call_setup;         ///< should the solver's Setup function be called?
+    bool call_setup;  ///< should the solver's Setup function be called?
 
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
@@ -20,8 +20,14 @@
 #ifndef CH_BENCHMARK_H
 #define CH_BENCHMARK_H
 
+#include <algorithm>
+#include <string>
+
 #include "chrono_thirdparty/googlebenchmark/include/benchmark/benchmark.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/solver/ChSolverADMM.h"
 
 namespace chrono {
 namespace utils {
@@ -183,6 +189,183 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
     TEST* m_test;
 };
 
+// =============================================================================
+
+/// Return the name of the specified solver type.
+inline std::string GetSolverTypeName(ChSolver::Type type) {
+    switch (type) {
+        case ChSolver::Type::PSOR:
+            return "PSOR";
+        case ChSolver::Type::PSSOR:
+            return "PSSOR";
+        case ChSolver::Type::PJACOBI:
+            return "PJACOBI";
+        case ChSolver::Type::PMINRES:
+            return "PMINRES";
+        case ChSolver::Type::BARZILAIBORWEIN:
+            return "BARZILAIBORWEIN";
+        case ChSolver::Type::APGD:
+            return "APGD";
+        case ChSolver::Type::ADMM:
+            return "ADMM";
+        case ChSolver::Type::SPARSE_LU:
+            return "SPARSE_LU";
+        case ChSolver::Type::SPARSE_QR:
+            return "SPARSE_QR";
+        case ChSolver::Type::PARDISO_MKL:
+            return "PARDISO_MKL";
+        case ChSolver::Type::MUMPS:
+            return "MUMPS";
+        case ChSolver::Type::GMRES:
+            return "GMRES";
+        case ChSolver::Type::MINRES:
+            return "MINRES";
+        case ChSolver::Type::BICGSTAB:
+            return "BICGSTAB";
+        default:
+            return "CUSTOM";
+    }
+}
+
+/// Return the name of the specified timestepper type.
+inline std::string GetTimestepperTypeName(ChTimestepper::Type type) {
+    switch (type) {
+        case ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED:
+            return "EULER_IMPLICIT_LINEARIZED";
+        case ChTimestepper::Type::EULER_IMPLICIT_PROJECTED:
+            return "EULER_IMPLICIT_PROJECTED";
+        case ChTimestepper::Type::EULER_IMPLICIT:
+            return "EULER_IMPLICIT";
+        case ChTimestepper::Type::TRAPEZOIDAL:
+            return "TRAPEZOIDAL";
+        case ChTimestepper::Type::TRAPEZOIDAL_LINEARIZED:
+            return "TRAPEZOIDAL_LINEARIZED";
+        case ChTimestepper::Type::HHT:
+            return "HHT";
+        case ChTimestepper::Type::HEUN:
+            return "HEUN";
+        case ChTimestepper::Type::RUNGEKUTTA45:
+            return "RUNGEKUTTA45";
+        case ChTimestepper::Type::EULER_EXPLICIT:
+            return "EULER_EXPLICIT";
+        case ChTimestepper::Type::LEAPFROG:
+            return "LEAPFROG";
+        case ChTimestepper::Type::NEWMARK:
+            return "NEWMARK";
+        default:
+            return "CUSTOM";
+    }
+}
+
+/// Set a solver and a timestepper of the specified types for the given system.
+/// Iterative solvers are set to perform at most the specified number of iterations. Solver types which cannot be
+/// created through ChSystem::SetSolverType (ADMM and BiCGSTAB) are created here; external solvers (Pardiso MKL and
+/// MUMPS) are not supported. The HHT timestepper is set to use a fixed step size (no step size control), so that all
+/// combinations advance the system with the same steps.
+inline void SetSolverAndTimestepper(ChSystem& sys,
+                                    ChSolver::Type solver_type,
+                                    ChTimestepper::Type timestepper_type,
+                                    int max_iterations = 100) {
+    switch (solver_type) {
+        case ChSolver::Type::ADMM:
+            sys.SetSolver(chrono_types::make_shared<ChSolverADMM>());
+            break;
+        case ChSolver::Type::BICGSTAB:
+            sys.SetSolver(chrono_types::make_shared<ChSolverBiCGSTAB>());
+            break;
+        default:
+            sys.SetSolverType(solver_type);
+            break;
+    }
+    if (auto solver = std::dynamic_pointer_cast<ChIterativeSolver>(sys.GetSolver()))
+        solver->SetMaxIterations(max_iterations);
+
+    sys.SetTimestepperType(timestepper_type);
+    if (auto integrator = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper()))
+        integrator->SetStepControl(false);
+}
+
+/// Per-step statistics of a simulation, for benchmarks of solver and timestepper combinations.
+/// Statistics are accumulated after each step and reported as benchmark counters, averaged over the steps: times (ms)
+/// of the simulation phases, numbers of solver iterations (of the last solve in a step) and of nonlinear iterations and
+/// solver setups (for implicit iterative timesteppers), and problem size. The residual of the last solve (the error
+/// reported by iterative solvers, or the norm of the linear system residual for direct solvers) is also reported.
+class ChBenchmarkStats {
+  public:
+    ChBenchmarkStats() { Reset(); }
+
+    /// Reset the accumulated statistics.
+    void Reset() {
+        m_num_steps = 0;
+        m_timer_step = 0;
+        m_timer_collision = 0;
+        m_timer_update = 0;
+        m_timer_jacobian = 0;
+        m_timer_ls_setup = 0;
+        m_timer_ls_solve = 0;
+        m_ls_iterations = 0;
+        m_nl_iterations = 0;
+        m_nl_setups = 0;
+    }
+
+    /// Accumulate statistics for the last step of the given system.
+    void Accumulate(ChSystem& sys) {
+        m_num_steps++;
+        m_timer_step += sys.GetTimerStep();
+        m_timer_collision += sys.GetTimerCollision();
+        m_timer_update += sys.GetTimerUpdate();
+        m_timer_jacobian += sys.GetTimerJacobian();
+        m_timer_ls_setup += sys.GetTimerLSsetup();
+        m_timer_ls_solve += sys.GetTimerLSsolve();
+        if (auto solver = std::dynamic_pointer_cast<ChIterativeSolver>(sys.GetSolver()))
+            m_ls_iterations += solver->GetIterations();
+        if (auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper())) {
+            m_nl_iterations += integrator->GetNumIterations();
+            m_nl_setups += integrator->GetNumSetupCalls();
+        }
+    }
+
+    /// Report the per-step statistics as counters of the given benchmark state.
+    void Report(ChSystem& sys, benchmark::State& st) const {
+        double n = (double)std::max(m_num_steps, 1);
+        st.counters["Step"] = 1e3 * m_timer_step / n;
+        st.counters["CD"] = 1e3 * m_timer_collision / n;
+        st.counters["Update"] = 1e3 * m_timer_update / n;
+        st.counters["LS_Jacobian"] = 1e3 * m_timer_jacobian / n;
+        st.counters["LS_Setup"] = 1e3 * m_timer_ls_setup / n;
+        st.counters["LS_Solve"] = 1e3 * m_timer_ls_solve / n;
+        st.counters["LS_Iterations"] = m_ls_iterations / n;
+        st.counters["LS_Residual"] = GetResidual(sys);
+        st.counters["NL_Iterations"] = m_nl_iterations / n;
+        st.counters["NL_Setups"] = m_nl_setups / n;
+        st.counters["Num_Coords"] = sys.GetNumCoordsVelLevel();
+        st.counters["Num_Constraints"] = sys.GetNumConstraints();
+        st.counters["Num_Contacts"] = sys.GetNumContacts();
+    }
+
+  private:
+    static double GetResidual(ChSystem& sys) {
+        if (auto solver = std::dynamic_pointer_cast<ChIterativeSolver>(sys.GetSolver()))
+            return solver->GetError();
+        if (auto solver = std::dynamic_pointer_cast<ChDirectSolverLS>(sys.GetSolver())) {
+            if (solver->x().size() > 0 && solver->A().cols() == solver->x().size())
+                return (solver->A() * solver->x() - solver->b()).norm();
+        }
+        return 0;
+    }
+
+    int m_num_steps;
+    double m_timer_step;
+    double m_timer_collision;
+    double m_timer_update;
+    double m_timer_jacobian;
+    double m_timer_ls_setup;
+    double m_timer_ls_solve;
+    double m_ls_iterations;
+    double m_nl_iterations;
+    double m_nl_setups;
+};
+
 /// @} chrono_utils
 
 }  // end namespace utils
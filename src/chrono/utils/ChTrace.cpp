@@ -0,0 +1,212 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <utility>
+
+#if defined(__GNUG__)
+    #include <cxxabi.h>
+#endif
+
+#include "chrono/utils/ChTrace.h"
+
+namespace chrono {
+namespace utils {
+
+// Unique identifiers of trace objects (used to find the thread buffers of a trace, even if it is allocated at the
+// address of a deleted one)
+static std::atomic<uint64_t> trace_counter(0);
+
+// Thread buffers of the calling thread, for all traces it recorded events in
+struct ThreadBufferCache {
+    std::vector<std::pair<uint64_t, void*>> entries;
+};
+static thread_local ThreadBufferCache thread_cache;
+
+// Return a readable name for the event (type names of individual items are demangled)
+static std::string EventName(const char* name, const char* category) {
+#if defined(__GNUG__)
+    if (std::strcmp(category, ChTrace::ItemsCategory()) == 0) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+        if (status == 0 && demangled) {
+            std::string result(demangled);
+            std::free(demangled);
+            return result;
+        }
+    }
+#endif
+    return std::string(name);
+}
+
+// Escape a string for output in JSON
+static std::string EscapeJSON(const std::string& str) {
+    std::string result;
+    for (char c : str) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+ChTrace::ChTrace(size_t capacity)
+    : m_id(++trace_counter),
+      m_capacity(std::max<size_t>(capacity, 1)),
+      m_enabled(false),
+      m_items(false),
+      m_origin(std::chrono::steady_clock::now()) {}
+
+ChTrace::~ChTrace() {}
+
+ChTrace::ThreadBuffer* ChTrace::GetThreadBuffer() {
+    for (const auto& entry : thread_cache.entries) {
+        if (entry.first == m_id)
+            return static_cast<ThreadBuffer*>(entry.second);
+    }
+
+    // First event recorded by this thread: allocate its buffer
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->thread = (int)m_buffers.size();
+    buffer->count = 0;
+    buffer->dropped = 0;
+    buffer->events.resize(m_capacity);
+    m_buffers.push_back(std::move(buffer));
+    thread_cache.entries.push_back({m_id, m_buffers.back().get()});
+
+    return m_buffers.back().get();
+}
+
+void ChTrace::Record(const char* name, const char* category, int64_t start, int64_t duration) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    if (buffer->count == m_capacity) {
+        buffer->dropped++;
+        return;
+    }
+    buffer->events[buffer->count++] = {name, category, start, duration};
+}
+
+void ChTrace::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& buffer : m_buffers) {
+        buffer->count = 0;
+        buffer->dropped = 0;
+    }
+    m_origin = std::chrono::steady_clock::now();
+}
+
+int ChTrace::GetNumThreads() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (int)m_buffers.size();
+}
+
+std::vector<ChTraceEvent> ChTrace::GetEvents(int thread) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto& buffer = m_buffers[thread];
+    return std::vector<ChTraceEvent>(buffer->events.begin(), buffer->events.begin() + buffer->count);
+}
+
+size_t ChTrace::GetNumEvents() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t num = 0;
+    for (const auto& buffer : m_buffers)
+        num += buffer->count;
+    return num;
+}
+
+size_t ChTrace::GetNumDroppedEvents() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t num = 0;
+    for (const auto& buffer : m_buffers)
+        num += buffer->dropped;
+    return num;
+}
+
+std::vector<ChTrace::Summary> ChTrace::GetSummary() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Group events by (category, name), comparing the string contents
+    std::map<std::pair<std::string, std::string>, Summary> groups;
+    for (const auto& buffer : m_buffers) {
+        for (size_t i = 0; i < buffer->count; i++) {
+            const auto& event = buffer->events[i];
+            auto& summary = groups[{event.category, event.name}];
+            if (summary.count == 0) {
+                summary.category = event.category;
+                summary.name = EventName(event.name, event.category);
+                summary.total = 0;
+                summary.max = 0;
+            }
+            double duration = 1e-9 * event.duration;
+            summary.count++;
+            summary.total += duration;
+            summary.max = std::max(summary.max, duration);
+        }
+    }
+
+    std::vector<Summary> result;
+    for (const auto& group : groups)
+        result.push_back(group.second);
+    std::sort(result.begin(), result.end(), [](const Summary& a, const Summary& b) { return a.total > b.total; });
+
+    return result;
+}
+
+void ChTrace::PrintSummary(std::ostream& os) const {
+    os << std::left << std::setw(16) << "category" << std::setw(40) << "name" << std::right << std::setw(10)
+       << "count" << std::setw(14) << "total [ms]" << std::setw(14) << "mean [us]" << std::setw(14) << "max [us]"
+       << std::endl;
+    for (const auto& summary : GetSummary()) {
+        os << std::left << std::setw(16) << summary.category << std::setw(40) << summary.name << std::right
+           << std::setw(10) << summary.count << std::fixed << std::setprecision(3) << std::setw(14)
+           << 1e3 * summary.total << std::setw(14) << 1e6 * summary.total / summary.count << std::setw(14)
+           << 1e6 * summary.max << std::defaultfloat << std::endl;
+    }
+}
+
+bool ChTrace::WriteChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open())
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    file << "{\"traceEvents\":[\n";
+    file << std::fixed << std::setprecision(3);
+    bool first = true;
+    for (const auto& buffer : m_buffers) {
+        // Thread name metadata
+        file << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->thread
+             << ",\"args\":{\"name\":\"thread " << buffer->thread << "\"}}";
+        first = false;
+
+        // Complete events (timestamps and durations in microseconds)
+        for (size_t i = 0; i < buffer->count; i++) {
+            const auto& event = buffer->events[i];
+            file << ",\n{\"name\":\"" << EscapeJSON(EventName(event.name, event.category)) << "\",\"cat\":\""
+                 << EscapeJSON(event.category) << "\",\"ph\":\"X\",\"ts\":" << 1e-3 * event.start
+                 << ",\"dur\":" << 1e-3 * event.duration << ",\"pid\":0,\"tid\":" << buffer->thread << "}";
+        }
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    return file.good();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
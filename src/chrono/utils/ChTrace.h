@@ -0,0 +1,177 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Low-overhead recording of timed events (simulation phases and item
+// categories), with export to the Chrome trace event format.
+//
+// ChTrace
+//  collects events in pre-allocated per-thread buffers (recording is
+//  lock-free), summarizes them, and writes a JSON timeline which can be
+//  loaded in chrome://tracing or https://ui.perfetto.dev.
+//
+// ChTraceScope
+//  records an event spanning its lifetime, if the trace is enabled.
+//
+// =============================================================================
+
+#ifndef CH_TRACE_H
+#define CH_TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Timed event recorded by a ChTrace.
+struct ChTraceEvent {
+    const char* name;      ///< event name (static storage)
+    const char* category;  ///< event category (static storage)
+    int64_t start;         ///< start time, in nanoseconds since the trace origin
+    int64_t duration;      ///< duration, in nanoseconds
+};
+
+/// Low-overhead recorder of timed events.
+/// Each thread records events in its own pre-allocated buffer, without locking and without memory allocation; events
+/// are dropped if a buffer is full. Event names and categories must point to static storage (e.g., string literals or
+/// std::type_info names, which are demangled on output). Querying and output functions must not be called while
+/// events are being recorded.
+class ChApi ChTrace {
+  public:
+    /// Summary statistics of the events with the same category and name.
+    struct Summary {
+        std::string category;  ///< event category
+        std::string name;      ///< event name
+        size_t count;          ///< number of events
+        double total;          ///< total duration (seconds)
+        double max;            ///< maximum duration (seconds)
+    };
+
+    /// Category of the events recorded for individual physics items.
+    /// The names of these events are type names (std::type_info::name), demangled on output.
+    static constexpr const char* ItemsCategory() { return "items"; }
+
+    /// Create a trace recorder with the given capacity (number of events) of each thread buffer.
+    ChTrace(size_t capacity = 100000);
+
+    ~ChTrace();
+
+    /// Enable/disable recording of events (default: disabled).
+    void Enable(bool val) { m_enabled.store(val, std::memory_order_relaxed); }
+
+    /// Return true if events are recorded.
+    bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Enable/disable recording of individual physics items (default: disabled).
+    /// If disabled, only simulation phases and categories of items (bodies, links, etc.) are recorded.
+    void EnableItems(bool val) { m_items = val; }
+
+    /// Return true if individual physics items are recorded.
+    bool IsItemsEnabled() const { return m_items && IsEnabled(); }
+
+    /// Remove all recorded events and reset the time origin.
+    void Clear();
+
+    /// Current time, in nanoseconds since the trace origin.
+    int64_t Now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_origin)
+            .count();
+    }
+
+    /// Record an event in the buffer of the calling thread.
+    void Record(const char* name, const char* category, int64_t start, int64_t duration);
+
+    /// Return the number of threads which recorded events.
+    int GetNumThreads() const;
+
+    /// Return the events recorded by the specified thread.
+    std::vector<ChTraceEvent> GetEvents(int thread) const;
+
+    /// Return the total number of recorded events.
+    size_t GetNumEvents() const;
+
+    /// Return the number of events dropped because of full buffers.
+    size_t GetNumDroppedEvents() const;
+
+    /// Return summary statistics of the recorded events, sorted by decreasing total duration.
+    std::vector<Summary> GetSummary() const;
+
+    /// Print summary statistics of the recorded events.
+    void PrintSummary(std::ostream& os) const;
+
+    /// Write the recorded events in the Chrome trace event format (JSON).
+    /// Return false if the file cannot be opened.
+    bool WriteChromeTrace(const std::string& filename) const;
+
+  private:
+    struct ThreadBuffer {
+        int thread;
+        size_t count;
+        size_t dropped;
+        std::vector<ChTraceEvent> events;
+    };
+
+    ThreadBuffer* GetThreadBuffer();
+
+    uint64_t m_id;
+    size_t m_capacity;
+    std::atomic<bool> m_enabled;
+    bool m_items;
+    std::chrono::steady_clock::time_point m_origin;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+/// Scoped recording of an event in a ChTrace.
+/// The event spans the lifetime of this object. Nothing is recorded (and the cost is that of a test) if the trace is
+/// null or disabled.
+class ChTraceScope {
+  public:
+    ChTraceScope(ChTrace* trace, const char* name, const char* category)
+        : m_trace((trace && trace->IsEnabled()) ? trace : nullptr), m_name(name), m_category(category), m_start(0) {
+        if (m_trace)
+            m_start = m_trace->Now();
+    }
+
+    ~ChTraceScope() {
+        if (m_trace)
+            m_trace->Record(m_name, m_category, m_start, m_trace->Now() - m_start);
+    }
+
+    ChTraceScope(const ChTraceScope&) = delete;
+    ChTraceScope& operator=(const ChTraceScope&) = delete;
+
+  private:
+    ChTrace* m_trace;
+    const char* m_name;
+    const char* m_category;
+    int64_t m_start;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
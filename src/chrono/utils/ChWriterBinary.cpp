@@ -0,0 +1,598 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// File layout (native byte order):
+//   header: magic "CHRECS" and format version (uint32), followed by blocks
+//   layout: marker "CHLY" (uint32), number of columns (uint32), and for each
+//           column the length (uint32) and characters of its name
+//   chunks: marker "CHNK" (uint32), number of records (uint32), stored size of
+//           each column (uint32), codec of each column (uint8), followed by the
+//           stored data of each column
+// A layout block precedes the first chunk and applies to all following chunks,
+// up to the next layout block.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+
+#include "chrono/utils/ChWriterBinary.h"
+
+namespace chrono {
+namespace utils {
+
+static const char binary_magic[8] = "CHRECS";
+static const uint32_t binary_version = 2;
+static const uint32_t layout_marker = 0x594C4843;  // "CHLY"
+static const uint32_t chunk_marker = 0x4B4E4843;   // "CHNK"
+
+// Codecs for the data of a column
+enum ColumnCodec : unsigned char {
+    CODEC_RAW = 0,     // uncompressed values
+    CODEC_XOR_RLE = 1  // XOR with previous value, byte planes, run-length encoding
+};
+
+// -----------------------------------------------------------------------------
+// Column compression
+// -----------------------------------------------------------------------------
+
+// Run-length encoding of a byte sequence. A control byte c < 128 is followed by c+1 literal bytes; a control byte
+// c >= 128 is followed by a single byte to be repeated c-125 times (3 to 130 times).
+static void EncodeRLE(const unsigned char* in, size_t n, std::vector<unsigned char>& out) {
+    out.clear();
+    size_t i = 0;
+    size_t literal_start = 0;
+    auto flush_literals = [&](size_t end) {
+        while (literal_start < end) {
+            size_t len = std::min<size_t>(end - literal_start, 128);
+            out.push_back((unsigned char)(len - 1));
+            out.insert(out.end(), in + literal_start, in + literal_start + len);
+            literal_start += len;
+        }
+    };
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < 130 && in[i + run] == in[i])
+            run++;
+        if (run >= 3) {
+            flush_literals(i);
+            out.push_back((unsigned char)(run + 125));
+            out.push_back(in[i]);
+            i += run;
+            literal_start = i;
+        } else {
+            i += run;
+        }
+    }
+    flush_literals(n);
+}
+
+// Decode a run-length encoded sequence of exactly n bytes. Return false if the input is malformed.
+static bool DecodeRLE(const unsigned char* in, size_t size, unsigned char* out, size_t n) {
+    size_t i = 0;
+    size_t o = 0;
+    while (i < size) {
+        unsigned char c = in[i++];
+        if (c < 128) {
+            size_t len = (size_t)c + 1;
+            if (i + len > size || o + len > n)
+                return false;
+            std::memcpy(out + o, in + i, len);
+            i += len;
+            o += len;
+        } else {
+            size_t len = (size_t)c - 125;
+            if (i >= size || o + len > n)
+                return false;
+            std::memset(out + o, in[i++], len);
+            o += len;
+        }
+    }
+    return o == n;
+}
+
+// Compress the n values of a column. Consecutive values are XOR-ed, so that the (identical) sign, exponent, and
+// leading mantissa bits of slowly varying values become zero, and the bytes of the results are grouped in planes (all
+// first bytes, then all second bytes, etc.) to create long runs for the run-length encoding.
+// Return the codec used (the values are stored uncompressed if that is smaller).
+static ColumnCodec CompressColumn(const double* values,
+                                  size_t n,
+                                  std::vector<unsigned char>& work,
+                                  std::vector<unsigned char>& out) {
+    work.resize(8 * n);
+    uint64_t prev = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t bits;
+        std::memcpy(&bits, &values[i], 8);
+        uint64_t delta = bits ^ prev;
+        prev = bits;
+        for (size_t k = 0; k < 8; k++)
+            work[k * n + i] = (unsigned char)(delta >> (8 * k));
+    }
+    EncodeRLE(work.data(), work.size(), out);
+
+    if (out.size() < 8 * n)
+        return CODEC_XOR_RLE;
+
+    out.resize(8 * n);
+    std::memcpy(out.data(), values, 8 * n);
+    return CODEC_RAW;
+}
+
+// Decompress the n values of a column. Return false if the data is malformed.
+static bool DecompressColumn(unsigned char codec,
+                             const std::vector<unsigned char>& in,
+                             size_t n,
+                             std::vector<unsigned char>& work,
+                             double* values) {
+    switch (codec) {
+        case CODEC_RAW:
+            if (in.size() != 8 * n)
+                return false;
+            std::memcpy(values, in.data(), 8 * n);
+            return true;
+        case CODEC_XOR_RLE: {
+            work.resize(8 * n);
+            if (!DecodeRLE(in.data(), in.size(), work.data(), work.size()))
+                return false;
+            uint64_t prev = 0;
+            for (size_t i = 0; i < n; i++) {
+                uint64_t delta = 0;
+                for (size_t k = 0; k < 8; k++)
+                    delta |= (uint64_t)work[k * n + i] << (8 * k);
+                prev ^= delta;
+                std::memcpy(&values[i], &prev, 8);
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ChRingBufferSPSC
+// -----------------------------------------------------------------------------
+
+ChRingBufferSPSC::ChRingBufferSPSC(size_t record_size, size_t capacity)
+    : m_record_size(record_size), m_head(0), m_tail(0) {
+    size_t cap = 2;
+    while (cap < capacity)
+        cap *= 2;
+    m_mask = cap - 1;
+    m_data.resize(cap * record_size);
+}
+
+bool ChRingBufferSPSC::Push(const double* record) {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    size_t head = m_head.load(std::memory_order_acquire);
+    if (tail - head > m_mask)
+        return false;
+    if (m_record_size > 0)
+        std::memcpy(&m_data[(tail & m_mask) * m_record_size], record, m_record_size * sizeof(double));
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+size_t ChRingBufferSPSC::Pop(double* records, size_t max_records) {
+    size_t head = m_head.load(std::memory_order_relaxed);
+    size_t tail = m_tail.load(std::memory_order_acquire);
+    size_t n = std::min(tail - head, max_records);
+    if (m_record_size > 0) {
+        for (size_t k = 0; k < n; k++) {
+            std::memcpy(records + k * m_record_size, &m_data[((head + k) & m_mask) * m_record_size],
+                        m_record_size * sizeof(double));
+        }
+    }
+    m_head.store(head + n, std::memory_order_release);
+    return n;
+}
+
+size_t ChRingBufferSPSC::GetSize() const {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+}
+
+// -----------------------------------------------------------------------------
+// ChWriterBinary
+// -----------------------------------------------------------------------------
+
+template <typename T>
+static void AppendBytes(std::vector<unsigned char>& buffer, const T& value) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+ChWriterBinary::ChWriterBinary(const std::string& filename,
+                               const std::vector<std::string>& columns,
+                               size_t chunk_size,
+                               size_t buffer_size)
+    : m_columns(columns),
+      m_chunk_size(std::max<size_t>(chunk_size, 1)),
+      m_buffer_size(std::max(buffer_size, m_chunk_size)),
+      m_policy(OverflowPolicy::BLOCK),
+      m_file(filename, std::ios::binary),
+      m_open(false),
+      m_chunk_records(0),
+      m_stop(false),
+      m_flush_requested(0),
+      m_flush_done(0),
+      m_num_written(0),
+      m_num_bytes(0),
+      m_failed(false),
+      m_num_dropped(0) {
+    if (!m_file.is_open())
+        throw std::runtime_error("Cannot open binary output file " + filename);
+
+    // File header
+    std::vector<unsigned char> header(binary_magic, binary_magic + sizeof(binary_magic));
+    AppendBytes(header, binary_version);
+    WriteBytes(header);
+    WriteLayout();
+
+    m_column.resize(m_chunk_size);
+
+    m_open = true;
+    m_thread = std::thread(&ChWriterBinary::WriterLoop, this);
+}
+
+ChWriterBinary::~ChWriterBinary() {
+    Close();
+}
+
+bool ChWriterBinary::Write(const double* record) {
+    if (!m_open || m_failed.load(std::memory_order_relaxed))
+        return false;
+    while (!m_buffer->Push(record)) {
+        if (m_policy == OverflowPolicy::DROP) {
+            m_num_dropped++;
+            return false;
+        }
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+bool ChWriterBinary::Write(const std::vector<double>& record) {
+    if (record.size() != m_columns.size())
+        throw std::invalid_argument("Record size does not match the number of columns");
+    return Write(record.data());
+}
+
+void ChWriterBinary::SetColumns(const std::vector<std::string>& columns) {
+    if (!m_open)
+        return;
+
+    // Write the records queued with the previous layout before switching to the new one
+    StopThread();
+    m_columns = columns;
+    WriteLayout();
+    m_thread = std::thread(&ChWriterBinary::WriterLoop, this);
+}
+
+bool ChWriterBinary::Flush() {
+    if (!m_open)
+        return !m_failed;
+    uint64_t request = m_flush_requested.fetch_add(1, std::memory_order_acq_rel) + 1;
+    while (m_flush_done.load(std::memory_order_acquire) < request)
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return !m_failed;
+}
+
+bool ChWriterBinary::Close() {
+    if (!m_open)
+        return !m_failed;
+    StopThread();
+    m_file.close();
+    if (m_file.fail())
+        m_failed = true;
+    m_open = false;
+    return !m_failed;
+}
+
+void ChWriterBinary::StopThread() {
+    m_stop.store(true, std::memory_order_release);
+    m_thread.join();
+    m_stop.store(false, std::memory_order_relaxed);
+}
+
+void ChWriterBinary::WriterLoop() {
+    size_t record_size = m_columns.size();
+    while (true) {
+        // Read the flags before emptying the buffer, so that all records queued before a flush or stop request are
+        // processed
+        bool stop = m_stop.load(std::memory_order_acquire);
+        uint64_t flush = m_flush_requested.load(std::memory_order_acquire);
+
+        size_t n = m_buffer->Pop(m_chunk.data() + m_chunk_records * record_size, m_chunk_size - m_chunk_records);
+        m_chunk_records += n;
+        if (m_chunk_records == m_chunk_size) {
+            WriteChunk();
+            continue;
+        }
+        if (n > 0)
+            continue;
+
+        // The buffer is empty
+        if (stop || flush > m_flush_done.load(std::memory_order_relaxed)) {
+            if (m_chunk_records > 0)
+                WriteChunk();
+            m_file.flush();
+            if (!m_file)
+                m_failed = true;
+            m_flush_done.store(flush, std::memory_order_release);
+            if (stop)
+                break;
+            continue;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void ChWriterBinary::WriteBytes(const std::vector<unsigned char>& bytes) {
+    if (m_failed)
+        return;
+    m_file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!m_file)
+        m_failed = true;
+    else
+        m_num_bytes += bytes.size();
+}
+
+void ChWriterBinary::WriteLayout() {
+    std::vector<unsigned char> layout;
+    AppendBytes(layout, layout_marker);
+    AppendBytes(layout, (uint32_t)m_columns.size());
+    for (const auto& name : m_columns) {
+        AppendBytes(layout, (uint32_t)name.size());
+        layout.insert(layout.end(), name.begin(), name.end());
+    }
+    WriteBytes(layout);
+
+    m_buffer = chrono_types::make_unique<ChRingBufferSPSC>(m_columns.size(), m_buffer_size);
+    m_chunk.resize(m_chunk_size * m_columns.size());
+}
+
+void ChWriterBinary::WriteChunk() {
+    size_t num_columns = m_columns.size();
+    size_t n = m_chunk_records;
+
+    // After a write failure, records are discarded
+    if (m_failed) {
+        m_chunk_records = 0;
+        return;
+    }
+
+    // Chunk header, followed by the column data
+    std::vector<unsigned char> chunk;
+    AppendBytes(chunk, chunk_marker);
+    AppendBytes(chunk, (uint32_t)n);
+    size_t sizes_pos = chunk.size();
+    chunk.resize(chunk.size() + num_columns * (sizeof(uint32_t) + 1));
+
+    for (size_t c = 0; c < num_columns; c++) {
+        for (size_t i = 0; i < n; i++)
+            m_column[i] = m_chunk[i * num_columns + c];
+        ColumnCodec codec = CompressColumn(m_column.data(), n, m_work, m_bytes);
+        uint32_t size = (uint32_t)m_bytes.size();
+        std::memcpy(&chunk[sizes_pos + c * sizeof(uint32_t)], &size, sizeof(uint32_t));
+        chunk[sizes_pos + num_columns * sizeof(uint32_t) + c] = codec;
+        chunk.insert(chunk.end(), m_bytes.begin(), m_bytes.end());
+    }
+
+    WriteBytes(chunk);
+    m_chunk_records = 0;
+    if (!m_failed)
+        m_num_written += n;
+}
+
+// -----------------------------------------------------------------------------
+// ChReaderBinary
+// -----------------------------------------------------------------------------
+
+ChReaderBinary::ChReaderBinary(const std::string& filename)
+    : m_file(filename, std::ios::binary | std::ios::ate), m_num_records(0) {
+    if (!m_file.is_open())
+        throw std::runtime_error("Cannot open binary output file " + filename);
+    uint64_t file_size = (uint64_t)m_file.tellg();
+    m_file.seekg(0, std::ios::beg);
+
+    char magic[8];
+    uint32_t version;
+    uint32_t marker;
+    if (!m_file.read(magic, sizeof(magic)) || std::memcmp(magic, binary_magic, sizeof(magic)) != 0 ||
+        !m_file.read(reinterpret_cast<char*>(&version), sizeof(version)) || version != binary_version ||
+        !m_file.read(reinterpret_cast<char*>(&marker), sizeof(marker)) || marker != layout_marker)
+        throw std::runtime_error("Invalid binary output file " + filename);
+
+    // Reader columns with a given name (several, if a layout has duplicate names)
+    std::map<std::string, std::vector<size_t>> column_indices;
+
+    // Index the layouts and the chunks, stopping at the first incomplete or invalid block
+    uint64_t pos = (uint64_t)m_file.tellg() - sizeof(marker);
+    while (true) {
+        m_file.seekg(pos);
+        if (!m_file.read(reinterpret_cast<char*>(&marker), sizeof(marker)))
+            break;
+
+        if (marker == layout_marker) {
+            uint32_t num_columns;
+            if (!m_file.read(reinterpret_cast<char*>(&num_columns), sizeof(num_columns)) || num_columns > file_size)
+                break;
+            std::vector<std::string> names(num_columns);
+            bool valid = true;
+            for (auto& name : names) {
+                uint32_t len;
+                if (!m_file.read(reinterpret_cast<char*>(&len), sizeof(len)) || len > file_size) {
+                    valid = false;
+                    break;
+                }
+                name.resize(len);
+                if (len > 0 && !m_file.read(&name[0], len)) {
+                    valid = false;
+                    break;
+                }
+            }
+            if (!valid)
+                break;
+
+            // Match the columns of the layout to the reader columns, by name and occurrence
+            std::map<std::string, size_t> occurrences;
+            std::vector<size_t> layout;
+            for (const auto& name : names) {
+                auto& indices = column_indices[name];
+                size_t k = occurrences[name]++;
+                if (k == indices.size()) {
+                    indices.push_back(m_columns.size());
+                    m_columns.push_back(name);
+                }
+                layout.push_back(indices[k]);
+            }
+            m_layouts.push_back(std::move(layout));
+            pos = (uint64_t)m_file.tellg();
+            continue;
+        }
+
+        if (marker != chunk_marker || m_layouts.empty())
+            break;
+
+        size_t num_columns = m_layouts.back().size();
+        uint64_t table_size = 2 * sizeof(uint32_t) + num_columns * (sizeof(uint32_t) + 1);
+        if (pos + table_size > file_size)
+            break;
+
+        uint32_t n;
+        Chunk chunk;
+        std::vector<uint32_t> sizes(num_columns);
+        chunk.codecs.resize(num_columns);
+        m_file.read(reinterpret_cast<char*>(&n), sizeof(n));
+        if (num_columns > 0) {
+            m_file.read(reinterpret_cast<char*>(sizes.data()), num_columns * sizeof(uint32_t));
+            m_file.read(reinterpret_cast<char*>(chunk.codecs.data()), num_columns);
+        }
+        if (!m_file || n == 0)
+            break;
+
+        uint64_t offset = pos + table_size;
+        for (size_t c = 0; c < num_columns; c++) {
+            chunk.offsets.push_back(offset);
+            offset += sizes[c];
+        }
+        if (offset > file_size)
+            break;
+
+        chunk.layout = m_layouts.size() - 1;
+        chunk.num_records = n;
+        chunk.sizes = std::move(sizes);
+        m_chunks.push_back(std::move(chunk));
+        m_num_records += n;
+        pos = offset;
+    }
+    m_file.clear();
+}
+
+int ChReaderBinary::GetColumnIndex(const std::string& name) const {
+    auto it = std::find(m_columns.begin(), m_columns.end(), name);
+    return it == m_columns.end() ? -1 : (int)(it - m_columns.begin());
+}
+
+std::vector<double> ChReaderBinary::GetColumn(size_t index) {
+    if (index >= m_columns.size())
+        throw std::runtime_error("Invalid column index");
+
+    // Position of the column in each layout (-1 if not present)
+    std::vector<int> layout_columns(m_layouts.size(), -1);
+    for (size_t l = 0; l < m_layouts.size(); l++) {
+        auto it = std::find(m_layouts[l].begin(), m_layouts[l].end(), index);
+        if (it != m_layouts[l].end())
+            layout_columns[l] = (int)(it - m_layouts[l].begin());
+    }
+
+    std::vector<double> values(m_num_records, std::numeric_limits<double>::quiet_NaN());
+    std::vector<unsigned char> data;
+    std::vector<unsigned char> work;
+    size_t start = 0;
+    for (const auto& chunk : m_chunks) {
+        int c = layout_columns[chunk.layout];
+        if (c >= 0) {
+            data.resize(chunk.sizes[c]);
+            m_file.seekg(chunk.offsets[c]);
+            if ((!data.empty() && !m_file.read(reinterpret_cast<char*>(data.data()), data.size())) ||
+                !DecompressColumn(chunk.codecs[c], data, chunk.num_records, work, &values[start]))
+                throw std::runtime_error("Corrupted data for column " + m_columns[index]);
+        }
+        start += chunk.num_records;
+    }
+
+    return values;
+}
+
+std::vector<double> ChReaderBinary::GetColumn(const std::string& name) {
+    int index = GetColumnIndex(name);
+    if (index < 0)
+        throw std::runtime_error("No column " + name);
+    return GetColumn((size_t)index);
+}
+
+// -----------------------------------------------------------------------------
+// ChWriterBodiesBinary
+// -----------------------------------------------------------------------------
+
+ChWriterBodiesBinary::ChWriterBodiesBinary(const std::string& filename,
+                                           const std::vector<std::shared_ptr<ChBody>>& bodies,
+                                           bool dump_vel)
+    : m_bodies(bodies), m_dump_vel(dump_vel) {
+    std::vector<std::string> columns = {"time"};
+    for (size_t i = 0; i < m_bodies.size(); i++) {
+        std::string name = m_bodies[i]->GetName();
+        if (name.empty())
+            name = "body" + std::to_string(i);
+        for (const char* c : {".pos.x", ".pos.y", ".pos.z", ".rot.e0", ".rot.e1", ".rot.e2", ".rot.e3"})
+            columns.push_back(name + c);
+        if (m_dump_vel) {
+            for (const char* c : {".vel.x", ".vel.y", ".vel.z", ".angvel.x", ".angvel.y", ".angvel.z"})
+                columns.push_back(name + c);
+        }
+    }
+
+    m_record.resize(columns.size());
+    m_writer = chrono_types::make_unique<ChWriterBinary>(filename, columns);
+}
+
+bool ChWriterBodiesBinary::Write(double time) {
+    double* r = m_record.data();
+    *r++ = time;
+    for (const auto& body : m_bodies) {
+        const auto& pos = body->GetPos();
+        const auto& rot = body->GetRot();
+        for (int k = 0; k < 3; k++)
+            *r++ = pos[k];
+        for (int k = 0; k < 4; k++)
+            *r++ = rot[k];
+        if (m_dump_vel) {
+            const auto& vel = body->GetPosDt();
+            auto angvel = body->GetAngVelLocal();
+            for (int k = 0; k < 3; k++)
+                *r++ = vel[k];
+            for (int k = 0; k < 3; k++)
+                *r++ = angvel[k];
+        }
+    }
+    return m_writer->Write(m_record.data());
+}
+
+}  // namespace utils
+}  // namespace chrono
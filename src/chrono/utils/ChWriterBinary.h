@@ -0,0 +1,266 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Asynchronous output of fixed-layout records to compressed, columnar binary
+// files.
+//
+// ChRingBufferSPSC
+//  lock-free single-producer/single-consumer queue of fixed-size records.
+//
+// ChWriterBinary
+//  the simulation thread pushes records into a ring buffer and a background
+//  thread writes them to file in chunks, with each column compressed
+//  separately.
+//
+// ChReaderBinary
+//  reads the columns of a file written by ChWriterBinary.
+//
+// ChWriterBodiesBinary
+//  asynchronous output of body states (binary counterpart of WriteBodies).
+//
+// =============================================================================
+
+#ifndef CH_WRITER_BINARY_H
+#define CH_WRITER_BINARY_H
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChBody.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Lock-free single-producer/single-consumer ring buffer of fixed-size records of doubles.
+/// Push() must only be called from one (producer) thread and Pop() from one (consumer) thread.
+class ChApi ChRingBufferSPSC {
+  public:
+    /// Create a ring buffer for records with the given number of values.
+    /// The capacity (number of records) is rounded up to a power of 2.
+    ChRingBufferSPSC(size_t record_size, size_t capacity);
+
+    /// Append a record to the buffer. Return false (and do nothing) if the buffer is full.
+    bool Push(const double* record);
+
+    /// Extract up to 'max_records' records, copied contiguously in 'records'. Return the number of extracted records.
+    size_t Pop(double* records, size_t max_records);
+
+    /// Current number of records in the buffer (approximate if called concurrently with Push or Pop).
+    size_t GetSize() const;
+
+    /// Maximum number of records in the buffer.
+    size_t GetCapacity() const { return m_mask + 1; }
+
+    /// Number of values in a record.
+    size_t GetRecordSize() const { return m_record_size; }
+
+  private:
+    size_t m_record_size;
+    size_t m_mask;
+    std::vector<double> m_data;
+    alignas(64) std::atomic<size_t> m_head;  ///< index of the next record to read (modified by the consumer)
+    alignas(64) std::atomic<size_t> m_tail;  ///< index of the next record to write (modified by the producer)
+};
+
+/// Asynchronous writer of fixed-layout records to a compressed, columnar binary file.
+/// Write() copies a record in a lock-free ring buffer and returns immediately; a background thread collects the records
+/// in chunks and writes each chunk to file column by column. Each column of a chunk is compressed with a lossless codec
+/// suited for time series (XOR with the previous value, split in byte planes, and run-length encoding), or stored
+/// uncompressed if smaller. The record layout can be changed with SetColumns(), which starts a new layout block in the
+/// file. Use ChReaderBinary to read the resulting file.
+/// Write(), Flush(), SetColumns(), and Close() must always be called from the same thread.
+/// A failure while writing to file is latched: all subsequent records are discarded, and Flush() and Close() return
+/// false.
+class ChApi ChWriterBinary {
+  public:
+    /// Behavior of Write() if the ring buffer is full (i.e., the writer thread does not keep up).
+    enum class OverflowPolicy {
+        BLOCK,  ///< wait until there is space in the buffer (no data loss)
+        DROP    ///< discard the record
+    };
+
+    /// Open the output file and start the writer thread. Each record has one value per column.
+    ChWriterBinary(const std::string& filename,              ///< output file name
+                   const std::vector<std::string>& columns,  ///< column names
+                   size_t chunk_size = 4096,                 ///< number of records per chunk
+                   size_t buffer_size = 65536                ///< capacity of the ring buffer (number of records)
+    );
+
+    /// Write all pending records and close the file.
+    ~ChWriterBinary();
+
+    /// Set the behavior of Write() when the ring buffer is full (default: BLOCK).
+    void SetOverflowPolicy(OverflowPolicy policy) { m_policy = policy; }
+
+    /// Queue a record for output. The record must have GetNumColumns() values.
+    /// Return false if the record was dropped (full buffer with DROP policy, closed writer, or failed file output).
+    bool Write(const double* record);
+
+    /// Queue a record for output.
+    bool Write(const std::vector<double>& record);
+
+    /// Change the record layout.
+    /// All records queued so far are written with the previous layout; subsequent records must have one value for each
+    /// of the new columns.
+    void SetColumns(const std::vector<std::string>& columns);
+
+    /// Wait until all queued records were written to file (including a last, partial, chunk).
+    /// Return false if writing to file failed.
+    bool Flush();
+
+    /// Write all queued records, stop the writer thread, and close the file.
+    /// Return false if writing to file failed.
+    bool Close();
+
+    /// Return true if the output file is open.
+    bool IsOpen() const { return m_open; }
+
+    /// Return true if writing to file failed.
+    bool HasFailed() const { return m_failed; }
+
+    /// Number of values in a record.
+    size_t GetNumColumns() const { return m_columns.size(); }
+
+    /// Column names.
+    const std::vector<std::string>& GetColumnNames() const { return m_columns; }
+
+    /// Number of records written to file so far.
+    uint64_t GetNumWritten() const { return m_num_written; }
+
+    /// Number of records dropped because of a full buffer.
+    uint64_t GetNumDropped() const { return m_num_dropped; }
+
+    /// Number of bytes written to file so far.
+    uint64_t GetNumBytes() const { return m_num_bytes; }
+
+  private:
+    void WriterLoop();
+    void WriteLayout();
+    void WriteChunk();
+    void WriteBytes(const std::vector<unsigned char>& bytes);
+
+    /// Write the remaining records and stop the writer thread.
+    void StopThread();
+
+    std::vector<std::string> m_columns;
+    size_t m_chunk_size;
+    size_t m_buffer_size;
+    OverflowPolicy m_policy;
+
+    std::unique_ptr<ChRingBufferSPSC> m_buffer;
+    std::ofstream m_file;
+    bool m_open;
+
+    std::vector<double> m_chunk;         ///< records of the current chunk (writer thread)
+    size_t m_chunk_records;              ///< number of records in the current chunk (writer thread)
+    std::vector<double> m_column;        ///< column values (writer thread)
+    std::vector<unsigned char> m_bytes;  ///< compressed column (writer thread)
+    std::vector<unsigned char> m_work;   ///< work buffer for compression (writer thread)
+
+    std::thread m_thread;
+    std::atomic<bool> m_stop;
+    std::atomic<uint64_t> m_flush_requested;
+    std::atomic<uint64_t> m_flush_done;
+    std::atomic<uint64_t> m_num_written;
+    std::atomic<uint64_t> m_num_bytes;
+    std::atomic<bool> m_failed;
+    uint64_t m_num_dropped;
+};
+
+/// Reader for the files written by ChWriterBinary.
+/// Only the chunk headers are read at construction; columns are decompressed on request. An incomplete last chunk
+/// (e.g. if the writing program was interrupted) is ignored.
+/// If the file has several record layouts, the columns of the reader are all the columns of the file (in order of
+/// first appearance, matched by name), and the records of a layout without a given column have NaN values for it.
+class ChApi ChReaderBinary {
+  public:
+    /// Open a file written by ChWriterBinary. Throws std::runtime_error if the file cannot be read.
+    ChReaderBinary(const std::string& filename);
+
+    /// Number of columns.
+    size_t GetNumColumns() const { return m_columns.size(); }
+
+    /// Number of records.
+    size_t GetNumRecords() const { return m_num_records; }
+
+    /// Column names.
+    const std::vector<std::string>& GetColumnNames() const { return m_columns; }
+
+    /// Number of record layouts in the file.
+    size_t GetNumLayouts() const { return m_layouts.size(); }
+
+    /// Return the index of the column with given name, or -1 if there is no such column.
+    int GetColumnIndex(const std::string& name) const;
+
+    /// Read all values of the specified column.
+    /// Throws std::runtime_error if the column index is out of range or the file is corrupted.
+    std::vector<double> GetColumn(size_t index);
+
+    /// Read all values of the column with the specified name.
+    std::vector<double> GetColumn(const std::string& name);
+
+  private:
+    struct Chunk {
+        size_t layout;                      ///< index of the record layout
+        uint64_t num_records;               ///< number of records in the chunk
+        std::vector<uint64_t> offsets;      ///< file offset of each column
+        std::vector<uint32_t> sizes;        ///< stored size of each column
+        std::vector<unsigned char> codecs;  ///< codec of each column
+    };
+
+    std::ifstream m_file;
+    std::vector<std::string> m_columns;
+    std::vector<std::vector<size_t>> m_layouts;  ///< reader column of each column of each layout
+    std::vector<Chunk> m_chunks;
+    size_t m_num_records;
+};
+
+/// Asynchronous binary output of body states.
+/// Each record contains the time and, for each body, its position and orientation (quaternion) and optionally its
+/// linear velocity (absolute frame) and angular velocity (body frame), as with WriteBodies. Columns are named after the
+/// bodies, e.g. "chassis.pos.x" or "chassis.rot.e0"; unnamed bodies are named "body<index>".
+/// The list of bodies is fixed at construction.
+class ChApi ChWriterBodiesBinary {
+  public:
+    ChWriterBodiesBinary(const std::string& filename,                        ///< output file name
+                         const std::vector<std::shared_ptr<ChBody>>& bodies,  ///< bodies to output
+                         bool dump_vel = false                                ///< include body velocities
+    );
+
+    /// Queue a record with the current body states.
+    bool Write(double time);
+
+    /// Access the underlying writer.
+    ChWriterBinary& GetWriter() { return *m_writer; }
+
+  private:
+    std::vector<std::shared_ptr<ChBody>> m_bodies;
+    bool m_dump_vel;
+    std::vector<double> m_record;
+    std::unique_ptr<ChWriterBinary> m_writer;
+};
+
+/// @} chrono_utils
+
+}  // namespace utils
+}  // namespace chrono
+
+#endif
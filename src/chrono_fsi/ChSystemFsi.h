@@ -20,8 +20,14 @@
 #ifndef CH_SYSTEM_FSI_H
 #define CH_SYSTEM_FSI_H
 
-#include <thrust/host_vector.h>
-#include <thrust/device_vector.h>
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <thrust/host_vector.h>
+    #include <thrust/device_vector.h>
+#else
+    #include "chrono_fsi/cpu/ChFsiCpuThrust.h"
+#endif
 
 #include "chrono/ChConfig.h"
 #include "chrono/physics/ChSystem.h"
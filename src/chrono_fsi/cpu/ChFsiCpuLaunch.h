@@ -0,0 +1,68 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Execution of Chrono::FSI kernels on the CPU.
+// A kernel launch over a 1D grid is emulated with an OpenMP parallel loop over
+// the global thread indices. Kernels obtain their index from the additional
+// argument declared with CHFSI_KERNEL_INDEX_PARAM (see ChUtilsDevice.cuh), so
+// no CUDA built-in variables are emulated. Kernels are launched through the
+// CHFSI_LAUNCH macro, which expands to the usual <<<...>>> launch with CUDA
+// and wraps the kernel in a generic lambda otherwise (so that overloaded
+// kernels are resolved with the launch arguments).
+//
+// =============================================================================
+
+#ifndef CH_FSI_CPU_LAUNCH_H
+#define CH_FSI_CPU_LAUNCH_H
+
+#include "chrono_fsi/cpu/ChFsiCpuRuntime.h"
+
+namespace chrono {
+namespace fsi {
+
+/// Launcher for a kernel over a 1D grid of numBlocks blocks with numThreads threads each.
+/// The call operator invokes the kernel with the given arguments, followed by the global thread index, and returns
+/// once all threads are done (as if followed by a device synchronization).
+template <typename Kernel>
+class ChFsiCpuLauncher {
+  public:
+    ChFsiCpuLauncher(Kernel kernel, unsigned int numBlocks, unsigned int numThreads)
+        : m_n((long long)numBlocks * numThreads), m_kernel(kernel) {}
+
+    template <typename... Args>
+    void operator()(const Args&... args) const {
+#pragma omp parallel for schedule(static)
+        for (long long i = 0; i < m_n; i++) {
+            m_kernel(args..., (unsigned int)i);
+        }
+    }
+
+  private:
+    long long m_n;
+    Kernel m_kernel;
+};
+
+/// Create a launcher for the given kernel and launch configuration.
+/// The size of the dynamic shared memory, if specified, is ignored (kernels using shared memory have a separate CPU
+/// code path).
+template <typename Kernel>
+ChFsiCpuLauncher<Kernel> ChFsiCpuLaunch(Kernel kernel,
+                                        unsigned int numBlocks,
+                                        unsigned int numThreads,
+                                        size_t sharedMemSize = 0) {
+    return ChFsiCpuLauncher<Kernel>(kernel, numBlocks, numThreads);
+}
+
+}  // end namespace fsi
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,298 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Host replacements for the subset of the CUDA runtime used by Chrono::FSI.
+// Included (instead of the CUDA headers) when Chrono::FSI is built with the
+// OpenMP CPU backend. Vector types have the same layout as their CUDA
+// counterparts, device memory is plain host memory, constant memory symbols
+// are ordinary (per translation unit) variables, and the atomic operations
+// used in the device functions are implemented with compiler intrinsics so
+// that they can be called from OpenMP parallel regions.
+//
+// =============================================================================
+
+#ifndef CH_FSI_CPU_RUNTIME_H
+#define CH_FSI_CPU_RUNTIME_H
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <math.h>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Function execution space and variable memory space specifiers
+// -----------------------------------------------------------------------------
+
+#ifndef __host__
+    #define __host__
+#endif
+#ifndef __device__
+    #define __device__
+#endif
+#ifndef __global__
+    #define __global__
+#endif
+#ifndef __constant__
+    #define __constant__
+#endif
+#ifndef __inline__
+    #define __inline__ inline
+#endif
+#ifndef __forceinline__
+    #define __forceinline__ inline
+#endif
+
+// -----------------------------------------------------------------------------
+// Built-in vector types (the make_* functions are provided by custom_math.h)
+// -----------------------------------------------------------------------------
+
+struct int2 {
+    int x, y;
+};
+
+struct int3 {
+    int x, y, z;
+};
+
+struct int4 {
+    int x, y, z, w;
+};
+
+struct uint2 {
+    unsigned int x, y;
+};
+
+struct uint3 {
+    unsigned int x, y, z;
+};
+
+struct uint4 {
+    unsigned int x, y, z, w;
+};
+
+struct float2 {
+    float x, y;
+};
+
+struct float3 {
+    float x, y, z;
+};
+
+struct float4 {
+    float x, y, z, w;
+};
+
+struct double2 {
+    double x, y;
+};
+
+struct double3 {
+    double x, y, z;
+};
+
+struct double4 {
+    double x, y, z, w;
+};
+
+// -----------------------------------------------------------------------------
+// Runtime API
+// -----------------------------------------------------------------------------
+
+enum cudaError { cudaSuccess = 0, cudaErrorMemoryAllocation = 2 };
+typedef enum cudaError cudaError_t;
+
+enum cudaMemcpyKind {
+    cudaMemcpyHostToHost = 0,
+    cudaMemcpyHostToDevice = 1,
+    cudaMemcpyDeviceToHost = 2,
+    cudaMemcpyDeviceToDevice = 3,
+    cudaMemcpyDefault = 4
+};
+
+typedef void* cudaStream_t;
+
+/// Host replacement for a CUDA event (records the wall clock time).
+struct ChFsiCpuEvent {
+    std::chrono::high_resolution_clock::time_point time;
+};
+typedef ChFsiCpuEvent* cudaEvent_t;
+
+inline const char* cudaGetErrorString(cudaError_t error) {
+    return error == cudaSuccess ? "no error" : "out of memory";
+}
+
+inline cudaError_t cudaGetLastError() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaDeviceSynchronize() {
+    return cudaSuccess;
+}
+
+/// Allocate host memory (there is no distinction between host and device memory with the CPU backend).
+inline cudaError_t cudaMalloc(void** ptr, size_t size) {
+    *ptr = std::malloc(size > 0 ? size : 1);
+    return *ptr ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+inline cudaError_t cudaFree(void* ptr) {
+    std::free(ptr);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void* dst, const void* src, size_t count, cudaMemcpyKind kind) {
+    std::memcpy(dst, src, count);
+    return cudaSuccess;
+}
+
+/// Copy data to a "constant memory" symbol (an ordinary variable with the CPU backend).
+template <typename T>
+inline cudaError_t cudaMemcpyToSymbolAsync(T& symbol,
+                                           const void* src,
+                                           size_t count,
+                                           size_t offset = 0,
+                                           cudaMemcpyKind kind = cudaMemcpyHostToDevice,
+                                           cudaStream_t stream = 0) {
+    std::memcpy(reinterpret_cast<char*>(&symbol) + offset, src, count);
+    return cudaSuccess;
+}
+
+/// Copy data from a "constant memory" symbol (an ordinary variable with the CPU backend).
+template <typename T>
+inline cudaError_t cudaMemcpyFromSymbol(void* dst,
+                                        const T& symbol,
+                                        size_t count,
+                                        size_t offset = 0,
+                                        cudaMemcpyKind kind = cudaMemcpyDeviceToHost) {
+    std::memcpy(dst, reinterpret_cast<const char*>(&symbol) + offset, count);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventCreate(cudaEvent_t* event) {
+    *event = new ChFsiCpuEvent;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventDestroy(cudaEvent_t event) {
+    delete event;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventRecord(cudaEvent_t event, cudaStream_t stream = 0) {
+    event->time = std::chrono::high_resolution_clock::now();
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaEventSynchronize(cudaEvent_t event) {
+    return cudaSuccess;
+}
+
+/// Elapsed time between two events, in milliseconds.
+inline cudaError_t cudaEventElapsedTime(float* ms, cudaEvent_t start, cudaEvent_t end) {
+    *ms = std::chrono::duration<float, std::milli>(end->time - start->time).count();
+    return cudaSuccess;
+}
+
+// -----------------------------------------------------------------------------
+// Type reinterpretation intrinsics
+// -----------------------------------------------------------------------------
+
+inline long long int __double_as_longlong(double x) {
+    long long int i;
+    std::memcpy(&i, &x, sizeof(double));
+    return i;
+}
+
+inline double __longlong_as_double(long long int i) {
+    double x;
+    std::memcpy(&x, &i, sizeof(double));
+    return x;
+}
+
+// -----------------------------------------------------------------------------
+// Atomic functions (safe to call concurrently from OpenMP threads)
+// -----------------------------------------------------------------------------
+
+inline unsigned long long int atomicCAS(unsigned long long int* address,
+                                        unsigned long long int compare,
+                                        unsigned long long int val) {
+#if defined(_MSC_VER)
+    return (unsigned long long int)_InterlockedCompareExchange64((volatile long long*)address, (long long)val,
+                                                                 (long long)compare);
+#else
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return compare;
+#endif
+}
+
+inline unsigned int atomicCAS(unsigned int* address, unsigned int compare, unsigned int val) {
+#if defined(_MSC_VER)
+    return (unsigned int)_InterlockedCompareExchange((volatile long*)address, (long)val, (long)compare);
+#else
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return compare;
+#endif
+}
+
+inline unsigned int atomicAdd(unsigned int* address, unsigned int val) {
+#if defined(_MSC_VER)
+    return (unsigned int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_SEQ_CST);
+#endif
+}
+
+inline int atomicAdd(int* address, int val) {
+#if defined(_MSC_VER)
+    return (int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_SEQ_CST);
+#endif
+}
+
+inline float atomicAdd(float* address, float val) {
+    static_assert(sizeof(float) == sizeof(unsigned int), "unexpected float size");
+    unsigned int* address_as_uint = reinterpret_cast<unsigned int*>(address);
+    unsigned int old = *address_as_uint;
+    unsigned int assumed;
+    float old_val;
+    do {
+        assumed = old;
+        std::memcpy(&old_val, &assumed, sizeof(float));
+        float new_val = old_val + val;
+        unsigned int new_bits;
+        std::memcpy(&new_bits, &new_val, sizeof(float));
+        old = atomicCAS(address_as_uint, assumed, new_bits);
+    } while (assumed != old);
+    return old_val;
+}
+
+inline double atomicAdd(double* address, double val) {
+    static_assert(sizeof(double) == sizeof(unsigned long long int), "unexpected double size");
+    unsigned long long int* address_as_ull = reinterpret_cast<unsigned long long int*>(address);
+    unsigned long long int old = *address_as_ull;
+    unsigned long long int assumed;
+    do {
+        assumed = old;
+        old = atomicCAS(address_as_ull, assumed,
+                        (unsigned long long int)__double_as_longlong(val + __longlong_as_double((long long)assumed)));
+    } while (assumed != old);
+    return __longlong_as_double((long long)old);
+}
+
+#endif
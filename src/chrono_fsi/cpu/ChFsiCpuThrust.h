@@ -0,0 +1,284 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Host replacements for the subset of Thrust used by Chrono::FSI.
+// Included (instead of the Thrust headers) when Chrono::FSI is built with the
+// OpenMP CPU backend. Device and host vectors are both std::vector, and the
+// algorithms are sequential (the particle loops of the solver run in the
+// kernels, which are parallelized with OpenMP, see ChFsiCpuLaunch.h).
+//
+// =============================================================================
+
+#ifndef CH_FSI_CPU_THRUST_H
+#define CH_FSI_CPU_THRUST_H
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace thrust {
+
+template <typename T>
+class device_vector;
+
+/// Vector in host memory.
+template <typename T>
+class host_vector : public std::vector<T> {
+  public:
+    using std::vector<T>::vector;
+    host_vector() = default;
+    host_vector(const std::vector<T>& other) : std::vector<T>(other) {}
+    host_vector(const device_vector<T>& other) : std::vector<T>(other.begin(), other.end()) {}
+    host_vector& operator=(const device_vector<T>& other) {
+        this->assign(other.begin(), other.end());
+        return *this;
+    }
+};
+
+/// Vector in "device" memory (host memory with the CPU backend).
+template <typename T>
+class device_vector : public std::vector<T> {
+  public:
+    using std::vector<T>::vector;
+    device_vector() = default;
+    device_vector(const std::vector<T>& other) : std::vector<T>(other) {}
+    device_vector(const host_vector<T>& other) : std::vector<T>(other.begin(), other.end()) {}
+    device_vector& operator=(const host_vector<T>& other) {
+        this->assign(other.begin(), other.end());
+        return *this;
+    }
+};
+
+template <typename T>
+T* raw_pointer_cast(T* ptr) {
+    return ptr;
+}
+
+// -----------------------------------------------------------------------------
+// Execution policies (ignored)
+// -----------------------------------------------------------------------------
+
+struct device_execution_policy {};
+constexpr device_execution_policy device{};
+
+// -----------------------------------------------------------------------------
+// Function objects
+// -----------------------------------------------------------------------------
+
+template <typename T>
+struct identity {
+    const T& operator()(const T& x) const { return x; }
+};
+
+template <typename T>
+struct plus {
+    T operator()(const T& a, const T& b) const { return a + b; }
+};
+
+template <typename T>
+struct maximum {
+    T operator()(const T& a, const T& b) const { return a < b ? b : a; }
+};
+
+template <typename T>
+struct minimum {
+    T operator()(const T& a, const T& b) const { return b < a ? b : a; }
+};
+
+// -----------------------------------------------------------------------------
+// Iterators and tuples
+// -----------------------------------------------------------------------------
+
+using std::get;
+using std::make_tuple;
+using std::tuple;
+
+/// Iterator over a sequence of integral values.
+template <typename T>
+class counting_iterator {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = T;
+
+    counting_iterator(T value) : m_value(value) {}
+    T operator*() const { return m_value; }
+    counting_iterator& operator++() {
+        ++m_value;
+        return *this;
+    }
+    counting_iterator operator+(difference_type n) const { return counting_iterator(m_value + (T)n); }
+    difference_type operator-(const counting_iterator& other) const { return (difference_type)(m_value - other.m_value); }
+    bool operator==(const counting_iterator& other) const { return m_value == other.m_value; }
+    bool operator!=(const counting_iterator& other) const { return m_value != other.m_value; }
+
+  private:
+    T m_value;
+};
+
+/// Tuple of iterators (only storage of the underlying iterators is supported).
+template <typename IteratorTuple>
+class zip_iterator {
+  public:
+    zip_iterator(const IteratorTuple& iterators) : m_iterators(iterators) {}
+    const IteratorTuple& get_iterator_tuple() const { return m_iterators; }
+
+  private:
+    IteratorTuple m_iterators;
+};
+
+template <typename IteratorTuple>
+zip_iterator<IteratorTuple> make_zip_iterator(const IteratorTuple& iterators) {
+    return zip_iterator<IteratorTuple>(iterators);
+}
+
+// -----------------------------------------------------------------------------
+// Algorithms
+// -----------------------------------------------------------------------------
+
+template <typename InputIterator, typename OutputIterator>
+OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result) {
+    return std::copy(first, last, result);
+}
+
+template <typename InputIterator, typename Size, typename OutputIterator>
+OutputIterator copy_n(InputIterator first, Size n, OutputIterator result) {
+    return std::copy_n(first, n, result);
+}
+
+template <typename ForwardIterator, typename T>
+void fill(ForwardIterator first, ForwardIterator last, const T& value) {
+    std::fill(first, last, value);
+}
+
+template <typename InputIterator, typename OutputIterator, typename UnaryFunction>
+OutputIterator transform(InputIterator first, InputIterator last, OutputIterator result, UnaryFunction op) {
+    return std::transform(first, last, result, op);
+}
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename BinaryFunction>
+OutputIterator transform(InputIterator1 first1,
+                         InputIterator1 last1,
+                         InputIterator2 first2,
+                         OutputIterator result,
+                         BinaryFunction op) {
+    return std::transform(first1, last1, first2, result, op);
+}
+
+/// Copy the elements in [first, last) for which the predicate applied to the corresponding stencil element is true.
+template <typename InputIterator, typename StencilIterator, typename OutputIterator, typename Predicate>
+OutputIterator copy_if(const device_execution_policy&,
+                       InputIterator first,
+                       InputIterator last,
+                       StencilIterator stencil,
+                       OutputIterator result,
+                       Predicate pred) {
+    for (; first != last; ++first, ++stencil) {
+        if (pred(*stencil)) {
+            *result = *first;
+            ++result;
+        }
+    }
+    return result;
+}
+
+/// Copy the elements of the input range at the locations given by the map range.
+template <typename MapIterator, typename InputIterator, typename OutputIterator>
+OutputIterator gather(const device_execution_policy&,
+                      MapIterator map_first,
+                      MapIterator map_last,
+                      InputIterator input,
+                      OutputIterator result) {
+    for (; map_first != map_last; ++map_first, ++result)
+        *result = input[*map_first];
+    return result;
+}
+
+/// Remove the elements in [first, last) for which the predicate applied to the corresponding stencil element is true.
+/// The order of the remaining elements is preserved; the new end of the range is returned.
+template <typename ForwardIterator, typename StencilIterator, typename Predicate>
+ForwardIterator remove_if(ForwardIterator first, ForwardIterator last, StencilIterator stencil, Predicate pred) {
+    ForwardIterator result = first;
+    for (; first != last; ++first, ++stencil) {
+        if (!pred(*stencil)) {
+            *result = *first;
+            ++result;
+        }
+    }
+    return result;
+}
+
+/// Sort the keys in ascending order and apply the same permutation to the values.
+/// As with Thrust, the sort is stable.
+template <typename KeyIterator, typename ValueIterator>
+void sort_by_key(KeyIterator keys_first, KeyIterator keys_last, ValueIterator values_first) {
+    using Key = typename std::iterator_traits<KeyIterator>::value_type;
+    using Value = typename std::iterator_traits<ValueIterator>::value_type;
+
+    const size_t n = (size_t)std::distance(keys_first, keys_last);
+    std::vector<size_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::stable_sort(perm.begin(), perm.end(), [&](size_t a, size_t b) { return keys_first[a] < keys_first[b]; });
+
+    std::vector<Key> keys(keys_first, keys_last);
+    std::vector<Value> values(values_first, values_first + n);
+    for (size_t i = 0; i < n; i++) {
+        keys_first[i] = keys[perm[i]];
+        values_first[i] = values[perm[i]];
+    }
+}
+
+/// For each group of consecutive equal keys, copy the first key and the sum of the corresponding values.
+/// Returns the ends of the output key and value ranges.
+template <typename KeyIterator,
+          typename ValueIterator,
+          typename KeyOutputIterator,
+          typename ValueOutputIterator,
+          typename BinaryPredicate>
+std::pair<KeyOutputIterator, ValueOutputIterator> reduce_by_key(KeyIterator keys_first,
+                                                                KeyIterator keys_last,
+                                                                ValueIterator values_first,
+                                                                KeyOutputIterator keys_output,
+                                                                ValueOutputIterator values_output,
+                                                                BinaryPredicate binary_pred) {
+    using Key = typename std::iterator_traits<KeyIterator>::value_type;
+    using Value = typename std::iterator_traits<ValueIterator>::value_type;
+
+    if (keys_first == keys_last)
+        return std::make_pair(keys_output, values_output);
+
+    // Input and output ranges may coincide, so the current group is accumulated in temporaries
+    Key key = *keys_first;
+    Value sum = *values_first;
+    for (++keys_first, ++values_first; keys_first != keys_last; ++keys_first, ++values_first) {
+        if (binary_pred(key, *keys_first)) {
+            sum = sum + *values_first;
+        } else {
+            *keys_output++ = key;
+            *values_output++ = sum;
+            key = *keys_first;
+            sum = *values_first;
+        }
+    }
+    *keys_output++ = key;
+    *values_output++ = sum;
+    return std::make_pair(keys_output, values_output);
+}
+
+}  // end namespace thrust
+
+#endif
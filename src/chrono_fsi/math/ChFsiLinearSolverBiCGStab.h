@@ -19,13 +19,16 @@
 #define CHFSILINEARSOLVER_BICGSTAB_H_
 
 #include <ctype.h>
-#include <cuda_runtime.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <typeinfo>
-#include "cublas_v2.h"
-#include "cusparse_v2.h"
+#include "chrono_fsi/ChConfigFSI.h"
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda_runtime.h>
+    #include "cublas_v2.h"
+    #include "cusparse_v2.h"
+#endif
 #include "chrono_fsi/math/ChFsiLinearSolver.h"
 
 namespace chrono {
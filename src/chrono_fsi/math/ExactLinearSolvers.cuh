@@ -17,8 +17,11 @@
 #ifndef CH_SOLVER6X6_H_
 #define CH_SOLVER6X6_H_
 
-#include <cuda_runtime.h>
 #include "chrono_fsi/ChConfigFSI.h"
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda_runtime.h>
+#endif
+#include "chrono_fsi/math/custom_math.h"
 
 namespace chrono {
 namespace fsi {
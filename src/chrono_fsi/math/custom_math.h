@@ -20,11 +20,16 @@
 #ifndef CHFSI_CUSTOM_MATH_H
 #define CHFSI_CUSTOM_MATH_H
 
-#include <cuda_runtime.h>
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda_runtime.h>
+#else
+    #include "chrono_fsi/cpu/ChFsiCpuRuntime.h"
+#endif
 #ifndef __CUDACC__
     #include <cmath>
 #endif
-#include "chrono_fsi/ChConfigFSI.h"
 
 namespace chrono {
 namespace fsi {
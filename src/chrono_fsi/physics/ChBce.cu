@@ -41,8 +41,9 @@ __global__ void Populate_RigidSPH_MeshPos_LRF_D(Real3* rigidSPH_MeshPos_LRF_D,
                                                 Real4* posRadD,
                                                 uint* rigidIdentifierD,
                                                 Real3* posRigidD,
-                                                Real4* qD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                                Real4* qD
+                                                CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numRigidMarkers)
         return;
 
@@ -64,8 +65,9 @@ __global__ void Populate_FlexSPH_MeshPos_LRF_D(Real3* FlexSPH_MeshPos_LRF_D,
                                                uint* FlexIdentifierD,
                                                uint2* CableElementsNodesD,
                                                uint4* ShellElementsNodesD,
-                                               Real3* pos_fsi_fea_D) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                               Real3* pos_fsi_fea_D
+                                               CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numFlexMarkers)
         return;
 
@@ -138,8 +140,9 @@ __global__ void Calc_Rigid_FSI_Forces_Torques_D(Real3* rigid_FSI_ForcesD,
                                                 Real4* posRadD,
                                                 uint* rigidIdentifierD,
                                                 Real3* posRigidD,
-                                                Real3* rigidSPH_MeshPos_LRF_D) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                                Real3* rigidSPH_MeshPos_LRF_D
+                                                CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numRigidMarkers)
         return;
 
@@ -179,8 +182,9 @@ __global__ void Calc_Flex_FSI_ForcesD(Real3* FlexSPH_MeshPos_LRF_D,
                                       Real4* derivVelRhoD,
                                       Real4* derivVelRhoD_old,
                                       Real3* pos_fsi_fea_D,
-                                      Real3* Flex_FSI_ForcesD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                      Real3* Flex_FSI_ForcesD
+                                      CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numFlexMarkers)
         return;
 
@@ -327,8 +331,9 @@ __global__ void BCE_VelocityPressureStress(Real3* velMas_ModifiedBCE,
                                            uint* extendedActivityIdD,
                                            Real3* bceAcc,
                                            int2 newPortion,
-                                           volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                           volatile bool* isErrorD
+                                           CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     uint sphIndex = index + newPortion.x;
     if (index >= newPortion.y - newPortion.x)
         return;
@@ -436,8 +441,9 @@ __global__ void CalcRigidBceAccelerationD(Real3* bceAcc,
                                           Real3* omegaVelLRF_fsiBodies_D,
                                           Real3* omegaAccLRF_fsiBodies_D,
                                           Real3* rigidSPH_MeshPos_LRF_D,
-                                          const uint* rigidIdentifierD) {
-    uint bceIndex = blockIdx.x * blockDim.x + threadIdx.x;
+                                          const uint* rigidIdentifierD
+                                          CHFSI_KERNEL_INDEX_PARAM) {
+    uint bceIndex = CHFSI_KERNEL_INDEX;
     if (bceIndex >= numObjectsD.numRigidMarkers)
         return;
 
@@ -472,8 +478,9 @@ __global__ void CalcFlexBceAccelerationD(Real3* bceAcc,
                                          Real3* FlexSPH_MeshPos_LRF_D,
                                          uint2* CableElementsNodesD,
                                          uint4* ShellElementsNodesD,
-                                         const uint* FlexIdentifierD) {
-    uint bceIndex = blockIdx.x * blockDim.x + threadIdx.x;
+                                         const uint* FlexIdentifierD
+                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint bceIndex = CHFSI_KERNEL_INDEX;
     if (bceIndex >= numObjectsD.numFlexMarkers)
         return;
 
@@ -523,8 +530,9 @@ __global__ void UpdateRigidMarkersPositionVelocityD(Real4* posRadD,
                                                     Real3* posRigidD,
                                                     Real4* velMassRigidD,
                                                     Real3* omegaLRF_D,
-                                                    Real4* qD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                                    Real4* qD
+                                                    CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numRigidMarkers)
         return;
 
@@ -560,8 +568,9 @@ __global__ void UpdateFlexMarkersPositionVelocityD(Real4* posRadD,
                                                    uint4* ShellElementsNodesD,
                                                    Real3* pos_fsi_fea_D,
                                                    Real3* vel_fsi_fea_D,
-                                                   Real3* dir_fsi_fea_D) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                                   Real3* dir_fsi_fea_D
+                                                   CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numFlexMarkers)
         return;
 
@@ -741,7 +750,7 @@ void ChBce::Populate_RigidSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMar
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
-    Populate_RigidSPH_MeshPos_LRF_D<<<nBlocks, nThreads>>>(
+    CHFSI_LAUNCH(Populate_RigidSPH_MeshPos_LRF_D, nBlocks, nThreads)(
         mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->rigidIdentifierD), mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR4CAST(fsiBodiesD->q_fsiBodies_D));
@@ -777,7 +786,7 @@ void ChBce::Populate_FlexSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMark
     computeGridSize((uint)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
     thrust::device_vector<Real3> FlexSPH_MeshPos_LRF_H = fsiGeneralData->FlexSPH_MeshPos_LRF_H;
-    Populate_FlexSPH_MeshPos_LRF_D<<<nBlocks, nThreads>>>(
+    CHFSI_LAUNCH(Populate_FlexSPH_MeshPos_LRF_D, nBlocks, nThreads)(
         mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), mR3CAST(FlexSPH_MeshPos_LRF_H), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->FlexIdentifierD), U2CAST(fsiGeneralData->CableElementsNodesD),
         U4CAST(fsiGeneralData->ShellElementsNodesD), mR3CAST(fsiMeshD->pos_fsi_fea_D));
@@ -821,7 +830,7 @@ void ChBce::ReCalcVelocityPressureStress_BCE(thrust::device_vector<Real3>& velMa
     uint numThreads, numBlocks;
     computeGridSize(numBCE, 256, numBlocks, numThreads);
 
-    BCE_VelocityPressureStress<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(BCE_VelocityPressureStress, numBlocks, numThreads)(
         mR3CAST(velMas_ModifiedBCE), mR4CAST(rhoPreMu_ModifiedBCE), mR3CAST(tauXxYyZz_ModifiedBCE),
         mR3CAST(tauXyXzYz_ModifiedBCE), mR4CAST(sortedPosRad), mR3CAST(sortedVelMas), mR4CAST(sortedRhoPreMu),
         mR3CAST(sortedTauXxYyZz), mR3CAST(sortedTauXyXzYz), U1CAST(cellStart), U1CAST(cellEnd),
@@ -850,7 +859,7 @@ void ChBce::CalcRigidBceAcceleration(thrust::device_vector<Real3>& bceAcc,
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, numBlocks, numThreads);
 
-    CalcRigidBceAccelerationD<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(CalcRigidBceAccelerationD, numBlocks, numThreads)(
         mR3CAST(bceAcc), mR4CAST(q_fsiBodies_D), mR3CAST(accRigid_fsiBodies_D), mR3CAST(omegaVelLRF_fsiBodies_D),
         mR3CAST(omegaAccLRF_fsiBodies_D), mR3CAST(rigidSPH_MeshPos_LRF_D), U1CAST(rigidIdentifierD));
 
@@ -869,7 +878,7 @@ void ChBce::CalcFlexBceAcceleration(thrust::device_vector<Real3>& bceAcc,
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numFlexMarkers, 256, numBlocks, numThreads);
 
-    CalcFlexBceAccelerationD<<<numBlocks, numThreads>>>(mR3CAST(bceAcc), mR3CAST(acc_fsi_fea_D),
+    CHFSI_LAUNCH(CalcFlexBceAccelerationD, numBlocks, numThreads)(mR3CAST(bceAcc), mR3CAST(acc_fsi_fea_D),
                                                         mR3CAST(FlexSPH_MeshPos_LRF_D), U2CAST(CableElementsNodesD),
                                                         U4CAST(ShellElementsNodesD), U1CAST(FlexIdentifierD));
 
@@ -991,7 +1000,7 @@ void ChBce::Rigid_Forces_Torques(std::shared_ptr<SphMarkerDataD> sphMarkersD,
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
-    Calc_Rigid_FSI_Forces_Torques_D<<<nBlocks, nThreads>>>(
+    CHFSI_LAUNCH(Calc_Rigid_FSI_Forces_Torques_D, nBlocks, nThreads)(
         mR3CAST(fsiGeneralData->rigid_FSI_ForcesD), mR3CAST(fsiGeneralData->rigid_FSI_TorquesD),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR4CAST(fsiGeneralData->derivVelRhoD_old), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->rigidIdentifierD), mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
@@ -1011,7 +1020,7 @@ void ChBce::Flex_Forces(std::shared_ptr<SphMarkerDataD> sphMarkersD, std::shared
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
-    Calc_Flex_FSI_ForcesD<<<nBlocks, nThreads>>>(
+    CHFSI_LAUNCH(Calc_Flex_FSI_ForcesD, nBlocks, nThreads)(
         mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), U1CAST(fsiGeneralData->FlexIdentifierD),
         U2CAST(fsiGeneralData->CableElementsNodesD), U4CAST(fsiGeneralData->ShellElementsNodesD),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR4CAST(fsiGeneralData->derivVelRhoD_old),
@@ -1030,7 +1039,7 @@ void ChBce::UpdateRigidMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> s
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
-    UpdateRigidMarkersPositionVelocityD<<<nBlocks, nThreads>>>(
+    CHFSI_LAUNCH(UpdateRigidMarkersPositionVelocityD, nBlocks, nThreads)(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D),
         U1CAST(fsiGeneralData->rigidIdentifierD), mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR4CAST(fsiBodiesD->velMassRigid_fsiBodies_D), mR3CAST(fsiBodiesD->omegaVelLRF_fsiBodies_D),
@@ -1049,7 +1058,7 @@ void ChBce::UpdateFlexMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> sp
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
-    UpdateFlexMarkersPositionVelocityD<<<nBlocks, nThreads>>>(
+    CHFSI_LAUNCH(UpdateFlexMarkersPositionVelocityD, nBlocks, nThreads)(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), mR3CAST(sphMarkersD->velMasD),
         U1CAST(fsiGeneralData->FlexIdentifierD), U2CAST(fsiGeneralData->CableElementsNodesD),
         U4CAST(fsiGeneralData->ShellElementsNodesD), mR3CAST(fsiMeshD->pos_fsi_fea_D), mR3CAST(fsiMeshD->vel_fsi_fea_D),
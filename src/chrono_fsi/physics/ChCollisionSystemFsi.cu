@@ -15,11 +15,14 @@
 // Base class for processing proximity in fsi system.
 // =============================================================================
 
-#include <thrust/sort.h>
 #include "chrono_fsi/physics/ChCollisionSystemFsi.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <thrust/sort.h>
+#endif
+
 namespace chrono {
 namespace fsi {
 
@@ -31,9 +34,10 @@ namespace fsi {
 __global__ void calcHashD(uint* gridMarkerHashD,   // store particle hash here
                           uint* gridMarkerIndexD,  // store particle index here
                           Real4* posRad,           // vector containing the positions of all particles (SPH and BCE)
-                          volatile bool* isErrorD) {
+                          volatile bool* isErrorD
+                          CHFSI_KERNEL_INDEX_PARAM) {
     // Calculate the index of where the particle is stored in posRad.
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -91,12 +95,14 @@ __global__ void reorderDataAndFindCellStartD(uint* cellStartD,          // outpu
                                              Real4* posRadD,            // input: original position array
                                              Real3* velMasD,            // input: original velocity array
                                              Real4* rhoPresMuD          // input: original density pressure
-                                            ) {
-    extern __shared__ uint sharedHash[];  // blockSize + 1 elements
-    
+                                             CHFSI_KERNEL_INDEX_PARAM) {
     // Get the particle index the current thread is supposed to be looking at.
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    uint index = CHFSI_KERNEL_INDEX;
     uint hash;
+    uint prevHash;
+
+#ifdef CHRONO_FSI_USE_CUDA
+    extern __shared__ uint sharedHash[];  // blockSize + 1 elements
     
     // handle case when no. of particles not multiple of block size
     if (index < numObjectsD.numAllMarkers) {
@@ -112,15 +118,24 @@ __global__ void reorderDataAndFindCellStartD(uint* cellStartD,          // outpu
 
     __syncthreads();
 
+    prevHash = sharedHash[threadIdx.x];
+#else
+    // without shared memory, read the hash of the previous particle directly
+    if (index < numObjectsD.numAllMarkers) {
+        hash = gridMarkerHashD[index];
+        prevHash = index > 0 ? gridMarkerHashD[index - 1] : 0;
+    }
+#endif
+
     if (index < numObjectsD.numAllMarkers) {
         // If this particle has a different cell index to the previous particle then
         // it must be the first particle in the cell, so store the index of this particle in
         // the cell. As it isn't the first particle, it must also be the cell end of the previous
         // particle's cell.
-        if (index == 0 || hash != sharedHash[threadIdx.x]) {
+        if (index == 0 || hash != prevHash) {
             cellStartD[hash] = index;
             if (index > 0)
-                cellEndD[sharedHash[threadIdx.x]] = index;
+                cellEndD[prevHash] = index;
         }
 
         if (index == numObjectsD.numAllMarkers - 1)
@@ -178,11 +193,14 @@ __global__ void findCellStartEndD(uint* cellStartD,         // output: cell star
                                   uint* cellEndD,           // output: cell end index
                                   uint* gridMarkerHashD,    // input: sorted grid hashes
                                   uint* gridMarkerIndexD    // input: sorted particle indices
-                                  ) {
-    extern __shared__ uint sharedHash[];  // blockSize + 1 elements
+                                  CHFSI_KERNEL_INDEX_PARAM) {
     // Get the particle index the current thread is supposed to be looking at.
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    uint index = CHFSI_KERNEL_INDEX;
     uint hash;
+    uint prevHash;
+
+#ifdef CHRONO_FSI_USE_CUDA
+    extern __shared__ uint sharedHash[];  // blockSize + 1 elements
     // handle case when no. of particles not multiple of block size
     if (index < numObjectsD.numAllMarkers) {
         hash = gridMarkerHashD[index];
@@ -197,16 +215,25 @@ __global__ void findCellStartEndD(uint* cellStartD,         // output: cell star
 
     __syncthreads();
 
+    prevHash = sharedHash[threadIdx.x];
+#else
+    // without shared memory, read the hash of the previous particle directly
+    if (index < numObjectsD.numAllMarkers) {
+        hash = gridMarkerHashD[index];
+        prevHash = index > 0 ? gridMarkerHashD[index - 1] : 0;
+    }
+#endif
+
     if (index < numObjectsD.numAllMarkers) {
         // If this particle has a different cell index to the previous 
         // particle then it must be the first particle in the cell, 
         // so store the index of this particle in the cell. As it
         // isn't the first particle, it must also be the cell end of 
         // the previous particle's cell.
-        if (index == 0 || hash != sharedHash[threadIdx.x]) {
+        if (index == 0 || hash != prevHash) {
             cellStartD[hash] = index;
             if (index > 0)
-                cellEndD[sharedHash[threadIdx.x]] = index;
+                cellEndD[prevHash] = index;
         }
 
         if (index == numObjectsD.numAllMarkers - 1)
@@ -227,8 +254,8 @@ __global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted partic
                              Real4* rhoPresMuD,          // input: original density pressure
                              Real3* tauXxYyZzD,          // input: original total stress xxyyzz
                              Real3* tauXyXzYzD           // input: original total stress xyzxyz
-                             ) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                             CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers)
         return;
 
@@ -288,8 +315,9 @@ __global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted partic
 }
 // ------------------------------------------------------------------------------
 __global__ void OriginalToSortedD(uint* mapOriginalToSorted,
-                                  uint* gridMarkerIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                  uint* gridMarkerIndex
+                                  CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers)
         return;
 
@@ -340,7 +368,7 @@ void ChCollisionSystemFsi::calcHash() {
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
     // Execute Kernel
-    calcHashD<<<numBlocks, numThreads>>>(U1CAST(markersProximityD->gridMarkerHashD),
+    CHFSI_LAUNCH(calcHashD, numBlocks, numThreads)(U1CAST(markersProximityD->gridMarkerHashD),
         U1CAST(markersProximityD->gridMarkerIndexD), mR4CAST(sphMarkersD->posRadD), isErrorD);
 
     // Check for errors in kernel execution
@@ -377,7 +405,7 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
 
     uint smemSize = sizeof(uint) * (numThreads + 1);
     // Find the start index and the end index of the sorted array in each cell
-    findCellStartEndD<<<numBlocks, numThreads, smemSize>>>(
+    CHFSI_LAUNCH(findCellStartEndD, numBlocks, numThreads, smemSize)(
         U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),          
         U1CAST(markersProximityD->gridMarkerHashD), U1CAST(markersProximityD->gridMarkerIndexD));
     cudaDeviceSynchronize();
@@ -385,12 +413,12 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
 
     // Launch a kernel to find the location of original particles in the sorted arrays.
     // This is faster than using thrust::sort_by_key()
-    OriginalToSortedD<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(OriginalToSortedD, numBlocks, numThreads)(
         U1CAST(markersProximityD->mapOriginalToSorted),
         U1CAST(markersProximityD->gridMarkerIndexD));
 
     // Reorder the arrays according to the sorted index of all particles
-    reorderDataD<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(reorderDataD, numBlocks, numThreads)(
         U1CAST(markersProximityD->gridMarkerIndexD),
         U1CAST(fsiGeneralData->extendedActivityIdD),
         U1CAST(markersProximityD->mapOriginalToSorted),
@@ -403,15 +431,44 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     cudaCheckError();
 }
 // ------------------------------------------------------------------------------
+#ifndef CHRONO_FSI_USE_CUDA
+// Sort the particle indices by cell hash with a counting sort (linear in the number of particles and cells).
+// The sort is stable, so the particles in a cell are ordered as with thrust::sort_by_key on the GPU.
+static void sortByCellHash(thrust::device_vector<uint>& gridMarkerHash,
+                           thrust::device_vector<uint>& gridMarkerIndex,
+                           uint numCells) {
+    size_t numMarkers = gridMarkerHash.size();
+    std::vector<uint> cellOffset(numCells + 1, 0);
+    for (size_t i = 0; i < numMarkers; i++)
+        cellOffset[gridMarkerHash[i] + 1]++;
+    for (uint c = 0; c < numCells; c++)
+        cellOffset[c + 1] += cellOffset[c];
+
+    std::vector<uint> sortedHash(numMarkers);
+    std::vector<uint> sortedIndex(numMarkers);
+    for (size_t i = 0; i < numMarkers; i++) {
+        uint pos = cellOffset[gridMarkerHash[i]]++;
+        sortedHash[pos] = gridMarkerHash[i];
+        sortedIndex[pos] = gridMarkerIndex[i];
+    }
+    std::copy(sortedHash.begin(), sortedHash.end(), gridMarkerHash.begin());
+    std::copy(sortedIndex.begin(), sortedIndex.end(), gridMarkerIndex.begin());
+}
+#endif
+
 void ChCollisionSystemFsi::ArrangeData(std::shared_ptr<SphMarkerDataD> otherSphMarkersD) {
     sphMarkersD = otherSphMarkersD;
     int3 cellsDim = paramsH->gridSize;
     int numCells = cellsDim.x * cellsDim.y * cellsDim.z;
     ResetCellSize(numCells);
     calcHash();
+#ifdef CHRONO_FSI_USE_CUDA
     thrust::sort_by_key(markersProximityD->gridMarkerHashD.begin(), 
         markersProximityD->gridMarkerHashD.end(),
         markersProximityD->gridMarkerIndexD.begin());
+#else
+    sortByCellHash(markersProximityD->gridMarkerHashD, markersProximityD->gridMarkerIndexD, numCells);
+#endif
     reorderDataAndFindCellStart();
 }
 
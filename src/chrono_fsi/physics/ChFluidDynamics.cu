@@ -15,6 +15,8 @@
 // Class for performing time integration in fluid system.
 // =============================================================================
 
+#include <iostream>
+
 #include "chrono_fsi/physics/ChFluidDynamics.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
@@ -59,8 +61,9 @@ __device__ void collideCellDensityReInit(Real& numerator,
 // Kernel to apply periodic BC along x
 __global__ void ApplyPeriodicBoundaryXKernel(Real4* posRadD, 
                                              Real4* rhoPresMuD, 
-                                             uint* activityIdentifierD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                             uint* activityIdentifierD
+                                             CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -95,8 +98,9 @@ __global__ void ApplyPeriodicBoundaryXKernel(Real4* posRadD,
 // Kernel to apply inlet/outlet BC along x
 __global__ void ApplyInletBoundaryXKernel(Real4* posRadD, 
                                           Real3* VelMassD, 
-                                          Real4* rhoPresMuD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                          Real4* rhoPresMuD
+                                          CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -136,8 +140,9 @@ __global__ void ApplyInletBoundaryXKernel(Real4* posRadD,
 // Kernel to apply periodic BC along y
 __global__ void ApplyPeriodicBoundaryYKernel(Real4* posRadD, 
                                              Real4* rhoPresMuD, 
-                                             uint* activityIdentifierD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                             uint* activityIdentifierD
+                                             CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -176,8 +181,9 @@ __global__ void ApplyPeriodicBoundaryYKernel(Real4* posRadD,
 // Kernel to apply periodic BC along z
 __global__ void ApplyPeriodicBoundaryZKernel(Real4* posRadD, 
                                              Real4* rhoPresMuD, 
-                                             uint* activityIdentifierD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                             uint* activityIdentifierD
+                                             CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -216,8 +222,9 @@ __global__ void ApplyPeriodicBoundaryZKernel(Real4* posRadD,
 // Kernel to keep particle inside the simulation domain
 __global__ void ApplyOutOfBoundaryKernel(Real4* posRadD, 
                                          Real4* rhoPresMuD, 
-                                         Real3* velMasD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                         Real3* velMasD
+                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -265,8 +272,9 @@ __global__ void UpdateFluidD(Real4* posRadD,
                              uint* freeSurfaceIdD,
                              int2 updatePortion,
                              Real dT,
-                             volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                             volatile bool* isErrorD
+                             CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     index += updatePortion.x;
     if (index >= updatePortion.y)
         return;
@@ -441,8 +449,9 @@ __global__ void Update_Fluid_State(Real3* new_vel,
                                    Real4* rhoPreMu,
                                    int4 updatePortion,
                                    double dT,
-                                   volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                   volatile bool* isErrorD
+                                   CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= updatePortion.y)
         return;
 
@@ -480,8 +489,9 @@ __global__ void ReCalcDensityD_F1(Real4* dummySortedRhoPreMu,
                                   Real4* sortedRhoPreMu,
                                   uint* gridMarkerIndex,
                                   uint* cellStart,
-                                  uint* cellEnd) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                  uint* cellEnd
+                                  CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -520,8 +530,9 @@ __global__ void UpdateActivityD(Real4* posRadD,
                                 uint* extendedActivityIdD,
                                 int2 updatePortion,
                                 Real Time,
-                                volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                volatile bool* isErrorD
+                                CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     index += updatePortion.x;
     if (index >= updatePortion.y)
         return;
@@ -593,6 +604,7 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
       integrator_type(type),
       verbose(verb) {
     switch (integrator_type) {
+#ifdef CHRONO_FSI_USE_CUDA
         case TimeIntegrator::I2SPH:
             forceSystem = chrono_types::make_shared<ChFsiForceI2SPH>(
                 otherBceWorker, fsiSystem.sortedSphMarkersD, fsiSystem.markersProximityD, 
@@ -610,6 +622,12 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
                 cout << "====== Created an IISPH framework" << endl;
             }
             break;
+#else
+        case TimeIntegrator::I2SPH:
+        case TimeIntegrator::IISPH:
+            // The implicit SPH methods require cuBLAS and cuSPARSE
+            throw std::runtime_error("The implicit SPH methods are not available with the CPU backend of Chrono::FSI");
+#endif
 
         case TimeIntegrator::EXPLICITSPH:
             forceSystem = chrono_types::make_shared<ChFsiForceExplicitSPH>(
@@ -679,7 +697,7 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
     //------------------------
     uint numBlocks, numThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
-    UpdateActivityD<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(UpdateActivityD, numBlocks, numThreads)(
         mR4CAST(sphMarkersD2->posRadD), mR3CAST(sphMarkersD1->velMasD), 
         mR3CAST(fsiBodiesD->posRigid_fsiBodies_D),
         mR3CAST(fsiMeshD->pos_fsi_fea_D),
@@ -711,7 +729,7 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
     //------------------------
     uint numBlocks, numThreads;
     computeGridSize(updatePortion.y - updatePortion.x, 256, numBlocks, numThreads);
-    UpdateFluidD<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(UpdateFluidD, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), 
         mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), 
@@ -752,7 +770,7 @@ void ChFluidDynamics::UpdateFluid_Implicit(std::shared_ptr<SphMarkerDataD> sphMa
     cudaMalloc((void**)&isErrorD, sizeof(bool));
     *isErrorH = false;
     cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
-    Update_Fluid_State<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(Update_Fluid_State, numBlocks, numThreads)(
         mR3CAST(fsiSystem.fsiGeneralData->vel_XSPH_D), 
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD), 
         mR4CAST(sphMarkersD->rhoPresMuD), updatePortion, paramsH->dT, isErrorD);
@@ -772,19 +790,19 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
     uint numBlocks, numThreads;
 
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
-    ApplyPeriodicBoundaryXKernel<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ApplyPeriodicBoundaryXKernel, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryYKernel<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ApplyPeriodicBoundaryYKernel, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryZKernel<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ApplyPeriodicBoundaryZKernel, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
@@ -803,20 +821,20 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
 void ChFluidDynamics::ApplyModifiedBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> sphMarkersD) {
     uint numBlocks, numThreads;
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
-    ApplyInletBoundaryXKernel<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ApplyInletBoundaryXKernel, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD),
         mR4CAST(sphMarkersD->rhoPresMuD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
     // these are useful anyway for out of bound particles
-    ApplyPeriodicBoundaryYKernel<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ApplyPeriodicBoundaryYKernel, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
 
-    ApplyPeriodicBoundaryZKernel<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ApplyPeriodicBoundaryZKernel, numBlocks, numThreads)(
         mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD),
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
@@ -831,7 +849,7 @@ void ChFluidDynamics::DensityReinitialization() {
     thrust::device_vector<Real4> dummySortedRhoPreMu(numObjectsH->numAllMarkers);
     thrust::fill(dummySortedRhoPreMu.begin(), dummySortedRhoPreMu.end(), mR4(0.0));
 
-    ReCalcDensityD_F1<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(ReCalcDensityD_F1, numBlocks, numThreads)(
         mR4CAST(dummySortedRhoPreMu), 
         mR4CAST(fsiSystem.sortedSphMarkersD->posRadD),
         mR3CAST(fsiSystem.sortedSphMarkersD->velMasD), 
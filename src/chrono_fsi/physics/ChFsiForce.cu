@@ -15,12 +15,15 @@
 // Base class for processing sph force in fsi system.//
 // =============================================================================
 
-#include <thrust/extrema.h>
-#include <thrust/sort.h>
 #include "chrono_fsi/physics/ChFsiForce.cuh"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <thrust/extrema.h>
+    #include <thrust/sort.h>
+#endif
+
 //==========================================================================================================================================
 namespace chrono {
 namespace fsi {
@@ -59,6 +62,7 @@ void ChFsiForce::Initialize() {
 ChFsiForce::~ChFsiForce() {}
 
 void ChFsiForce::SetLinearSolver(SolverType type) {
+#ifdef CHRONO_FSI_USE_CUDA
     switch (type) {
         case SolverType::BICGSTAB:
             myLinearSolver = chrono_types::make_shared<ChFsiLinearSolverBiCGStab>();
@@ -71,6 +75,10 @@ void ChFsiForce::SetLinearSolver(SolverType type) {
             std::cout << "The ChFsiLinearSolver you chose has not been implemented, reverting back to "
                          "ChFsiLinearSolverBiCGStab\n";
     }
+#else
+    // The iterative linear solvers (only used by the implicit SPH methods) require cuBLAS and cuSPARSE
+    myLinearSolver = nullptr;
+#endif
 }
 //--------------------------------------------------------------------------------------------------------------------------------
 // Use invasive to avoid one extra copy.
@@ -12,13 +12,15 @@
 // Author: Arman Pazouki, Wei Hu
 // =============================================================================
 
-#include <thrust/extrema.h>
-#include <thrust/remove.h>
-#include <thrust/sort.h>
-
 #include "chrono_fsi/physics/ChFsiForceExplicitSPH.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <thrust/extrema.h>
+    #include <thrust/remove.h>
+    #include <thrust/sort.h>
+#endif
+
 //================================================================================================================================
 namespace chrono {
 namespace fsi {
@@ -30,8 +32,9 @@ __device__ __inline__ void calc_G_Matrix(Real4* sortedPosRad,
                                          Real* G_i,
                                          uint* cellStart,
                                          uint* cellEnd,
-                                         uint* indexOfIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                         uint* indexOfIndex
+                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
@@ -108,8 +111,9 @@ __device__ __inline__ void calc_A_Matrix(Real4* sortedPosRad,
                                          Real* G_i,
                                          uint* cellStart,
                                          uint* cellEnd,
-                                         uint* indexOfIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                         uint* indexOfIndex
+                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
@@ -190,8 +194,9 @@ __device__ __inline__ void calc_L_Matrix(Real4* sortedPosRad,
                                          Real* G_i,
                                          uint* cellStart,
                                          uint* cellEnd,
-                                         uint* indexOfIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                         uint* indexOfIndex
+                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
@@ -329,8 +334,9 @@ __device__ __inline__ void calc_L_Matrix(Real4* sortedPosRad,
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calIndexOfIndex(uint* indexOfIndex,
                                 uint* identityOfIndex,
-                                uint* gridMarkerIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                uint* gridMarkerIndex
+                                CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers)
         return;
 
@@ -356,8 +362,9 @@ __global__ void Shear_Stress_Rate(uint* indexOfIndex,
                                   Real3* sortedDerivTauXyXzYz,
                                   uint* gridMarkerIndex,
                                   uint* cellStart,
-                                  uint* cellEnd) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                  uint* cellEnd
+                                  CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
@@ -390,7 +397,7 @@ __global__ void Shear_Stress_Rate(uint* indexOfIndex,
 
     Real G_i[9] = {0.0};
     calc_G_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, G_i, cellStart, 
-        cellEnd, indexOfIndex);
+        cellEnd, indexOfIndex CHFSI_KERNEL_INDEX_ARG);
 
     // get address in grid
     int3 gridPos = calcGridPos(posRadA);
@@ -478,8 +485,9 @@ __global__ void calcRho_kernel(Real4* sortedPosRad,
                                uint* cellStart,
                                uint* cellEnd,
                                int density_reinit,
-                               volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                               volatile bool* isErrorD
+                               CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -547,8 +555,9 @@ __global__ void calcKernelSupport(Real4* sortedPosRad,
                                   Real3* sortedKernelSupport,
                                   uint* cellStart,
                                   uint* cellEnd,
-                                  volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+                                  volatile bool* isErrorD
+                                  CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
@@ -975,8 +984,8 @@ __device__ inline Real4 LaplacianOperator(float G_i[9],
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void EOS(Real4* sortedRhoPreMu, volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+__global__ void EOS(Real4* sortedRhoPreMu, volatile bool* isErrorD CHFSI_KERNEL_INDEX_PARAM) {
+    uint index = CHFSI_KERNEL_INDEX;
     if (index >= numObjectsD.numAllMarkers)
         return;
     sortedRhoPreMu[index].y = Eos(sortedRhoPreMu[index].x, sortedRhoPreMu[index].w);
@@ -994,8 +1003,9 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
                               uint* gridMarkerIndex,
                               uint* cellStart,
                               uint* cellEnd,
-                              volatile bool* isErrorD) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
@@ -1018,14 +1028,14 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
     Real L_i[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
     if (paramsD.USE_Consistent_G)
         calc_G_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, G_i, cellStart, 
-            cellEnd, indexOfIndex);
+            cellEnd, indexOfIndex CHFSI_KERNEL_INDEX_ARG);
 
     if (paramsD.USE_Consistent_L) {
         Real A_i[27] = {0.0};
         calc_A_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, A_i, G_i, cellStart, 
-            cellEnd, indexOfIndex);
+            cellEnd, indexOfIndex CHFSI_KERNEL_INDEX_ARG);
         calc_L_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, A_i, L_i, G_i, cellStart, 
-            cellEnd, indexOfIndex);
+            cellEnd, indexOfIndex CHFSI_KERNEL_INDEX_ARG);
     }
     float Gi[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
     float Li[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
@@ -1191,8 +1201,9 @@ __global__ void NS_SSR(uint* activityIdentifierD,
                        uint* cellEnd,
                        uint* mapOriginalToSorted,
                        uint* sortedFreeSurfaceIdD,
-                       volatile bool* isErrorD) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                       volatile bool* isErrorD
+                       CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers)
         return;
 
@@ -1472,8 +1483,9 @@ __global__ void CalcVel_XSPH_D(uint* indexOfIndex,
                                uint* gridMarkerIndex,
                                uint* cellStart,
                                uint* cellEnd,
-                               volatile bool* isErrorD) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                               volatile bool* isErrorD
+                               CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
@@ -1542,8 +1554,9 @@ __global__ void CopySortedToOriginal_D(Real4* sortedDerivVelRho,
                                        uint* activityIdentifierD,
                                        uint* mapOriginalToSorted,
                                        uint* originalFreeSurfaceId,
-                                       uint* sortedFreeSurfaceId) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                       uint* sortedFreeSurfaceId
+                                       CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers)
         return;
 
@@ -1568,8 +1581,9 @@ __global__ void CopySortedToOriginal_XSPH_D(Real3* sortedXSPH,
                                             Real3* originalXSPH,
                                             uint* gridMarkerIndex,
                                             uint* activityIdentifierD,
-                                            uint* mapOriginalToSorted) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+                                            uint* mapOriginalToSorted
+                                            CHFSI_KERNEL_INDEX_PARAM) {
+    uint id = CHFSI_KERNEL_INDEX;
     if (id >= numObjectsD.numAllMarkers)
         return;
 
@@ -1651,7 +1665,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Calculate the kernel support of each particle
     if (paramsH->bceTypeWall == BceVersion::ADAMI || paramsH->bceType == BceVersion::ADAMI){
-        calcKernelSupport<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(calcKernelSupport, numBlocks, numThreads)(
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
             mR3CAST(sortedKernelSupport), U1CAST(markersProximityD->cellStartD),
             U1CAST(markersProximityD->cellEndD), isErrorD);
@@ -1662,7 +1676,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     if (density_initialization >= paramsH->densityReinit) {
         thrust::device_vector<Real4> rhoPresMuD_old = sortedSphMarkersD->rhoPresMuD;
         printf("Re-initializing density after %d steps.\n", paramsH->densityReinit);
-        calcRho_kernel<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(calcRho_kernel, numBlocks, numThreads)(
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD), 
             mR4CAST(rhoPresMuD_old), U1CAST(markersProximityD->cellStartD), 
             U1CAST(markersProximityD->cellEndD), density_initialization, isErrorD);
@@ -1677,7 +1691,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
         cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
 
         // execute the kernel Navier_Stokes and Shear_Stress_Rate in one kernel
-        NS_SSR<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(NS_SSR, numBlocks, numThreads)(
             U1CAST(fsiGeneralData->activityIdentifierD), mR4CAST(sortedDerivVelRho), 
             mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz), mR3CAST(sortedXSPHandShift), 
             mR3CAST(sortedKernelSupport), mR4CAST(sortedSphMarkersD->posRadD), 
@@ -1696,13 +1710,13 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
-        calIndexOfIndex<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(calIndexOfIndex, numBlocks, numThreads)(
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), U1CAST(markersProximityD->gridMarkerIndexD));
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // execute the kernel
-        Navier_Stokes<<<numBlocks1, numThreads1>>>(
+        CHFSI_LAUNCH(Navier_Stokes, numBlocks1, numThreads1)(
             U1CAST(indexOfIndex), mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
@@ -1713,7 +1727,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Launch a kernel to copy data from sorted arrays to original arrays.
     // This is faster than using thrust::sort_by_key()
-    CopySortedToOriginal_D<<<numBlocks, numThreads>>>(
+    CHFSI_LAUNCH(CopySortedToOriginal_D, numBlocks, numThreads)(
         mR4CAST(sortedDerivVelRho), mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR3CAST(fsiGeneralData->derivTauXxYyZzD),
         mR3CAST(fsiGeneralData->derivTauXyXzYzD), U1CAST(markersProximityD->gridMarkerIndexD),
@@ -1753,7 +1767,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
     //------------------------------------------------------------------------
     if (paramsH->elastic_SPH) {
         // The XSPH vector already included in the shifting vector
-        CopySortedToOriginal_XSPH_D<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(CopySortedToOriginal_XSPH_D, numBlocks, numThreads)(
             mR3CAST(sortedXSPHandShift), mR3CAST(fsiGeneralData->vel_XSPH_D),
             U1CAST(markersProximityD->gridMarkerIndexD), 
             U1CAST(fsiGeneralData->activityIdentifierD),
@@ -1768,14 +1782,14 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
-        calIndexOfIndex<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(calIndexOfIndex, numBlocks, numThreads)(
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), 
             U1CAST(markersProximityD->gridMarkerIndexD));
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // Execute the kernel
-        CalcVel_XSPH_D<<<numBlocks1, numThreads1>>>(
+        CHFSI_LAUNCH(CalcVel_XSPH_D, numBlocks1, numThreads1)(
             U1CAST(indexOfIndex), mR3CAST(vel_XSPH_Sorted_D),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(sortedXSPHandShift),
@@ -1783,7 +1797,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
             U1CAST(markersProximityD->cellEndD), isErrorD);
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "CalcVel_XSPH_D");
 
-        CopySortedToOriginal_XSPH_D<<<numBlocks, numThreads>>>(
+        CHFSI_LAUNCH(CopySortedToOriginal_XSPH_D, numBlocks, numThreads)(
             mR3CAST(vel_XSPH_Sorted_D), mR3CAST(fsiGeneralData->vel_XSPH_D),
             U1CAST(markersProximityD->gridMarkerIndexD), 
             U1CAST(fsiGeneralData->activityIdentifierD),
@@ -39,8 +39,9 @@ __global__ void calc_A_tensor(Real* A_tensor,
                               uint* csrColInd,
                               uint* numContacts,
                               const size_t numAllMarkers,
-                              volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -120,8 +121,9 @@ __global__ void calc_L_tensor(Real* A_tensor,
                               uint* csrColInd,
                               uint* numContacts,
                               const size_t numAllMarkers,
-                              volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -243,8 +245,9 @@ __global__ void calcRho_kernel(Real4* sortedPosRad,
                                uint* cellEnd,
                                uint* mynumContact,
                                const size_t numAllMarkers,
-                               volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                               volatile bool* isErrorD
+                               CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -310,8 +313,9 @@ __global__ void calcNormalizedRho_kernel(Real4* sortedPosRad,
                                          uint* cellStart,
                                          uint* cellEnd,
                                          const size_t numAllMarkers,
-                                         volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                         volatile bool* isErrorD
+                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers || sortedRhoPreMu[i_idx].w <= -2)
         return;
     //    Real3 gravity = paramsD.gravity;
@@ -432,8 +436,9 @@ __global__ void calcNormalizedRho_Gi_fillInMatrixIndices(Real4* sortedPosRad,
                                                          uint* cellStart,
                                                          uint* cellEnd,
                                                          const size_t numAllMarkers,
-                                                         volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                                         volatile bool* isErrorD
+                                                         CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -575,8 +580,9 @@ __global__ void Function_Gradient_Laplacian_Operator(Real4* sortedPosRad,
                                                      uint* csrColInd,
                                                      uint* numContacts,
                                                      const size_t numAllMarkers,
-                                                     volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                                     volatile bool* isErrorD
+                                                     CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -723,8 +729,9 @@ __global__ void Jacobi_SOR_Iter(Real4* sortedRhoPreMu,
                                 const uint* numContacts,
                                 size_t numAllMarkers,
                                 bool _3dvector,
-                                volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                volatile bool* isErrorD
+                                CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -755,8 +762,9 @@ __global__ void Update_AND_Calc_Res(Real4* sortedRhoPreMu,
                                     Real* Residuals,
                                     const size_t numAllMarkers,
                                     bool _3dvector,
-                                    volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                    volatile bool* isErrorD
+                                    CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -782,8 +790,9 @@ __global__ void Initialize_Variables(Real4* sortedRhoPreMu,
                                      Real3* sortedVelMas,
                                      Real3* V_new,
                                      const size_t numAllMarkers,
-                                     volatile bool* isErrorD) {
-    const uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                                     volatile bool* isErrorD
+                                     CHFSI_KERNEL_INDEX_PARAM) {
+    const uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
@@ -807,8 +816,9 @@ __global__ void UpdateDensity(Real3* vis_vel,
                               uint* cellStart,
                               uint* cellEnd,
                               size_t numAllMarkers,
-                              volatile bool* isErrorD) {
-    uint i_idx = blockIdx.x * blockDim.x + threadIdx.x;
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM) {
+    uint i_idx = CHFSI_KERNEL_INDEX;
     if (i_idx >= numAllMarkers)
         return;
 
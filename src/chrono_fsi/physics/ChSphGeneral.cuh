@@ -17,10 +17,14 @@
 #ifndef CH_SPH_GENERAL_CUH
 #define CH_SPH_GENERAL_CUH
 
-#include <cuda.h>
-#include <cuda_runtime.h>
-#include <cuda_runtime_api.h>
-#include <device_launch_parameters.h>
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda.h>
+    #include <cuda_runtime.h>
+    #include <cuda_runtime_api.h>
+    #include <device_launch_parameters.h>
+#endif
 
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
@@ -436,7 +440,8 @@ __global__ void calc_A_tensor(Real* A_tensor,
                               uint* cellStart,
                               uint* cellEnd,
                               const size_t numAllMarkers,
-                              volatile bool* isErrorD);
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM);
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calc_L_tensor(Real* A_tensor,
                               Real* L_tensor,
@@ -447,7 +452,8 @@ __global__ void calc_L_tensor(Real* A_tensor,
                               uint* cellStart,
                               uint* cellEnd,
                               const size_t numAllMarkers,
-                              volatile bool* isErrorD);
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM);
 
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calcRho_kernel(Real4* sortedPosRad,  // input: sorted positionsmin(
@@ -457,7 +463,8 @@ __global__ void calcRho_kernel(Real4* sortedPosRad,  // input: sorted positionsm
                                uint* cellEnd,
                                uint* mynumContact,
                                const size_t numAllMarkers,
-                               volatile bool* isErrorD);
+                               volatile bool* isErrorD
+                               CHFSI_KERNEL_INDEX_PARAM);
 
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calcNormalizedRho_kernel(Real4* sortedPosRad,  // input: sorted positions
@@ -470,7 +477,8 @@ __global__ void calcNormalizedRho_kernel(Real4* sortedPosRad,  // input: sorted
                                          uint* cellStart,
                                          uint* cellEnd,
                                          const size_t numAllMarkers,
-                                         volatile bool* isErrorD);
+                                         volatile bool* isErrorD
+                                         CHFSI_KERNEL_INDEX_PARAM);
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calcNormalizedRho_Gi_fillInMatrixIndices(Real4* sortedPosRad,  // input: sorted positions
                                                          Real3* sortedVelMas,
@@ -483,7 +491,8 @@ __global__ void calcNormalizedRho_Gi_fillInMatrixIndices(Real4* sortedPosRad,  /
                                                          uint* cellStart,
                                                          uint* cellEnd,
                                                          const size_t numAllMarkers,
-                                                         volatile bool* isErrorD);
+                                                         volatile bool* isErrorD
+                                                         CHFSI_KERNEL_INDEX_PARAM);
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void Function_Gradient_Laplacian_Operator(Real4* sortedPosRad,  // input: sorted positions
                                                      Real3* sortedVelMas,
@@ -497,7 +506,8 @@ __global__ void Function_Gradient_Laplacian_Operator(Real4* sortedPosRad,  // in
                                                      uint* csrColInd,
                                                      uint* numContacts,
                                                      const size_t numAllMarkers,
-                                                     volatile bool* isErrorD);
+                                                     volatile bool* isErrorD
+                                                     CHFSI_KERNEL_INDEX_PARAM);
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void Jacobi_SOR_Iter(Real4* sortedRhoPreMu,
                                 Real* A_Matrix,
@@ -511,7 +521,8 @@ __global__ void Jacobi_SOR_Iter(Real4* sortedRhoPreMu,
                                 const uint* numContacts,
                                 size_t numAllMarkers,
                                 bool _3dvector,
-                                volatile bool* isErrorD);
+                                volatile bool* isErrorD
+                                CHFSI_KERNEL_INDEX_PARAM);
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void Update_AND_Calc_Res(Real4* sortedRhoPreMu,
                                     Real3* V_old,
@@ -521,14 +532,16 @@ __global__ void Update_AND_Calc_Res(Real4* sortedRhoPreMu,
                                     Real* Residuals,
                                     const size_t numAllMarkers,
                                     bool _3dvector,
-                                    volatile bool* isErrorD);
+                                    volatile bool* isErrorD
+                                    CHFSI_KERNEL_INDEX_PARAM);
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void Initialize_Variables(Real4* sortedRhoPreMu,
                                      Real* p_old,
                                      Real3* sortedVelMas,
                                      Real3* V_new,
                                      const size_t numAllMarkers,
-                                     volatile bool* isErrorD);
+                                     volatile bool* isErrorD
+                                     CHFSI_KERNEL_INDEX_PARAM);
 
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void UpdateDensity(Real3* vis_vel,
@@ -540,7 +553,8 @@ __global__ void UpdateDensity(Real3* vis_vel,
                               uint* cellStart,
                               uint* cellEnd,
                               size_t numAllMarkers,
-                              volatile bool* isErrorD);
+                              volatile bool* isErrorD
+                              CHFSI_KERNEL_INDEX_PARAM);
 
 }  // namespace fsi
 }  // namespace chrono
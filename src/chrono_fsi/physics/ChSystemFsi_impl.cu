@@ -17,17 +17,22 @@
 //
 // =============================================================================
 
-#include <thrust/copy.h>
-#include <thrust/gather.h>
-#include <thrust/for_each.h>
-#include <thrust/iterator/counting_iterator.h>
-#include <thrust/functional.h>
-#include <thrust/execution_policy.h>
-#include <thrust/transform.h>
+#include <cassert>
+#include <iostream>
 
 #include "chrono_fsi/physics/ChSystemFsi_impl.cuh"
 #include "chrono_fsi/physics/ChSphGeneral.cuh"
 
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <thrust/copy.h>
+    #include <thrust/gather.h>
+    #include <thrust/for_each.h>
+    #include <thrust/iterator/counting_iterator.h>
+    #include <thrust/functional.h>
+    #include <thrust/execution_policy.h>
+    #include <thrust/transform.h>
+#endif
+
 namespace chrono {
 namespace fsi {
 
@@ -22,12 +22,18 @@
 
 #include "chrono/ChConfig.h"
 
-#include <thrust/device_vector.h>
-#include <thrust/host_vector.h>
-#include <thrust/iterator/detail/normal_iterator.h>
-#include <thrust/iterator/transform_iterator.h>
-#include <thrust/iterator/zip_iterator.h>
-#include <thrust/tuple.h>
+#include "chrono_fsi/ChConfigFSI.h"
+
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <thrust/device_vector.h>
+    #include <thrust/host_vector.h>
+    #include <thrust/iterator/detail/normal_iterator.h>
+    #include <thrust/iterator/transform_iterator.h>
+    #include <thrust/iterator/zip_iterator.h>
+    #include <thrust/tuple.h>
+#else
+    #include "chrono_fsi/cpu/ChFsiCpuThrust.h"
+#endif
 
 #include "chrono_fsi/physics/ChFsiGeneral.h"
 #include "chrono_fsi/math/custom_math.h"
@@ -18,10 +18,17 @@
 #ifndef CH_UTILS_DEVICE_H
 #define CH_UTILS_DEVICE_H
 
-#include <cuda_runtime.h>
+#include "chrono_fsi/ChConfigFSI.h"
 
-#include <thrust/device_vector.h>
-#include <thrust/host_vector.h>
+#ifdef CHRONO_FSI_USE_CUDA
+    #include <cuda_runtime.h>
+    #include <thrust/device_vector.h>
+    #include <thrust/host_vector.h>
+#else
+    #include "chrono_fsi/cpu/ChFsiCpuLaunch.h"
+    #include "chrono_fsi/cpu/ChFsiCpuRuntime.h"
+    #include "chrono_fsi/cpu/ChFsiCpuThrust.h"
+#endif
 
 #include "chrono/core/ChTypes.h"
 
@@ -85,6 +92,31 @@ typedef unsigned int uint;
     #define CUDA_KERNEL_DIM(...) << <__VA_ARGS__>>>
 #endif
 
+// ----------------------------------------------------------------------------
+// Kernel launches
+// ----------------------------------------------------------------------------
+
+// Global index of the current thread in a kernel launched over a 1D grid.
+// With the CPU backend, kernels receive this index as an additional (last) argument, see ChFsiCpuLaunch.
+// Device functions that use the index declare the same parameter and are called with CHFSI_KERNEL_INDEX_ARG.
+#ifdef CHRONO_FSI_USE_CUDA
+    #define CHFSI_KERNEL_INDEX_PARAM
+    #define CHFSI_KERNEL_INDEX_ARG
+    #define CHFSI_KERNEL_INDEX (blockIdx.x * blockDim.x + threadIdx.x)
+#else
+    #define CHFSI_KERNEL_INDEX_PARAM , unsigned int chfsi_kernel_index
+    #define CHFSI_KERNEL_INDEX_ARG , chfsi_kernel_index
+    #define CHFSI_KERNEL_INDEX chfsi_kernel_index
+#endif
+
+// Launch a kernel, as in CHFSI_LAUNCH(kernel, numBlocks, numThreads[, sharedMemSize])(arguments).
+#ifdef CHRONO_FSI_USE_CUDA
+    #define CHFSI_LAUNCH(kernel, ...) kernel<<<__VA_ARGS__>>>
+#else
+    #define CHFSI_LAUNCH(kernel, ...) \
+        ChFsiCpuLaunch([](auto... chfsi_args) { kernel(chfsi_args...); }, __VA_ARGS__)
+#endif
+
 // ----------------------------------------------------------------------------
 // Values
 // ----------------------------------------------------------------------------
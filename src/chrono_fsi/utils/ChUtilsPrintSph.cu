@@ -14,7 +14,6 @@
 //
 // Utility function to print the save fluid, bce, and boundary data to files
 // =============================================================================
-#include <thrust/reduce.h>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
@@ -16,8 +16,6 @@
 // =============================================================================
 #ifndef CHUTILSPRINTSPH_H
 #define CHUTILSPRINTSPH_H
-#include <thrust/device_vector.h>
-#include <thrust/host_vector.h>
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/utils/ChUtilsDevice.cuh"
 #include "chrono_fsi/physics/ChParams.h"
@@ -20,8 +20,7 @@
 
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/math/custom_math.h"
-#include <thrust/device_vector.h>
-#include <thrust/host_vector.h>
+#include "chrono_fsi/utils/ChUtilsDevice.cuh"
 
 namespace chrono {
 namespace fsi {
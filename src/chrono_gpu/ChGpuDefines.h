@@ -15,11 +15,18 @@
 #pragma once
 
 #include <climits>
-#include <cuda_runtime.h>
 #include <cstdio>
 #include <cstdlib>
 #include <functional>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda_runtime.h>
+#else
+    #include "chrono_gpu/cpu/ChGpuCpuRuntime.h"
+#endif
+
 namespace chrono {
 namespace gpu {
 
@@ -0,0 +1,36 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Execution of Chrono::Gpu per-thread kernels on the CPU.
+// A kernel launch over a 1D grid is emulated with an OpenMP parallel loop over
+// the global thread indices. Kernels obtain their index from the additional
+// argument declared with CHGPU_KERNEL_INDEX_PARAM (see ChGpuHelpers.cuh), so no
+// CUDA built-in variables are emulated. Kernels which use block-collective
+// operations (shared memory, __syncthreads) cannot be executed this way.
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono_gpu/cpu/ChGpuCpuRuntime.h"
+
+/// Execute the given kernel over a 1D grid of nBlocks blocks with nThreads threads each.
+/// The kernel is called with the given arguments, followed by the global thread index. The call returns once all
+/// threads are done (as if followed by a device synchronization).
+template <typename Kernel, typename... Args>
+void ChGpuCpuLaunch(unsigned int nBlocks, unsigned int nThreads, Kernel kernel, const Args&... args) {
+    const long long n = (long long)nBlocks * nThreads;
+#pragma omp parallel for schedule(static)
+    for (long long i = 0; i < n; i++) {
+        kernel(args..., (unsigned int)i);
+    }
+}
@@ -0,0 +1,224 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Host replacements for the subset of the CUDA runtime used by Chrono::Gpu.
+// Included (instead of the CUDA headers) when Chrono::Gpu is built with the
+// OpenMP CPU backend. Vector types have the same layout as their CUDA
+// counterparts, "managed" memory is plain host memory, and the atomic
+// operations used in the device functions are implemented with compiler
+// intrinsics so that they can be called from OpenMP parallel regions.
+//
+// =============================================================================
+
+#pragma once
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Function execution space and variable memory space specifiers
+// -----------------------------------------------------------------------------
+
+#ifndef __host__
+    #define __host__
+#endif
+#ifndef __device__
+    #define __device__
+#endif
+#ifndef __global__
+    #define __global__
+#endif
+#ifndef __forceinline__
+    #define __forceinline__ inline
+#endif
+
+// -----------------------------------------------------------------------------
+// Built-in vector types
+// -----------------------------------------------------------------------------
+
+struct int3 {
+    int x, y, z;
+};
+
+struct float3 {
+    float x, y, z;
+};
+
+struct double3 {
+    double x, y, z;
+};
+
+struct longlong3 {
+    long long int x, y, z;
+};
+
+inline int3 make_int3(int x, int y, int z) {
+    return {x, y, z};
+}
+
+inline float3 make_float3(float x, float y, float z) {
+    return {x, y, z};
+}
+
+inline double3 make_double3(double x, double y, double z) {
+    return {x, y, z};
+}
+
+inline longlong3 make_longlong3(long long int x, long long int y, long long int z) {
+    return {x, y, z};
+}
+
+// -----------------------------------------------------------------------------
+// Runtime API
+// -----------------------------------------------------------------------------
+
+enum cudaError { cudaSuccess = 0, cudaErrorMemoryAllocation = 2, cudaErrorNotSupported = 801 };
+typedef enum cudaError cudaError_t;
+
+enum cudaMemoryAdvise { cudaMemAdviseSetReadMostly = 1 };
+
+#define cudaMemAttachGlobal 0x01
+
+inline const char* cudaGetErrorString(cudaError_t error) {
+    switch (error) {
+        case cudaSuccess:
+            return "no error";
+        case cudaErrorMemoryAllocation:
+            return "out of memory";
+        default:
+            return "operation not supported";
+    }
+}
+
+/// Allocate host memory (there is no distinction between host and device memory with the CPU backend).
+template <typename T>
+inline cudaError_t cudaMallocManaged(T** ptr, size_t size, unsigned int flags = cudaMemAttachGlobal) {
+    *ptr = static_cast<T*>(std::malloc(size > 0 ? size : 1));
+    if (*ptr == nullptr)
+        return cudaErrorMemoryAllocation;
+    std::memset(*ptr, 0, size);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaFree(void* ptr) {
+    std::free(ptr);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaGetDevice(int* device) {
+    *device = 0;
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemAdvise(const void* ptr, size_t count, cudaMemoryAdvise advice, int device) {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaDeviceSynchronize() {
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaPeekAtLastError() {
+    return cudaSuccess;
+}
+
+// -----------------------------------------------------------------------------
+// Math functions and constants
+// -----------------------------------------------------------------------------
+
+inline float rsqrt(float x) {
+    return 1.0f / std::sqrt(x);
+}
+
+inline double rsqrt(double x) {
+    return 1.0 / std::sqrt(x);
+}
+
+// Directed-rounding intrinsics; the host versions use the current (round-to-nearest) mode.
+inline double __drcp_ru(double x) {
+    return 1.0 / x;
+}
+
+inline double __dmul_ru(double x, double y) {
+    return x * y;
+}
+
+#define CUDART_PI_F 3.141592654f
+#define CUDART_PI 3.1415926535897931e+0
+
+// -----------------------------------------------------------------------------
+// Atomic functions (safe to call concurrently from OpenMP threads)
+// -----------------------------------------------------------------------------
+
+inline unsigned int atomicCAS(unsigned int* address, unsigned int compare, unsigned int val) {
+#if defined(_MSC_VER)
+    return (unsigned int)_InterlockedCompareExchange((volatile long*)address, (long)val, (long)compare);
+#else
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return compare;
+#endif
+}
+
+inline unsigned int atomicAdd(unsigned int* address, unsigned int val) {
+#if defined(_MSC_VER)
+    return (unsigned int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_SEQ_CST);
+#endif
+}
+
+inline float atomicAdd(float* address, float val) {
+    static_assert(sizeof(float) == sizeof(unsigned int), "unexpected float size");
+    unsigned int* address_as_uint = reinterpret_cast<unsigned int*>(address);
+    unsigned int old = *address_as_uint;
+    unsigned int assumed;
+    float old_val;
+    do {
+        assumed = old;
+        std::memcpy(&old_val, &assumed, sizeof(float));
+        float new_val = old_val + val;
+        unsigned int new_bits;
+        std::memcpy(&new_bits, &new_val, sizeof(float));
+        old = atomicCAS(address_as_uint, assumed, new_bits);
+    } while (assumed != old);
+    return old_val;
+}
+
+inline double atomicAdd(double* address, double val) {
+    static_assert(sizeof(double) == sizeof(unsigned long long int), "unexpected double size");
+    unsigned long long int* address_as_ull = reinterpret_cast<unsigned long long int*>(address);
+    unsigned long long int old = *address_as_ull;
+    unsigned long long int assumed;
+    double old_val;
+    do {
+        assumed = old;
+        std::memcpy(&old_val, &assumed, sizeof(double));
+        double new_val = old_val + val;
+        unsigned long long int new_bits;
+        std::memcpy(&new_bits, &new_val, sizeof(double));
+#if defined(_MSC_VER)
+        old = (unsigned long long int)_InterlockedCompareExchange64((volatile long long*)address_as_ull,
+                                                                    (long long)new_bits, (long long)assumed);
+#else
+        old = assumed;
+        __atomic_compare_exchange_n(address_as_ull, &old, new_bits, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+    } while (assumed != old);
+    return old_val;
+}
+
+inline void __threadfence() {}
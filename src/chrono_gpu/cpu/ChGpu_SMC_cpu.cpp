@@ -0,0 +1,489 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// OpenMP CPU implementation of the ChSystemGpu_impl compute kernels.
+// This file replaces ChGpu_SMC.cu when Chrono::Gpu is built without CUDA.
+// Per-sphere kernels are shared with the CUDA implementation and executed with
+// ChGpuCpuLaunch; the block-collective kernels (SD binning, contact detection,
+// and frictionless force evaluation) are reimplemented as OpenMP loops over
+// SDs, with the SD-local sphere data cached in thread-private arrays.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "chrono_gpu/cpu/ChGpu_SMC_cpu.h"
+#include "chrono_gpu/utils/ChGpuUtilities.h"
+
+namespace chrono {
+namespace gpu {
+
+// -----------------------------------------------------------------------------
+// CPU versions of the block-collective kernels
+// -----------------------------------------------------------------------------
+
+void countSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                unsigned int nSpheres,
+                                ChSystemGpu_impl::GranParamsPtr gran_params) {
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)nSpheres; i++) {
+        unsigned int SDsTouched[MAX_SDs_TOUCHED_BY_SPHERE] = {NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID};
+        int3 ownerSD_triplet = SDIDTriplet(sphere_data->sphere_owner_SDs[i], gran_params);
+        figureOutTouchedSD(sphere_data->sphere_local_pos_X[i], sphere_data->sphere_local_pos_Y[i],
+                           sphere_data->sphere_local_pos_Z[i], ownerSD_triplet, SDsTouched, gran_params);
+
+        for (unsigned int k = 0; k < MAX_SDs_TOUCHED_BY_SPHERE; k++) {
+            if (SDsTouched[k] != NULL_CHGPU_ID)
+                atomicAdd(sphere_data->SD_NumSpheresTouching + SDsTouched[k], 1u);
+        }
+    }
+}
+
+void sortSpheresInEachSD(ChSystemGpu_impl::GranSphereDataPtr sphere_data, unsigned int nSDs) {
+#pragma omp parallel for schedule(static)
+    for (int sd = 0; sd < (int)nSDs; sd++) {
+        unsigned int* first = sphere_data->spheres_in_SD_composite + sphere_data->SD_SphereCompositeOffsets[sd];
+        std::sort(first, first + sphere_data->SD_NumSpheresTouching[sd]);
+    }
+}
+
+unsigned int loadSpheresInSD(unsigned int thisSD,
+                             ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                             ChSystemGpu_impl::GranParamsPtr gran_params,
+                             unsigned int* sphIDs,
+                             int3* sphere_pos,
+                             float3* sphere_vel,
+                             not_stupid_bool* sphere_fixed) {
+    unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[thisSD];
+    if (spheresTouchingThisSD > MAX_COUNT_OF_SPHERES_PER_SD) {
+        ABORTABORTABORT("TOO MANY SPHERES! SD %u has %u spheres\n", thisSD, spheresTouchingThisSD);
+    }
+
+    const unsigned int* composite =
+        sphere_data->spheres_in_SD_composite + sphere_data->SD_SphereCompositeOffsets[thisSD];
+    for (unsigned int i = 0; i < spheresTouchingThisSD; i++) {
+        unsigned int mySphereID = composite[i];
+        sphIDs[i] = mySphereID;
+        sphere_pos[i] = make_int3(sphere_data->sphere_local_pos_X[mySphereID],
+                                  sphere_data->sphere_local_pos_Y[mySphereID],
+                                  sphere_data->sphere_local_pos_Z[mySphereID]);
+        // if this SD doesn't own that sphere, add an offset to account
+        unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[mySphereID];
+        if (sphere_owner_SD != thisSD) {
+            sphere_pos[i] = sphere_pos[i] + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
+        }
+        if (sphere_vel) {
+            sphere_vel[i] = make_float3(sphere_data->pos_X_dt[mySphereID], sphere_data->pos_Y_dt[mySphereID],
+                                        sphere_data->pos_Z_dt[mySphereID]);
+        }
+        sphere_fixed[i] = sphere_data->sphere_fixed[mySphereID];
+    }
+
+    return spheresTouchingThisSD;
+}
+
+void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                           ChSystemGpu_impl::GranParamsPtr gran_params,
+                           unsigned int nSDs) {
+#pragma omp parallel
+    {
+        // SD-local sphere data, reused for all SDs processed by this thread
+        std::vector<int3> sphere_pos_local(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<unsigned int> sphIDs(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<not_stupid_bool> sphFixed(MAX_COUNT_OF_SPHERES_PER_SD);
+
+#pragma omp for schedule(dynamic, 64)
+        for (int sd = 0; sd < (int)nSDs; sd++) {
+            unsigned int thisSD = (unsigned int)sd;
+            if (sphere_data->SD_NumSpheresTouching[thisSD] == 0)
+                continue;
+
+            unsigned int spheresTouchingThisSD = loadSpheresInSD(thisSD, sphere_data, gran_params, sphIDs.data(),
+                                                                 sphere_pos_local.data(), nullptr, sphFixed.data());
+
+            // Each body looks at each other body and determines whether that body is touching it
+            for (unsigned int bodyA = 0; bodyA < spheresTouchingThisSD; bodyA++) {
+                unsigned int bodyB_list[MAX_SPHERES_TOUCHED_BY_SPHERE];
+                unsigned int ncontacts = 0;
+
+                for (unsigned int bodyB = 0; bodyB < spheresTouchingThisSD; bodyB++) {
+                    if (bodyA == bodyB || (sphFixed[bodyA] && sphFixed[bodyB])) {
+                        continue;
+                    }
+
+                    bool active_contact = checkSpheresContacting_int(sphere_pos_local[bodyA], sphere_pos_local[bodyB],
+                                                                     thisSD, gran_params);
+                    if (active_contact) {
+                        if (ncontacts >= MAX_SPHERES_TOUCHED_BY_SPHERE) {
+                            ABORTABORTABORT("Sphere %u is touching 12 spheres already and we just found another!!!\n",
+                                            sphIDs[bodyA]);
+                        }
+                        bodyB_list[ncontacts] = bodyB;
+                        ncontacts++;
+                    }
+                }
+
+                // for each contact we just found, mark it in the global map
+                for (unsigned int contact_id = 0; contact_id < ncontacts; contact_id++) {
+                    findContactPairInfo(sphere_data, gran_params, sphIDs[bodyA], sphIDs[bodyB_list[contact_id]]);
+                }
+            }
+        }
+    }
+}
+
+// Compute sphere-sphere forces (frictionless) and external forces on each sphere.
+// A sphere contributes to the SDs it touches; each SD adds the forces from contacts with contact point inside it.
+template <bool use_mat_based>
+static void computeSphereForces_frictionless_impl(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                  ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                  BC_type* bc_type_list,
+                                                  BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                                  unsigned int nBCs,
+                                                  unsigned int nSDs) {
+#pragma omp parallel
+    {
+        // SD-local sphere data, reused for all SDs processed by this thread
+        std::vector<int3> sphere_pos(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<float3> sphere_vel(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<unsigned int> sphIDs(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<not_stupid_bool> sphere_fixed(MAX_COUNT_OF_SPHERES_PER_SD);
+
+#pragma omp for schedule(dynamic, 64)
+        for (int sd = 0; sd < (int)nSDs; sd++) {
+            unsigned int thisSD = (unsigned int)sd;
+            if (sphere_data->SD_NumSpheresTouching[thisSD] == 0)
+                continue;
+
+            unsigned int spheresTouchingThisSD = loadSpheresInSD(thisSD, sphere_data, gran_params, sphIDs.data(),
+                                                                 sphere_pos.data(), sphere_vel.data(),
+                                                                 sphere_fixed.data());
+
+            for (unsigned int bodyA = 0; bodyA < spheresTouchingThisSD; bodyA++) {
+                unsigned int mySphereID = sphIDs[bodyA];
+                unsigned int ncontacts = 0;
+
+                // Force generated on this sphere
+                float3 bodyA_force = {0.f, 0.f, 0.f};
+
+                for (unsigned int bodyB = 0; bodyB < spheresTouchingThisSD; bodyB++) {
+                    if (bodyA == bodyB || (sphere_fixed[bodyA] && sphere_fixed[bodyB])) {
+                        continue;
+                    }
+                    if (!checkSpheresContacting_int(sphere_pos[bodyA], sphere_pos[bodyB], thisSD, gran_params)) {
+                        continue;
+                    }
+                    if (ncontacts >= MAX_SPHERES_TOUCHED_BY_SPHERE) {
+                        ABORTABORTABORT("Sphere %u is touching 12 spheres already and we just found another!!!\n",
+                                        mySphereID);
+                    }
+                    ncontacts++;
+
+                    float3 vrel_t;  // unused but needed for function signature
+                    float3 force_accum;
+                    if (use_mat_based) {
+                        float sqrt_Rd;  // unused but needed for function signature
+                        float beta;
+                        float3 contact_normal;
+                        force_accum = computeSphereNormalForces_matBased(vrel_t, contact_normal, sqrt_Rd, beta,
+                                                                         sphere_pos[bodyA], sphere_pos[bodyB],
+                                                                         sphere_vel[bodyA], sphere_vel[bodyB],
+                                                                         gran_params);
+                        // Add cohesion term
+                        force_accum =
+                            force_accum - gran_params->sphere_mass_SU * gran_params->cohesionAcc_s2s * contact_normal;
+                    } else {
+                        float reciplength;  // used to compute contact normal
+                        float3 delta_r;     // used for contact normal
+                        force_accum = computeSphereNormalForces(reciplength, vrel_t, delta_r, sphere_pos[bodyA],
+                                                                sphere_pos[bodyB], sphere_vel[bodyA], sphere_vel[bodyB],
+                                                                gran_params);
+                        // Add cohesion term
+                        force_accum = force_accum - gran_params->sphere_mass_SU * gran_params->cohesionAcc_s2s *
+                                                        delta_r * reciplength;
+                    }
+                    bodyA_force = bodyA_force + force_accum;
+                }
+
+                // If this SD owns the body, add its wall, BC, and grav forces
+                unsigned int myOwnerSD = sphere_data->sphere_owner_SDs[mySphereID];
+                if (myOwnerSD == thisSD) {
+                    applyExternalForces_frictionless(myOwnerSD, sphere_pos[bodyA], sphere_vel[bodyA], bodyA_force,
+                                                     gran_params, sphere_data, bc_type_list, bc_params_list, nBCs);
+                }
+
+                // Spheres touching several SDs receive contributions from different threads
+                atomicAdd(sphere_data->sphere_acc_X + mySphereID, bodyA_force.x / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Y + mySphereID, bodyA_force.y / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Z + mySphereID, bodyA_force.z / gran_params->sphere_mass_SU);
+            }
+        }
+    }
+}
+
+void computeSphereForces_frictionless(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                      ChSystemGpu_impl::GranParamsPtr gran_params,
+                                      BC_type* bc_type_list,
+                                      BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                      unsigned int nBCs,
+                                      unsigned int nSDs) {
+    computeSphereForces_frictionless_impl<false>(sphere_data, gran_params, bc_type_list, bc_params_list, nBCs, nSDs);
+}
+
+void computeSphereForces_frictionless_matBased(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                               BC_type* bc_type_list,
+                                               BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                               unsigned int nBCs,
+                                               unsigned int nSDs) {
+    computeSphereForces_frictionless_impl<true>(sphere_data, gran_params, bc_type_list, bc_params_list, nBCs, nSDs);
+}
+
+// -----------------------------------------------------------------------------
+// ChSystemGpu_impl members implemented by the compute backend
+// -----------------------------------------------------------------------------
+
+int3 ChSystemGpu_impl::getSDTripletFromID(unsigned int SD_ID) const {
+    return SDIDTriplet(SD_ID, gran_params);
+}
+
+float ChSystemGpu_impl::computeArray3SquaredSum(std::vector<float, cudallocator<float>>& arrX,
+                                                std::vector<float, cudallocator<float>>& arrY,
+                                                std::vector<float, cudallocator<float>>& arrZ,
+                                                size_t nSpheres) {
+    const unsigned int threadsPerBlock = 1024;
+    unsigned int nBlocks = (unsigned int)((nSpheres + threadsPerBlock - 1) / threadsPerBlock);
+    ChGpuCpuLaunch(nBlocks, threadsPerBlock, elementalArray3Squared<float>, sphere_data->sphere_stats_buffer,
+                   arrX.data(), arrY.data(), arrZ.data(), nSpheres);
+
+    // Put the reduced result at the last element of sphere_stats_buffer array (as the CUDA implementation does)
+    float* buffer = sphere_data->sphere_stats_buffer;
+    buffer[nSpheres] = std::accumulate(buffer, buffer + nSpheres, 0.0f);
+    return buffer[nSpheres];
+}
+
+double ChSystemGpu_impl::GetMaxParticleZ(bool getMax) {
+    size_t nSpheres = sphere_local_pos_Z.size();
+    if (nSpheres == 0)
+        CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
+
+    const unsigned int threadsPerBlock = 1024;
+    unsigned int nBlocks = (unsigned int)((nSpheres + threadsPerBlock - 1) / threadsPerBlock);
+    ChGpuCpuLaunch(nBlocks, threadsPerBlock, elementalZLocalToGlobal, sphere_data->sphere_stats_buffer, sphere_data,
+                   nSpheres, gran_params);
+
+    float* buffer = sphere_data->sphere_stats_buffer;
+    buffer[nSpheres] = getMax ? *std::max_element(buffer, buffer + nSpheres)  //
+                              : *std::min_element(buffer, buffer + nSpheres);
+    return buffer[nSpheres];
+}
+
+unsigned int ChSystemGpu_impl::GetNumParticleAboveZ(float ZValue) {
+    size_t nSpheres = sphere_local_pos_Z.size();
+    if (nSpheres == 0)
+        CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
+
+    const unsigned int threadsPerBlock = 1024;
+    unsigned int nBlocks = (unsigned int)((nSpheres + threadsPerBlock - 1) / threadsPerBlock);
+    ChGpuCpuLaunch(nBlocks, threadsPerBlock, elementalZAboveValue, sphere_data->sphere_stats_buffer_int, sphere_data,
+                   nSpheres, gran_params, ZValue);
+
+    unsigned int* buffer = sphere_data->sphere_stats_buffer_int;
+    buffer[nSpheres] = std::accumulate(buffer, buffer + nSpheres, 0u);
+    return buffer[nSpheres];
+}
+
+unsigned int ChSystemGpu_impl::GetNumParticleAboveX(float XValue) {
+    size_t nSpheres = sphere_local_pos_X.size();
+    if (nSpheres == 0)
+        CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
+
+    const unsigned int threadsPerBlock = 1024;
+    unsigned int nBlocks = (unsigned int)((nSpheres + threadsPerBlock - 1) / threadsPerBlock);
+    ChGpuCpuLaunch(nBlocks, threadsPerBlock, elementalXAboveValue, sphere_data->sphere_stats_buffer_int, sphere_data,
+                   nSpheres, gran_params, XValue);
+
+    unsigned int* buffer = sphere_data->sphere_stats_buffer_int;
+    buffer[nSpheres] = std::accumulate(buffer, buffer + nSpheres, 0u);
+    return buffer[nSpheres];
+}
+
+// Reset broadphase data structures
+void ChSystemGpu_impl::resetBroadphaseInformation() {
+    std::fill(SD_NumSpheresTouching.begin(), SD_NumSpheresTouching.end(), 0);
+    std::fill(SD_SphereCompositeOffsets.begin(), SD_SphereCompositeOffsets.end(), 0);
+    std::fill(spheres_in_SD_composite.begin(), spheres_in_SD_composite.end(), NULL_CHGPU_ID);
+}
+
+// Reset sphere acceleration data structures
+void ChSystemGpu_impl::resetSphereAccelerations() {
+    // cache past acceleration data
+    if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
+        std::copy(sphere_acc_X.begin(), sphere_acc_X.begin() + nSpheres, sphere_acc_X_old.begin());
+        std::copy(sphere_acc_Y.begin(), sphere_acc_Y.begin() + nSpheres, sphere_acc_Y_old.begin());
+        std::copy(sphere_acc_Z.begin(), sphere_acc_Z.begin() + nSpheres, sphere_acc_Z_old.begin());
+        // if we have multistep AND friction, cache old alphas
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            std::copy(sphere_ang_acc_X.begin(), sphere_ang_acc_X.begin() + nSpheres, sphere_ang_acc_X_old.begin());
+            std::copy(sphere_ang_acc_Y.begin(), sphere_ang_acc_Y.begin() + nSpheres, sphere_ang_acc_Y_old.begin());
+            std::copy(sphere_ang_acc_Z.begin(), sphere_ang_acc_Z.begin() + nSpheres, sphere_ang_acc_Z_old.begin());
+        }
+    }
+
+    // reset current accelerations to zero
+    std::fill(sphere_acc_X.begin(), sphere_acc_X.begin() + nSpheres, 0.0f);
+    std::fill(sphere_acc_Y.begin(), sphere_acc_Y.begin() + nSpheres, 0.0f);
+    std::fill(sphere_acc_Z.begin(), sphere_acc_Z.begin() + nSpheres, 0.0f);
+
+    // reset torques to zero, if applicable
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        std::fill(sphere_ang_acc_X.begin(), sphere_ang_acc_X.begin() + nSpheres, 0.0f);
+        std::fill(sphere_ang_acc_Y.begin(), sphere_ang_acc_Y.begin() + nSpheres, 0.0f);
+        std::fill(sphere_ang_acc_Z.begin(), sphere_ang_acc_Z.begin() + nSpheres, 0.0f);
+    }
+}
+
+float ChSystemGpu_impl::get_max_vel() const {
+    float max_vel2 = 0;
+    for (unsigned int i = 0; i < nSpheres; i++) {
+        float v2 = pos_X_dt[i] * pos_X_dt[i] + pos_Y_dt[i] * pos_Y_dt[i] + pos_Z_dt[i] * pos_Z_dt[i];
+        max_vel2 = std::max(max_vel2, v2);
+    }
+    return std::sqrt(max_vel2);
+}
+
+// Same three stages as the CUDA implementation: count the spheres touching each SD, compute the offsets into the
+// composite array with a prefix scan, and populate the composite array. The spheres in each SD are then sorted.
+void ChSystemGpu_impl::runSphereBroadphase() {
+    METRICS_PRINTF("Resetting broadphase info!\n");
+
+    // reset the number of spheres per SD, the offsets in the big composite array, and the big fat composite array
+    resetBroadphaseInformation();
+
+    // First stage: figure out how many spheres touch each SD
+    countSpheresTouchingEachSD(sphere_data, nSpheres, gran_params);
+
+    // Second stage: exclusive prefix scan
+    unsigned int* out_ptr = SD_SphereCompositeOffsets.data();
+    unsigned int* in_ptr = SD_NumSpheresTouching.data();
+    unsigned int num_entries = 0;
+    for (unsigned int sd = 0; sd < nSDs; sd++) {
+        out_ptr[sd] = num_entries;
+        num_entries += in_ptr[sd];
+    }
+
+    // Last stage: assemble the big composite array
+    spheres_in_SD_composite.resize(num_entries, NULL_CHGPU_ID);
+    sphere_data->spheres_in_SD_composite = spheres_in_SD_composite.data();
+
+    // Copy the offsets in the scratch pad; populating the composite array steps on the outcome of the prefix scan
+    std::copy(SD_SphereCompositeOffsets.begin(), SD_SphereCompositeOffsets.begin() + nSDs,
+              SD_SphereCompositeOffsets_ScratchPad.begin());
+
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, populateSpheresInEachSD, sphere_data, nSpheres, gran_params);
+
+    sortSpheresInEachSD(sphere_data, nSDs);
+}
+
+void ChSystemGpu_impl::convertToLocalPositions(int64_t* sphere_pos_global_X,
+                                               int64_t* sphere_pos_global_Y,
+                                               int64_t* sphere_pos_global_Z) {
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, initializeLocalPositions, sphere_data, sphere_pos_global_X,
+                   sphere_pos_global_Y, sphere_pos_global_Z, nSpheres, gran_params);
+}
+
+void ChSystemGpu_impl::shiftBDFrame(int64_t3 offset_delta) {
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, applyBDFrameChange, offset_delta, sphere_data, nSpheres,
+                   gran_params);
+}
+
+double ChSystemGpu_impl::AdvanceSimulation(float duration) {
+    // Figure our the number of blocks that need to be launched to cover the box
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    // Settling simulation loop.
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+    float time_elapsed_SU = 0;  // time elapsed in this advance call
+
+    packSphereDataPointers();
+
+    for (unsigned int n = 0; n < nsteps; n++) {
+        updateBCPositions();
+        runSphereBroadphase();
+        resetSphereAccelerations();
+        resetBCForces();
+
+        METRICS_PRINTF("Starting computeSphereForces!\n");
+
+        if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            // Compute sphere-sphere forces
+            if (gran_params->use_mat_based == true) {
+                computeSphereForces_frictionless_matBased(sphere_data, gran_params, BC_type_list.data(),
+                                                          BC_params_list_SU.data(),
+                                                          (unsigned int)BC_params_list_SU.size(), nSDs);
+            } else {
+                computeSphereForces_frictionless(sphere_data, gran_params, BC_type_list.data(),
+                                                 BC_params_list_SU.data(), (unsigned int)BC_params_list_SU.size(),
+                                                 nSDs);
+            }
+        } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
+                   gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
+            // figure out who is contacting
+            determineContactPairs(sphere_data, gran_params, nSDs);
+
+            if (gran_params->use_mat_based == true) {
+                ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, computeSphereContactForces_matBased, sphere_data,
+                               gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                               (unsigned int)BC_params_list_SU.size(), nSpheres);
+            } else {
+                ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, computeSphereContactForces, sphere_data, gran_params,
+                               BC_type_list.data(), BC_params_list_SU.data(), (unsigned int)BC_params_list_SU.size(),
+                               nSpheres);
+            }
+        }
+
+        METRICS_PRINTF("Starting integrateSpheres!\n");
+        ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, integrateSpheres, stepSize_SU, sphere_data, nSpheres,
+                       gran_params);
+
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
+            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+            unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
+
+            METRICS_PRINTF("Update Friction Data!\n");
+            ChGpuCpuLaunch(nBlocksFricHistoryPostProcess, nThreadsUpdateHist, updateFrictionData, fricMapSize,
+                           sphere_data, gran_params);
+
+            METRICS_PRINTF("Update angular velocity.\n");
+            ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, updateAngVels, stepSize_SU, sphere_data, nSpheres,
+                           gran_params);
+        }
+
+        elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);  // Advance current time
+        time_elapsed_SU += stepSize_SU;
+    }
+
+    return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
+}
+
+}  // namespace gpu
+}  // namespace chrono
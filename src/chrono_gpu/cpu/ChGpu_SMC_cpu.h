@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// CPU versions of the block-collective Chrono::Gpu kernels (the kernels in
+// ChGpu_SMC.cuh which use shared memory). Each function processes all SDs,
+// distributed over the OpenMP threads.
+//
+// =============================================================================
+
+#pragma once
+
+#include "chrono_gpu/cuda/ChGpu_SMC.cuh"
+
+namespace chrono {
+namespace gpu {
+
+/// @addtogroup gpu_cuda
+/// @{
+
+/// Count the number of spheres touching each SD.
+void countSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                unsigned int nSpheres,
+                                ChSystemGpu_impl::GranParamsPtr gran_params);
+
+/// Sort the spheres in each SD by their ID.
+/// The composite array is populated concurrently, so the order of the spheres within an SD depends on thread
+/// scheduling. Sorting makes the contact lists independent of the number of threads.
+void sortSpheresInEachSD(ChSystemGpu_impl::GranSphereDataPtr sphere_data, unsigned int nSDs);
+
+/// Load positions (relative to the given SD), velocities (optional), and fixity of the spheres touching the SD.
+/// Returns the number of spheres touching the SD.
+unsigned int loadSpheresInSD(unsigned int thisSD,
+                             ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                             ChSystemGpu_impl::GranParamsPtr gran_params,
+                             unsigned int* sphIDs,
+                             int3* sphere_pos,
+                             float3* sphere_vel,
+                             not_stupid_bool* sphere_fixed);
+
+/// Find the contacts between spheres touching the same SD and record them in the contact map.
+void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                           ChSystemGpu_impl::GranParamsPtr gran_params,
+                           unsigned int nSDs);
+
+/// Compute sphere-sphere forces (frictionless, user-defined model) and external forces on each sphere.
+void computeSphereForces_frictionless(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                      ChSystemGpu_impl::GranParamsPtr gran_params,
+                                      BC_type* bc_type_list,
+                                      BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                      unsigned int nBCs,
+                                      unsigned int nSDs);
+
+/// Compute sphere-sphere forces (frictionless, material-based model) and external forces on each sphere.
+void computeSphereForces_frictionless_matBased(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                               BC_type* bc_type_list,
+                                               BC_params_t<int64_t, int64_t3>* bc_params_list,
+                                               unsigned int nBCs,
+                                               unsigned int nSDs);
+
+/// @} gpu_cuda
+
+}  // namespace gpu
+}  // namespace chrono
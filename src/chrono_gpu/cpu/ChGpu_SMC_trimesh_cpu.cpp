@@ -0,0 +1,417 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// OpenMP CPU implementation of the ChSystemGpuMesh_impl compute kernels.
+// This file replaces ChGpu_SMC_trimesh.cu when Chrono::Gpu is built without
+// CUDA. The per-triangle broadphase kernels are shared with the CUDA
+// implementation; the triangle lists of the SDs are assembled with a counting
+// sort (instead of CUB sort-by-key and run-length encoding), and the
+// sphere-triangle interaction is evaluated with an OpenMP loop over SDs.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono_gpu/cpu/ChGpu_SMC_cpu.h"
+#include "chrono_gpu/cuda/ChGpu_SMC_trimesh.cuh"
+#include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
+#include "chrono_gpu/utils/ChGpuUtilities.h"
+
+namespace chrono {
+namespace gpu {
+
+void ChSystemGpuMesh_impl::runTriangleBroadphase() {
+    METRICS_PRINTF("Resetting broadphase info!\n");
+
+    unsigned int numTriangles = meshSoup->nTrianglesInSoup;
+    unsigned int nblocks = (numTriangles + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+    ChGpuCpuLaunch(nblocks, CUDA_THREADS_PER_BLOCK, determineCountOfSDsTouchedByEachTriangle, meshSoup,
+                   Triangle_NumSDsTouching.data(), gran_params, tri_params);
+
+    // exclusive prefix scan over the number of SDs touched by each triangle
+    unsigned int* out_ptr = Triangle_SDsCompositeOffsets.data();
+    unsigned int* in_ptr = Triangle_NumSDsTouching.data();
+    unsigned int numOfTriangleTouchingSD_instances = 0;  // total number of instances in which a triangle touches an SD
+    for (unsigned int i = 0; i < numTriangles; i++) {
+        out_ptr[i] = numOfTriangleTouchingSD_instances;
+        numOfTriangleTouchingSD_instances += in_ptr[i];
+    }
+
+    SDsTouchedByEachTriangle_composite.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+    TriangleIDS_ByMultiplicity.resize(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+
+    // (SD, triangle) pairs, triangle by triangle
+    ChGpuCpuLaunch(nblocks, CUDA_THREADS_PER_BLOCK, storeSDsTouchedByEachTriangle, meshSoup,
+                   Triangle_NumSDsTouching.data(), Triangle_SDsCompositeOffsets.data(),
+                   SDsTouchedByEachTriangle_composite.data(), TriangleIDS_ByMultiplicity.data(), gran_params,
+                   tri_params);
+
+    // Flip the pairs with a counting sort on the SD ID. The pairs are visited in increasing triangle order, so the
+    // triangles touching an SD end up sorted by their ID.
+    const unsigned int* pair_SDs = SDsTouchedByEachTriangle_composite.data();
+    const unsigned int* pair_triangles = TriangleIDS_ByMultiplicity.data();
+
+    std::fill(SD_numTrianglesTouching.begin(), SD_numTrianglesTouching.begin() + nSDs, 0);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++) {
+        SD_numTrianglesTouching[pair_SDs[i]]++;
+    }
+
+    // Now assert that no SD has over max amount of triangles
+    unsigned int maxTriCount = *std::max_element(SD_numTrianglesTouching.begin(), SD_numTrianglesTouching.begin() + nSDs);
+    if (maxTriCount > MAX_TRIANGLE_COUNT_PER_SD)
+        CHGPU_ERROR("ERROR! %u triangles are found in one of the SDs! The max allowance is %u.\n", maxTriCount,
+                    MAX_TRIANGLE_COUNT_PER_SD);
+
+    // offsets in the big composite array
+    unsigned int num_entries = 0;
+    for (unsigned int sd = 0; sd < nSDs; sd++) {
+        SD_TrianglesCompositeOffsets[sd] = num_entries;
+        num_entries += SD_numTrianglesTouching[sd];
+    }
+
+    SD_trianglesInEachSD_composite.resize(numOfTriangleTouchingSD_instances);
+    // the per-triangle offsets are no longer needed; reuse them as the insertion positions of the SDs
+    std::vector<unsigned int> insert_pos(SD_TrianglesCompositeOffsets.begin(),
+                                         SD_TrianglesCompositeOffsets.begin() + nSDs);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++) {
+        SD_trianglesInEachSD_composite[insert_pos[pair_SDs[i]]++] = pair_triangles[i];
+    }
+}
+
+// Sphere-triangle interaction, one SD at a time. This mirrors interactionGranMat_TriangleSoup(_matBased), with the
+// SD-local sphere and triangle data cached in thread-private arrays instead of shared memory.
+template <bool use_mat_based>
+static void interactionGranMat_TriangleSoup_impl(ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                                 ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                 const unsigned int* SD_trianglesInEachSD_composite,
+                                                 const unsigned int* SD_numTrianglesTouching,
+                                                 const unsigned int* SD_TrianglesCompositeOffsets,
+                                                 ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                 ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+                                                 unsigned int triangleFamilyHistmapOffset,
+                                                 unsigned int nSDs) {
+    const bool with_friction = gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS;
+
+#pragma omp parallel
+    {
+        // SD-local sphere and triangle data, reused for all SDs processed by this thread
+        std::vector<unsigned int> sphIDs(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<int3> sphere_pos_local(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<float3> sphere_vel(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<not_stupid_bool> sphere_fixed(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<float3> omega(MAX_COUNT_OF_SPHERES_PER_SD);
+        std::vector<unsigned int> triangleIDs(MAX_TRIANGLE_COUNT_PER_SD);
+        std::vector<double3> node1(MAX_TRIANGLE_COUNT_PER_SD);
+        std::vector<double3> node2(MAX_TRIANGLE_COUNT_PER_SD);
+        std::vector<double3> node3(MAX_TRIANGLE_COUNT_PER_SD);
+
+#pragma omp for schedule(dynamic, 16)
+        for (int sd = 0; sd < (int)nSDs; sd++) {
+            unsigned int thisSD = (unsigned int)sd;
+            unsigned int numSDTriangles = SD_numTrianglesTouching[thisSD];
+            if (numSDTriangles == 0 || sphere_data->SD_NumSpheresTouching[thisSD] == 0)
+                continue;
+
+            unsigned int spheresTouchingThisSD =
+                loadSpheresInSD(thisSD, sphere_data, gran_params, sphIDs.data(), sphere_pos_local.data(),
+                                sphere_vel.data(), sphere_fixed.data());
+            if (with_friction) {
+                for (unsigned int i = 0; i < spheresTouchingThisSD; i++) {
+                    unsigned int sphereIDGlobal = sphIDs[i];
+                    omega[i] = make_float3(sphere_data->sphere_Omega_X[sphereIDGlobal],
+                                           sphere_data->sphere_Omega_Y[sphereIDGlobal],
+                                           sphere_data->sphere_Omega_Z[sphereIDGlobal]);
+                }
+            }
+
+            // Triangle node positions (in SU)
+            for (unsigned int local_ID = 0; local_ID < numSDTriangles; local_ID++) {
+                unsigned int globalID = SD_trianglesInEachSD_composite[SD_TrianglesCompositeOffsets[thisSD] + local_ID];
+                triangleIDs[local_ID] = globalID;
+
+                unsigned int fam = d_triangleSoup->triangleFamily_ID[globalID];
+                node1[local_ID] = apply_frame_transform<double, float3, double3>(
+                    d_triangleSoup->node1[globalID], mesh_params->fam_frame_narrow[fam].pos,
+                    mesh_params->fam_frame_narrow[fam].rot_mat);
+                node2[local_ID] = apply_frame_transform<double, float3, double3>(
+                    d_triangleSoup->node2[globalID], mesh_params->fam_frame_narrow[fam].pos,
+                    mesh_params->fam_frame_narrow[fam].rot_mat);
+                node3[local_ID] = apply_frame_transform<double, float3, double3>(
+                    d_triangleSoup->node3[globalID], mesh_params->fam_frame_narrow[fam].pos,
+                    mesh_params->fam_frame_narrow[fam].rot_mat);
+
+                convert_pos_UU2SU<double3>(node1[local_ID], gran_params);
+                convert_pos_UU2SU<double3>(node2[local_ID], gran_params);
+                convert_pos_UU2SU<double3>(node3[local_ID], gran_params);
+            }
+
+            for (unsigned int sphereIDLocal = 0; sphereIDLocal < spheresTouchingThisSD; sphereIDLocal++) {
+                unsigned int sphereIDGlobal = sphIDs[sphereIDLocal];
+                float3 sphere_force = {0.f, 0.f, 0.f};
+                float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+
+                // NOTE sphere_pos_local is relative to THIS SD, not its owner SD
+                double3 sphCntr =
+                    int64_t3_to_double3(convertPosLocalToGlobal(thisSD, sphere_pos_local[sphereIDLocal], gran_params));
+
+                for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
+                    float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
+                    float depth;    // Negative in overlap
+                    double3 pt1;    // Contact point on triangle
+                    bool valid_contact =
+                        face_sphere_cd(node1[triangleLocalID], node2[triangleLocalID], node3[triangleLocalID], sphCntr,
+                                       gran_params->sphereRadius_SU, normal, depth, pt1);
+
+                    // Only the SD containing the contact point accounts for this contact
+                    valid_contact = valid_contact &&
+                                    SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params), gran_params) == thisSD;
+                    if (!valid_contact)
+                        continue;
+
+                    const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
+                    float3 pt1_float = make_float3(pt1.x, pt1.y, pt1.z);
+
+                    // vector from center of mesh body to contact point
+                    double3 meshCenter_double =
+                        make_double3(mesh_params->fam_frame_narrow[fam].pos[0],
+                                     mesh_params->fam_frame_narrow[fam].pos[1],
+                                     mesh_params->fam_frame_narrow[fam].pos[2]);
+                    convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
+                    double3 fromCenter_double = pt1 - meshCenter_double;
+                    float3 fromCenter = make_float3(fromCenter_double.x, fromCenter_double.y, fromCenter_double.z);
+
+                    // normal points from triangle to sphere
+                    float3 delta = -depth * normal;
+
+                    float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
+                    const float sphere_mass_SU = gran_params->sphere_mass_SU;
+                    float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
+
+                    // relative velocity = v_sphere - v_mesh
+                    float3 v_rel = sphere_vel[sphereIDLocal] - d_triangleSoup->vel[fam];
+
+                    // assumes pos is the center of mass of the mesh
+                    float3 meshCenter =
+                        make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
+                                    mesh_params->fam_frame_broad[fam].pos[2]);
+                    convert_pos_UU2SU<float3>(meshCenter, gran_params);
+
+                    // NOTE depth is negative and normal points from triangle to sphere center
+                    float3 r = pt1_float + normal * (depth / 2) - meshCenter;
+
+                    // Add angular velocity contribution from mesh
+                    v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
+
+                    if (with_friction) {
+                        // Vector from the center of sphere to center of contact volume
+                        float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                        v_rel = v_rel + Cross(omega[sphereIDLocal], r_A);
+                    }
+
+                    float3 force_accum;
+                    float3 tangent_force = {0.f, 0.f, 0.f};
+                    unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
+                    // radius pointing from the contact point to the center of particle
+                    float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
+
+                    if (use_mat_based) {
+                        float sqrt_Rd = std::sqrt(std::abs(depth) * gran_params->sphereRadius_SU);
+                        float Sn = 2.f * mesh_params->E_eff_s2m_SU * sqrt_Rd;
+
+                        float loge = (mesh_params->COR_s2m_SU < EPSILON) ? std::log(EPSILON)
+                                                                         : std::log(mesh_params->COR_s2m_SU);
+                        float beta = loge / std::sqrt(loge * loge + CUDART_PI_F * CUDART_PI_F);
+
+                        // stiffness and damping coefficient
+                        float kn = (2.f / 3.f) * Sn;
+                        float gn = 2 * std::sqrt(5.f / 6.f) * beta * std::sqrt(Sn * m_eff);
+
+                        // normal and tangential components of relative velocity
+                        float projection = Dot(v_rel, normal);
+                        float3 vrel_t = v_rel - projection * normal;
+
+                        float forceN_mag = -kn * depth + gn * projection;
+                        force_accum = forceN_mag * normal;
+
+                        // adhesion term, opposite the spring term
+                        force_accum =
+                            force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+                        if (with_friction) {
+                            sphere_AngAcc = sphere_AngAcc + computeRollingAngAcc(sphere_data, gran_params,
+                                                                                 mesh_params->rolling_coeff_s2m_SU,
+                                                                                 mesh_params->spinning_coeff_s2m_SU,
+                                                                                 force_accum, omega[sphereIDLocal],
+                                                                                 d_triangleSoup->omega[fam], Rc);
+                            tangent_force = computeFrictionForces_matBased(
+                                gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                                mesh_params->static_friction_coeff_s2m, mesh_params->E_eff_s2m_SU,
+                                mesh_params->G_eff_s2m_SU, sqrt_Rd, beta, force_accum, vrel_t, normal, m_eff);
+                        }
+                    } else {
+                        // effective radius is just sphere radius -- assume meshes are locally flat
+                        float hertz_force_factor = std::sqrt(std::abs(depth) / gran_params->sphereRadius_SU);
+
+                        force_accum = hertz_force_factor * mesh_params->K_n_s2m_SU * delta;
+
+                        // adhesion term, opposite the spring term
+                        force_accum =
+                            force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+                        // normal damping term
+                        float3 vrel_n = Dot(v_rel, normal) * normal;
+                        v_rel = v_rel - vrel_n;  // v_rel is now tangential relative velocity
+                        force_accum = force_accum - hertz_force_factor * mesh_params->Gamma_n_s2m_SU * m_eff * vrel_n;
+
+                        if (with_friction) {
+                            sphere_AngAcc = sphere_AngAcc + computeRollingAngAcc(sphere_data, gran_params,
+                                                                                 mesh_params->rolling_coeff_s2m_SU,
+                                                                                 mesh_params->spinning_coeff_s2m_SU,
+                                                                                 force_accum, omega[sphereIDLocal],
+                                                                                 d_triangleSoup->omega[fam], Rc);
+                            tangent_force = computeFrictionForces(
+                                gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                                mesh_params->static_friction_coeff_s2m, mesh_params->K_t_s2m_SU,
+                                mesh_params->Gamma_t_s2m_SU, hertz_force_factor, m_eff, force_accum, v_rel, normal);
+                        }
+                    }
+
+                    if (with_friction) {
+                        force_accum = force_accum + tangent_force;
+                        sphere_AngAcc =
+                            sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
+                    }
+
+                    sphere_force = sphere_force + force_accum;
+
+                    // Force and torque on the mesh family are opposite the force on the sphere
+                    float3 force_total = -1.f * force_accum;
+                    float3 torque = Cross(fromCenter, force_total);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
+                    atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
+                }
+
+                // write back sphere forces
+                atomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
+                atomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
+
+                if (with_friction) {
+                    atomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
+                    atomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
+                    atomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
+                }
+            }
+        }
+    }
+}
+
+double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
+    // Figure our the number of blocks that need to be launched to cover the box
+    unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+
+    // Settling simulation loop.
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+
+    packSphereDataPointers();
+
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+
+    float time_elapsed_SU = 0.f;  // time elapsed in this call (SU)
+    for (unsigned int n = 0; n < nsteps; n++) {
+        updateBCPositions();
+        runSphereBroadphase();
+
+        resetSphereAccelerations();
+        resetBCForces();
+        if (meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled) {
+            std::fill(meshSoup->generalizedForcesPerFamily,
+                      meshSoup->generalizedForcesPerFamily + 6 * meshSoup->numTriangleFamilies, 0.f);
+            runTriangleBroadphase();
+        }
+
+        METRICS_PRINTF("Starting computeSphereForces!\n");
+
+        if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            // Compute sphere-sphere forces
+            if (gran_params->use_mat_based == true) {
+                computeSphereForces_frictionless_matBased(sphere_data, gran_params, BC_type_list.data(),
+                                                          BC_params_list_SU.data(),
+                                                          (unsigned int)BC_params_list_SU.size(), nSDs);
+            } else {
+                computeSphereForces_frictionless(sphere_data, gran_params, BC_type_list.data(),
+                                                 BC_params_list_SU.data(), (unsigned int)BC_params_list_SU.size(),
+                                                 nSDs);
+            }
+        } else if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP ||
+                   gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
+            // figure out who is contacting
+            determineContactPairs(sphere_data, gran_params, nSDs);
+
+            if (gran_params->use_mat_based == true) {
+                ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, computeSphereContactForces_matBased, sphere_data,
+                               gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                               (unsigned int)BC_params_list_SU.size(), nSpheres);
+            } else {
+                ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, computeSphereContactForces, sphere_data, gran_params,
+                               BC_type_list.data(), BC_params_list_SU.data(), (unsigned int)BC_params_list_SU.size(),
+                               nSpheres);
+            }
+        }
+
+        if (meshSoup->numTriangleFamilies != 0 && mesh_collision_enabled) {
+            // triangle labels come after BC labels numerically
+            unsigned int triangleFamilyHistmapOffset =
+                gran_params->nSpheres + 1 + (unsigned int)BC_params_list_SU.size() + 1;
+            // compute sphere-triangle forces
+            if (tri_params->use_mat_based == true) {
+                interactionGranMat_TriangleSoup_impl<true>(
+                    meshSoup, sphere_data, SD_trianglesInEachSD_composite.data(), SD_numTrianglesTouching.data(),
+                    SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleFamilyHistmapOffset, nSDs);
+            } else {
+                interactionGranMat_TriangleSoup_impl<false>(
+                    meshSoup, sphere_data, SD_trianglesInEachSD_composite.data(), SD_numTrianglesTouching.data(),
+                    SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleFamilyHistmapOffset, nSDs);
+            }
+        }
+
+        METRICS_PRINTF("Starting integrateSpheres!\n");
+        ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, integrateSpheres, stepSize_SU, sphere_data, nSpheres,
+                       gran_params);
+
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            const unsigned int nThreadsUpdateHist = 2 * CUDA_THREADS_PER_BLOCK;
+            unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+            unsigned int nBlocksFricHistoryPostProcess = (fricMapSize + nThreadsUpdateHist - 1) / nThreadsUpdateHist;
+            ChGpuCpuLaunch(nBlocksFricHistoryPostProcess, nThreadsUpdateHist, updateFrictionData, fricMapSize,
+                           sphere_data, gran_params);
+            ChGpuCpuLaunch(nBlocks, CUDA_THREADS_PER_BLOCK, updateAngVels, stepSize_SU, sphere_data, nSpheres,
+                           gran_params);
+        }
+
+        elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);  // Advance current time
+        time_elapsed_SU += stepSize_SU;
+    }
+
+    return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
+}
+
+}  // namespace gpu
+}  // namespace chrono
@@ -18,7 +18,6 @@
 #ifndef CUDALLOC_HPP
 #define CUDALLOC_HPP
 
-#include <cuda_runtime_api.h>
 #include <climits>
 #include <iostream>
 #include <memory>
@@ -26,6 +25,14 @@
 #include <type_traits>
 #include <utility>
 
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cuda_runtime_api.h>
+#else
+    #include "chrono_gpu/cpu/ChGpuCpuRuntime.h"
+#endif
+
 ////#if (__cplusplus >= 201703L)  // C++17 or newer
 ////template <class T>
 ////struct cudallocator {
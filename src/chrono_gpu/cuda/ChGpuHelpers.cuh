@@ -20,7 +20,9 @@
 #include "chrono_gpu/cuda/ChCudaMathUtils.cuh"
 #include "chrono_gpu/ChGpuDefines.h"
 
-#include <cub/cub.cuh>
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cub/cub.cuh>
+#endif
 
 using chrono::gpu::ChSystemGpu_impl;
 using chrono::gpu::CHGPU_TIME_INTEGRATOR;
@@ -28,12 +30,30 @@ using chrono::gpu::CHGPU_FRICTION_MODE;
 using chrono::gpu::CHGPU_ROLLING_MODE;
 
 // Print a user-given error message and crash
-#define ABORTABORTABORT(...) \
-    {                        \
-        printf(__VA_ARGS__); \
-        __threadfence();     \
-        cub::ThreadTrap();   \
-    }
+#ifdef CHRONO_GPU_USE_CUDA
+    #define ABORTABORTABORT(...) \
+        {                        \
+            printf(__VA_ARGS__); \
+            __threadfence();     \
+            cub::ThreadTrap();   \
+        }
+#else
+    #define ABORTABORTABORT(...) \
+        {                        \
+            printf(__VA_ARGS__); \
+            abort();             \
+        }
+#endif
+
+// Global index of the current thread in a kernel launched over a 1D grid.
+// With the CPU backend, kernels receive this index as an additional (last) argument, see ChGpuCpuLaunch.
+#ifdef CHRONO_GPU_USE_CUDA
+    #define CHGPU_KERNEL_INDEX_PARAM
+    #define CHGPU_KERNEL_INDEX (threadIdx.x + blockIdx.x * blockDim.x)
+#else
+    #define CHGPU_KERNEL_INDEX_PARAM , unsigned int chgpu_kernel_index
+    #define CHGPU_KERNEL_INDEX chgpu_kernel_index
+#endif
 
 #define CHGPU_DEBUG_PRINTF(...) printf(__VA_ARGS__)
 
@@ -16,9 +16,13 @@
 
 #pragma once
 
-#include <cub/cub.cuh>
+#include "chrono_gpu/ChConfigGpu.h"
+
+#ifdef CHRONO_GPU_USE_CUDA
+    #include <cub/cub.cuh>
+    #include <cuda.h>
+#endif
 
-#include <cuda.h>
 #include <cassert>
 #include <cstdio>
 #include <fstream>
@@ -36,6 +40,10 @@
 #include "chrono_gpu/cuda/ChGpuBoundaryConditions.cuh"
 //#include <math_constants.h>
 
+#ifndef CHRONO_GPU_USE_CUDA
+    #include "chrono_gpu/cpu/ChGpuCpuLaunch.h"
+#endif
+
 #define PI_F 3.1415926
 using chrono::gpu::ChSystemGpu_impl;
 
@@ -110,8 +118,9 @@ inline __device__ void figureOutTouchedSD(int sphCenter_X_local,
 
 /// Compute the elementwise squared sum of array XYZ components.
 template <typename T>
-__global__ void elementalArray3Squared(T* sqSum, const T* arrX, const T* arrY, const T* arrZ, size_t nSpheres) {
-    size_t mySphereID = (threadIdx.x + blockIdx.x * blockDim.x);
+__global__ void elementalArray3Squared(T* sqSum, const T* arrX, const T* arrY, const T* arrZ, size_t nSpheres
+                                       CHGPU_KERNEL_INDEX_PARAM) {
+    size_t mySphereID = CHGPU_KERNEL_INDEX;
     T Xdata;
     T Ydata;
     T Zdata;
@@ -128,8 +137,9 @@ __global__ void elementalArray3Squared(T* sqSum, const T* arrX, const T* arrY, c
 static __global__ void elementalZLocalToGlobal(float* posZ,
                                                ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                size_t nSpheres,
-                                               ChSystemGpu_impl::GranParamsPtr gran_params) {
-    size_t mySphereID = (threadIdx.x + blockIdx.x * blockDim.x);
+                                               ChSystemGpu_impl::GranParamsPtr gran_params
+                                               CHGPU_KERNEL_INDEX_PARAM) {
+    size_t mySphereID = CHGPU_KERNEL_INDEX;
     if (mySphereID < nSpheres) {
         int zPos_local = sphere_data->sphere_local_pos_Z[mySphereID];
         int3 ownerSD_triplet = SDIDTriplet(sphere_data->sphere_owner_SDs[mySphereID], gran_params);
@@ -145,8 +155,9 @@ static __global__ void elementalZAboveValue(unsigned int* YorN,
                                             ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                             size_t nSpheres,
                                             ChSystemGpu_impl::GranParamsPtr gran_params,
-                                            float Value) {
-    size_t mySphereID = (threadIdx.x + blockIdx.x * blockDim.x);
+                                            float Value
+                                            CHGPU_KERNEL_INDEX_PARAM) {
+    size_t mySphereID = CHGPU_KERNEL_INDEX;
     if (mySphereID < nSpheres) {
         int pos_local = sphere_data->sphere_local_pos_Z[mySphereID];
         int3 ownerSD_triplet = SDIDTriplet(sphere_data->sphere_owner_SDs[mySphereID], gran_params);
@@ -162,8 +173,9 @@ static __global__ void elementalXAboveValue(unsigned int* YorN,
                                             ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                             size_t nSpheres,
                                             ChSystemGpu_impl::GranParamsPtr gran_params,
-                                            float Value) {
-    size_t mySphereID = (threadIdx.x + blockIdx.x * blockDim.x);
+                                            float Value
+                                            CHGPU_KERNEL_INDEX_PARAM) {
+    size_t mySphereID = CHGPU_KERNEL_INDEX;
     if (mySphereID < nSpheres) {
         int pos_local = sphere_data->sphere_local_pos_X[mySphereID];
         int3 ownerSD_triplet = SDIDTriplet(sphere_data->sphere_owner_SDs[mySphereID], gran_params);
@@ -174,6 +186,9 @@ static __global__ void elementalXAboveValue(unsigned int* YorN,
     }
 }
 
+#ifdef CHRONO_GPU_USE_CUDA
+// Block-collective kernel (uses shared memory); the CPU backend provides its own implementation.
+
 /**
  * Template arguments:
  *   - CUB_THREADS: the number of threads used in this kernel, comes into play when invoking CUB block collectives
@@ -213,7 +228,7 @@ __global__ void getNumberOfSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDat
     __shared__ typename Block_Discontinuity::TempStorage temp_storage_disc;
 
     // Figure out what sphereID this thread will handle. We work with a 1D block structure and a 1D grid structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     // This uses a lot of registers but is needed
     unsigned int SDsTouched[MAX_SDs_TOUCHED_BY_SPHERE] = {NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
@@ -267,6 +282,8 @@ __global__ void getNumberOfSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDat
     }
 }
 
+#endif
+
 /// <summary>
 /// Kernel figures out whether a sphere touches an SD. Since a sphere can touch at most 8 SDs, the number of threads
 /// launched in conjunction with this kernel is eight times the number of spheres.
@@ -285,8 +302,9 @@ __global__ void getNumberOfSpheresTouchingEachSD(ChSystemGpu_impl::GranSphereDat
 /// <returns></returns>
 static __global__ void populateSpheresInEachSD(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                unsigned int nSpheres,  // Number of spheres in the box
-                                               ChSystemGpu_impl::GranParamsPtr gran_params) {
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+                                               ChSystemGpu_impl::GranParamsPtr gran_params
+                                               CHGPU_KERNEL_INDEX_PARAM) {
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     unsigned int SDsTouched[MAX_SDs_TOUCHED_BY_SPHERE] = {NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
                                                           NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID};
@@ -361,15 +379,13 @@ inline __device__ void findNewLocalCoords(ChSystemGpu_impl::GranSphereDataPtr sp
 
     if (sphere_pos_local_X < 0 || sphere_pos_local_Y < 0 || sphere_pos_local_Z < 0) {
         float l_unit = gran_params->LENGTH_UNIT;
-        printf(
+        ABORTABORTABORT(
             "error! sphere %u has negative local pos in SD %u (%d, %d, %d), pos_local: %e, %e, %e, pos_global: %e, %e, "
             "%e, BD starts at: %e, %e, %e\n",
             mySphereID, SDID, ownerSD.x, ownerSD.y, ownerSD.z, (float)sphere_pos_local_X * l_unit,
             (float)sphere_pos_local_Y * l_unit, (float)sphere_pos_local_Z * l_unit, (float)global_pos_X * l_unit,
             (float)global_pos_Y * l_unit, (float)global_pos_Z * l_unit, (float)gran_params->BD_frame_X * l_unit,
             (float)gran_params->BD_frame_Y * l_unit, (float)gran_params->BD_frame_Z * l_unit);
-        __threadfence();
-        cub::ThreadTrap();
     }
 
     // write local pos back to global memory
@@ -378,8 +394,6 @@ inline __device__ void findNewLocalCoords(ChSystemGpu_impl::GranSphereDataPtr sp
     sphere_data->sphere_local_pos_Z[mySphereID] = sphere_pos_local_Z;
 
     if (SDID >= gran_params->nSDs) {
-        unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
-
         ABORTABORTABORT("ERROR! Sphere %u has invalid SD %u, max is %u, triplet %d, %d, %d\n", mySphereID, SDID,
                         gran_params->nSDs, ownerSD.x, ownerSD.y, ownerSD.z);
     }
@@ -392,8 +406,9 @@ inline __device__ void findNewLocalCoords(ChSystemGpu_impl::GranSphereDataPtr sp
 static __global__ void applyBDFrameChange(int64_t3 delta,
                                           ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                           unsigned int nSpheres,
-                                          ChSystemGpu_impl::GranParamsPtr gran_params) {
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+                                          ChSystemGpu_impl::GranParamsPtr gran_params
+                                          CHGPU_KERNEL_INDEX_PARAM) {
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     if (mySphereID < nSpheres) {
         int3 sphere_pos_local =
@@ -416,8 +431,9 @@ static __global__ void initializeLocalPositions(ChSystemGpu_impl::GranSphereData
                                                 int64_t* sphere_pos_global_Y,
                                                 int64_t* sphere_pos_global_Z,
                                                 unsigned int nSpheres,
-                                                ChSystemGpu_impl::GranParamsPtr gran_params) {
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+                                                ChSystemGpu_impl::GranParamsPtr gran_params
+                                                CHGPU_KERNEL_INDEX_PARAM) {
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     if (mySphereID < nSpheres) {
         int64_t global_pos_X = sphere_pos_global_X[mySphereID];
@@ -537,6 +553,9 @@ inline __device__ void applyExternalForces(unsigned int currSphereID,
     applyGravity(sphere_force, gran_params);
 }
 
+#ifdef CHRONO_GPU_USE_CUDA
+// Block-collective kernel (uses shared memory); the CPU backend provides its own implementation.
+
 static __global__ void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                              ChSystemGpu_impl::GranParamsPtr gran_params) {
     // Cache positions of spheres local to this SD
@@ -614,6 +633,8 @@ static __global__ void determineContactPairs(ChSystemGpu_impl::GranSphereDataPtr
     }
 }
 
+#endif
+
 /// Compute normal forces for a contacting pair
 // returns the normal force and sets the reciplength, tangent velocity, and delta_r
 // delta_r is direction of normal force on me
@@ -739,12 +760,13 @@ static __global__ void computeSphereContactForces(ChSystemGpu_impl::GranSphereDa
                                                   BC_type* bc_type_list,
                                                   BC_params_t<int64_t, int64_t3>* bc_params_list,
                                                   unsigned int nBCs,
-                                                  unsigned int nSpheres) {
+                                                  unsigned int nSpheres
+                                                  CHGPU_KERNEL_INDEX_PARAM) {
     // grab the sphere radius
     unsigned int sphereRadius_SU = gran_params->sphereRadius_SU;
 
     // my sphere ID, we're using a 1D thread->sphere map
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     //    float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT / (gran_params->TIME_UNIT *
     //    gran_params->TIME_UNIT);
@@ -939,12 +961,13 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
                                                            BC_type* bc_type_list,
                                                            BC_params_t<int64_t, int64_t3>* bc_params_list,
                                                            unsigned int nBCs,
-                                                           unsigned int nSpheres) {
+                                                           unsigned int nSpheres
+                                                           CHGPU_KERNEL_INDEX_PARAM) {
     // grab the sphere radius
     unsigned int sphereRadius_SU = gran_params->sphereRadius_SU;
 
     // my sphere ID, we're using a 1D thread->sphere map
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     // don't overrun the array
     if (mySphereID < nSpheres) {
@@ -1101,6 +1124,9 @@ static __global__ void computeSphereContactForces_matBased(ChSystemGpu_impl::Gra
     }
 }
 
+#ifdef CHRONO_GPU_USE_CUDA
+// Block-collective kernels (use shared memory); the CPU backend provides its own implementations.
+
 static __global__ void computeSphereForces_frictionless(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                         ChSystemGpu_impl::GranParamsPtr gran_params,
                                                         BC_type* bc_type_list,
@@ -1329,6 +1355,8 @@ static __global__ void computeSphereForces_frictionless_matBased(ChSystemGpu_imp
     }
 }
 
+#endif
+
 /// Compute update for a quantity using Forward Euler integrator
 inline __device__ float integrateForwardEuler(float stepsize_SU, float val_dt) {
     return stepsize_SU * val_dt;
@@ -1352,10 +1380,11 @@ inline __device__ float integrateChung_pos(float stepsize_SU, float vel_old, flo
 static __global__ void integrateSpheres(const float stepsize_SU,
                                         ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                         unsigned int nSpheres,
-                                        ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                        ChSystemGpu_impl::GranParamsPtr gran_params
+                                        CHGPU_KERNEL_INDEX_PARAM) {
     // Figure out what sphereID this thread will handle. We work with a 1D block structure and a 1D grid
     // structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
     // Write back velocity updates
     if (mySphereID < nSpheres && !sphere_data->sphere_fixed[mySphereID]) {
         float curr_acc_X = sphere_data->sphere_acc_X[mySphereID];
@@ -1462,8 +1491,9 @@ static __global__ void integrateSpheres(const float stepsize_SU,
  */
 static __global__ void updateFrictionData(unsigned int frictionHistoryMapSize,
                                           ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                          ChSystemGpu_impl::GranParamsPtr gran_params) {
-    unsigned int offsetInFrictionMap = threadIdx.x + blockIdx.x * blockDim.x;
+                                          ChSystemGpu_impl::GranParamsPtr gran_params
+                                          CHGPU_KERNEL_INDEX_PARAM) {
+    unsigned int offsetInFrictionMap = CHGPU_KERNEL_INDEX;
 
     if (offsetInFrictionMap < frictionHistoryMapSize) {
         // look at this map contact slot and reset it if that slot wasn't active last timestep
@@ -1491,9 +1521,10 @@ static __global__ void updateFrictionData(unsigned int frictionHistoryMapSize,
 static __global__ void updateAngVels(const float stepsize_SU,
                                      ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                      unsigned int nSpheres,
-                                     ChSystemGpu_impl::GranParamsPtr gran_params) {
+                                     ChSystemGpu_impl::GranParamsPtr gran_params
+                                     CHGPU_KERNEL_INDEX_PARAM) {
     // Figure which sphereID this thread handles. We work with a 1D block structure and a 1D grid structure
-    unsigned int mySphereID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int mySphereID = CHGPU_KERNEL_INDEX;
 
     if (mySphereID >= nSpheres || sphere_data->sphere_fixed[mySphereID])
         return;
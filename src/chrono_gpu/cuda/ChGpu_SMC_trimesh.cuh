@@ -284,9 +284,10 @@ __global__ void determineCountOfSDsTouchedByEachTriangle(
     const ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
     unsigned int* Triangle_NumSDsTouching,
     ChSystemGpu_impl::GranParamsPtr gran_params,
-    ChSystemGpuMesh_impl::MeshParamsPtr mesh_params) {
+    ChSystemGpuMesh_impl::MeshParamsPtr mesh_params
+    CHGPU_KERNEL_INDEX_PARAM) {
     // Figure out what triangleID this thread will handle. We work with a 1D block structure and a 1D grid structure
-    unsigned int myTriangleID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int myTriangleID = CHGPU_KERNEL_INDEX;
 
     if (myTriangleID < d_triangleSoup->nTrianglesInSoup) {
         Triangle_NumSDsTouching[myTriangleID] =
@@ -311,9 +312,10 @@ __global__ void storeSDsTouchedByEachTriangle(const ChSystemGpuMesh_impl::Triang
                                               unsigned int* Triangle_SDsComposite,
                                               unsigned int* Triangle_TriIDsComposite,
                                               ChSystemGpu_impl::GranParamsPtr gran_params,
-                                              ChSystemGpuMesh_impl::MeshParamsPtr mesh_params) {
+                                              ChSystemGpuMesh_impl::MeshParamsPtr mesh_params
+                                              CHGPU_KERNEL_INDEX_PARAM) {
     // Figure out what triangleID this thread will handle. We work with a 1D block structure and a 1D grid structure
-    unsigned int myTriangleID = threadIdx.x + blockIdx.x * blockDim.x;
+    unsigned int myTriangleID = CHGPU_KERNEL_INDEX;
 
     if (myTriangleID < d_triangleSoup->nTrianglesInSoup) {
         triangle_figureOutTouchedSDs(myTriangleID, d_triangleSoup,
@@ -340,8 +342,9 @@ __global__ void storeSDsTouchedByEachTriangle(const ChSystemGpuMesh_impl::Triang
 __global__ void finalizeSD_numTrianglesTouching(const unsigned int* d_SDs_touched,
                                                 const unsigned int* d_howManyTrianglesTouchTheTouchedSDs,
                                                 const unsigned int* nSDs_touchedByTriangles,
-                                                unsigned int* pSD_numTrianglesTouching) {
-    unsigned int threadID = threadIdx.x + blockIdx.x * blockDim.x;
+                                                unsigned int* pSD_numTrianglesTouching
+                                                CHGPU_KERNEL_INDEX_PARAM) {
+    unsigned int threadID = CHGPU_KERNEL_INDEX;
     if (threadID < (*nSDs_touchedByTriangles)) {
         // this thread has work to do
         unsigned int whichSD = d_SDs_touched[threadID];
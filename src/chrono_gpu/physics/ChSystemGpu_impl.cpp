@@ -12,11 +12,10 @@
 // Authors: Conlain Kelly, Nic Olsen, Dan Negrut, Luning Fang, Radu Serban
 // =============================================================================
 
-#include <cuda.h>
-#include <cuda_runtime.h>
 #include <cmath>
 #include <vector>
 #include <algorithm>
+#include <numeric>
 #include <climits>
 
 #include "chrono/utils/ChUtilsGenerators.h"
@@ -1248,6 +1247,376 @@ void ChSystemGpu_impl::initializeSpheres() {
     INFO_PRINTF("running at approximate timestep %f\n", stepSize_SU * TIME_SU2UU);
 }
 
+/// Sort sphere positions by subdomain id
+/// Occurs entirely on host, not intended to be efficient
+/// ONLY DO AT BEGINNING OF SIMULATION
+void ChSystemGpu_impl::defragment_initial_positions() {
+    // key and value pointers
+    std::vector<unsigned int, cudallocator<unsigned int>> sphere_ids;
+
+    // load sphere indices
+    sphere_ids.resize(nSpheres);
+    std::iota(sphere_ids.begin(), sphere_ids.end(), 0);
+
+    // sort sphere ids by owner SD
+    std::sort(sphere_ids.begin(), sphere_ids.end(),
+              [&](std::size_t i, std::size_t j) { return sphere_owner_SDs.at(i) < sphere_owner_SDs.at(j); });
+
+    std::vector<int, cudallocator<int>> sphere_pos_x_tmp;
+    std::vector<int, cudallocator<int>> sphere_pos_y_tmp;
+    std::vector<int, cudallocator<int>> sphere_pos_z_tmp;
+
+    std::vector<float, cudallocator<float>> sphere_vel_x_tmp;
+    std::vector<float, cudallocator<float>> sphere_vel_y_tmp;
+    std::vector<float, cudallocator<float>> sphere_vel_z_tmp;
+
+    std::vector<float, cudallocator<float>> sphere_angv_x_tmp;
+    std::vector<float, cudallocator<float>> sphere_angv_y_tmp;
+    std::vector<float, cudallocator<float>> sphere_angv_z_tmp;
+
+    std::vector<not_stupid_bool, cudallocator<not_stupid_bool>> sphere_fixed_tmp;
+    std::vector<unsigned int, cudallocator<unsigned int>> sphere_owner_SDs_tmp;
+
+    sphere_pos_x_tmp.resize(nSpheres);
+    sphere_pos_y_tmp.resize(nSpheres);
+    sphere_pos_z_tmp.resize(nSpheres);
+
+    sphere_vel_x_tmp.resize(nSpheres);
+    sphere_vel_y_tmp.resize(nSpheres);
+    sphere_vel_z_tmp.resize(nSpheres);
+
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        sphere_angv_x_tmp.resize(nSpheres);
+        sphere_angv_y_tmp.resize(nSpheres);
+        sphere_angv_z_tmp.resize(nSpheres);
+    }
+
+    sphere_fixed_tmp.resize(nSpheres);
+    sphere_owner_SDs_tmp.resize(nSpheres);
+
+    // reorder values into new sorted
+    for (unsigned int i = 0; i < nSpheres; i++) {
+        sphere_pos_x_tmp.at(i) = sphere_local_pos_X.at(sphere_ids.at(i));
+        sphere_pos_y_tmp.at(i) = sphere_local_pos_Y.at(sphere_ids.at(i));
+        sphere_pos_z_tmp.at(i) = sphere_local_pos_Z.at(sphere_ids.at(i));
+
+        sphere_vel_x_tmp.at(i) = (float)pos_X_dt.at(sphere_ids.at(i));
+        sphere_vel_y_tmp.at(i) = (float)pos_Y_dt.at(sphere_ids.at(i));
+        sphere_vel_z_tmp.at(i) = (float)pos_Z_dt.at(sphere_ids.at(i));
+
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            sphere_angv_x_tmp.at(i) = (float)sphere_Omega_X.at(sphere_ids.at(i));
+            sphere_angv_y_tmp.at(i) = (float)sphere_Omega_Y.at(sphere_ids.at(i));
+            sphere_angv_z_tmp.at(i) = (float)sphere_Omega_Z.at(sphere_ids.at(i));
+        }
+
+        sphere_fixed_tmp.at(i) = sphere_fixed.at(sphere_ids.at(i));
+        sphere_owner_SDs_tmp.at(i) = sphere_owner_SDs.at(sphere_ids.at(i));
+    }
+
+    // swap into the correct data structures
+    sphere_local_pos_X.swap(sphere_pos_x_tmp);
+    sphere_local_pos_Y.swap(sphere_pos_y_tmp);
+    sphere_local_pos_Z.swap(sphere_pos_z_tmp);
+
+    pos_X_dt.swap(sphere_vel_x_tmp);
+    pos_Y_dt.swap(sphere_vel_y_tmp);
+    pos_Z_dt.swap(sphere_vel_z_tmp);
+
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        sphere_Omega_X.swap(sphere_angv_x_tmp);
+        sphere_Omega_Y.swap(sphere_angv_y_tmp);
+        sphere_Omega_Z.swap(sphere_angv_z_tmp);
+    }
+
+    sphere_fixed.swap(sphere_fixed_tmp);
+    sphere_owner_SDs.swap(sphere_owner_SDs_tmp);
+}
+
+/// Same defragment function, but this time for the contact friction history arrays.
+/// It is stand-alone because it should rarely be needed, so let us save some time by
+/// not calling it in most of our simulations.
+void ChSystemGpu_impl::defragment_friction_history(unsigned int history_offset) {
+    // key and value pointers
+    std::vector<unsigned int, cudallocator<unsigned int>> sphere_ids;
+
+    // load sphere indices
+    sphere_ids.resize(nSpheres);
+    std::iota(sphere_ids.begin(), sphere_ids.end(), 0);
+
+    // sort sphere ids by owner SD
+    std::sort(sphere_ids.begin(), sphere_ids.end(),
+              [&](std::size_t i, std::size_t j) { return sphere_owner_SDs.at(i) < sphere_owner_SDs.at(j); });
+
+    std::vector<float3, cudallocator<float3>> history_tmp;
+    std::vector<unsigned int, cudallocator<unsigned int>> partners_tmp;
+
+    history_tmp.resize(history_offset * nSpheres);
+    partners_tmp.resize(history_offset * nSpheres);
+
+    // reorder values into new sorted
+    for (unsigned int i = 0; i < nSpheres; i++) {
+        for (unsigned int j = 0; j < history_offset; j++) {
+            history_tmp.at(history_offset * i + j) = contact_history_map.at(history_offset * sphere_ids.at(i) + j);
+            partners_tmp.at(history_offset * i + j) = contact_partners_map.at(history_offset * sphere_ids.at(i) + j);
+        }
+    }
+
+    contact_history_map.swap(history_tmp);
+    contact_partners_map.swap(partners_tmp);
+}
+
+void ChSystemGpu_impl::setupSphereDataStructures() {
+    // Each fills user_sphere_positions with positions to be copied
+    if (user_sphere_positions.size() == 0) {
+        CHGPU_ERROR("ERROR! no sphere positions given!\n");
+    }
+
+    nSpheres = (unsigned int)user_sphere_positions.size();
+    INFO_PRINTF("%u balls added!\n", nSpheres);
+    gran_params->nSpheres = nSpheres;
+
+    TRACK_VECTOR_RESIZE(sphere_owner_SDs, nSpheres, "sphere_owner_SDs", NULL_CHGPU_ID);
+
+    // Allocate space for new bodies
+    TRACK_VECTOR_RESIZE(sphere_local_pos_X, nSpheres, "sphere_local_pos_X", 0);
+    TRACK_VECTOR_RESIZE(sphere_local_pos_Y, nSpheres, "sphere_local_pos_Y", 0);
+    TRACK_VECTOR_RESIZE(sphere_local_pos_Z, nSpheres, "sphere_local_pos_Z", 0);
+
+    TRACK_VECTOR_RESIZE(sphere_fixed, nSpheres, "sphere_fixed", 0);
+
+    TRACK_VECTOR_RESIZE(pos_X_dt, nSpheres, "pos_X_dt", 0);
+    TRACK_VECTOR_RESIZE(pos_Y_dt, nSpheres, "pos_Y_dt", 0);
+    TRACK_VECTOR_RESIZE(pos_Z_dt, nSpheres, "pos_Z_dt", 0);
+
+    // temporarily store global positions as 64-bit, discard as soon as local positions are loaded
+    {
+        bool user_provided_fixed = user_sphere_fixed.size() != 0;
+        bool user_provided_vel = user_sphere_vel.size() != 0;
+        if (user_provided_fixed && user_sphere_fixed.size() != nSpheres)
+            CHGPU_ERROR("Provided fixity array has length %zu, but there are %u spheres!\n", user_sphere_fixed.size(),
+                        nSpheres);
+        if (user_provided_vel && user_sphere_vel.size() != nSpheres)
+            CHGPU_ERROR("Provided velocity array has length %zu, but there are %u spheres!\n", user_sphere_vel.size(),
+                        nSpheres);
+
+        std::vector<int64_t, cudallocator<int64_t>> sphere_global_pos_X;
+        std::vector<int64_t, cudallocator<int64_t>> sphere_global_pos_Y;
+        std::vector<int64_t, cudallocator<int64_t>> sphere_global_pos_Z;
+
+        sphere_global_pos_X.resize(nSpheres);
+        sphere_global_pos_Y.resize(nSpheres);
+        sphere_global_pos_Z.resize(nSpheres);
+
+        // Copy from array of structs to 3 arrays
+        for (unsigned int i = 0; i < nSpheres; i++) {
+            float3 vec = user_sphere_positions.at(i);
+            // cast to double, convert to SU, then cast to int64_t
+            sphere_global_pos_X.at(i) = (int64_t)((double)vec.x / LENGTH_SU2UU);
+            sphere_global_pos_Y.at(i) = (int64_t)((double)vec.y / LENGTH_SU2UU);
+            sphere_global_pos_Z.at(i) = (int64_t)((double)vec.z / LENGTH_SU2UU);
+
+            // Convert to not_stupid_bool
+            sphere_fixed.at(i) = (not_stupid_bool)((user_provided_fixed) ? user_sphere_fixed[i] : false);
+            if (user_provided_vel) {
+                auto vel = user_sphere_vel.at(i);
+                pos_X_dt.at(i) = (float)(vel.x / VEL_SU2UU);
+                pos_Y_dt.at(i) = (float)(vel.y / VEL_SU2UU);
+                pos_Z_dt.at(i) = (float)(vel.z / VEL_SU2UU);
+            }
+        }
+
+        packSphereDataPointers();
+        convertToLocalPositions(sphere_global_pos_X.data(), sphere_global_pos_Y.data(), sphere_global_pos_Z.data());
+    }
+
+    TRACK_VECTOR_RESIZE(sphere_acc_X, nSpheres, "sphere_acc_X", 0);
+    TRACK_VECTOR_RESIZE(sphere_acc_Y, nSpheres, "sphere_acc_Y", 0);
+    TRACK_VECTOR_RESIZE(sphere_acc_Z, nSpheres, "sphere_acc_Z", 0);
+
+    // The buffer array that stores any quantity that the user wish to quarry. We resize it here once instead of
+    // resizing on-the-call, to save time, in case that quarry function is called with a high frequency. The last
+    // element in this array is to store the reduced value.
+    TRACK_VECTOR_RESIZE(sphere_stats_buffer, nSpheres + 1, "sphere_stats_buffer", 0);
+    TRACK_VECTOR_RESIZE(sphere_stats_buffer_int, nSpheres + 1, "sphere_stats_buffer_int", 0);
+
+    // NOTE that this will get resized again later, this is just the first estimate
+    TRACK_VECTOR_RESIZE(spheres_in_SD_composite, 2 * nSpheres, "spheres_in_SD_composite", NULL_CHGPU_ID);
+
+    if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        // add rotational DOFs
+        TRACK_VECTOR_RESIZE(sphere_Omega_X, nSpheres, "sphere_Omega_X", 0);
+        TRACK_VECTOR_RESIZE(sphere_Omega_Y, nSpheres, "sphere_Omega_Y", 0);
+        TRACK_VECTOR_RESIZE(sphere_Omega_Z, nSpheres, "sphere_Omega_Z", 0);
+
+        // add torques
+        TRACK_VECTOR_RESIZE(sphere_ang_acc_X, nSpheres, "sphere_ang_acc_X", 0);
+        TRACK_VECTOR_RESIZE(sphere_ang_acc_Y, nSpheres, "sphere_ang_acc_Y", 0);
+        TRACK_VECTOR_RESIZE(sphere_ang_acc_Z, nSpheres, "sphere_ang_acc_Z", 0);
+
+        {
+            bool user_provided_ang_vel = user_sphere_ang_vel.size() != 0;
+            if (user_provided_ang_vel && user_sphere_ang_vel.size() != nSpheres)
+                CHGPU_ERROR("Provided angular velocity array has length %zu, but there are %u spheres!\n",
+                            user_sphere_ang_vel.size(), nSpheres);
+            if (user_provided_ang_vel) {
+                for (unsigned int i = 0; i < nSpheres; i++) {
+                    auto ang_vel = user_sphere_ang_vel.at(i);
+                    sphere_Omega_X.at(i) = (float)(ang_vel.x * TIME_SU2UU);
+                    sphere_Omega_Y.at(i) = (float)(ang_vel.y * TIME_SU2UU);
+                    sphere_Omega_Z.at(i) = (float)(ang_vel.z * TIME_SU2UU);
+                }
+            }
+        }
+    }
+
+    if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
+        TRACK_VECTOR_RESIZE(sphere_acc_X_old, nSpheres, "sphere_acc_X_old", 0);
+        TRACK_VECTOR_RESIZE(sphere_acc_Y_old, nSpheres, "sphere_acc_Y_old", 0);
+        TRACK_VECTOR_RESIZE(sphere_acc_Z_old, nSpheres, "sphere_acc_Z_old", 0);
+
+        // friction and multistep means keep old ang acc
+        if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+            TRACK_VECTOR_RESIZE(sphere_ang_acc_X_old, nSpheres, "sphere_ang_acc_X_old", 0);
+            TRACK_VECTOR_RESIZE(sphere_ang_acc_Y_old, nSpheres, "sphere_ang_acc_Y_old", 0);
+            TRACK_VECTOR_RESIZE(sphere_ang_acc_Z_old, nSpheres, "sphere_ang_acc_Z_old", 0);
+        }
+    }
+
+    // If this is a new-boot, we usually want to do this defragment.
+    // But if this is a restart, then probably no. We do not want every time the simulation restarts,
+    // we have the order of particles completely changed: it may be bad for visualization or debugging
+    if (defragment_on_start) {
+        defragment_initial_positions();
+    }
+
+    bool user_provided_internal_data = false;
+    if (gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP ||
+        gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP) {
+        TRACK_VECTOR_RESIZE(contact_partners_map, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "contact_partners_map",
+                            NULL_CHGPU_ID);
+        TRACK_VECTOR_RESIZE(contact_active_map, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "contact_active_map", false);
+
+        // If the user provides a checkpointed history array, we load it here
+        bool user_provided_partner_map = user_partner_map.size() != 0;
+        if (user_provided_partner_map && user_partner_map.size() != MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres)
+            CHGPU_ERROR("ERROR! The user provided contact partner map has size %zu. It needs to be %u * %u!\n",
+                        user_partner_map.size(), MAX_SPHERES_TOUCHED_BY_SPHERE, nSpheres);
+
+        // Hope that using .at (instead of []) gives better err msg when things go wrong,
+        // at the cost of some speed which is not important in I/O
+        if (user_provided_partner_map) {
+            for (unsigned int i = 0; i < nSpheres; i++) {
+                for (unsigned int j = 0; j < MAX_SPHERES_TOUCHED_BY_SPHERE; j++) {
+                    contact_partners_map.at(MAX_SPHERES_TOUCHED_BY_SPHERE * i + j) =
+                        user_partner_map.at(MAX_SPHERES_TOUCHED_BY_SPHERE * i + j);
+                }
+            }
+        }
+
+        user_provided_internal_data = user_provided_internal_data || user_provided_partner_map;
+    }
+
+    if (gran_params->friction_mode == CHGPU_FRICTION_MODE::MULTI_STEP) {
+        float3 null_history = {0., 0., 0.};
+        TRACK_VECTOR_RESIZE(contact_history_map, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "contact_history_map",
+                            null_history);
+        TRACK_VECTOR_RESIZE(contact_duration, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "contact_duration", 0);
+
+        // If the user provides a checkpointed history array, we load it here
+        bool user_provided_friction_history = user_friction_history.size() != 0;
+        if (user_provided_friction_history && user_friction_history.size() != MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres)
+            CHGPU_ERROR("ERROR! The user provided contact friction history has size %zu. It needs to be %u * %u!\n",
+                        user_friction_history.size(), MAX_SPHERES_TOUCHED_BY_SPHERE, nSpheres);
+
+        if (user_provided_friction_history) {
+            for (unsigned int i = 0; i < nSpheres; i++) {
+                for (unsigned int j = 0; j < MAX_SPHERES_TOUCHED_BY_SPHERE; j++) {
+                    float3 history_UU = user_friction_history[MAX_SPHERES_TOUCHED_BY_SPHERE * i + j];
+                    float3 history_SU = make_float3(history_UU.x / LENGTH_SU2UU, history_UU.y / LENGTH_SU2UU,
+                                                    history_UU.z / LENGTH_SU2UU);
+                    contact_history_map.at(MAX_SPHERES_TOUCHED_BY_SPHERE * i + j) = history_SU;
+                }
+            }
+        }
+
+        user_provided_internal_data = user_provided_internal_data || user_provided_friction_history;
+    }
+
+    // This if content should be executed rarely, if at all.
+    // If user gives Chrono::Gpu internal data from a file then it's a restart,
+    // then defragment_on_start should be set to false. But I implemented it anyway.
+    if (user_provided_internal_data && defragment_on_start) {
+        defragment_friction_history(MAX_SPHERES_TOUCHED_BY_SPHERE);
+    }
+
+    // record normal contact force
+    if (gran_params->recording_contactInfo == true) {
+        float3 null_force = {0.0f, 0.0f, 0.0f};
+        TRACK_VECTOR_RESIZE(normal_contact_force, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "normal contact force",
+                            null_force);
+    }
+
+    // record friction force
+    if (gran_params->recording_contactInfo == true && gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        float3 null_force = {0.0f, 0.0f, 0.0f};
+        TRACK_VECTOR_RESIZE(tangential_friction_force, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres,
+                            "tangential contact force", null_force);
+    }
+
+    // record rolling friction torque
+    if (gran_params->recording_contactInfo == true && gran_params->rolling_mode != CHGPU_ROLLING_MODE::NO_RESISTANCE) {
+        float3 null_force = {0.0f, 0.0f, 0.0f};
+        TRACK_VECTOR_RESIZE(rolling_friction_torque, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres,
+                            "rolling friction torque", null_force);
+        TRACK_VECTOR_RESIZE(char_collision_time, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres,
+                            "characterisitc collision time", 0);
+        TRACK_VECTOR_RESIZE(v_rot_array, MAX_SPHERES_TOUCHED_BY_SPHERE * nSpheres, "v rot", null_force);
+    }
+
+    // make sure the right pointers are packed
+    packSphereDataPointers();
+}
+
+void ChSystemGpu_impl::updateBCPositions() {
+    for (unsigned int i = 0; i < BC_params_list_UU.size(); i++) {
+        auto bc_type = BC_type_list.at(i);
+        const BC_params_t<float, float3>& params_UU = BC_params_list_UU.at(i);
+        BC_params_t<int64_t, int64_t3>& params_SU = BC_params_list_SU.at(i);
+        auto offset_function = BC_offset_function_list.at(i);
+        setBCOffset(bc_type, params_UU, params_SU, offset_function(elapsedSimTime));
+    }
+
+    if (!BD_is_fixed) {
+        double3 new_BD_offset = BDOffsetFunction(elapsedSimTime);
+
+        int64_t3 bd_offset_SU = {0, 0, 0};
+        bd_offset_SU.x = (int64_t)(new_BD_offset.x / LENGTH_SU2UU);
+        bd_offset_SU.y = (int64_t)(new_BD_offset.y / LENGTH_SU2UU);
+        bd_offset_SU.z = (int64_t)(new_BD_offset.z / LENGTH_SU2UU);
+
+        int64_t old_frame_X = gran_params->BD_frame_X;
+        int64_t old_frame_Y = gran_params->BD_frame_Y;
+        int64_t old_frame_Z = gran_params->BD_frame_Z;
+
+        gran_params->BD_frame_X = bd_offset_SU.x + BD_rest_frame_SU.x;
+        gran_params->BD_frame_Y = bd_offset_SU.y + BD_rest_frame_SU.y;
+        gran_params->BD_frame_Z = bd_offset_SU.z + BD_rest_frame_SU.z;
+
+        int64_t3 offset_delta = {0, 0, 0};
+
+        // if the frame X increases, the local X should decrease
+        offset_delta.x = old_frame_X - gran_params->BD_frame_X;
+        offset_delta.y = old_frame_Y - gran_params->BD_frame_Y;
+        offset_delta.z = old_frame_Z - gran_params->BD_frame_Z;
+
+        // printf("offset is %lld, %lld, %lld\n", offset_delta.x, offset_delta.y, offset_delta.z);
+
+        packSphereDataPointers();
+        shiftBDFrame(offset_delta);
+    }
+}
+
 // Set particle positions in UU
 void ChSystemGpu_impl::SetParticles(const std::vector<float3>& points,
                                     const std::vector<float3>& vels,
@@ -450,6 +450,16 @@ class ChSystemGpu_impl {
     /// Setup sphere data, initialize local coords
     void setupSphereDataStructures();
 
+    /// Set owner SDs and local coordinates of all spheres from their global positions (in SU).
+    /// Implemented by the compute backend (CUDA or CPU).
+    void convertToLocalPositions(int64_t* sphere_pos_global_X,
+                                 int64_t* sphere_pos_global_Y,
+                                 int64_t* sphere_pos_global_Z);
+
+    /// Update owner SDs and local coordinates of all spheres after the BD frame moved by -offset_delta.
+    /// Implemented by the compute backend (CUDA or CPU).
+    void shiftBDFrame(int64_t3 offset_delta);
+
     /// Helper function to convert a position in UU to its SU representation while also changing data type
     template <typename T1, typename T2>
     T1 convertToPosSU(T2 val) {
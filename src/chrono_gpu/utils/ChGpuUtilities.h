@@ -16,6 +16,8 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <sstream>
+#include <string>
 
 #define CHGPU_ERROR(...)                  \
     {                                     \
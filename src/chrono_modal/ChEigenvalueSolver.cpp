@@ -12,7 +12,10 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <exception>
 #include <numeric>
+#include <memory>
 #include <iomanip>
 
 #include "chrono_modal/ChEigenvalueSolver.h"
@@ -24,6 +27,7 @@
 
 #include <Eigen/Core>
 #include <Eigen/SparseCore>
+#include <Eigen/SparseLU>
 #include <Eigen/Eigenvalues>
 
 #include <Spectra/KrylovSchurGEigsSolver.h>
@@ -90,6 +94,60 @@ class KrylovSchurGEigsShiftInvert : public KrylovSchurGEigsBase<SymGEigsShiftInv
         : Base(set_shift_and_move(ModeMatOp(op, Bop), sigma), Bop, nev, ncv), m_sigma(sigma) {}
 };
 
+// Shift&invert operation y = (A - sigma * B)^-1 * x, with the same interface as Spectra::SymShiftInvert.
+// The shifted matrix is factorized once in set_shift(), either with the provided Chrono direct solver (ex. Pardiso
+// MKL or MUMPS) or, by default, with Eigen::SparseLU. Matrices are referenced, not copied.
+class ChShiftInvertOp {
+  public:
+    using Scalar = double;
+
+    ChShiftInvertOp(const Eigen::Ref<const SpMatrix>& A,
+                    const Eigen::Ref<const SpMatrix>& B,
+                    ChDirectSolverLS* linear_solver)
+        : m_A(A), m_B(B), m_n(A.rows()), m_solver(linear_solver) {}
+
+    Eigen::Index rows() const { return m_n; }
+    Eigen::Index cols() const { return m_n; }
+
+    void set_shift(const Scalar& sigma) {
+        if (m_solver) {
+            m_solver->A() = m_A - sigma * m_B;
+            if (!m_solver->SetupCurrent())
+                throw std::runtime_error("ChShiftInvertOp: factorization failed with the given shift");
+        } else {
+            m_lu.compute(m_A - sigma * m_B);
+            if (m_lu.info() != Eigen::Success)
+                throw std::runtime_error("ChShiftInvertOp: factorization failed with the given shift");
+        }
+    }
+
+    void perform_op(const Scalar* x_in, Scalar* y_out) const {
+        Eigen::Map<const Vector> x(x_in, m_n);
+        Eigen::Map<Vector> y(y_out, m_n);
+        if (m_solver) {
+            m_solver->b() = x;
+            m_solver->SolveCurrent();
+            y = m_solver->x();
+        } else {
+            y.noalias() = m_lu.solve(x);
+        }
+    }
+
+  private:
+    const Eigen::Ref<const SpMatrix> m_A;
+    const Eigen::Ref<const SpMatrix> m_B;
+    const Eigen::Index m_n;
+    ChDirectSolverLS* m_solver;
+    Eigen::SparseLU<SpMatrix> m_lu;
+};
+
+void ChGeneralizedEigenvalueSolver::AddTimers(const ChGeneralizedEigenvalueSolver& other) const {
+    m_timer_matrix_assembly.add(other.m_timer_matrix_assembly);
+    m_timer_eigen_setup.add(other.m_timer_eigen_setup);
+    m_timer_eigen_solver.add(other.m_timer_eigen_solver);
+    m_timer_solution_postprocessing.add(other.m_timer_solution_postprocessing);
+}
+
 void placeMatrix(Eigen::SparseMatrix<double, Eigen::ColMajor, int>& HCQ,
                  const ChSparseMatrix& H,
                  int row_start,
@@ -100,6 +158,21 @@ void placeMatrix(Eigen::SparseMatrix<double, Eigen::ColMajor, int>& HCQ,
         }
 }
 
+ChGeneralizedEigenvalueSolverKrylovSchur::ChGeneralizedEigenvalueSolverKrylovSchur(ChDirectSolverLS* mlinear_solver)
+    : linear_solver(mlinear_solver) {}
+
+ChGeneralizedEigenvalueSolverKrylovSchur* ChGeneralizedEigenvalueSolverKrylovSchur::Clone() const {
+    std::shared_ptr<ChDirectSolverLS> solver;
+    if (linear_solver) {
+        solver.reset(linear_solver->Clone());
+        if (!solver)
+            return nullptr;
+    }
+    auto clone = new ChGeneralizedEigenvalueSolverKrylovSchur(solver.get());
+    clone->m_linear_solver_clone = solver;
+    return clone;
+}
+
 bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(
     const ChSparseMatrix& M,   ///< input M matrix, n_v x n_v
     const ChSparseMatrix& K,   ///< input K matrix, n_v x n_v
@@ -155,9 +228,9 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(
         m = settings.n_modes + 1;
 
     // Construct matrix operation objects using the wrapper classes
-    using OpType = SymShiftInvert<double, Eigen::Sparse, Eigen::Sparse>;
+    using OpType = ChShiftInvertOp;
     using BOpType = SparseSymMatProd<double>;
-    OpType op(A, B);
+    OpType op(A, B, linear_solver);
     BOpType Bop(B);
 
     // Eigen::saveMarket(A, "C:/workspace/_temp/ChronoDump/generalized_splitmatrix_A.dat");
@@ -318,9 +391,9 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(ChAssembly& assembly,
         m = settings.n_modes + 1;
 
     // Construct matrix operation objects using the wrapper classes
-    using OpType = SymShiftInvert<double, Eigen::Sparse, Eigen::Sparse>;
+    using OpType = ChShiftInvertOp;
     using BOpType = SparseSymMatProd<double>;
-    OpType op(getColMajorSparseMatrix(A), getColMajorSparseMatrix(B));
+    OpType op(getColMajorSparseMatrix(A), getColMajorSparseMatrix(B), linear_solver);
     BOpType Bop(getColMajorSparseMatrix(B));
 
     // Dump data for test. ***TODO*** remove when well tested
@@ -337,7 +410,7 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(ChAssembly& assembly,
 
     eigen_solver.init();
 
-    m_timer_eigen_setup.start();
+    m_timer_eigen_setup.stop();
     m_timer_eigen_solver.start();
 
     int nconv = eigen_solver.compute(SortRule::LargestMagn, settings.max_iterations, settings.tolerance);
@@ -407,6 +480,21 @@ bool ChGeneralizedEigenvalueSolverKrylovSchur::Solve(ChAssembly& assembly,
     return true;
 }
 
+ChGeneralizedEigenvalueSolverLanczos::ChGeneralizedEigenvalueSolverLanczos(ChDirectSolverLS* mlinear_solver)
+    : linear_solver(mlinear_solver) {}
+
+ChGeneralizedEigenvalueSolverLanczos* ChGeneralizedEigenvalueSolverLanczos::Clone() const {
+    std::shared_ptr<ChDirectSolverLS> solver;
+    if (linear_solver) {
+        solver.reset(linear_solver->Clone());
+        if (!solver)
+            return nullptr;
+    }
+    auto clone = new ChGeneralizedEigenvalueSolverLanczos(solver.get());
+    clone->m_linear_solver_clone = solver;
+    return clone;
+}
+
 bool ChGeneralizedEigenvalueSolverLanczos::Solve(
     const ChSparseMatrix& M,   ///< input M matrix, n_v x n_v
     const ChSparseMatrix& K,   ///< input K matrix, n_v x n_v
@@ -462,9 +550,9 @@ bool ChGeneralizedEigenvalueSolverLanczos::Solve(
         m = settings.n_modes + 1;
 
     // Construct matrix operation objects using the wrapper classes
-    using OpType = SymShiftInvert<double, Eigen::Sparse, Eigen::Sparse>;
+    using OpType = ChShiftInvertOp;
     using BOpType = SparseSymMatProd<double>;
-    OpType op(A, B);
+    OpType op(A, B, linear_solver);
     BOpType Bop(B);
 
     // The Lanczos solver, using the shift and invert mode
@@ -476,7 +564,7 @@ bool ChGeneralizedEigenvalueSolverLanczos::Solve(
 
     m_timer_eigen_solver.start();
     int nconv = eigen_solver.compute(SortRule::LargestMagn, settings.max_iterations, settings.tolerance);
-    m_timer_eigen_solver.start();
+    m_timer_eigen_solver.stop();
 
     if (settings.verbose) {
         if (eigen_solver.info() != CompInfo::Successful) {
@@ -532,6 +620,45 @@ bool ChGeneralizedEigenvalueSolverLanczos::Solve(
     return true;
 }
 
+void ChModalSolveUndamped::AppendSpanModes(ChMatrixDynamic<std::complex<double>>& eigvects_i,
+                                           ChVectorDynamic<std::complex<double>>& eigvals_i,
+                                           ChVectorDynamic<double>& freq_i,
+                                           ChMatrixDynamic<std::complex<double>>& eigvects,
+                                           ChVectorDynamic<std::complex<double>>& eigvals,
+                                           ChVectorDynamic<double>& freq) const {
+    int nmodes_out_i = eigvals_i.size();
+
+    // Sort modes by frequencies if not exactly in increasing order. Some solver sometime fail at this.
+    std::vector<int> order(nmodes_out_i);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return freq_i[a] < freq_i[b]; });
+    Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic> perm;
+    perm.indices() = Eigen::Map<Eigen::ArrayXi>(order.data(), order.size());
+    eigvects_i = eigvects_i * perm;
+    eigvals_i = perm * eigvals_i;
+    freq_i = perm * freq_i;
+
+    // avoid overlap when multiple shifts were used, and too close.. If is it may happen that the lowest eigvals of
+    // some shift are smaller than the highest of the previous shift.
+    int i_nodes_notoverlap = nmodes_out_i;
+    if (freq.size() > 0) {
+        double upper_freq = freq[freq.size() - 1];
+        for (int j = 0; j < nmodes_out_i; ++j)
+            if (freq_i[j] < upper_freq)
+                i_nodes_notoverlap--;
+    }
+
+    if (i_nodes_notoverlap) {
+        eigvects.conservativeResize(eigvects_i.rows(), eigvects.cols() + i_nodes_notoverlap);
+        eigvals.conservativeResize(eigvals.size() + i_nodes_notoverlap);
+        freq.conservativeResize(freq.size() + i_nodes_notoverlap);
+        // modes are sorted by increasing frequency, so the overlapping ones (if any) are the first ones
+        eigvects.rightCols(i_nodes_notoverlap) = eigvects_i.rightCols(i_nodes_notoverlap);
+        eigvals.tail(i_nodes_notoverlap) = eigvals_i.tail(i_nodes_notoverlap);
+        freq.tail(i_nodes_notoverlap) = freq_i.tail(i_nodes_notoverlap);
+    }
+}
+
 int ChModalSolveUndamped::Solve(
     const ChSparseMatrix& M,   ///< input M matrix, n_v x n_v
     const ChSparseMatrix& K,   ///< input K matrix, n_v x n_v
@@ -546,61 +673,66 @@ int ChModalSolveUndamped::Solve(
     eigvals.resize(0);
     freq.resize(0);
 
+    int num_spans = (int)this->freq_spans.size();
+
+    std::vector<ChMatrixDynamic<std::complex<double>>> eigvects_s(num_spans);
+    std::vector<ChVectorDynamic<std::complex<double>>> eigvals_s(num_spans);
+    std::vector<ChVectorDynamic<double>> freq_s(num_spans);
+    std::vector<char> success_s(num_spans, 0);
+    std::vector<std::exception_ptr> exception_s(num_spans);
+
+    // Spans are independent shift&invert runs (each with its own factorization), so they can be solved in parallel,
+    // each with its own clone of the eigensolver (and of its linear solver, if any). Results are then merged in the
+    // order of the spans, as in the sequential case.
+    int nthreads = std::max(1, std::min(this->num_threads, num_spans));
+    std::vector<std::unique_ptr<ChGeneralizedEigenvalueSolver>> solver_s(num_spans);
+    if (nthreads > 1) {
+        for (int i = 0; i < num_spans; ++i) {
+            solver_s[i].reset(this->msolver.Clone());
+            if (!solver_s[i]) {
+                nthreads = 1;
+                break;
+            }
+        }
+    }
+
     // for each freq_spans finds the closest modes to i-th input frequency:
-    for (int i = 0; i < this->freq_spans.size(); ++i) {
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+    for (int i = 0; i < num_spans; ++i) {
         int nmodes_goal_i = this->freq_spans[i].nmodes;
         double sigma_i =
             -pow(this->freq_spans[i].freq * CH_2PI, 2);  // sigma for shift&invert, as lowest eigenvalue, from Hz info
 
-        ChMatrixDynamic<std::complex<double>> eigvects_i;
-        ChVectorDynamic<std::complex<double>> eigvals_i;
-        ChVectorDynamic<double> freq_i;
-
-        eigvects_i.setZero(M.rows(), nmodes_goal_i);
-        eigvals_i.setZero(nmodes_goal_i);
-        freq_i.setZero(nmodes_goal_i);
+        eigvects_s[i].setZero(M.rows(), nmodes_goal_i);
+        eigvals_s[i].setZero(nmodes_goal_i);
+        freq_s[i].setZero(nmodes_goal_i);
 
         ChEigenvalueSolverSettings settings_i(nmodes_goal_i, this->max_iterations, this->tolerance, this->verbose,
                                               sigma_i);
 
-        if (!this->msolver.Solve(M, K, Cq, eigvects_i, eigvals_i, freq_i, settings_i))
-            return found_eigs;
-
-        // append to list of results
-
-        int nmodes_out_i = eigvals_i.size();
+        // exceptions cannot leave the parallel region; rethrown below
+        try {
+            const ChGeneralizedEigenvalueSolver& solver_i = (nthreads > 1) ? *solver_s[i] : this->msolver;
+            success_s[i] = solver_i.Solve(M, K, Cq, eigvects_s[i], eigvals_s[i], freq_s[i], settings_i);
+        } catch (...) {
+            exception_s[i] = std::current_exception();
+        }
+    }
 
-        // Sort modes by frequencies if not exactly in increasing order. Some solver sometime fail at this.
-        std::vector<int> order(nmodes_out_i);
-        std::iota(order.begin(), order.end(), 0);
-        std::sort(order.begin(), order.end(), [&](int a, int b) { return freq_i[a] < freq_i[b]; });
-        Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic> perm;
-        perm.indices() = Eigen::Map<Eigen::ArrayXi>(order.data(), order.size());
-        eigvects_i = eigvects_i * perm;
-        eigvals_i = perm * eigvals_i;
-        freq_i = perm * freq_i;
+    if (nthreads > 1) {
+        for (int i = 0; i < num_spans; ++i)
+            this->msolver.AddTimers(*solver_s[i]);
+    }
 
-        // avoid overlap when multiple shifts were used, and too close.. If is it may happen that the lowest eigvals of
-        // some shift are smaller than the highest of the previous shift.
-        int i_nodes_notoverlap = nmodes_out_i;
-        if (freq.size() > 0) {
-            double upper_freq = freq[freq.size() - 1];
-            for (int j = 0; j < nmodes_out_i; ++j)
-                if (freq_i[j] < upper_freq)
-                    i_nodes_notoverlap--;
-        }
+    // append to list of results
+    for (int i = 0; i < num_spans; ++i) {
+        if (exception_s[i])
+            std::rethrow_exception(exception_s[i]);
+        if (!success_s[i])
+            return found_eigs;
 
-        if (i_nodes_notoverlap) {
-            eigvects.conservativeResize(M.rows(), eigvects.cols() + i_nodes_notoverlap);
-            eigvals.conservativeResize(eigvals.size() + i_nodes_notoverlap);
-            freq.conservativeResize(freq.size() + i_nodes_notoverlap);
-            // TODO: seems a bug in below three lines
-            // because we might have i_nodes_notoverlap < nmodes_out_i when there are overlap modes
-            eigvects.rightCols(i_nodes_notoverlap) = eigvects_i;
-            eigvals.tail(i_nodes_notoverlap) = eigvals_i;
-            freq.tail(i_nodes_notoverlap) = freq_i;
-            found_eigs = eigvals.size();
-        }
+        AppendSpanModes(eigvects_s[i], eigvals_s[i], freq_s[i], eigvects, eigvals, freq);
+        found_eigs = eigvals.size();
     }
 
     return found_eigs;
@@ -616,6 +748,7 @@ int ChModalSolveUndamped::Solve(ChAssembly& assembly,
     freq.resize(0);
 
     // for each freq_spans finds the closest modes to i-th input frequency:
+    // (spans are solved sequentially here, as the assembly is used to load the system matrices)
     for (int i = 0; i < this->freq_spans.size(); ++i) {
         int nmodes_goal_i = this->freq_spans[i].nmodes;
         double sigma_i =
@@ -632,40 +765,8 @@ int ChModalSolveUndamped::Solve(ChAssembly& assembly,
             return found_eigs;
 
         // append to list of results
-
-        int nmodes_out_i = eigvals_i.size();
-
-        // Sort modes by frequencies if not exactly in increasing order. Some solver sometime fail at this.
-        std::vector<int> order(nmodes_out_i);
-        std::iota(order.begin(), order.end(), 0);
-        std::sort(order.begin(), order.end(), [&](int a, int b) { return freq_i[a] < freq_i[b]; });
-        Eigen::PermutationMatrix<Eigen::Dynamic, Eigen::Dynamic> perm;
-        perm.indices() = Eigen::Map<Eigen::ArrayXi>(order.data(), order.size());
-        eigvects_i = eigvects_i * perm;
-        eigvals_i = perm * eigvals_i;
-        freq_i = perm * freq_i;
-
-        // avoid overlap when multiple shifts were used, and too close.. If is it may happen that the lowest eigvals of
-        // some shift are smaller than the highest of the previous shift.
-        int i_nodes_notoverlap = nmodes_out_i;
-        if (freq.size() > 0) {
-            double upper_freq = freq[freq.size() - 1];
-            for (int j = 0; j < nmodes_out_i; ++j)
-                if (freq_i[j] < upper_freq)
-                    i_nodes_notoverlap--;
-        }
-
-        if (i_nodes_notoverlap) {
-            eigvects.conservativeResize(assembly.GetNumCoordsVelLevel(), eigvects.cols() + i_nodes_notoverlap);
-            eigvals.conservativeResize(eigvals.size() + i_nodes_notoverlap);
-            freq.conservativeResize(freq.size() + i_nodes_notoverlap);
-            // TODO: seems a bug in below three lines
-            // because we might have i_nodes_notoverlap < nmodes_out_i when there are overlap modes
-            eigvects.rightCols(i_nodes_notoverlap) = eigvects_i;
-            eigvals.tail(i_nodes_notoverlap) = eigvals_i;
-            freq.tail(i_nodes_notoverlap) = freq_i;
-            found_eigs = eigvals.size();
-        }
+        AppendSpanModes(eigvects_i, eigvals_i, freq_i, eigvects, eigvals, freq);
+        found_eigs = eigvals.size();
     }
     return found_eigs;
 }
@@ -107,6 +107,14 @@ class ChApiModal ChGeneralizedEigenvalueSolver {
     /// Get cumulative time for post-solver solution postprocessing.
     double GetTimeSolutionPostProcessing() const { return m_timer_solution_postprocessing(); }
 
+    /// Create a new eigensolver with the same settings, that can be used concurrently with this one (e.g. for
+    /// different shifts). The new eigensolver owns a clone of the linear solver, if any, and has its own timers.
+    /// Return nullptr if not supported.
+    virtual ChGeneralizedEigenvalueSolver* Clone() const { return nullptr; }
+
+    /// Add the cumulative times of another eigensolver (e.g. a clone) to the timers of this one.
+    void AddTimers(const ChGeneralizedEigenvalueSolver& other) const;
+
   protected:
     mutable ChTimer m_timer_matrix_assembly;          ///< timer for matrix assembly
     mutable ChTimer m_timer_eigen_setup;              ///< timer for eigensolver setup
@@ -120,6 +128,11 @@ class ChApiModal ChGeneralizedEigenvalueSolver {
 /// It uses an iterative method and it exploits the sparsity of the matrices.
 class ChApiModal ChGeneralizedEigenvalueSolverKrylovSchur : public ChGeneralizedEigenvalueSolver {
   public:
+    /// Default: uses Eigen::SparseLU as factorization for the shift&invert,
+    /// otherwise pass a custom sparse solver for faster factorization (ex. ChSolverPardisoMKL, ChSolverMumps).
+    /// The shifted matrix is factorized once per shift.
+    ChGeneralizedEigenvalueSolverKrylovSchur(ChDirectSolverLS* mlinear_solver = 0);
+
     virtual ~ChGeneralizedEigenvalueSolverKrylovSchur(){};
 
     /// Solve the constrained eigenvalue problem (-wsquare*M + K)*x = 0 s.t. Cq*x = 0
@@ -147,6 +160,15 @@ class ChApiModal ChGeneralizedEigenvalueSolverKrylovSchur : public ChGeneralized
         ChEigenvalueSolverSettings settings = 0  ///< optional: settings for the solver, or n. of desired lower
                                                  ///< eigenvalues. If =0, return all eigenvalues.
     ) const override;
+
+    /// Create a new eigensolver using a clone of the linear solver (if any).
+    /// Return nullptr if the linear solver cannot be cloned.
+    virtual ChGeneralizedEigenvalueSolverKrylovSchur* Clone() const override;
+
+    ChDirectSolverLS* linear_solver;
+
+  private:
+    std::shared_ptr<ChDirectSolverLS> m_linear_solver_clone;  ///< linear solver owned by a clone
 };
 
 /// Solves the undamped constrained eigenvalue problem with the Lanczos iterative method.
@@ -156,6 +178,11 @@ class ChApiModal ChGeneralizedEigenvalueSolverKrylovSchur : public ChGeneralized
 /// It uses an iterative method and it exploits the sparsity of the matrices.
 class ChApiModal ChGeneralizedEigenvalueSolverLanczos : public ChGeneralizedEigenvalueSolver {
   public:
+    /// Default: uses Eigen::SparseLU as factorization for the shift&invert,
+    /// otherwise pass a custom sparse solver for faster factorization (ex. ChSolverPardisoMKL, ChSolverMumps).
+    /// The shifted matrix is factorized once per shift.
+    ChGeneralizedEigenvalueSolverLanczos(ChDirectSolverLS* mlinear_solver = 0);
+
     virtual ~ChGeneralizedEigenvalueSolverLanczos(){};
 
     /// Solve the constrained eigenvalue problem (-wsquare*M + K)*x = 0 s.t. Cq*x = 0
@@ -185,6 +212,15 @@ class ChApiModal ChGeneralizedEigenvalueSolverLanczos : public ChGeneralizedEige
     ) const override {
         throw std::runtime_error("Method not implemented yet.");
     }
+
+    /// Create a new eigensolver using a clone of the linear solver (if any).
+    /// Return nullptr if the linear solver cannot be cloned.
+    virtual ChGeneralizedEigenvalueSolverLanczos* Clone() const override;
+
+    ChDirectSolverLS* linear_solver;
+
+  private:
+    std::shared_ptr<ChDirectSolverLS> m_linear_solver_clone;  ///< linear solver owned by a clone
 };
 
 //---------------------------------------------------------------------------------------------
@@ -280,7 +316,17 @@ class ChApiModal ChModalSolveUndamped {
     double tolerance = 1e-10;  ///< tolerance for the iterative solver.
     int max_iterations = 500;  ///< upper limit for the number of iterations. If too low might not converge.
     bool verbose = false;      ///< turn to true to see some diagnostic.
+    int num_threads = 1;       ///< max n. of frequency spans solved in parallel, if the eigensolver can be cloned.
     const ChGeneralizedEigenvalueSolver& msolver;
+
+  private:
+    /// Sort the modes of one span by frequency and append them to the results, discarding overlapping modes.
+    void AppendSpanModes(ChMatrixDynamic<std::complex<double>>& eigvects_i,
+                         ChVectorDynamic<std::complex<double>>& eigvals_i,
+                         ChVectorDynamic<double>& freq_i,
+                         ChMatrixDynamic<std::complex<double>>& eigvects,
+                         ChVectorDynamic<std::complex<double>>& eigvals,
+                         ChVectorDynamic<double>& freq) const;
 };
 
 //---------------------------------------------------------------------------------------------
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono_modal/ChModalAssembly.h"
@@ -76,6 +77,42 @@ void ChModalAssembly::FlagModelAsReduced() {
     Setup();
 }
 
+void ChModalAssembly::RecoverFullModel() {
+    if (!m_is_model_reduced)
+        return;
+
+    // bring the internal items in the configuration represented by the modal coordinates
+    // (already done at each update if the internal nodes are updated)
+    if (!m_internal_nodes_update)
+        this->UpdateInternalStateWithModes(true);
+
+    // restore the masses of the boundary items, which were moved to the modal mass matrix
+    size_t k = 0;
+    for (auto& body : bodylist) {
+        body->SetMass(m_boundary_masses[k]);
+        body->SetInertia(m_boundary_inertias[k]);
+        k++;
+    }
+    for (auto& item : this->meshlist) {
+        if (auto mesh = std::dynamic_pointer_cast<ChMesh>(item)) {
+            for (auto& node : mesh->GetNodes()) {
+                if (auto xyz = std::dynamic_pointer_cast<ChNodeFEAxyz>(node)) {
+                    xyz->SetMass(m_boundary_masses[k]);
+                    k++;
+                }
+                if (auto xyzrot = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(node)) {
+                    xyzrot->SetMass(m_boundary_masses[k]);
+                    static_cast<ChVariablesBodyOwnMass&>(xyzrot->Variables()).SetBodyInertia(m_boundary_inertias[k]);
+                    k++;
+                }
+            }
+        }
+    }
+
+    m_is_model_reduced = false;
+    Setup();
+}
+
 void ChModalAssembly::SetUseStaticCorrection(bool flag) {
     if (m_internal_nodes_update)
         m_num_coords_static_correction = flag ? 1 : 0;
@@ -184,6 +221,17 @@ void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
 
     this->Initialize();
 
+    // when recomputing the reduction, the modal coordinates are re-initialized from the current full state
+    bool is_rereduction = (modal_variables != nullptr);
+    ChState full_x;
+    ChStateDelta full_v;
+    if (is_rereduction) {
+        double fooT;
+        full_x.setZero(m_num_coords_pos, nullptr);
+        full_v.setZero(m_num_coords_vel, nullptr);
+        this->IntStateGather(0, full_x, 0, full_v, fooT);
+    }
+
     // in modal reduced state, m_modal_automatic_gravity overwrites the gravity settings for both boundary and internal
     // meshes.
     if (m_modal_automatic_gravity) {
@@ -245,6 +293,12 @@ void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
     this->ApplyModeAccelerationTransformation(damping_model);
     //// end of modal reduction transformation
 
+    if (is_rereduction) {
+        this->InitializeModalCoordinates(full_x, full_v);
+        // the projection matrices depend on the reduced mass matrix and must be recomputed
+        this->is_projection_initialized = false;
+    }
+
     // initialize the projection matrices
     this->ComputeProjectionMatrix();
 
@@ -280,8 +334,9 @@ void ChModalAssembly::DoModalReduction(ChSparseMatrix& full_M,
 
 void ChModalAssembly::DoModalReduction(const ChModalSolveUndamped& n_modes_settings,
                                        const ChModalDamping& damping_model) {
+    // if already reduced, go back to the full assembly and recompute the reduction in the current configuration
     if (m_is_model_reduced)
-        return;
+        this->RecoverFullModel();
 
     // 1) fetch the full (not reduced) mass and stiffness
     ChSparseMatrix full_M;
@@ -698,8 +753,7 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         util_convert_to_colmajor(K_II_col, K_II_loc);
     }
     // avoid computing K_IIc^{-1}, effectively do n times a linear solve:
-    m_solver_invKIIc.analyzePattern(K_II_col);
-    m_solver_invKIIc.factorize(K_II_col);
+    FactorizeKIIc(K_II_col);
 
     // 1) Matrix of static modes (constrained, so use K_IIc instead of K_II,
     // the original unconstrained static reduction is: Psi_S = - K_II^{-1} * K_IB.
@@ -710,19 +764,20 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         Psi_S_LambdaI.setZero(m_num_constr_internal, m_num_coords_vel_boundary);
     // ChMatrixDynamic<> Psi_S_C(m_num_coords_vel_internal + m_num_constr_internal, m_num_coords_vel_boundary);
 
-    for (unsigned int i = 0; i < m_num_coords_vel_boundary; ++i) {
-        ChVectorDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal);
+    {
+        ChMatrixDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal, m_num_coords_vel_boundary);
         if (m_num_constr_internal)
-            rhs << K_IB_loc.col(i).toDense(), Cq_IB_loc.col(i).toDense() * m_scaling_factor_CqI;
+            rhs << K_IB_loc.toDense(), Cq_IB_loc.toDense() * m_scaling_factor_CqI;
         else
-            rhs << K_IB_loc.col(i).toDense();
+            rhs << K_IB_loc.toDense();
 
-        ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs.sparseView());
+        ChMatrixDynamic<> x;
+        SolveKIIc(rhs, x);
 
-        Psi_S.col(i) = -x.head(m_num_coords_vel_internal);
-        // Psi_S_C.col(i) = -x;
+        Psi_S = -x.topRows(m_num_coords_vel_internal);
+        // Psi_S_C = -x;
         if (m_num_constr_internal)
-            Psi_S_LambdaI.col(i) = -x.tail(m_num_constr_internal);
+            Psi_S_LambdaI = -x.bottomRows(m_num_constr_internal);
     }
 
     // 2) Matrix of dynamic modes (V_B and V_I already computed, reuse K_IIc already factored before.
@@ -754,24 +809,31 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         rhs_dyn = M_II_loc * V_I;
     }
 
-    for (unsigned int i = 0; i < m_num_coords_modal - m_num_coords_static_correction; ++i) {
-        ChVectorDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal);
+    {
+        unsigned int num_dyn_modes = m_num_coords_modal - m_num_coords_static_correction;
+        ChMatrixDynamic<> rhs(m_num_coords_vel_internal + m_num_constr_internal, num_dyn_modes);
         if (m_num_constr_internal)
-            rhs << rhs_dyn.col(i), Eigen::VectorXd::Zero(m_num_constr_internal);
+            rhs << rhs_dyn.leftCols(num_dyn_modes), Eigen::MatrixXd::Zero(m_num_constr_internal, num_dyn_modes);
         else
-            rhs << rhs_dyn.col(i);
+            rhs << rhs_dyn.leftCols(num_dyn_modes);
 
-        ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs.sparseView());
+        ChMatrixDynamic<> x;
+        SolveKIIc(rhs, x);
 
-        Psi_D.col(i) = -x.head(m_num_coords_vel_internal);
-        // Psi_D_C.col(i) = -x;
+        Psi_D = -x.topRows(m_num_coords_vel_internal);
+        // Psi_D_C = -x;
         if (m_num_constr_internal)
-            Psi_D_LambdaI.col(i) = -x.tail(m_num_constr_internal);
+            Psi_D_LambdaI = -x.bottomRows(m_num_constr_internal);
     }
 
-    ChMatrixDynamic<> M_SS =
-        M_BB_loc + M_BI_loc * Psi_S + Psi_S.transpose() * M_IB_loc + Psi_S.transpose() * M_II_loc * Psi_S;
-    ChMatrixDynamic<> M_DD = Psi_D.transpose() * M_II_loc * Psi_D;
+    // Products of the internal mass matrix with the static and dynamic modes, reused in the reduced mass matrix.
+    // These are evaluated once as (sparse x dense) products, so that the remaining products are dense and can use the
+    // blocked (and multithreaded) Eigen matrix products.
+    ChMatrixDynamic<> MII_PsiS = M_II_loc * Psi_S;
+    ChMatrixDynamic<> MII_PsiD = M_II_loc * Psi_D;
+
+    ChMatrixDynamic<> M_SS = M_BB_loc + M_BI_loc * Psi_S + Psi_S.transpose() * M_IB_loc + Psi_S.transpose() * MII_PsiS;
+    ChMatrixDynamic<> M_DD = Psi_D.transpose() * MII_PsiD;
 
     // Find proper coefficients to normalize 'm_modal_eigvect' to improve the condition number of 'M_red'.
     ChVectorDynamic<> modes_scaling_factor(m_modal_eigvect.cols());
@@ -785,6 +847,7 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     for (unsigned int i_mode = 0; i_mode < m_modal_eigvect.cols(); ++i_mode) {
         m_modal_eigvect.col(i_mode) *= modes_scaling_factor(i_mode);
         Psi_D.col(i_mode) *= modes_scaling_factor(i_mode);
+        MII_PsiD.col(i_mode) *= modes_scaling_factor(i_mode);
         if (m_num_constr_internal)
             Psi_D_LambdaI.col(i_mode) *= modes_scaling_factor(i_mode);
     }
@@ -808,7 +871,7 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
         else
             rhs << f_loc;
 
-        ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs.sparseView());
+        ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs);
 
         Psi_Cor = x.head(m_num_coords_vel_internal);
         // Psi_Cor_C = x;
@@ -849,7 +912,8 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     this->M_red.topLeftCorner(m_num_coords_vel_boundary, m_num_coords_vel_boundary) = M_SS;
 
     this->M_red.block(0, m_num_coords_vel_boundary, m_num_coords_vel_boundary,
-                      m_num_coords_modal - m_num_coords_static_correction) = MBI_PsiST_MII * Psi_D;
+                      m_num_coords_modal - m_num_coords_static_correction) =
+        M_BI_loc * Psi_D + Psi_S.transpose() * MII_PsiD;
     this->M_red.block(m_num_coords_vel_boundary, 0, m_num_coords_modal - m_num_coords_static_correction,
                       m_num_coords_vel_boundary) = this->M_red
                                                        .block(0, m_num_coords_vel_boundary, m_num_coords_vel_boundary,
@@ -857,14 +921,14 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
                                                        .transpose();  // symmetric block
     this->M_red.block(m_num_coords_vel_boundary, m_num_coords_vel_boundary,
                       m_num_coords_modal - m_num_coords_static_correction,
-                      m_num_coords_modal - m_num_coords_static_correction) = Psi_D.transpose() * M_II_loc * Psi_D;
+                      m_num_coords_modal - m_num_coords_static_correction) = Psi_D.transpose() * MII_PsiD;
     if (m_num_coords_static_correction) {  // static correction blocks
         this->M_red.block(0, m_num_coords_vel_boundary + m_num_coords_modal - m_num_coords_static_correction,
                           m_num_coords_vel_boundary, m_num_coords_static_correction) = MBI_PsiST_MII * Psi_Cor;
         this->M_red.block(m_num_coords_vel_boundary,
                           m_num_coords_vel_boundary + m_num_coords_modal - m_num_coords_static_correction,
                           m_num_coords_modal - m_num_coords_static_correction, m_num_coords_static_correction) =
-            Psi_D.transpose() * M_II_loc * Psi_Cor;
+            MII_PsiD.transpose() * Psi_Cor;
 
         this->M_red.block(m_num_coords_vel_boundary + m_num_coords_modal - m_num_coords_static_correction, 0,
                           m_num_coords_static_correction, m_num_coords_vel_boundary) =
@@ -887,16 +951,17 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     }
 
     this->K_red.setZero(m_num_coords_vel_boundary + m_num_coords_modal, m_num_coords_vel_boundary + m_num_coords_modal);
+    ChMatrixDynamic<> KII_PsiD = K_II_loc * Psi_D;
     this->K_red.topLeftCorner(m_num_coords_vel_boundary, m_num_coords_vel_boundary) =
-        K_BB_loc + K_BI_loc * Psi_S + Psi_S.transpose() * K_IB_loc + Psi_S.transpose() * K_II_loc * Psi_S;
+        K_BB_loc + K_BI_loc * Psi_S + Psi_S.transpose() * K_IB_loc + Psi_S.transpose() * (K_II_loc * Psi_S);
     this->K_red.block(m_num_coords_vel_boundary, m_num_coords_vel_boundary,
                       m_num_coords_modal - m_num_coords_static_correction,
-                      m_num_coords_modal - m_num_coords_static_correction) = Psi_D.transpose() * K_II_loc * Psi_D;
+                      m_num_coords_modal - m_num_coords_static_correction) = Psi_D.transpose() * KII_PsiD;
     if (m_num_coords_static_correction) {  // static correction blocks
         this->K_red.block(m_num_coords_vel_boundary,
                           m_num_coords_vel_boundary + m_num_coords_modal - m_num_coords_static_correction,
                           m_num_coords_modal - m_num_coords_static_correction, m_num_coords_static_correction) =
-            Psi_D.transpose() * K_II_loc * Psi_Cor;
+            KII_PsiD.transpose() * Psi_Cor;
 
         this->K_red.block(m_num_coords_vel_boundary + m_num_coords_modal - m_num_coords_static_correction,
                           m_num_coords_vel_boundary, m_num_coords_static_correction,
@@ -933,16 +998,26 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     // this->modal_M.
     // NOTE! this should be made more generic and future-proof by implementing a virtual method ex.
     // RemoveMass() in all ChPhysicsItem
+    // The original masses are stored, to be restored if the reduction is recomputed (see RecoverFullModel).
+    m_boundary_masses.clear();
+    m_boundary_inertias.clear();
     for (auto& body : bodylist) {
+        m_boundary_masses.push_back(body->GetMass());
+        m_boundary_inertias.push_back(body->GetInertia());
         body->SetMass(0);
         body->SetInertia(VNULL);
     }
     for (auto& item : this->meshlist) {
         if (auto mesh = std::dynamic_pointer_cast<ChMesh>(item)) {
             for (auto& node : mesh->GetNodes()) {
-                if (auto xyz = std::dynamic_pointer_cast<ChNodeFEAxyz>(node))
+                if (auto xyz = std::dynamic_pointer_cast<ChNodeFEAxyz>(node)) {
+                    m_boundary_masses.push_back(xyz->GetMass());
+                    m_boundary_inertias.push_back(ChMatrix33<>(0));
                     xyz->SetMass(0);
+                }
                 if (auto xyzrot = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(node)) {
+                    m_boundary_masses.push_back(xyzrot->GetMass());
+                    m_boundary_inertias.push_back(xyzrot->GetInertia());
                     xyzrot->SetMass(0);
                     xyzrot->GetInertia().setZero();
                 }
@@ -959,6 +1034,100 @@ void ChModalAssembly::ApplyModeAccelerationTransformation(const ChModalDamping&
     m_modal_eigvect.resize(0, 0);
 }
 
+void ChModalAssembly::FactorizeKIIc(const Eigen::SparseMatrix<double, Eigen::ColMajor, int>& K_IIc) {
+    bool same_pattern = m_reuse_factorization_KIIc && m_num_factorize_KIIc > 0 &&  //
+                        m_KIIc.rows() == K_IIc.rows() && m_KIIc.cols() == K_IIc.cols() &&
+                        m_KIIc.nonZeros() == K_IIc.nonZeros() &&
+                        std::equal(K_IIc.outerIndexPtr(), K_IIc.outerIndexPtr() + K_IIc.outerSize() + 1,
+                                   m_KIIc.outerIndexPtr()) &&
+                        std::equal(K_IIc.innerIndexPtr(), K_IIc.innerIndexPtr() + K_IIc.nonZeros(),
+                                   m_KIIc.innerIndexPtr());
+
+    // Nothing to do if the matrix did not change since the last factorization
+    if (same_pattern && std::equal(K_IIc.valuePtr(), K_IIc.valuePtr() + K_IIc.nonZeros(), m_KIIc.valuePtr()))
+        return;
+
+    if (!same_pattern) {
+        m_solver_invKIIc.analyzePattern(K_IIc);
+        m_num_analyze_KIIc++;
+    }
+    m_solver_invKIIc.factorize(K_IIc);
+    m_num_factorize_KIIc++;
+
+    m_KIIc = K_IIc;
+}
+
+void ChModalAssembly::SolveKIIc(const ChMatrixDynamic<>& rhs, ChMatrixDynamic<>& x) {
+    x.resize(rhs.rows(), rhs.cols());
+
+    // Split the right-hand sides in contiguous blocks of columns, one per thread
+    int nthreads = system ? system->nthreads_chrono : 1;
+    int ncols = (int)rhs.cols();
+    int nblocks = std::max(1, std::min(nthreads, ncols));
+    int block_size = (ncols + nblocks - 1) / nblocks;
+
+#pragma omp parallel for num_threads(nblocks)
+    for (int ib = 0; ib < nblocks; ib++) {
+        int start = ib * block_size;
+        int n = std::min(block_size, ncols - start);
+        if (n > 0)
+            x.middleCols(start, n) = m_solver_invKIIc.solve(rhs.middleCols(start, n));
+    }
+}
+
+void ChModalAssembly::InitializeModalCoordinates(const ChState& full_x, const ChStateDelta& full_v) {
+    unsigned int num_dyn_modes = m_num_coords_modal - m_num_coords_static_correction;
+
+    // local elastic displacement of the boundary nodes
+    ChVectorDynamic<> u_locred;
+    ChVectorDynamic<> e_locred;
+    ChVectorDynamic<> edt_locred;
+    this->GetLocalDeformations(u_locred, e_locred, edt_locred);
+
+    // local velocity of the boundary nodes
+    ChVectorDynamic<> vloc_bou(m_num_coords_vel_boundary);
+    for (unsigned int i_node = 0; i_node < m_num_coords_vel_boundary / 6; ++i_node) {
+        vloc_bou.segment(6 * i_node, 3) = floating_frame_F.GetRot().RotateBack(full_v.segment(6 * i_node, 3)).eigen();
+        vloc_bou.segment(6 * i_node + 3, 3) = full_v.segment(6 * i_node + 3, 3);
+    }
+
+    // local deformation and velocity of the internal nodes, w.r.t. the initial undeformed configuration
+    // (inverse of the recovery of the internal nodes in UpdateInternalStateWithModes)
+    ChVectorDynamic<> Dx_internal_loc(m_num_coords_vel_internal);
+    ChVectorDynamic<> vloc_int(m_num_coords_vel_internal);
+    for (unsigned int i_int = 0; i_int < m_num_coords_vel_internal / 6; i_int++) {
+        unsigned int offset_x = m_num_coords_pos_boundary + 7 * i_int;
+        unsigned int offset_v = m_num_coords_vel_boundary + 6 * i_int;
+
+        ChVector3d r_IF0 = floating_frame_F0.GetRotMat().transpose() *
+                           (m_full_state_x0.segment(offset_x, 3) - floating_frame_F0.GetPos().eigen());
+        ChVector3d r_IF = floating_frame_F.GetRotMat().transpose() *
+                          (full_x.segment(offset_x, 3) - floating_frame_F.GetPos().eigen());
+        Dx_internal_loc.segment(6 * i_int, 3) = (r_IF - r_IF0).eigen();
+
+        ChQuaternion<> quat_int0 = m_full_state_x0.segment(offset_x + 3, 4);
+        ChQuaternion<> quat_int = full_x.segment(offset_x + 3, 4);
+        ChQuaternion<> q_delta =
+            quat_int0.GetConjugate() * floating_frame_F0.GetRot() * floating_frame_F.GetRot().GetConjugate() * quat_int;
+        Dx_internal_loc.segment(6 * i_int + 3, 3) = q_delta.GetRotVec().eigen();
+
+        vloc_int.segment(6 * i_int, 3) = floating_frame_F.GetRot().RotateBack(full_v.segment(offset_v, 3)).eigen();
+        vloc_int.segment(6 * i_int + 3, 3) = full_v.segment(offset_v + 3, 3);
+    }
+
+    // least-squares fit of the dynamic modes, in the metric of the internal mass matrix:
+    // Dx_I = Psi_S * e_B + Psi_D * eta  ==>  eta = (Psi_D^T M_II Psi_D)^-1 Psi_D^T M_II (Dx_I - Psi_S * e_B)
+    ChMatrixDynamic<> PsiDT_MII = Psi_D.transpose() * M_II_loc;
+    Eigen::LDLT<ChMatrixDynamic<>> MDD_solver(PsiDT_MII * Psi_D);
+
+    modal_q.setZero(m_num_coords_modal);
+    modal_q_dt.setZero(m_num_coords_modal);
+    modal_q_dtdt.setZero(m_num_coords_modal);
+    modal_q.head(num_dyn_modes) =
+        MDD_solver.solve(PsiDT_MII * (Dx_internal_loc - Psi_S * e_locred.head(m_num_coords_vel_boundary)));
+    modal_q_dt.head(num_dyn_modes) = MDD_solver.solve(PsiDT_MII * (vloc_int - Psi_S * vloc_bou));
+}
+
 void ChModalAssembly::UpdateStaticCorrectionMode() {
     if (!m_num_coords_static_correction)
         return;
@@ -991,7 +1160,7 @@ void ChModalAssembly::UpdateStaticCorrectionMode() {
     else
         rhs << f_loc;
 
-    ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs.sparseView());
+    ChVectorDynamic<> x = m_solver_invKIIc.solve(rhs);
 
     Psi_Cor = x.head(m_num_coords_vel_internal);
     // Psi_Cor_C = x;
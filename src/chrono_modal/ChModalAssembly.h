@@ -84,6 +84,11 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     /// - An undamped modal analysis will be done on the full assembly, followed by a modal reduction transformation.
     /// - The "boundary" nodes will be retained.
     /// - The "internal" nodes will be replaced by n_modes modal coordinates.
+    /// If the assembly is already in reduced state, the reduction is recomputed in the current configuration (e.g. to
+    /// periodically refresh the modal basis during a simulation with large deformations): the full state is recovered
+    /// from the modal coordinates, the modal analysis and the reduction transformation are repeated, and the modal
+    /// coordinates are re-initialized from the current state of the internal nodes. The factorization of K_IIc is
+    /// reused if possible, see SetReuseFactorization().
     void DoModalReduction(const ChModalSolveUndamped& n_modes_settings,
                           const ChModalDamping& damping_model = ChModalDampingNone());
 
@@ -133,6 +138,17 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     ///  - False: rigorous deviation is used, only for internal test.
     void SetUseLinearInertialTerm(bool flag) { m_use_linear_inertial_term = flag; }
 
+    /// Enable/disable reuse of the factorization of the internal stiffness matrix K_IIc (default: true).
+    /// If enabled, the symbolic analysis of K_IIc is skipped if its sparsity pattern did not change since the last
+    /// factorization, and the numeric factorization is skipped altogether if K_IIc did not change.
+    void SetReuseFactorization(bool flag) { m_reuse_factorization_KIIc = flag; }
+
+    /// Get the number of symbolic analyses of the internal stiffness matrix K_IIc.
+    unsigned int GetNumAnalyzeCallsKIIc() const { return m_num_analyze_KIIc; }
+
+    /// Get the number of numeric factorizations of the internal stiffness matrix K_IIc.
+    unsigned int GetNumFactorizeCallsKIIc() const { return m_num_factorize_KIIc; }
+
     /// For displaying modes, you can use the following function. It sets the state of this modal assembly
     /// (both boundary and internal items) using the n-th eigenvector multiplied by an "amplitude" factor * sin(phase).
     /// If you increment the phase during an animation, you will see the n-th mode oscillating on the screen.
@@ -526,9 +542,18 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     friend void swap(ChModalAssembly& first, ChModalAssembly& second);
 
   private:
-    /// Set the model as reduced. Cannot go back (from reduced to full state) for now.
+    /// Set the model as reduced.
     void FlagModelAsReduced();
 
+    /// Bring a reduced model back to its full state, in the configuration represented by the modal coordinates.
+    /// Used to recompute the modal reduction.
+    void RecoverFullModel();
+
+    /// Initialize the modal coordinates from the current full state, with a least-squares fit (in the metric of the
+    /// internal mass matrix) of the deformation and velocity of the internal nodes. Used when recomputing the
+    /// modal reduction.
+    void InitializeModalCoordinates(const ChState& full_x, const ChStateDelta& full_v);
+
     /// Initialize the modal assembly: 1.the initial undeformed configuration; 2.the floating frame F;
     void Initialize();
 
@@ -558,6 +583,13 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     /// Compute the modal M,R,K,Cq matrices which are the tangent matrices used in the time stepper.
     void ComputeModalKRMmatricesGlobal(double Kfactor = 1.0, double Rfactor = 1.0, double Mfactor = 1.0);
 
+    /// Factorize the internal stiffness matrix K_IIc, reusing the previous factorization when possible.
+    void FactorizeKIIc(const Eigen::SparseMatrix<double, Eigen::ColMajor, int>& K_IIc);
+
+    /// Solve K_IIc * x = rhs for multiple right-hand sides, using the current factorization of K_IIc.
+    /// The right-hand side columns are distributed over the Chrono threads.
+    void SolveKIIc(const ChMatrixDynamic<>& rhs, ChMatrixDynamic<>& x);
+
     /// [INTERNAL USE ONLY]
     /// Both Herting and Craig-Bampton reductions are implemented in this function.
     void ApplyModeAccelerationTransformation(const ChModalDamping& damping_model = ChModalDampingNone());
@@ -608,7 +640,11 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     ChMatrixDynamic<> Psi_Cor_LambdaI;  ///< static correction mode - corresponding to internal Lagrange multipliers.
 
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>>
-        m_solver_invKIIc;  // linear solver for K_IIc^{-1}
+        m_solver_invKIIc;                                          // linear solver for K_IIc^{-1}
+    Eigen::SparseMatrix<double, Eigen::ColMajor, int> m_KIIc;  // last factorized K_IIc
+    bool m_reuse_factorization_KIIc = true;                    // reuse K_IIc factorization if possible
+    unsigned int m_num_analyze_KIIc = 0;                       // number of symbolic analyses of K_IIc
+    unsigned int m_num_factorize_KIIc = 0;                     // number of numeric factorizations of K_IIc
 
     // Results of eigenvalue analysis like ComputeModes() or ComputeModesDamped():
     ChMatrixDynamic<std::complex<double>> m_modal_eigvect;  // eigenvectors
@@ -628,6 +664,9 @@ class ChApiModal ChModalAssembly : public ChAssembly {
     ChState m_full_state_x0;  // full state snapshot of assembly in the initial undeformed configuration
     ChState m_full_state_x;   // full state snapshot of assembly in the deformed configuration
 
+    std::vector<double> m_boundary_masses;          // masses of boundary items, moved to the modal mass matrix
+    std::vector<ChMatrix33<>> m_boundary_inertias;  // inertias of boundary items, moved to the modal mass matrix
+
     // Projection matrices
     ChSparseMatrix U_locred;         // rigid body modes of the reduced modal assembly in the deformed configuration
     ChSparseMatrix U_locred_0;       // rigid body modes of the reduced modal assembly in the initial configuration
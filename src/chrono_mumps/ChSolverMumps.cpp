@@ -18,8 +18,20 @@
 namespace chrono {
 
 ChSolverMumps::ChSolverMumps(int num_threads) {
-    int nthreads = (num_threads <= 0) ? ChOMP::GetNumProcs() : num_threads;
+    m_num_threads = (num_threads <= 0) ? ChOMP::GetNumProcs() : num_threads;
+    ChOMP::SetNumThreads(m_num_threads);
+    m_engine.SetICNTL(16, m_num_threads);  // number of OpenMP threads used by this Mumps instance
+}
+
+ChSolverMumps* ChSolverMumps::Clone() const {
+    // The clone uses the thread count of this solver; the global OpenMP setting is left unchanged
+    int nthreads = ChOMP::GetMaxThreads();
+    auto solver = new ChSolverMumps(m_num_threads);
     ChOMP::SetNumThreads(nthreads);
+    solver->CopySettings(*this);
+    solver->SetMatrixSymmetryType(m_symmetry);
+    solver->EnableNullPivotDetection(m_null_pivot_detection);
+    return solver;
 }
 
 void ChSolverMumps::EnableNullPivotDetection(bool val, double threshold) {
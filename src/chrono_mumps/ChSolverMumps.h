@@ -53,9 +53,12 @@ See ChSystemDescriptor for more information about the problem formulation and th
 */
 class ChApiMumps ChSolverMumps : public ChDirectSolverLS {
   public:
+    /// Create a Mumps solver using the specified number of OpenMP threads (all available processors if 0).
+    /// Note that this also sets the number of threads for subsequent OpenMP parallel regions (see ChOMP::SetNumThreads).
     ChSolverMumps(int num_threads = 0);
     ~ChSolverMumps() {}
     virtual Type GetType() const override { return Type::MUMPS; }
+    virtual ChSolverMumps* Clone() const override;
 
     /// Enable detection of null pivots.
     virtual void EnableNullPivotDetection(bool val, double threshold = 0) override;
@@ -79,6 +82,7 @@ class ChApiMumps ChSolverMumps : public ChDirectSolverLS {
     virtual void PrintErrorMessage() override;
 
     ChMumpsEngine m_engine;  ///< interface to Mumps solver
+    int m_num_threads;       ///< number of OpenMP threads used by Mumps
 };
 
 /// @} mumps_module
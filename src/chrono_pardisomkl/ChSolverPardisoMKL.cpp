@@ -21,6 +21,12 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(unsigned int num_threads) {
     mkl_set_num_threads(num_threads);
 }
 
+ChSolverPardisoMKL* ChSolverPardisoMKL::Clone() const {
+    auto solver = new ChSolverPardisoMKL(mkl_get_max_threads());
+    solver->CopySettings(*this);
+    return solver;
+}
+
 bool ChSolverPardisoMKL::FactorizeMatrix() {
     m_engine.compute(m_mat);
     return (m_engine.info() == Eigen::Success);
@@ -60,6 +60,7 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     ~ChSolverPardisoMKL() {}
 
     virtual Type GetType() const override { return Type::PARDISO_MKL; }
+    virtual ChSolverPardisoMKL* Clone() const override;
 
     /// Get a handle to the underlying MKL engine.
     Eigen::PardisoLU<ChSparseMatrix>& GetMklEngine() { return m_engine; }
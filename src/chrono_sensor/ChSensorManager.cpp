@@ -19,13 +19,17 @@
 #include "chrono_sensor/ChSensorManager.h"
 
 #include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/sensors/ChRadarSensor.h"
 #include <iomanip>
 #include <iostream>
 
 namespace chrono {
 namespace sensor {
 
-CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system) : m_verbose(false), m_optix_reflections(9) {
+CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system)
+    : m_verbose(false), m_render_backend(RenderBackend::OPTIX), m_optix_reflections(9) {
     // save the chrono system handle
     m_system = chrono_system;
     scene = chrono_types::make_shared<ChScene>();
@@ -50,6 +54,10 @@ CH_SENSOR_API void ChSensorManager::Update() {
         pEngine->UpdateSensors(scene);
     }
 
+    // render the sensors that use the CPU backend (and run their filter graphs)
+    if (m_cpu_manager)
+        m_cpu_manager->Update();
+
     // have the sensormanager update all of the non-optix sensor (IMU and GPS).
     // TODO: perhaps create a thread that takes care of this? Tradeoff since IMU should require some data from EVERY
     // step
@@ -70,6 +78,8 @@ CH_SENSOR_API void ChSensorManager::ReconstructScenes() {
     for (auto eng : m_engines) {
         eng->ConstructScene();
     }
+    if (m_cpu_manager)
+        m_cpu_manager->ReconstructScenes();
 }
 
 CH_SENSOR_API void ChSensorManager::SetMaxEngines(int num_groups) {
@@ -91,7 +101,20 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
     }
     m_sensor_list.push_back(sensor);
 
-    if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
+    // lidar, depth camera, and radar sensors can be rendered on the CPU
+    bool cpu_render = m_render_backend == RenderBackend::CPU && (std::dynamic_pointer_cast<ChLidarSensor>(sensor) ||
+                                                                 std::dynamic_pointer_cast<ChDepthCamera>(sensor) ||
+                                                                 std::dynamic_pointer_cast<ChRadarSensor>(sensor));
+
+    if (cpu_render) {
+        if (!m_cpu_manager) {
+            m_cpu_manager = chrono_types::make_shared<ChCpuSensorManager>(m_system);
+        }
+        m_render_sensor.push_back(sensor);
+        m_cpu_manager->AddSensor(std::static_pointer_cast<ChOptixSensor>(sensor));
+        if (m_verbose)
+            std::cout << "Sensor added to CPU render backend\n";
+    } else if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
         m_render_sensor.push_back(sensor);
         /******** give each render group all sensor with same update rate *************/
         bool found_group = false;
@@ -28,6 +28,7 @@
 #include "chrono_sensor/optix/ChOptixEngine.h"
 #include "chrono_sensor/ChDynamicsManager.h"
 #include "chrono_sensor/optix/scene/ChScene.h"
+#include "chrono_sensor/cpu/ChCpuSensorManager.h"
 
 #include <fstream>
 #include <sstream>
@@ -42,6 +43,12 @@ namespace sensor {
 
 class CH_SENSOR_API ChSensorManager {
   public:
+    /// Backend used to render the lidar, depth camera, and radar sensors.
+    enum class RenderBackend {
+        OPTIX,  ///< OptiX ray tracing on the GPU
+        CPU     ///< CPU ray tracing (see ChCpuSensorManager)
+    };
+
     /// Class constructor
     /// @param chrono_system The chrono system with which the sensor manager is associated. Used for time management.
     /// created.
@@ -58,6 +65,20 @@ class CH_SENSOR_API ChSensorManager {
     /// @param sensor The sensor that should be added to the system
     void AddSensor(std::shared_ptr<ChSensor> sensor);
 
+    /// Set the backend used to render the lidar, depth camera, and radar sensors added after this call (default:
+    /// OPTIX). With the CPU backend, these sensors are traced on the CPU at each update of the manager and their filter
+    /// graphs are run on the calling thread. Cameras and segmentation cameras are always rendered with OptiX.
+    /// @param backend The render backend
+    void SetRenderBackend(RenderBackend backend) { m_render_backend = backend; }
+
+    /// Get the backend used to render the lidar, depth camera, and radar sensors.
+    /// @return The render backend
+    RenderBackend GetRenderBackend() const { return m_render_backend; }
+
+    /// Get the manager of the sensors rendered with the CPU backend.
+    /// @return The CPU sensor manager, or nullptr if no sensor uses the CPU backend
+    std::shared_ptr<ChCpuSensorManager> GetCpuManager() { return m_cpu_manager; }
+
     /// Get the list of sensors for which this manager is responsible
     /// @return The list of sensors for which the manager is responsible and updates
     std::vector<std::shared_ptr<ChSensor>> GetSensorList() { return m_sensor_list; }
@@ -115,7 +136,8 @@ class CH_SENSOR_API ChSensorManager {
     std::shared_ptr<ChScene> scene;
 
   private:
-    bool m_verbose;           ///< Whether we should print messages and warnings
+    bool m_verbose;                  ///< Whether we should print messages and warnings
+    RenderBackend m_render_backend;  ///< Backend for the lidar, depth camera, and radar sensors added next
     int m_optix_reflections;  ///< Maximum number of ray tracing recursions
     int m_num_keyframes;      ///< number of keyframes to use
 
@@ -123,6 +145,7 @@ class CH_SENSOR_API ChSensorManager {
     ChSystem* m_system;                                     ///< Chrono system the manager is attached to
     std::vector<std::shared_ptr<ChOptixEngine>> m_engines;  ///< The optix engine(s) used for rendered sensors
     std::shared_ptr<ChDynamicsManager> m_dynamics_manager;  ///< Container for updating dynamic sensors
+    std::shared_ptr<ChCpuSensorManager> m_cpu_manager;      ///< Container for sensors rendered on the CPU
 
     int m_allowable_groups = 1;  ///< Default maximum number of allowable engines
 
@@ -0,0 +1,203 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Bounding volume hierarchy and ray packets for the CPU ray tracing backend
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_sensor/cpu/ChCpuBVH.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+
+void ChCpuRayPacket::SetRay(int i, const float* origin, const float* dir, float t_min, float t_max) {
+    ox[i] = origin[0];
+    oy[i] = origin[1];
+    oz[i] = origin[2];
+    dx[i] = dir[0];
+    dy[i] = dir[1];
+    dz[i] = dir[2];
+    tmin[i] = t_min;
+    tmax[i] = t_max;
+    cosine[i] = 0;
+    prim[i] = -1;
+    inst[i] = -1;
+}
+
+void ChCpuRayPacket::DisableRay(int i) {
+    float zero[3] = {0, 0, 0};
+    float dir[3] = {1, 0, 0};
+    SetRay(i, zero, dir, 1, 0);
+}
+
+void ChCpuRayPacket::Prepare() {
+    // Use a large (finite) value for zero direction components to avoid NaNs in the slab tests
+    const float big = 1e30f;
+    for (int i = 0; i < SIZE; i++) {
+        inv_dx[i] = std::abs(dx[i]) > 1e-30f ? 1 / dx[i] : std::copysign(big, dx[i]);
+        inv_dy[i] = std::abs(dy[i]) > 1e-30f ? 1 / dy[i] : std::copysign(big, dy[i]);
+        inv_dz[i] = std::abs(dz[i]) > 1e-30f ? 1 / dz[i] : std::copysign(big, dz[i]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Build the hierarchy top-down, using a binned SAH to select the split plane.
+// Node children are stored consecutively, so that only the index of the left child needs to be recorded.
+void ChCpuBVH::Build(const std::vector<ChCpuAABB>& boxes, int max_leaf_size) {
+    static const int num_bins = 12;
+    static const int max_depth = 48;  // traversal stack size is 64
+
+    m_nodes.clear();
+    m_prims.resize(boxes.size());
+    if (boxes.empty())
+        return;
+
+    std::vector<float> centroids(3 * boxes.size());
+    for (size_t i = 0; i < boxes.size(); i++) {
+        m_prims[i] = (int)i;
+        for (int k = 0; k < 3; k++)
+            centroids[3 * i + k] = 0.5f * (boxes[i].bmin[k] + boxes[i].bmax[k]);
+    }
+
+    m_nodes.reserve(2 * boxes.size());
+    m_nodes.push_back({ChCpuAABB(), 0, (int)boxes.size()});
+
+    struct Task {
+        int node;
+        int depth;
+    };
+    std::vector<Task> tasks;
+    tasks.push_back({0, 0});
+
+    while (!tasks.empty()) {
+        Task task = tasks.back();
+        tasks.pop_back();
+
+        int first = m_nodes[task.node].first;
+        int count = m_nodes[task.node].count;
+
+        // Node bounds and centroid bounds
+        ChCpuAABB box;
+        ChCpuAABB cbox;
+        for (int i = first; i < first + count; i++) {
+            box.Grow(boxes[m_prims[i]]);
+            cbox.Grow(&centroids[3 * m_prims[i]]);
+        }
+        m_nodes[task.node].box = box;
+
+        if (count <= max_leaf_size || task.depth >= max_depth)
+            continue;
+
+        // Split axis along the largest centroid extent
+        int axis = 0;
+        for (int k = 1; k < 3; k++) {
+            if (cbox.bmax[k] - cbox.bmin[k] > cbox.bmax[axis] - cbox.bmin[axis])
+                axis = k;
+        }
+        float extent = cbox.bmax[axis] - cbox.bmin[axis];
+        if (extent <= 0)
+            continue;
+
+        // Bin primitives by centroid
+        ChCpuAABB bin_box[num_bins];
+        int bin_count[num_bins] = {0};
+        float scale = num_bins / extent;
+        auto bin_of = [&](int p) {
+            int b = (int)((centroids[3 * p + axis] - cbox.bmin[axis]) * scale);
+            return std::min(std::max(b, 0), num_bins - 1);
+        };
+        for (int i = first; i < first + count; i++) {
+            int b = bin_of(m_prims[i]);
+            bin_count[b]++;
+            bin_box[b].Grow(boxes[m_prims[i]]);
+        }
+
+        // Sweep to evaluate the SAH cost of each candidate split
+        float left_area[num_bins - 1];
+        int left_count[num_bins - 1];
+        ChCpuAABB acc;
+        int n = 0;
+        for (int b = 0; b < num_bins - 1; b++) {
+            acc.Grow(bin_box[b]);
+            n += bin_count[b];
+            left_area[b] = acc.Area();
+            left_count[b] = n;
+        }
+        int best_split = -1;
+        float best_cost = count * box.Area();
+        acc.Reset();
+        n = 0;
+        for (int b = num_bins - 1; b > 0; b--) {
+            acc.Grow(bin_box[b]);
+            n += bin_count[b];
+            float cost = left_count[b - 1] * left_area[b - 1] + n * acc.Area();
+            if (left_count[b - 1] > 0 && n > 0 && cost < best_cost) {
+                best_cost = cost;
+                best_split = b;
+            }
+        }
+
+        // Partition primitives (fall back to a median split if the SAH does not find a better partition)
+        int mid;
+        if (best_split > 0) {
+            auto it = std::partition(m_prims.begin() + first, m_prims.begin() + first + count,
+                                     [&](int p) { return bin_of(p) < best_split; });
+            mid = (int)(it - m_prims.begin());
+        } else {
+            mid = first + count / 2;
+            std::nth_element(m_prims.begin() + first, m_prims.begin() + mid, m_prims.begin() + first + count,
+                             [&](int a, int b) { return centroids[3 * a + axis] < centroids[3 * b + axis]; });
+        }
+
+        int left = (int)m_nodes.size();
+        m_nodes.push_back({ChCpuAABB(), first, mid - first});
+        m_nodes.push_back({ChCpuAABB(), mid, first + count - mid});
+        m_nodes[task.node].first = left;
+        m_nodes[task.node].count = 0;
+
+        tasks.push_back({left, task.depth + 1});
+        tasks.push_back({left + 1, task.depth + 1});
+    }
+}
+
+// Children are always created after their parent, so a reverse sweep over the nodes updates all boxes bottom-up.
+void ChCpuBVH::Refit(const std::vector<ChCpuAABB>& boxes) {
+    for (int n = (int)m_nodes.size() - 1; n >= 0; n--) {
+        auto& node = m_nodes[n];
+        node.box.Reset();
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++)
+                node.box.Grow(boxes[m_prims[i]]);
+        } else {
+            node.box.Grow(m_nodes[node.first].box);
+            node.box.Grow(m_nodes[node.first + 1].box);
+        }
+    }
+}
+
+float ChCpuBVH::GetCost() const {
+    if (m_nodes.empty() || m_nodes[0].box.Area() <= 0)
+        return 0;
+    float cost = 0;
+    for (const auto& node : m_nodes)
+        cost += node.box.Area() * (node.count > 0 ? node.count : 1);
+    return cost / m_nodes[0].box.Area();
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Bounding volume hierarchy and ray packets for the CPU ray tracing backend
+//
+// =============================================================================
+
+#ifndef CHCPUBVH_H
+#define CHCPUBVH_H
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Axis-aligned bounding box (single precision) used by the CPU ray tracing backend.
+struct CH_SENSOR_API ChCpuAABB {
+    ChCpuAABB() { Reset(); }
+
+    /// Reset to an empty (inverted) box.
+    void Reset() {
+        for (int k = 0; k < 3; k++) {
+            bmin[k] = +std::numeric_limits<float>::max();
+            bmax[k] = -std::numeric_limits<float>::max();
+        }
+    }
+
+    /// Grow the box to include the given point.
+    void Grow(const float* p) {
+        for (int k = 0; k < 3; k++) {
+            bmin[k] = std::min(bmin[k], p[k]);
+            bmax[k] = std::max(bmax[k], p[k]);
+        }
+    }
+
+    /// Grow the box to include the given box.
+    void Grow(const ChCpuAABB& b) {
+        for (int k = 0; k < 3; k++) {
+            bmin[k] = std::min(bmin[k], b.bmin[k]);
+            bmax[k] = std::max(bmax[k], b.bmax[k]);
+        }
+    }
+
+    /// Return true if the box is empty (inverted).
+    bool IsEmpty() const { return bmin[0] > bmax[0]; }
+
+    /// Return the box surface area (used by the SAH build).
+    float Area() const {
+        if (IsEmpty())
+            return 0;
+        float e0 = bmax[0] - bmin[0];
+        float e1 = bmax[1] - bmin[1];
+        float e2 = bmax[2] - bmin[2];
+        return 2 * (e0 * e1 + e1 * e2 + e2 * e0);
+    }
+
+    float bmin[3];  ///< lower corner
+    float bmax[3];  ///< upper corner
+};
+
+/// Packet of rays traced together through a BVH.
+/// Data is stored in structure-of-arrays layout so that per-node and per-primitive tests over all rays in the packet
+/// are vectorized by the compiler.
+struct CH_SENSOR_API ChCpuRayPacket {
+    static constexpr int SIZE = 8;  ///< number of rays in a packet
+
+    /// Initialize ray i of the packet. The direction is assumed to be normalized.
+    void SetRay(int i, const float* origin, const float* dir, float t_min, float t_max);
+
+    /// Deactivate ray i of the packet (unused lanes of a partially filled packet).
+    void DisableRay(int i);
+
+    /// Compute the inverse ray directions (must be called after setting the rays and before tracing).
+    void Prepare();
+
+    float ox[SIZE], oy[SIZE], oz[SIZE];           ///< ray origins
+    float dx[SIZE], dy[SIZE], dz[SIZE];           ///< ray directions
+    float inv_dx[SIZE], inv_dy[SIZE], inv_dz[SIZE];  ///< inverse ray directions
+    float tmin[SIZE];                             ///< minimum ray parameter
+    float tmax[SIZE];                             ///< maximum ray parameter (distance to closest hit, if any)
+    float cosine[SIZE];                           ///< cosine of the incidence angle at the closest hit
+    int prim[SIZE];                               ///< closest hit primitive (-1 if no hit)
+    int inst[SIZE];                               ///< closest hit instance (-1 if no hit)
+};
+
+/// Bounding volume hierarchy over a set of primitive bounding boxes.
+/// The hierarchy is built with a binned surface area heuristic and can be refit (without changing its topology) when
+/// the primitives move. Traversal is performed for an entire ray packet, with the primitive tests delegated to a
+/// user-provided callback.
+class CH_SENSOR_API ChCpuBVH {
+  public:
+    /// BVH node. Leaf nodes have count > 0 and reference primitives [first, first + count) of the primitive list.
+    /// Internal nodes have count = 0 and children at indices first and first + 1.
+    struct Node {
+        ChCpuAABB box;
+        int first;
+        int count;
+    };
+
+    ChCpuBVH() {}
+
+    /// Build the hierarchy over the given primitive bounding boxes.
+    void Build(const std::vector<ChCpuAABB>& boxes, int max_leaf_size = 4);
+
+    /// Update the node bounding boxes for new primitive bounding boxes (same number and order as in Build).
+    void Refit(const std::vector<ChCpuAABB>& boxes);
+
+    /// Return the surface area heuristic cost of the hierarchy, relative to the area of its bounding box.
+    /// This is the expected number of node visits and primitive tests for a random ray hitting the root box; it
+    /// increases as a refit hierarchy becomes loose.
+    float GetCost() const;
+
+    /// Return the bounding box of the entire hierarchy.
+    const ChCpuAABB& GetBounds() const { return m_nodes.empty() ? m_empty : m_nodes[0].box; }
+
+    /// Return true if the hierarchy is empty.
+    bool IsEmpty() const { return m_nodes.empty(); }
+
+    /// Get the list of nodes.
+    const std::vector<Node>& GetNodes() const { return m_nodes; }
+
+    /// Get the primitive indices, in leaf order.
+    const std::vector<int>& GetPrimitives() const { return m_prims; }
+
+    /// Traverse the hierarchy with the given packet.
+    /// The callback is invoked as leaf(packet, prim, mask) for each primitive in a leaf intersected by at least one
+    /// active ray; mask[i] is nonzero for rays that intersect the leaf box. The callback is responsible for shrinking
+    /// packet.tmax for rays that hit the primitive.
+    template <class LeafCallback>
+    void Traverse(ChCpuRayPacket& packet, LeafCallback&& leaf) const;
+
+  private:
+    /// Test the packet against the given box. Return the number of active rays intersecting the box.
+    static int IntersectBox(const ChCpuRayPacket& packet, const ChCpuAABB& box, int* mask);
+
+    std::vector<Node> m_nodes;  ///< BVH nodes (root at index 0)
+    std::vector<int> m_prims;   ///< primitive indices referenced by the leaves
+    ChCpuAABB m_empty;          ///< empty box returned for an empty hierarchy
+};
+
+// -----------------------------------------------------------------------------
+
+inline int ChCpuBVH::IntersectBox(const ChCpuRayPacket& packet, const ChCpuAABB& box, int* mask) {
+    int num_hit = 0;
+    for (int i = 0; i < ChCpuRayPacket::SIZE; i++) {
+        float tx0 = (box.bmin[0] - packet.ox[i]) * packet.inv_dx[i];
+        float tx1 = (box.bmax[0] - packet.ox[i]) * packet.inv_dx[i];
+        float ty0 = (box.bmin[1] - packet.oy[i]) * packet.inv_dy[i];
+        float ty1 = (box.bmax[1] - packet.oy[i]) * packet.inv_dy[i];
+        float tz0 = (box.bmin[2] - packet.oz[i]) * packet.inv_dz[i];
+        float tz1 = (box.bmax[2] - packet.oz[i]) * packet.inv_dz[i];
+        float t0 = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)),  //
+                            std::max(std::min(tz0, tz1), packet.tmin[i]));
+        float t1 = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)),  //
+                            std::min(std::max(tz0, tz1), packet.tmax[i]));
+        mask[i] = (t0 <= t1) ? 1 : 0;
+        num_hit += mask[i];
+    }
+    return num_hit;
+}
+
+template <class LeafCallback>
+void ChCpuBVH::Traverse(ChCpuRayPacket& packet, LeafCallback&& leaf) const {
+    if (m_nodes.empty())
+        return;
+
+    int mask[ChCpuRayPacket::SIZE];
+    int stack[64];
+    int stack_size = 0;
+    stack[stack_size++] = 0;
+
+    while (stack_size > 0) {
+        const Node& node = m_nodes[stack[--stack_size]];
+        if (!IntersectBox(packet, node.box, mask))
+            continue;
+
+        if (node.count > 0) {
+            for (int k = node.first; k < node.first + node.count; k++)
+                leaf(packet, m_prims[k], mask);
+        } else if (stack_size < 63) {
+            stack[stack_size++] = node.first + 1;
+            stack[stack_size++] = node.first;
+        }
+    }
+}
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,396 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scene representation for the CPU ray tracing backend.
+//
+// =============================================================================
+
+#include <cassert>
+#include <cmath>
+
+#include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/assets/ChVisualShapeCylinder.h"
+#include "chrono/assets/ChVisualShapeSphere.h"
+#include "chrono/utils/ChConstants.h"
+
+#include "chrono_sensor/cpu/ChCpuRayScene.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+// Tessellation of primitive visual shapes
+// -----------------------------------------------------------------------------
+
+static void TessellateBox(const ChVector3d& hlen, std::vector<ChVector3d>& v, std::vector<ChVector3i>& t) {
+    for (int i = 0; i < 8; i++)
+        v.push_back(ChVector3d((i & 1) ? hlen.x() : -hlen.x(), (i & 2) ? hlen.y() : -hlen.y(),
+                               (i & 4) ? hlen.z() : -hlen.z()));
+    static const int faces[6][4] = {{0, 2, 6, 4}, {1, 5, 7, 3}, {0, 4, 5, 1}, {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 6, 7, 5}};
+    for (const auto& f : faces) {
+        t.push_back(ChVector3i(f[0], f[1], f[2]));
+        t.push_back(ChVector3i(f[0], f[2], f[3]));
+    }
+}
+
+static void TessellateSphere(double radius, std::vector<ChVector3d>& v, std::vector<ChVector3i>& t) {
+    const int n_lat = 16;
+    const int n_lon = 32;
+    for (int i = 0; i <= n_lat; i++) {
+        double theta = CH_PI * i / n_lat;
+        for (int j = 0; j < n_lon; j++) {
+            double phi = CH_2PI * j / n_lon;
+            v.push_back(radius * ChVector3d(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi),
+                                            std::cos(theta)));
+        }
+    }
+    for (int i = 0; i < n_lat; i++) {
+        for (int j = 0; j < n_lon; j++) {
+            int a = i * n_lon + j;
+            int b = i * n_lon + (j + 1) % n_lon;
+            t.push_back(ChVector3i(a, a + n_lon, b + n_lon));
+            t.push_back(ChVector3i(a, b + n_lon, b));
+        }
+    }
+}
+
+static void TessellateCylinder(double radius,
+                               double height,
+                               std::vector<ChVector3d>& v,
+                               std::vector<ChVector3i>& t) {
+    const int n = 32;
+    for (int j = 0; j < n; j++) {
+        double phi = CH_2PI * j / n;
+        v.push_back(ChVector3d(radius * std::cos(phi), radius * std::sin(phi), -height / 2));
+        v.push_back(ChVector3d(radius * std::cos(phi), radius * std::sin(phi), +height / 2));
+    }
+    int c0 = (int)v.size();
+    v.push_back(ChVector3d(0, 0, -height / 2));
+    v.push_back(ChVector3d(0, 0, +height / 2));
+    for (int j = 0; j < n; j++) {
+        int a = 2 * j;
+        int b = 2 * ((j + 1) % n);
+        t.push_back(ChVector3i(a, b, b + 1));
+        t.push_back(ChVector3i(a, b + 1, a + 1));
+        t.push_back(ChVector3i(c0, b, a));
+        t.push_back(ChVector3i(c0 + 1, a + 1, b + 1));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ChCpuRayMesh
+// -----------------------------------------------------------------------------
+
+ChCpuRayMesh::ChCpuRayMesh(const std::vector<ChVector3d>& vertices, const std::vector<ChVector3i>& triangles) {
+    m_triangles.reserve(3 * triangles.size());
+    for (const auto& tri : triangles) {
+        m_triangles.push_back(tri.x());
+        m_triangles.push_back(tri.y());
+        m_triangles.push_back(tri.z());
+    }
+    m_vertices.resize(3 * vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        m_vertices[3 * i + 0] = (float)vertices[i].x();
+        m_vertices[3 * i + 1] = (float)vertices[i].y();
+        m_vertices[3 * i + 2] = (float)vertices[i].z();
+    }
+
+    std::vector<ChCpuAABB> boxes;
+    CalcTriangleBoxes(boxes);
+    m_bvh.Build(boxes);
+}
+
+void ChCpuRayMesh::SetVertices(const std::vector<ChVector3d>& vertices) {
+    assert(3 * vertices.size() == m_vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        m_vertices[3 * i + 0] = (float)vertices[i].x();
+        m_vertices[3 * i + 1] = (float)vertices[i].y();
+        m_vertices[3 * i + 2] = (float)vertices[i].z();
+    }
+
+    std::vector<ChCpuAABB> boxes;
+    CalcTriangleBoxes(boxes);
+    m_bvh.Refit(boxes);
+}
+
+void ChCpuRayMesh::CalcTriangleBoxes(std::vector<ChCpuAABB>& boxes) const {
+    size_t num_triangles = GetNumTriangles();
+    boxes.resize(num_triangles);
+    for (size_t i = 0; i < num_triangles; i++) {
+        boxes[i].Reset();
+        for (int k = 0; k < 3; k++)
+            boxes[i].Grow(&m_vertices[3 * m_triangles[3 * i + k]]);
+    }
+}
+
+// Moller-Trumbore ray-triangle intersection, evaluated for all rays in the packet.
+void ChCpuRayMesh::Intersect(ChCpuRayPacket& packet, int instance) const {
+    const float* vertices = m_vertices.data();
+    const int* triangles = m_triangles.data();
+
+    m_bvh.Traverse(packet, [&](ChCpuRayPacket& p, int tri, const int* mask) {
+        const float* v0 = vertices + 3 * triangles[3 * tri + 0];
+        const float* v1 = vertices + 3 * triangles[3 * tri + 1];
+        const float* v2 = vertices + 3 * triangles[3 * tri + 2];
+        const float e1[3] = {v1[0] - v0[0], v1[1] - v0[1], v1[2] - v0[2]};
+        const float e2[3] = {v2[0] - v0[0], v2[1] - v0[1], v2[2] - v0[2]};
+        const float n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2],
+                            e1[0] * e2[1] - e1[1] * e2[0]};
+        const float n_len = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (n_len <= 0)
+            return;
+        const float inv_n_len = 1 / n_len;
+
+        for (int i = 0; i < ChCpuRayPacket::SIZE; i++) {
+            float px = p.dy[i] * e2[2] - p.dz[i] * e2[1];
+            float py = p.dz[i] * e2[0] - p.dx[i] * e2[2];
+            float pz = p.dx[i] * e2[1] - p.dy[i] * e2[0];
+            float det = e1[0] * px + e1[1] * py + e1[2] * pz;
+            float inv_det = 1 / (std::abs(det) > 1e-12f ? det : 1e-12f);
+            float tx = p.ox[i] - v0[0];
+            float ty = p.oy[i] - v0[1];
+            float tz = p.oz[i] - v0[2];
+            float u = (tx * px + ty * py + tz * pz) * inv_det;
+            float qx = ty * e1[2] - tz * e1[1];
+            float qy = tz * e1[0] - tx * e1[2];
+            float qz = tx * e1[1] - ty * e1[0];
+            float v = (p.dx[i] * qx + p.dy[i] * qy + p.dz[i] * qz) * inv_det;
+            float t = (e2[0] * qx + e2[1] * qy + e2[2] * qz) * inv_det;
+            bool hit = mask[i] && std::abs(det) > 1e-12f && u >= 0 && v >= 0 && u + v <= 1 && t > p.tmin[i] &&
+                       t < p.tmax[i];
+            if (hit) {
+                p.tmax[i] = t;
+                p.prim[i] = tri;
+                p.inst[i] = instance;
+                p.cosine[i] = std::abs(n[0] * p.dx[i] + n[1] * p.dy[i] + n[2] * p.dz[i]) * inv_n_len;
+            }
+        }
+    });
+}
+
+// -----------------------------------------------------------------------------
+// ChCpuRayScene
+// -----------------------------------------------------------------------------
+
+ChCpuRayScene::ChCpuRayScene(ChSystem* system)
+    : m_system(system), m_rebuild_threshold(1.3f), m_tlas_build_cost(0), m_num_tlas_builds(0), m_num_items(0) {
+    m_num_threads = system->GetNumThreadsChrono();
+}
+
+// Number of vertices of a triangle mesh shape (0 for other shapes).
+static size_t NumMeshVertices(const std::shared_ptr<ChVisualShape>& shape) {
+    if (auto trimesh_shape = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape))
+        return trimesh_shape->GetMesh()->GetCoordsVertices().size();
+    return 0;
+}
+
+void ChCpuRayScene::Reconstruct() {
+    m_shape_keys.clear();
+    m_instances.clear();
+    m_meshes.clear();
+    m_num_items = 0;
+
+    for (const auto& body : m_system->GetBodies())
+        AddItem(body.get());
+    for (const auto& item : m_system->GetOtherPhysicsItems())
+        AddItem(item.get());
+
+    // Force a build of the top-level hierarchy for the new set of instances
+    m_tlas = ChCpuBVH();
+    Update();
+}
+
+bool ChCpuRayScene::IsOutdated() const {
+    size_t n = 0;
+    auto changed = [&](ChPhysicsItem* item) {
+        if (!item->GetVisualModel())
+            return false;
+        for (const auto& shape_instance : item->GetVisualModel()->GetShapeInstances()) {
+            const auto& shape = shape_instance.first;
+            if (n >= m_shape_keys.size())
+                return true;
+            const auto& key = m_shape_keys[n++];
+            if (key.item != item || key.shape != shape.get() || key.visible != shape->IsVisible() ||
+                key.num_vertices != NumMeshVertices(shape))
+                return true;
+        }
+        return false;
+    };
+
+    for (const auto& body : m_system->GetBodies()) {
+        if (changed(body.get()))
+            return true;
+    }
+    for (const auto& item : m_system->GetOtherPhysicsItems()) {
+        if (changed(item.get()))
+            return true;
+    }
+    return n != m_shape_keys.size();
+}
+
+void ChCpuRayScene::AddItem(ChPhysicsItem* item) {
+    if (!item->GetVisualModel())
+        return;
+
+    size_t num_instances = m_instances.size();
+    for (const auto& shape_instance : item->GetVisualModel()->GetShapeInstances()) {
+        const auto& shape = shape_instance.first;
+        m_shape_keys.push_back({item, shape.get(), shape->IsVisible(), NumMeshVertices(shape)});
+        AddShape(item, shape, shape_instance.second);
+    }
+
+    if (m_instances.size() > num_instances)
+        m_num_items++;
+}
+
+void ChCpuRayScene::AddShape(ChPhysicsItem* item, std::shared_ptr<ChVisualShape> shape, const ChFrame<>& frame) {
+    if (!shape->IsVisible())
+        return;
+
+    Instance instance;
+    instance.item = item;
+    instance.object_id = m_num_items;
+    instance.shape_frame = frame;
+
+    auto trimesh_shape = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape);
+    if (trimesh_shape && trimesh_shape->IsMutable())
+        instance.mutable_trimesh = trimesh_shape;
+
+    // Reuse the tessellation of shapes shared by multiple visual models
+    auto cached = m_meshes.find(shape.get());
+    if (cached != m_meshes.end()) {
+        instance.mesh = cached->second;
+    } else {
+        std::vector<ChVector3d> vertices;
+        std::vector<ChVector3i> triangles;
+        if (auto box = std::dynamic_pointer_cast<ChVisualShapeBox>(shape)) {
+            TessellateBox(box->GetHalflengths(), vertices, triangles);
+        } else if (auto sphere = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape)) {
+            TessellateSphere(sphere->GetRadius(), vertices, triangles);
+        } else if (auto cylinder = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape)) {
+            TessellateCylinder(cylinder->GetRadius(), cylinder->GetHeight(), vertices, triangles);
+        } else if (trimesh_shape) {
+            const auto& scale = trimesh_shape->GetScale();
+            for (const auto& v : trimesh_shape->GetMesh()->GetCoordsVertices())
+                vertices.push_back(ChVector3d(v.x() * scale.x(), v.y() * scale.y(), v.z() * scale.z()));
+            triangles = trimesh_shape->GetMesh()->GetIndicesVertexes();
+        }
+
+        if (triangles.empty())
+            return;
+
+        instance.mesh = chrono_types::make_shared<ChCpuRayMesh>(vertices, triangles);
+        m_meshes[shape.get()] = instance.mesh;
+    }
+
+    m_instances.push_back(instance);
+}
+
+void ChCpuRayScene::Update() {
+    m_instance_boxes.resize(m_instances.size());
+
+    for (size_t k = 0; k < m_instances.size(); k++) {
+        auto& instance = m_instances[k];
+
+        // Refit mutable meshes to their current vertex positions
+        if (instance.mutable_trimesh) {
+            const auto& scale = instance.mutable_trimesh->GetScale();
+            const auto& coords = instance.mutable_trimesh->GetMesh()->GetCoordsVertices();
+            std::vector<ChVector3d> vertices;
+            vertices.reserve(coords.size());
+            for (const auto& v : coords)
+                vertices.push_back(ChVector3d(v.x() * scale.x(), v.y() * scale.y(), v.z() * scale.z()));
+            instance.mesh->SetVertices(vertices);
+        }
+
+        // Current shape pose in absolute frame
+        ChFrame<> abs_frame = instance.item->GetVisualModelFrame() * instance.shape_frame;
+        const ChMatrix33<>& R = abs_frame.GetRotMat();
+        for (int i = 0; i < 3; i++) {
+            instance.pos[i] = (float)abs_frame.GetPos()[i];
+            for (int j = 0; j < 3; j++)
+                instance.rot[3 * i + j] = (float)R(i, j);
+        }
+
+        // Absolute bounding box of the transformed mesh bounding box
+        const auto& box = instance.mesh->GetBounds();
+        auto& abs_box = m_instance_boxes[k];
+        abs_box.Reset();
+        for (int c = 0; c < 8; c++) {
+            float corner[3] = {(c & 1) ? box.bmax[0] : box.bmin[0], (c & 2) ? box.bmax[1] : box.bmin[1],
+                               (c & 4) ? box.bmax[2] : box.bmin[2]};
+            float p[3];
+            for (int i = 0; i < 3; i++) {
+                p[i] = instance.pos[i] + instance.rot[3 * i + 0] * corner[0] + instance.rot[3 * i + 1] * corner[1] +
+                       instance.rot[3 * i + 2] * corner[2];
+            }
+            abs_box.Grow(p);
+        }
+    }
+
+    // Refit the top-level hierarchy to the new instance boxes. Refitting keeps the topology, so the hierarchy degrades
+    // as bodies move relative to each other; rebuild it when its cost grows too much relative to a fresh build.
+    if (!m_tlas.IsEmpty()) {
+        m_tlas.Refit(m_instance_boxes);
+        if (m_tlas.GetCost() <= m_rebuild_threshold * m_tlas_build_cost)
+            return;
+    }
+    m_tlas.Build(m_instance_boxes, 2);
+    m_tlas_build_cost = m_tlas.GetCost();
+    m_num_tlas_builds++;
+}
+
+void ChCpuRayScene::Trace(ChCpuRayPacket& packet) const {
+    packet.Prepare();
+
+    m_tlas.Traverse(packet, [&](ChCpuRayPacket& p, int k, const int* mask) {
+        const auto& instance = m_instances[k];
+
+        // Express the rays in the shape frame (rigid transform, so ray parameters are preserved)
+        ChCpuRayPacket local;
+        for (int i = 0; i < ChCpuRayPacket::SIZE; i++) {
+            float o[3] = {p.ox[i] - instance.pos[0], p.oy[i] - instance.pos[1], p.oz[i] - instance.pos[2]};
+            const float* R = instance.rot;
+            local.ox[i] = R[0] * o[0] + R[3] * o[1] + R[6] * o[2];
+            local.oy[i] = R[1] * o[0] + R[4] * o[1] + R[7] * o[2];
+            local.oz[i] = R[2] * o[0] + R[5] * o[1] + R[8] * o[2];
+            local.dx[i] = R[0] * p.dx[i] + R[3] * p.dy[i] + R[6] * p.dz[i];
+            local.dy[i] = R[1] * p.dx[i] + R[4] * p.dy[i] + R[7] * p.dz[i];
+            local.dz[i] = R[2] * p.dx[i] + R[5] * p.dy[i] + R[8] * p.dz[i];
+            local.tmin[i] = p.tmin[i];
+            local.tmax[i] = mask[i] ? p.tmax[i] : -1;
+            local.inst[i] = -1;
+        }
+        local.Prepare();
+
+        instance.mesh->Intersect(local, k);
+
+        for (int i = 0; i < ChCpuRayPacket::SIZE; i++) {
+            if (local.inst[i] == k) {
+                p.tmax[i] = local.tmax[i];
+                p.prim[i] = local.prim[i];
+                p.inst[i] = k;
+                p.cosine[i] = local.cosine[i];
+            }
+        }
+    });
+}
+
+void ChCpuRayScene::Trace(std::vector<ChCpuRayPacket>& packets) const {
+    int num_packets = (int)packets.size();
+#pragma omp parallel for num_threads(m_num_threads) schedule(dynamic, 16)
+    for (int i = 0; i < num_packets; i++)
+        Trace(packets[i]);
+}
+
+}  // namespace sensor
+}  // namespace chrono
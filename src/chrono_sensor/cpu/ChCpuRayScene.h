@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Scene representation for the CPU ray tracing backend.
+// The scene is a two-level hierarchy: each visual shape is tessellated once into
+// a triangle mesh with its own BVH (expressed in the shape frame) and a top-level
+// BVH over the shape instances is refit to the current body poses at each update
+// (and rebuilt only when the refit hierarchy becomes too loose).
+//
+// =============================================================================
+
+#ifndef CHCPURAYSCENE_H
+#define CHCPURAYSCENE_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/assets/ChVisualShapeTriangleMesh.h"
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/cpu/ChCpuBVH.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Triangle mesh with a BVH over its triangles, used as a bottom-level acceleration structure.
+class CH_SENSOR_API ChCpuRayMesh {
+  public:
+    /// Construct the mesh from the given vertices (in the shape frame) and triangle vertex indices.
+    ChCpuRayMesh(const std::vector<ChVector3d>& vertices, const std::vector<ChVector3i>& triangles);
+
+    /// Update the mesh vertex positions (same number and order) and refit the BVH.
+    void SetVertices(const std::vector<ChVector3d>& vertices);
+
+    /// Intersect the rays in the packet (expressed in the mesh frame) with the mesh triangles.
+    /// Rays hitting a triangle closer than their current tmax are updated and tagged with the given instance index.
+    void Intersect(ChCpuRayPacket& packet, int instance) const;
+
+    /// Get the bounding box of the mesh (in the mesh frame).
+    const ChCpuAABB& GetBounds() const { return m_bvh.GetBounds(); }
+
+    /// Get the number of triangles in the mesh.
+    size_t GetNumTriangles() const { return m_triangles.size() / 3; }
+
+  private:
+    void CalcTriangleBoxes(std::vector<ChCpuAABB>& boxes) const;
+
+    std::vector<float> m_vertices;  ///< vertex coordinates (x, y, z per vertex)
+    std::vector<int> m_triangles;   ///< vertex indices (3 per triangle)
+    ChCpuBVH m_bvh;                 ///< BVH over the mesh triangles
+};
+
+/// Scene of visual shapes traced by the CPU ray tracing backend.
+/// The scene is populated from the visual models of all bodies and other physics items in a Chrono system (boxes,
+/// spheres, cylinders, and triangle meshes are supported). Reconstruct() must be called whenever visual shapes are
+/// added or removed (IsOutdated() detects such changes); Update() must be called before tracing to account for the
+/// current body poses (and for the current vertex positions of mutable meshes).
+class CH_SENSOR_API ChCpuRayScene {
+  public:
+    ChCpuRayScene(ChSystem* system);
+
+    /// Set the number of OpenMP threads used to trace ray packets (default: number of Chrono threads).
+    void SetNumThreads(int num_threads) { m_num_threads = num_threads; }
+
+    /// Get the number of OpenMP threads used to trace ray packets.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Set the threshold for rebuilding the top-level BVH (default: 1.3).
+    /// At each update, the top-level BVH is refit to the new instance poses; it is rebuilt instead if the SAH cost of
+    /// the refit hierarchy exceeds this multiple of its cost when last built.
+    void SetRebuildThreshold(float threshold) { m_rebuild_threshold = threshold; }
+
+    /// Rebuild the scene from the visual models of the associated Chrono system.
+    void Reconstruct();
+
+    /// Return true if the visual models of the associated Chrono system changed since the last reconstruction.
+    /// Changes detected are visual shapes added or removed, shown or hidden, and triangle meshes with a different
+    /// number of vertices.
+    bool IsOutdated() const;
+
+    /// Update the instance poses and the top-level BVH. Mutable meshes are refit.
+    void Update();
+
+    /// Trace a single packet of rays (expressed in the absolute frame).
+    void Trace(ChCpuRayPacket& packet) const;
+
+    /// Trace the given packets of rays in parallel.
+    void Trace(std::vector<ChCpuRayPacket>& packets) const;
+
+    /// Get the number of shape instances in the scene.
+    size_t GetNumInstances() const { return m_instances.size(); }
+
+    /// Get the number of distinct tessellated shapes in the scene.
+    size_t GetNumMeshes() const { return m_meshes.size(); }
+
+    /// Get the physics item owning the specified instance.
+    ChPhysicsItem* GetInstanceItem(int instance) const { return m_instances[instance].item; }
+
+    /// Get the object identifier of the specified instance (index of its owner among the scene physics items).
+    int GetInstanceObjectId(int instance) const { return m_instances[instance].object_id; }
+
+    /// Get the number of times the top-level BVH was built (at reconstruction, or when refitting was not sufficient).
+    unsigned int GetNumTLASBuilds() const { return m_num_tlas_builds; }
+
+  private:
+    /// Shape instance in the scene.
+    struct Instance {
+        ChPhysicsItem* item;                                          ///< owner of the visual model
+        int object_id;                                                ///< index of the owner in the scene
+        ChFrame<> shape_frame;                                        ///< shape frame in the visual model frame
+        std::shared_ptr<ChCpuRayMesh> mesh;                           ///< tessellated shape
+        std::shared_ptr<ChVisualShapeTriangleMesh> mutable_trimesh;   ///< source of mutable meshes
+        float rot[9];                                                 ///< rotation to absolute frame (row major)
+        float pos[3];                                                 ///< position in absolute frame
+    };
+
+    /// Visual shape of a physics item, as seen at the last reconstruction (used to detect scene changes).
+    struct ShapeKey {
+        ChPhysicsItem* item;
+        ChVisualShape* shape;
+        bool visible;
+        size_t num_vertices;
+    };
+
+    void AddItem(ChPhysicsItem* item);
+    void AddShape(ChPhysicsItem* item, std::shared_ptr<ChVisualShape> shape, const ChFrame<>& frame);
+
+    ChSystem* m_system;
+    int m_num_threads;
+    float m_rebuild_threshold;
+
+    std::vector<ShapeKey> m_shape_keys;                                          ///< visual shapes at reconstruction
+    std::vector<Instance> m_instances;                                           ///< shape instances
+    std::unordered_map<ChVisualShape*, std::shared_ptr<ChCpuRayMesh>> m_meshes;  ///< tessellated shapes
+    std::vector<ChCpuAABB> m_instance_boxes;                                     ///< instance bounding boxes
+    ChCpuBVH m_tlas;                                                             ///< top-level BVH over instances
+    float m_tlas_build_cost;                                                     ///< TLAS cost when last built
+    unsigned int m_num_tlas_builds;                                              ///< number of TLAS builds
+    int m_num_items;                                                             ///< physics items with shapes
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,456 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Lidar, depth camera, and radar sensors rendered with the CPU ray tracing backend.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "chrono/utils/ChConstants.h"
+
+#include "chrono_sensor/cpu/ChCpuRaySensors.h"
+
+namespace chrono {
+namespace sensor {
+
+// -----------------------------------------------------------------------------
+// ChCpuRaySensor
+// -----------------------------------------------------------------------------
+
+ChCpuRaySensor::ChCpuRaySensor(std::shared_ptr<ChBody> parent,
+                               float update_rate,
+                               const ChFrame<double>& offset_pose,
+                               unsigned int num_rays_x,
+                               unsigned int num_rays_y)
+    : m_parent(parent),
+      m_update_rate(update_rate),
+      m_offset_pose(offset_pose),
+      m_num_rays_x(num_rays_x),
+      m_num_rays_y(num_rays_y),
+      m_num_launches(0),
+      m_num_threads(1) {}
+
+void ChCpuRaySensor::Render(const ChCpuRayScene& scene, float time) {
+    const int size = ChCpuRayPacket::SIZE;
+    const int num_rays = (int)(m_num_rays_x * m_num_rays_y);
+    const int num_packets = (num_rays + size - 1) / size;
+
+    // Ray directions in the sensor frame do not change between renders
+    if (m_ray_dirs.empty()) {
+        m_ray_dirs.resize(3 * num_rays);
+        for (unsigned int j = 0; j < m_num_rays_y; j++)
+            for (unsigned int i = 0; i < m_num_rays_x; i++)
+                GetRayDirection(i, j, &m_ray_dirs[3 * (j * m_num_rays_x + i)]);
+        m_packets.resize(num_packets);
+    }
+
+    // Current sensor pose
+    ChFrame<> pose = m_parent->GetVisualModelFrame() * m_offset_pose;
+    const ChMatrix33<>& R = pose.GetRotMat();
+    float rot[9];
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            rot[3 * i + j] = (float)R(i, j);
+    float origin[3] = {(float)pose.GetPos().x(), (float)pose.GetPos().y(), (float)pose.GetPos().z()};
+
+    float t_min, t_max;
+    GetRayLimits(t_min, t_max);
+
+    m_num_threads = scene.GetNumThreads();
+
+    // Fill the ray packets (ray directions expressed in the absolute frame)
+#pragma omp parallel for num_threads(m_num_threads)
+    for (int p = 0; p < num_packets; p++) {
+        auto& packet = m_packets[p];
+        for (int i = 0; i < size; i++) {
+            int k = p * size + i;
+            if (k >= num_rays) {
+                packet.DisableRay(i);
+                continue;
+            }
+            const float* d = &m_ray_dirs[3 * k];
+            float dir[3] = {rot[0] * d[0] + rot[1] * d[1] + rot[2] * d[2],  //
+                            rot[3] * d[0] + rot[4] * d[1] + rot[5] * d[2],  //
+                            rot[6] * d[0] + rot[7] * d[1] + rot[8] * d[2]};
+            packet.SetRay(i, origin, dir, t_min, t_max);
+        }
+    }
+
+    scene.Trace(m_packets);
+    ProcessRays(scene, m_packets, time);
+
+    m_num_launches++;
+}
+
+// -----------------------------------------------------------------------------
+// ChCpuLidarSensor
+// -----------------------------------------------------------------------------
+
+ChCpuLidarSensor::ChCpuLidarSensor(std::shared_ptr<ChBody> parent,
+                                   float update_rate,
+                                   const ChFrame<double>& offset_pose,
+                                   unsigned int w,
+                                   unsigned int h,
+                                   float hfov,
+                                   float max_vertical_angle,
+                                   float min_vertical_angle,
+                                   float max_distance,
+                                   BeamShape beam_shape,
+                                   unsigned int sample_radius,
+                                   float vert_divergence_angle,
+                                   float hori_divergence_angle,
+                                   ReturnMode return_mode,
+                                   float clip_near)
+    : ChCpuRaySensor(parent,
+                     update_rate,
+                     offset_pose,
+                     w * (2 * std::max(sample_radius, 1u) - 1),
+                     h * (2 * std::max(sample_radius, 1u) - 1)),
+      m_w(w),
+      m_h(h),
+      m_hfov(hfov),
+      m_max_vert_angle(max_vertical_angle),
+      m_min_vert_angle(min_vertical_angle),
+      m_max_distance(max_distance),
+      m_beam_shape(beam_shape),
+      m_sample_radius(std::max(sample_radius, 1u)),
+      m_vert_divergence_angle(vert_divergence_angle),
+      m_hori_divergence_angle(hori_divergence_angle),
+      m_return_mode(return_mode),
+      m_clip_near(clip_near),
+      m_reduce_beams(true) {}
+
+// Same beam pattern as the OptiX lidar ray generation programs.
+void ChCpuLidarSensor::GetRayDirection(unsigned int i, unsigned int j, float* dir) const {
+    int d = 2 * m_sample_radius - 1;
+
+    // Beam center direction
+    int bi = i / d;
+    int bj = j / d;
+    float phi = (bj / (float)std::max(1, (int)m_h - 1)) * (m_max_vert_angle - m_min_vert_angle) + m_min_vert_angle;
+    float theta = (bi / (float)std::max(1, (int)m_w - 1)) * m_hfov - m_hfov / 2;
+
+    // Offset of the sample within the beam
+    if (d > 1) {
+        float fx = ((i % d) + 0.5f) / d * 2 - 1;
+        float fy = ((j % d) + 0.5f) / d * 2 - 1;
+        if (m_beam_shape == BeamShape::ELLIPTICAL) {
+            theta += fx * m_hori_divergence_angle / 2;
+            phi += fy * m_vert_divergence_angle / 2;
+        } else {
+            float angle = std::atan2(fy, fx);
+            float ring = std::max(std::abs(fx), std::abs(fy));
+            float ax = m_vert_divergence_angle / 2 * ring;
+            float ay = m_hori_divergence_angle / 2 * ring;
+            float radius = 0;
+            if (ax != 0 || ay != 0) {
+                float s = std::sin(angle);
+                float c = std::cos(angle);
+                radius = (ax * ay) / std::sqrt(ax * ax * s * s + ay * ay * c * c);
+            }
+            theta += radius * std::sin(angle);
+            phi += radius * std::cos(angle);
+        }
+    }
+
+    dir[0] = std::cos(phi) * std::cos(theta);
+    dir[1] = std::cos(phi) * std::sin(theta);
+    dir[2] = std::sin(phi);
+}
+
+void ChCpuLidarSensor::GetRayLimits(float& t_min, float& t_max) const {
+    t_min = m_clip_near;
+    t_max = 1.5f * m_max_distance;
+}
+
+void ChCpuLidarSensor::ProcessRays(const ChCpuRayScene& scene,
+                                   const std::vector<ChCpuRayPacket>& packets,
+                                   float time) {
+    const int size = ChCpuRayPacket::SIZE;
+    const int d = 2 * m_sample_radius - 1;
+    const int w = (int)m_w;
+    const int h = (int)m_h;
+
+    auto range = [&](int k) {
+        const auto& packet = packets[k / size];
+        return packet.prim[k % size] >= 0 ? packet.tmax[k % size] : 0.f;
+    };
+    auto intensity = [&](int k) {
+        const auto& packet = packets[k / size];
+        return packet.prim[k % size] >= 0 ? packet.cosine[k % size] : 0.f;
+    };
+
+    // Unreduced beam samples
+    if (!m_reduce_beams) {
+        const int num_samples = (int)(m_num_rays_x * m_num_rays_y);
+        auto di = chrono_types::make_shared<SensorHostDIBuffer>();
+        di->Buffer = std::make_unique<PixelDI[]>(num_samples);
+        di->Width = m_num_rays_x;
+        di->Height = m_num_rays_y;
+        di->TimeStamp = time;
+        di->LaunchedCount = m_num_launches;
+        for (int k = 0; k < num_samples; k++)
+            di->Buffer[k] = {range(k), intensity(k)};
+        m_di_buffer = di;
+        m_xyzi_buffer = nullptr;
+        return;
+    }
+
+    auto di = chrono_types::make_shared<SensorHostDIBuffer>();
+    di->Buffer = std::make_unique<PixelDI[]>(w * h);
+    di->Width = w;
+    di->Height = h;
+    di->TimeStamp = time;
+    di->LaunchedCount = m_num_launches;
+
+    auto xyzi = chrono_types::make_shared<SensorHostXYZIBuffer>();
+    xyzi->Buffer = std::make_unique<PixelXYZI[]>(w * h);
+    xyzi->Width = w;
+    xyzi->Height = h;
+    xyzi->TimeStamp = time;
+    xyzi->LaunchedCount = m_num_launches;
+
+    // Reduce the samples of each beam (same reductions as the lidar reduce filter)
+    const float kernel_radius = 0.05f;
+    unsigned int num_returns = 0;
+
+#pragma omp parallel for num_threads(m_num_threads) reduction(+ : num_returns)
+    for (int b = 0; b < w * h; b++) {
+        int bi = b % w;
+        int bj = b / w;
+        auto sample = [&](int si, int sj) { return (d * bj + sj) * d * w + (d * bi + si); };
+
+        float beam_range = 0;
+        float beam_intensity = 0;
+        if (d == 1) {
+            beam_range = range(b);
+            beam_intensity = intensity(b);
+        } else if (m_return_mode == ReturnMode::MEAN_RETURN) {
+            float sum_range = 0;
+            float sum_intensity = 0;
+            int n = 0;
+            for (int s = 0; s < d * d; s++) {
+                int k = sample(s % d, s / d);
+                sum_intensity += intensity(k);
+                if (intensity(k) > 1e-6f) {
+                    sum_range += range(k);
+                    n++;
+                }
+            }
+            if (n > 0) {
+                beam_range = sum_range / n;
+                beam_intensity = sum_intensity / (d * d);
+            }
+        } else {
+            float shortest = std::numeric_limits<float>::max();
+            for (int s = 0; s < d * d; s++) {
+                int k = sample(s % d, s / d);
+                float r = range(k);
+                float local_intensity = intensity(k);
+                for (int t = 0; t < d * d; t++) {
+                    int l = sample(t % d, t / d);
+                    if (l != k && std::abs(range(l) - r) < kernel_radius)
+                        local_intensity += (kernel_radius - std::abs(range(l) - r)) / kernel_radius * intensity(l);
+                }
+                local_intensity /= (d * d);
+                if (m_return_mode == ReturnMode::STRONGEST_RETURN) {
+                    if (local_intensity > beam_intensity) {
+                        beam_intensity = local_intensity;
+                        beam_range = r;
+                    }
+                } else if (intensity(k) > 0 && r < shortest) {
+                    shortest = r;
+                    beam_intensity = local_intensity;
+                    beam_range = r;
+                }
+            }
+        }
+
+        di->Buffer[b] = {beam_range, beam_intensity};
+
+        // Point cloud in the sensor frame, using the beam center direction
+        float phi = (bj / (float)std::max(1, h - 1)) * (m_max_vert_angle - m_min_vert_angle) + m_min_vert_angle;
+        float theta = (bi / (float)std::max(1, w - 1)) * m_hfov - m_hfov / 2;
+        float proj_xy = beam_range * std::cos(phi);
+        xyzi->Buffer[b] = {proj_xy * std::cos(theta), proj_xy * std::sin(theta), beam_range * std::sin(phi),
+                           beam_intensity};
+
+        if (beam_range > 0)
+            num_returns++;
+    }
+
+    di->Beam_return_count = num_returns;
+    xyzi->Beam_return_count = num_returns;
+
+    m_di_buffer = di;
+    m_xyzi_buffer = xyzi;
+}
+
+// -----------------------------------------------------------------------------
+// ChCpuDepthCamera
+// -----------------------------------------------------------------------------
+
+ChCpuDepthCamera::ChCpuDepthCamera(std::shared_ptr<ChBody> parent,
+                                   float update_rate,
+                                   const ChFrame<double>& offset_pose,
+                                   unsigned int w,
+                                   unsigned int h,
+                                   float hfov,
+                                   float max_depth)
+    : ChCpuRaySensor(parent, update_rate, offset_pose, w, h), m_hfov(hfov), m_max_depth(max_depth) {}
+
+// Same pixel directions as the OptiX depth camera ray generation program (pinhole lens).
+void ChCpuDepthCamera::GetRayDirection(unsigned int i, unsigned int j, float* dir) const {
+    float dx = (i + 0.5f) / m_num_rays_x * 2 - 1;
+    float dy = ((j + 0.5f) / m_num_rays_y * 2 - 1) * m_num_rays_y / (float)m_num_rays_x;
+    float h_factor = m_hfov / (float)CH_PI * 2;
+
+    float x = 1;
+    float y = -dx * h_factor;
+    float z = dy * h_factor;
+    float len = std::sqrt(x * x + y * y + z * z);
+
+    dir[0] = x / len;
+    dir[1] = y / len;
+    dir[2] = z / len;
+}
+
+void ChCpuDepthCamera::GetRayLimits(float& t_min, float& t_max) const {
+    t_min = 1e-3f;
+    t_max = m_max_depth;
+}
+
+void ChCpuDepthCamera::ProcessRays(const ChCpuRayScene& scene,
+                                   const std::vector<ChCpuRayPacket>& packets,
+                                   float time) {
+    const int size = ChCpuRayPacket::SIZE;
+    const int num_pixels = (int)(m_num_rays_x * m_num_rays_y);
+
+    auto depth = chrono_types::make_shared<SensorHostDepthBuffer>();
+    depth->Buffer = std::make_unique<PixelDepth[]>(num_pixels);
+    depth->Width = m_num_rays_x;
+    depth->Height = m_num_rays_y;
+    depth->TimeStamp = time;
+    depth->LaunchedCount = m_num_launches;
+
+    for (int k = 0; k < num_pixels; k++) {
+        const auto& packet = packets[k / size];
+        bool hit = packet.prim[k % size] >= 0;
+        depth->Buffer[k].depth = hit ? std::min(packet.tmax[k % size], m_max_depth) : m_max_depth;
+    }
+
+    m_depth_buffer = depth;
+}
+
+// -----------------------------------------------------------------------------
+// ChCpuRadarSensor
+// -----------------------------------------------------------------------------
+
+ChCpuRadarSensor::ChCpuRadarSensor(std::shared_ptr<ChBody> parent,
+                                   float update_rate,
+                                   const ChFrame<double>& offset_pose,
+                                   unsigned int w,
+                                   unsigned int h,
+                                   float hfov,
+                                   float vfov,
+                                   float max_distance,
+                                   float clip_near)
+    : ChCpuRaySensor(parent, update_rate, offset_pose, w, h),
+      m_hfov(hfov),
+      m_vfov(vfov),
+      m_max_distance(max_distance),
+      m_clip_near(clip_near) {}
+
+// Same sample directions as the OptiX radar ray generation program.
+void ChCpuRadarSensor::GetRayDirection(unsigned int i, unsigned int j, float* dir) const {
+    float dx = (i + 0.5f) / m_num_rays_x * 2 - 1;
+    float dy = (j + 0.5f) / m_num_rays_y * 2 - 1;
+    float theta = dx * m_hfov / 2;
+    float phi = -m_vfov / 2 + (dy * 0.5f + 0.5f) * m_vfov;
+
+    dir[0] = std::cos(phi) * std::cos(theta);
+    dir[1] = std::cos(phi) * std::sin(theta);
+    dir[2] = std::sin(phi);
+}
+
+void ChCpuRadarSensor::GetRayLimits(float& t_min, float& t_max) const {
+    t_min = m_clip_near;
+    t_max = 1.5f * m_max_distance;
+}
+
+void ChCpuRadarSensor::ProcessRays(const ChCpuRayScene& scene,
+                                   const std::vector<ChCpuRayPacket>& packets,
+                                   float time) {
+    const int size = ChCpuRayPacket::SIZE;
+    const int w = (int)m_num_rays_x;
+    const int h = (int)m_num_rays_y;
+
+    auto radar = chrono_types::make_shared<SensorHostRadarBuffer>();
+    radar->Buffer = std::shared_ptr<RadarReturn[]>(new RadarReturn[w * h]);
+    radar->Width = w;
+    radar->Height = h;
+    radar->TimeStamp = time;
+    radar->LaunchedCount = m_num_launches;
+
+    // Sensor frame and velocity of the sensor origin
+    ChFrame<> pose = m_parent->GetVisualModelFrame() * m_offset_pose;
+    const ChMatrix33<>& R = pose.GetRotMat();
+    ChVector3d sensor_vel = m_parent->PointSpeedLocalToParent(m_parent->TransformPointParentToLocal(pose.GetPos()));
+
+    int num_returns = 0;
+    for (int k = 0; k < w * h; k++) {
+        const auto& packet = packets[k / size];
+        int lane = k % size;
+
+        auto& ret = radar->Buffer[k];
+        ret.range = 0;
+        ret.azimuth = ((k % w) / (float)w) * m_hfov - m_hfov / 2;
+        ret.elevation = ((k / w) / (float)h) * m_vfov - m_vfov / 2;
+        ret.doppler_velocity[0] = 0;
+        ret.doppler_velocity[1] = 0;
+        ret.doppler_velocity[2] = 0;
+        ret.amplitude = 0;
+        ret.objectId = 0;
+
+        if (packet.prim[lane] < 0)
+            continue;
+
+        ret.range = packet.tmax[lane];
+        ret.amplitude = packet.cosine[lane];
+        ret.objectId = (float)scene.GetInstanceObjectId(packet.inst[lane]);
+        num_returns++;
+
+        // Velocity of the hit point relative to the sensor, for returns from moving bodies
+        auto body = dynamic_cast<ChBody*>(scene.GetInstanceItem(packet.inst[lane]));
+        if (!body)
+            continue;
+        ChVector3d hit(packet.ox[lane] + packet.tmax[lane] * packet.dx[lane],
+                       packet.oy[lane] + packet.tmax[lane] * packet.dy[lane],
+                       packet.oz[lane] + packet.tmax[lane] * packet.dz[lane]);
+        ChVector3d hit_vel = body->PointSpeedLocalToParent(body->TransformPointParentToLocal(hit));
+        if (hit_vel.IsNull())
+            continue;
+        ChVector3d rel_vel = R.transpose() * (hit_vel - sensor_vel);
+        ret.doppler_velocity[0] = (float)rel_vel.x();
+        ret.doppler_velocity[1] = (float)rel_vel.y();
+        ret.doppler_velocity[2] = (float)rel_vel.z();
+    }
+
+    radar->Beam_return_count = num_returns;
+    m_radar_buffer = radar;
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,277 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Lidar, depth camera, and radar sensors rendered with the CPU ray tracing
+// backend. Ray patterns and outputs follow the OptiX-based ChLidarSensor,
+// ChDepthCamera, and ChRadarSensor, so that data can be consumed the same way as
+// the host buffers provided by the corresponding access filters.
+//
+// =============================================================================
+
+#ifndef CHCPURAYSENSORS_H
+#define CHCPURAYSENSORS_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChBody.h"
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/cpu/ChCpuRayScene.h"
+#include "chrono_sensor/sensors/ChSensorBuffer.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Base class for sensors rendered with the CPU ray tracing backend.
+/// A sensor generates a (w x h) grid of rays, expressed in the sensor frame (x forward, y left, z up), which are traced
+/// in packets through a ChCpuRayScene. Rendering is triggered by a ChCpuSensorManager at the sensor update rate.
+class CH_SENSOR_API ChCpuRaySensor {
+  public:
+    virtual ~ChCpuRaySensor() {}
+
+    /// Get the body to which the sensor is attached.
+    std::shared_ptr<ChBody> GetParent() const { return m_parent; }
+
+    /// Get the sensor update rate [Hz].
+    float GetUpdateRate() const { return m_update_rate; }
+
+    /// Get the sensor pose relative to its parent body.
+    const ChFrame<double>& GetOffsetPose() const { return m_offset_pose; }
+
+    /// Set the sensor pose relative to its parent body.
+    void SetOffsetPose(const ChFrame<double>& pose) { m_offset_pose = pose; }
+
+    /// Get the number of times the sensor was rendered.
+    unsigned int GetNumLaunches() const { return m_num_launches; }
+
+    /// Return true if the sensor is due for an update at the given time.
+    bool IsDue(double time) const { return time > m_num_launches / m_update_rate - 1e-7; }
+
+    /// Trace the sensor rays through the given scene and process the hits.
+    void Render(const ChCpuRayScene& scene, float time);
+
+  protected:
+    ChCpuRaySensor(std::shared_ptr<ChBody> parent,
+                   float update_rate,
+                   const ChFrame<double>& offset_pose,
+                   unsigned int num_rays_x,
+                   unsigned int num_rays_y);
+
+    /// Direction (in the sensor frame) of ray (i, j) of the ray grid.
+    virtual void GetRayDirection(unsigned int i, unsigned int j, float* dir) const = 0;
+
+    /// Minimum and maximum ray parameters.
+    virtual void GetRayLimits(float& t_min, float& t_max) const = 0;
+
+    /// Process the rays traced through the given scene. Hit information for ray (i, j) is stored in lane (k % SIZE) of
+    /// packet (k / SIZE), with k = j * num_rays_x + i.
+    virtual void ProcessRays(const ChCpuRayScene& scene, const std::vector<ChCpuRayPacket>& packets, float time) = 0;
+
+    std::shared_ptr<ChBody> m_parent;
+    float m_update_rate;
+    ChFrame<double> m_offset_pose;
+    unsigned int m_num_rays_x;
+    unsigned int m_num_rays_y;
+    unsigned int m_num_launches;
+    int m_num_threads;  ///< number of OpenMP threads (set from the scene at each render)
+
+  private:
+    std::vector<float> m_ray_dirs;             ///< cached ray directions in sensor frame
+    std::vector<ChCpuRayPacket> m_packets;     ///< ray packets (reused between renders)
+};
+
+/// Lidar sensor rendered with the CPU ray tracing backend.
+/// Beam directions, multi-sample beams (with rectangular or elliptical cross section), return modes, and the output
+/// range-intensity and point cloud data match those of the OptiX-based ChLidarSensor. The intensity of a sample is the
+/// cosine of the incidence angle (unit lidar reflectivity, as in the OptiX backend).
+class CH_SENSOR_API ChCpuLidarSensor : public ChCpuRaySensor {
+  public:
+    /// Cross section shape of multi-sample beams.
+    enum class BeamShape { RECTANGULAR, ELLIPTICAL };
+
+    /// Return mode used to reduce the samples of a beam to a single return.
+    enum class ReturnMode {
+        STRONGEST_RETURN,  ///< range at peak intensity
+        MEAN_RETURN,       ///< average beam range
+        FIRST_RETURN       ///< shortest beam range
+    };
+
+    /// Construct a lidar with the same parameters as ChLidarSensor.
+    /// @param parent Body to which the sensor is attached.
+    /// @param update_rate Rate at which the sensor should update.
+    /// @param offset_pose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Width in number of samples of a lidar scan
+    /// @param h Height in number of sample of a lidar scan (typical the same as laser channels)
+    /// @param hfov Horizontal field of view of the lidar
+    /// @param max_vertical_angle Maximum vertical angle of the lidar
+    /// @param min_vertical_angle Minimum vertical angle of the lidar
+    /// @param max_distance the maximum measurable distance for the lidar
+    /// @param beam_shape Shape of lidar beam
+    /// @param sample_radius The radius in samples for multisampling beams (total samples per beam is 2*radius-1)
+    /// @param vert_divergence_angle The vertical divergence angle of the lidar's laser beam
+    /// @param hori_divergence_angle The horizontal divergence angle of the lidar's laser beam
+    /// @param return_mode The return mode for lidar data when multiple objects are visible
+    /// @param clip_near Near clipping distance
+    ChCpuLidarSensor(std::shared_ptr<ChBody> parent,
+                     float update_rate,
+                     const ChFrame<double>& offset_pose,
+                     unsigned int w,
+                     unsigned int h,
+                     float hfov,
+                     float max_vertical_angle,
+                     float min_vertical_angle,
+                     float max_distance,
+                     BeamShape beam_shape = BeamShape::RECTANGULAR,
+                     unsigned int sample_radius = 1,
+                     float vert_divergence_angle = .003f,
+                     float hori_divergence_angle = .003f,
+                     ReturnMode return_mode = ReturnMode::MEAN_RETURN,
+                     float clip_near = 1e-3f);
+
+    /// Enable or disable the reduction of beam samples (default: true).
+    /// If disabled, the range-intensity buffer holds all beam samples (as generated by the OptiX lidar, before the
+    /// ChFilterLidarReduce filter) and no point cloud is generated.
+    void SetReduceBeams(bool reduce) { m_reduce_beams = reduce; }
+
+    /// Get the last range-intensity scan (w x h beams), or nullptr if the sensor was not yet rendered.
+    UserDIBufferPtr GetDIBuffer() const { return m_di_buffer; }
+
+    /// Get the last scan as a point cloud in the sensor frame (w x h points), or nullptr if the sensor was not yet
+    /// rendered. Beams without a return are placed at the sensor origin, with zero intensity.
+    UserXYZIBufferPtr GetPointCloud() const { return m_xyzi_buffer; }
+
+    float GetHFOV() const { return m_hfov; }
+    float GetMaxVertAngle() const { return m_max_vert_angle; }
+    float GetMinVertAngle() const { return m_min_vert_angle; }
+    float GetMaxDistance() const { return m_max_distance; }
+
+  private:
+    virtual void GetRayDirection(unsigned int i, unsigned int j, float* dir) const override;
+    virtual void GetRayLimits(float& t_min, float& t_max) const override;
+    virtual void ProcessRays(const ChCpuRayScene& scene,
+                             const std::vector<ChCpuRayPacket>& packets,
+                             float time) override;
+
+    unsigned int m_w;
+    unsigned int m_h;
+    float m_hfov;
+    float m_max_vert_angle;
+    float m_min_vert_angle;
+    float m_max_distance;
+    BeamShape m_beam_shape;
+    unsigned int m_sample_radius;
+    float m_vert_divergence_angle;
+    float m_hori_divergence_angle;
+    ReturnMode m_return_mode;
+    float m_clip_near;
+    bool m_reduce_beams;
+
+    UserDIBufferPtr m_di_buffer;
+    UserXYZIBufferPtr m_xyzi_buffer;
+};
+
+/// Depth camera rendered with the CPU ray tracing backend (pinhole lens model, as in ChDepthCamera).
+class CH_SENSOR_API ChCpuDepthCamera : public ChCpuRaySensor {
+  public:
+    /// Construct a depth camera.
+    /// @param parent Body to which the sensor is attached.
+    /// @param update_rate Rate at which the sensor should update.
+    /// @param offset_pose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Width of the image in pixels
+    /// @param h Height of the image in pixels
+    /// @param hfov Horizontal field of view of the camera
+    /// @param max_depth Depth reported for pixels without a hit
+    ChCpuDepthCamera(std::shared_ptr<ChBody> parent,
+                     float update_rate,
+                     const ChFrame<double>& offset_pose,
+                     unsigned int w,
+                     unsigned int h,
+                     float hfov,
+                     float max_depth = 1000);
+
+    /// Get the last depth image, or nullptr if the sensor was not yet rendered.
+    UserDepthBufferPtr GetDepthBuffer() const { return m_depth_buffer; }
+
+    float GetHFOV() const { return m_hfov; }
+    float GetMaxDepth() const { return m_max_depth; }
+
+  private:
+    virtual void GetRayDirection(unsigned int i, unsigned int j, float* dir) const override;
+    virtual void GetRayLimits(float& t_min, float& t_max) const override;
+    virtual void ProcessRays(const ChCpuRayScene& scene,
+                             const std::vector<ChCpuRayPacket>& packets,
+                             float time) override;
+
+    float m_hfov;
+    float m_max_depth;
+
+    UserDepthBufferPtr m_depth_buffer;
+};
+
+/// Radar rendered with the CPU ray tracing backend (same ray pattern and returns as ChRadarSensor).
+/// The radar cross section of a return is the cosine of the incidence angle (unit backscatter, as in the OptiX
+/// backend). The Doppler velocity is the velocity of the hit point relative to the sensor, expressed in the sensor
+/// frame; it is reported only for returns from moving objects.
+class CH_SENSOR_API ChCpuRadarSensor : public ChCpuRaySensor {
+  public:
+    /// Construct a radar.
+    /// @param parent Body to which the sensor is attached.
+    /// @param update_rate Rate at which the sensor should update.
+    /// @param offset_pose Relative position and orientation of the sensor with respect to its parent object.
+    /// @param w Width in number of samples of a radar scan
+    /// @param h Height in number of samples of a radar scan
+    /// @param hfov Horizontal field of view of the radar
+    /// @param vfov Vertical field of view of the radar
+    /// @param max_distance The farthest detectable distance for the radar
+    /// @param clip_near Near clipping distance
+    ChCpuRadarSensor(std::shared_ptr<ChBody> parent,
+                     float update_rate,
+                     const ChFrame<double>& offset_pose,
+                     unsigned int w,
+                     unsigned int h,
+                     float hfov,
+                     float vfov,
+                     float max_distance,
+                     float clip_near = 1e-3f);
+
+    /// Get the last radar scan (w x h returns), or nullptr if the sensor was not yet rendered.
+    UserRadarBufferPtr GetRadarBuffer() const { return m_radar_buffer; }
+
+    float GetHFOV() const { return m_hfov; }
+    float GetVFOV() const { return m_vfov; }
+    float GetMaxDistance() const { return m_max_distance; }
+
+  private:
+    virtual void GetRayDirection(unsigned int i, unsigned int j, float* dir) const override;
+    virtual void GetRayLimits(float& t_min, float& t_max) const override;
+    virtual void ProcessRays(const ChCpuRayScene& scene,
+                             const std::vector<ChCpuRayPacket>& packets,
+                             float time) override;
+
+    float m_hfov;
+    float m_vfov;
+    float m_max_distance;
+    float m_clip_near;
+
+    UserRadarBufferPtr m_radar_buffer;
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
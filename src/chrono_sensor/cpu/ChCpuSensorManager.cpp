@@ -0,0 +1,85 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Manager for sensors rendered with the CPU ray tracing backend
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+
+#include "chrono_sensor/cpu/ChCpuSensorManager.h"
+
+namespace chrono {
+namespace sensor {
+
+ChCpuSensorManager::ChCpuSensorManager(ChSystem* system) : m_system(system), m_scene(system) {}
+
+#ifndef CH_SENSOR_CPU_ONLY
+void ChCpuSensorManager::AddSensor(std::shared_ptr<ChOptixSensor> sensor) {
+    if (std::find(m_optix_sensors.begin(), m_optix_sensors.end(), sensor) != m_optix_sensors.end()) {
+        std::cerr << "WARNING: This sensor already exists in manager. Ignoring this addition\n";
+        return;
+    }
+
+    auto render_filter = chrono_types::make_shared<ChFilterCpuRender>(&m_scene);
+    sensor->PushFilterFront(render_filter);
+    sensor->LockFilterList();
+
+    std::shared_ptr<SensorBuffer> buffer;
+    for (auto f : sensor->GetFilterList())
+        f->Initialize(sensor, buffer);
+
+    m_optix_sensors.push_back(sensor);
+    m_render_filters.push_back(render_filter);
+}
+#endif
+
+void ChCpuSensorManager::UpdateScene(bool& scene_updated) {
+    if (scene_updated)
+        return;
+    if (m_scene.IsOutdated())
+        m_scene.Reconstruct();
+    else
+        m_scene.Update();
+    scene_updated = true;
+}
+
+void ChCpuSensorManager::Update() {
+    double time = m_system->GetChTime();
+
+    bool scene_updated = false;
+    for (auto& sensor : m_sensors) {
+        if (!sensor->IsDue(time))
+            continue;
+        UpdateScene(scene_updated);
+        sensor->Render(m_scene, (float)time);
+    }
+
+#ifndef CH_SENSOR_CPU_ONLY
+    for (size_t i = 0; i < m_optix_sensors.size(); i++) {
+        auto& sensor = m_optix_sensors[i];
+        if (time <= sensor->GetNumLaunches() / sensor->GetUpdateRate() - 1e-7)
+            continue;
+        UpdateScene(scene_updated);
+
+        sensor->IncrementNumLaunches();
+        m_render_filters[i]->SetTimeStamp((float)time);
+        for (auto f : sensor->GetFilterList())
+            f->Apply();
+        cudaStreamSynchronize(sensor->GetCudaStream());
+    }
+#endif
+}
+
+}  // namespace sensor
+}  // namespace chrono
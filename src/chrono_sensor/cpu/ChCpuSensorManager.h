@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Manager for sensors rendered with the CPU ray tracing backend
+//
+// =============================================================================
+
+#ifndef CHCPUSENSORMANAGER_H
+#define CHCPUSENSORMANAGER_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/cpu/ChCpuRayScene.h"
+#include "chrono_sensor/cpu/ChCpuRaySensors.h"
+
+#ifndef CH_SENSOR_CPU_ONLY
+    #include "chrono_sensor/cpu/ChFilterCpuRender.h"
+    #include "chrono_sensor/sensors/ChOptixSensor.h"
+#endif
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Manager for sensors rendered with the CPU ray tracing backend.
+/// This is the CPU counterpart of ChSensorManager for lidar, depth camera, and radar sensors. Sensors are rendered
+/// synchronously, on the calling thread and the OpenMP threads of the scene, when they are due. When Chrono::Sensor is
+/// built with CUDA, the manager also renders OptiX sensors (ChLidarSensor, ChDepthCamera, ChRadarSensor) and runs their
+/// filter graphs; this is how ChSensorManager uses the CPU render backend.
+class CH_SENSOR_API ChCpuSensorManager {
+  public:
+    ChCpuSensorManager(ChSystem* system);
+
+    /// Add a sensor to the manager.
+    void AddSensor(std::shared_ptr<ChCpuRaySensor> sensor) { m_sensors.push_back(sensor); }
+
+#ifndef CH_SENSOR_CPU_ONLY
+    /// Add a lidar, depth camera, or radar sensor to the manager.
+    /// A ChFilterCpuRender is inserted at the front of the sensor filter graph and the filter graph is initialized.
+    /// At each update of the sensor, the filter graph is run on the calling thread, so the sensor data is available
+    /// right after the update (the sensor lag and collection window are ignored).
+    void AddSensor(std::shared_ptr<ChOptixSensor> sensor);
+#endif
+
+    /// Get the list of sensors for which this manager is responsible.
+    const std::vector<std::shared_ptr<ChCpuRaySensor>>& GetSensorList() const { return m_sensors; }
+
+    /// Set the number of OpenMP threads used for ray tracing.
+    void SetNumThreads(int num_threads) { m_scene.SetNumThreads(num_threads); }
+
+    /// Rebuild the scene from the Chrono system.
+    /// Changes in the visual shapes of the Chrono system are otherwise detected at the next update of a sensor.
+    void ReconstructScenes() { m_scene.Reconstruct(); }
+
+    /// Render all sensors due at the current time of the Chrono system.
+    /// The scene is updated (once) whenever at least one sensor is due, and reconstructed if the visual shapes of the
+    /// Chrono system changed.
+    void Update();
+
+    /// Get the ray tracing scene.
+    ChCpuRayScene& GetScene() { return m_scene; }
+
+  private:
+    /// Update the scene, if not already done for the current time.
+    void UpdateScene(bool& scene_updated);
+
+    ChSystem* m_system;
+    ChCpuRayScene m_scene;
+    std::vector<std::shared_ptr<ChCpuRaySensor>> m_sensors;
+
+#ifndef CH_SENSOR_CPU_ONLY
+    std::vector<std::shared_ptr<ChOptixSensor>> m_optix_sensors;       ///< sensors with a filter graph
+    std::vector<std::shared_ptr<ChFilterCpuRender>> m_render_filters;  ///< render filter of each such sensor
+#endif
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Filter generating the data of an OptiX sensor with the CPU ray tracing backend
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChFilterCpuRender.h"
+
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/sensors/ChRadarSensor.h"
+#include "chrono_sensor/utils/CudaMallocHelper.h"
+
+namespace chrono {
+namespace sensor {
+
+// Allocate a device buffer of the given type, with the dimensions of the sensor.
+template <class BufferT, class PixelT>
+static std::shared_ptr<BufferT> MakeDeviceBuffer(std::shared_ptr<ChOptixSensor> sensor, void*& data) {
+    auto buffer = chrono_types::make_shared<BufferT>();
+    buffer->Buffer = std::shared_ptr<PixelT[]>(cudaMallocHelper<PixelT>(sensor->GetWidth() * sensor->GetHeight()),
+                                               cudaFreeHelper<PixelT>);
+    buffer->Width = sensor->GetWidth();
+    buffer->Height = sensor->GetHeight();
+    data = buffer->Buffer.get();
+    return buffer;
+}
+
+ChFilterCpuRender::ChFilterCpuRender(const ChCpuRayScene* scene)
+    : ChFilter("CpuRenderer"), m_scene(scene), m_bufferOutData(nullptr), m_pixelSize(0), m_time_stamp(0) {}
+
+CH_SENSOR_API void ChFilterCpuRender::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                 std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (bufferInOut) {
+        throw std::runtime_error("The CPU render filter must be the first filter in the list");
+    }
+    auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(pSensor);
+    if (!pOptixSensor) {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+    m_optixSensor = pOptixSensor;
+    m_cuda_stream = pOptixSensor->GetCudaStream();
+
+    auto parent = pOptixSensor->GetParent();
+    auto rate = pOptixSensor->GetUpdateRate();
+    auto offset = pOptixSensor->GetOffsetPose();
+
+    if (auto lidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
+        // The samples of multi-sample beams are reduced by the ChFilterLidarReduce filter of the sensor
+        unsigned int d = 2 * lidar->GetSampleRadius() - 1;
+        auto beam_shape = lidar->GetBeamShape() == LidarBeamShape::ELLIPTICAL
+                              ? ChCpuLidarSensor::BeamShape::ELLIPTICAL
+                              : ChCpuLidarSensor::BeamShape::RECTANGULAR;
+        auto cpu_lidar = chrono_types::make_shared<ChCpuLidarSensor>(
+            parent, rate, offset, lidar->GetWidth() / d, lidar->GetHeight() / d, lidar->GetHFOV(),
+            lidar->GetMaxVertAngle(), lidar->GetMinVertAngle(), lidar->GetMaxDistance(), beam_shape,
+            lidar->GetSampleRadius(), lidar->GetVertDivAngle(), lidar->GetHorizDivAngle(),
+            ChCpuLidarSensor::ReturnMode::MEAN_RETURN, lidar->GetClipNear());
+        cpu_lidar->SetReduceBeams(false);
+        m_cpuSensor = cpu_lidar;
+        m_bufferOut = MakeDeviceBuffer<SensorDeviceDIBuffer, PixelDI>(pOptixSensor, m_bufferOutData);
+        m_pixelSize = sizeof(PixelDI);
+    } else if (auto depthCamera = std::dynamic_pointer_cast<ChDepthCamera>(pSensor)) {
+        if (depthCamera->GetLensModelType() != CameraLensModelType::PINHOLE) {
+            throw std::runtime_error("The CPU render backend supports only the pinhole lens model for depth cameras");
+        }
+        m_cpuSensor = chrono_types::make_shared<ChCpuDepthCamera>(parent, rate, offset, depthCamera->GetWidth(),
+                                                                  depthCamera->GetHeight(), depthCamera->GetHFOV(),
+                                                                  depthCamera->GetMaxDepth());
+        m_bufferOut = MakeDeviceBuffer<SensorDeviceDepthBuffer, PixelDepth>(pOptixSensor, m_bufferOutData);
+        m_pixelSize = sizeof(PixelDepth);
+    } else if (auto radar = std::dynamic_pointer_cast<ChRadarSensor>(pSensor)) {
+        m_cpuSensor = chrono_types::make_shared<ChCpuRadarSensor>(parent, rate, offset, radar->GetWidth(),
+                                                                  radar->GetHeight(), radar->GetHFOV(),
+                                                                  radar->GetVFOV(), radar->GetMaxDistance(),
+                                                                  radar->GetClipNear());
+        m_bufferOut = MakeDeviceBuffer<SensorDeviceRadarBuffer, RadarReturn>(pOptixSensor, m_bufferOutData);
+        m_pixelSize = sizeof(RadarReturn);
+    } else {
+        throw std::runtime_error("The CPU render backend supports only lidar, depth camera, and radar sensors");
+    }
+
+    bufferInOut = m_bufferOut;
+}
+
+CH_SENSOR_API void ChFilterCpuRender::Apply() {
+    auto pOptixSensor = m_optixSensor.lock();
+
+    // Trace the sensor rays from the current sensor pose
+    m_cpuSensor->SetOffsetPose(pOptixSensor->GetOffsetPose());
+    m_cpuSensor->Render(*m_scene, m_time_stamp);
+
+    void* host_data = nullptr;
+    if (auto lidar = std::dynamic_pointer_cast<ChCpuLidarSensor>(m_cpuSensor)) {
+        auto di = lidar->GetDIBuffer();
+        host_data = di->Buffer.get();
+        m_hostBuffer = di;
+    } else if (auto depth_camera = std::dynamic_pointer_cast<ChCpuDepthCamera>(m_cpuSensor)) {
+        auto depth = depth_camera->GetDepthBuffer();
+        host_data = depth->Buffer.get();
+        m_hostBuffer = depth;
+    } else if (auto radar = std::dynamic_pointer_cast<ChCpuRadarSensor>(m_cpuSensor)) {
+        auto returns = radar->GetRadarBuffer();
+        host_data = returns->Buffer.get();
+        m_hostBuffer = returns;
+    }
+
+    cudaMemcpyAsync(m_bufferOutData, host_data, m_pixelSize * m_bufferOut->Width * m_bufferOut->Height,
+                    cudaMemcpyHostToDevice, m_cuda_stream);
+
+    m_bufferOut->LaunchedCount = pOptixSensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = m_time_stamp;
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,73 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Filter generating the data of an OptiX sensor with the CPU ray tracing backend
+//
+// =============================================================================
+
+#ifndef CHFILTERCPURENDER_H
+#define CHFILTERCPURENDER_H
+
+#include <memory>
+
+#include "chrono_sensor/cpu/ChCpuRayScene.h"
+#include "chrono_sensor/cpu/ChCpuRaySensors.h"
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// A filter that generates data for a ChLidarSensor, ChDepthCamera, or ChRadarSensor with the CPU ray tracing backend.
+/// This filter takes the place of ChFilterOptixRender at the front of the sensor filter graph: the rays of the sensor
+/// are traced through a ChCpuRayScene and the result is copied to a device buffer of the same type as the one produced
+/// by the OptiX render filter, so that the rest of the filter graph is unchanged.
+class CH_SENSOR_API ChFilterCpuRender : public ChFilter {
+  public:
+    /// Class constructor.
+    /// @param scene The scene through which rays are traced (updated by the caller before Apply).
+    ChFilterCpuRender(const ChCpuRayScene* scene);
+
+    virtual ~ChFilterCpuRender() {}
+
+    /// Apply function. Generates data for the sensor.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut A pointer to the process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+    /// Set the time stamp of the next render.
+    void SetTimeStamp(float time) { m_time_stamp = time; }
+
+  private:
+    const ChCpuRayScene* m_scene;                 ///< scene through which rays are traced
+    std::weak_ptr<ChOptixSensor> m_optixSensor;   ///< for holding a weak reference to parent sensor
+    std::shared_ptr<ChCpuRaySensor> m_cpuSensor;  ///< CPU sensor generating the rays of the parent sensor
+    std::shared_ptr<SensorBuffer> m_hostBuffer;   ///< last host buffer (kept alive until the copy completes)
+    std::shared_ptr<SensorBuffer> m_bufferOut;    ///< device buffer passed to the next filters
+    void* m_bufferOutData;                        ///< device memory of the output buffer
+    size_t m_pixelSize;                           ///< size of an element of the output buffer
+    CUstream m_cuda_stream;                       ///< reference to a cuda stream
+    float m_time_stamp;                           ///< time stamp for when the data (render) was launched
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -1,5 +1,7 @@
 #include "chrono_synchrono/SynChronoManager.h"
 
+#include <algorithm>
+
 #include "chrono_synchrono/SynConfig.h"
 #include "chrono_synchrono/utils/SynLog.h"
 #include "chrono_synchrono/agent/SynAgentFactory.h"
@@ -53,7 +55,11 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
       m_time_update(0),
       m_time_msg_gather(0),
       m_time_communication(0),
-      m_time_msg_process(0) {
+      m_time_msg_process(0),
+      m_num_bytes_sent(0),
+      m_num_bytes_received(0),
+      m_total_bytes_sent(0),
+      m_total_bytes_received(0) {
     if (communicator)
         SetCommunicator(communicator);
 
@@ -195,6 +201,7 @@ void SynChronoManager::Synchronize(double time) {
     m_timer_msg_gather.start();
     SynMessageList messages = GatherMessages();
     m_communicator->AddOutgoingMessages(messages);
+    UpdateInterestRegion();
     m_timer_msg_gather.stop();
 
     // Send the messages out to each node and receive any other messages
@@ -216,6 +223,12 @@ void SynChronoManager::Synchronize(double time) {
     m_time_communication += m_timer_communication();
     m_time_msg_process += m_timer_msg_process();
 
+    // Accumulate communication volume
+    m_num_bytes_sent = m_communicator->GetNumBytesSent();
+    m_num_bytes_received = m_communicator->GetNumBytesReceived();
+    m_total_bytes_sent += m_num_bytes_sent;
+    m_total_bytes_received += m_num_bytes_received;
+
     // Reset
     m_communicator->Reset();     // Reset the communicator
     m_messages.clear();          // clean the message map
@@ -241,6 +254,9 @@ void SynChronoManager::PrintStepStatistics(std::ostream& os) const {
     os << "   Msg. generation: " << 1e3 * m_timer_msg_gather() << "  [" << m_time_msg_gather << "]" << std::endl;
     os << "   Communication:   " << 1e3 * m_timer_communication() << "  [" << m_time_communication << "]" << std::endl;
     os << "   Msg. processing: " << 1e3 * m_timer_msg_process() << "  [" << m_time_msg_process << "]" << std::endl;
+    os << " Communication (bytes [total]):" << std::endl;
+    os << "   Sent:            " << m_num_bytes_sent << "  [" << m_total_bytes_sent << "]" << std::endl;
+    os << "   Received:        " << m_num_bytes_received << "  [" << m_total_bytes_received << "]" << std::endl;
 }
 
 // --------------------------------------------------------------------------------------------------------------
@@ -252,6 +268,14 @@ SynMessageList SynChronoManager::GatherMessages() {
     for (auto& agent_pair : m_agents)
         agent_pair.second->GatherMessages(messages);
 
+    // Ask for keyframes from the sources of delta-encoded states which could not be decoded
+    if (!m_keyframe_requests.empty()) {
+        auto request = chrono_types::make_shared<SynSimulationMessage>(AgentKey(m_node_id, 0), AgentKey());
+        request->m_keyframe_requests = m_keyframe_requests;
+        messages.push_back(request);
+        m_keyframe_requests.clear();
+    }
+
     return messages;
 }
 
@@ -265,6 +289,30 @@ SynMessageList SynChronoManager::GatherDescriptionMessages() {
     return messages;
 }
 
+void SynChronoManager::UpdateInterestRegion() {
+    if (m_agents.empty())
+        return;
+
+    std::vector<ChVector3d> locations;
+    for (auto& agent_pair : m_agents) {
+        ChVector3d location;
+        if (!agent_pair.second->GetLocation(location))
+            return;
+        locations.push_back(location);
+    }
+
+    ChVector3d center(0);
+    for (const auto& location : locations)
+        center += location;
+    center /= (double)locations.size();
+
+    double radius = 0;
+    for (const auto& location : locations)
+        radius = std::max(radius, (location - center).Length());
+
+    m_communicator->SetInterestRegion(center, radius);
+}
+
 void SynChronoManager::ProcessReceivedMessages() {
     // get the message buffer from the underlying communicator
     SynMessageList messages = m_communicator->GetMessages();
@@ -273,7 +321,24 @@ void SynChronoManager::ProcessReceivedMessages() {
         if (message->GetMessageType() == SynFlatBuffers::Type_Simulation_State) {
             auto sim_msg = std::dynamic_pointer_cast<SynSimulationMessage>(message);
             m_is_ok = !(sim_msg->m_quit_sim);
+
+            // Send a keyframe with the next state of the requested agents on this node
+            for (const auto& key : sim_msg->m_keyframe_requests) {
+                auto agent = m_agents.find(key);
+                if (agent != m_agents.end())
+                    agent->second->RequestKeyframe();
+            }
         } else {
+            // Reconstruct the message content (e.g. delta-encoded states); drop undecodable messages and request a
+            // keyframe from their source
+            auto zombie = m_zombies.find(message->GetSourceKey());
+            if (zombie != m_zombies.end() && zombie->second && !zombie->second->DecodeMessage(message)) {
+                if (std::find(m_keyframe_requests.begin(), m_keyframe_requests.end(), message->GetSourceKey()) ==
+                    m_keyframe_requests.end())
+                    m_keyframe_requests.push_back(message->GetSourceKey());
+                continue;
+            }
+
             for (const auto& agent_pair : m_agents)
                 m_messages[agent_pair.second].push_back(message);
         }
@@ -86,9 +86,17 @@ class SYN_API SynChronoManager {
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
-    /// @brief Print timing information (over last step and cumulative)
+    /// @brief Print timing and communication information (over last step and cumulative)
     void PrintStepStatistics(std::ostream& os) const;
 
+    /// @brief Get the number of bytes sent and received during the last synchronization
+    size_t GetNumBytesSent() const { return m_num_bytes_sent; }
+    size_t GetNumBytesReceived() const { return m_num_bytes_received; }
+
+    /// @brief Get the cumulative number of bytes sent and received
+    size_t GetTotalBytesSent() const { return m_total_bytes_sent; }
+    size_t GetTotalBytesReceived() const { return m_total_bytes_received; }
+
   private:
     // These methods are only available to derived classes.
     // This decision was made to ensure agents are responsible for message generation,
@@ -128,6 +136,11 @@ class SYN_API SynChronoManager {
     ///
     void DistributeMessages();
 
+    ///@brief Provide the communicator with the region occupied by the agents on this node (for interest management)
+    /// No region is provided if any of the agents does not have a well-defined location.
+    ///
+    void UpdateInterestRegion();
+
     ///@brief Create a agents from description messages
     /// During the initialization phase, description messages of each agent in the simulation is passed.
     /// This method uses those descriptions to create new agents and store them in the proper location
@@ -156,10 +169,16 @@ class SYN_API SynChronoManager {
     double m_time_communication;  ///< cummulative time for communication
     double m_time_msg_process;    ///< cumulative time for processing received messages
 
+    size_t m_num_bytes_sent;        ///< number of bytes sent during last synchronization
+    size_t m_num_bytes_received;    ///< number of bytes received during last synchronization
+    size_t m_total_bytes_sent;      ///< cumulative number of bytes sent
+    size_t m_total_bytes_received;  ///< cumulative number of bytes received
+
     int m_num_managed_agents = 0;                                    ///< Number of agents managed by this node
     std::map<AgentKey, std::shared_ptr<SynAgent>> m_agents;          ///< Agents in the SynChrono world on this node
     std::map<AgentKey, std::shared_ptr<SynAgent>> m_zombies;         ///< Agents in the SynChrono world not on this node
     std::map<std::shared_ptr<SynAgent>, SynMessageList> m_messages;  ///< Messages associated with each agent
+    std::vector<AgentKey> m_keyframe_requests;                       ///< Agents to request a keyframe from
 
     std::shared_ptr<SynCommunicator> m_communicator;  ///< Underlying communicator used for inter-node comm
 };
@@ -60,6 +60,19 @@ class SYN_API SynAgent {
     ///@param message the message to process and is used to update the position of the zombie
     virtual void SynchronizeZombie(std::shared_ptr<SynMessage> message) = 0;
 
+    ///@brief Reconstruct the full content of a message received from this zombie (e.g. a delta-encoded state)
+    /// Called once for each received message, before the message is distributed to the agents on this node.
+    /// Messages which cannot be decoded are dropped and a keyframe is requested from the source agent.
+    ///
+    ///@param message the received message
+    ///@return false if the message cannot be decoded
+    virtual bool DecodeMessage(std::shared_ptr<SynMessage> message) { return true; }
+
+    ///@brief Send the full state with the next state message
+    /// Called when another node could not decode a delta-encoded state message from this agent.
+    ///
+    virtual void RequestKeyframe() {}
+
     ///@brief Update this agent
     /// Typically used to update the state representation of the agent to be distributed to other agents
     ///
@@ -87,6 +100,13 @@ class SYN_API SynAgent {
     ///@param zombie the new zombie
     virtual void RegisterZombie(std::shared_ptr<SynAgent> zombie) {}
 
+    ///@brief Get the current location of this agent, used for interest management
+    /// Agents without a well-defined location (e.g. terrain or environment agents) return false, in which case the
+    /// messages of their node are exchanged with all other nodes.
+    ///
+    ///@param location the current location of this agent
+    virtual bool GetLocation(ChVector3d& location) const { return false; }
+
     // -------------------------------------------------------------------------
 
     void SetProcessMessageCallback(std::function<void(std::shared_ptr<SynMessage>)> callback);
@@ -42,9 +42,20 @@ SynSCMTerrainAgent::~SynSCMTerrainAgent() {}
 void SynSCMTerrainAgent::InitializeZombie(ChSystem* system) {}
 
 void SynSCMTerrainAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
-    if (auto state = std::dynamic_pointer_cast<SynSCMMessage>(message))
-        if (m_terrain)
-            m_terrain->SetModifiedNodes(state->modified_nodes);
+    auto state = std::dynamic_pointer_cast<SynSCMMessage>(message);
+    if (!state || !m_terrain)
+        return;
+
+    if (!state->IsCompact()) {
+        m_terrain->SetModifiedNodes(state->modified_nodes);
+        return;
+    }
+
+    // Compact messages carry levels relative to the initial terrain
+    auto nodes = state->modified_nodes;
+    for (auto& n : nodes)
+        n.second += m_terrain->GetInitNodeLevel(n.first);
+    m_terrain->SetModifiedNodes(nodes);
 }
 
 void SynSCMTerrainAgent::Update() {
@@ -55,8 +66,15 @@ void SynSCMTerrainAgent::Update() {
 
     m_message->modified_nodes.clear();
     m_message->modified_nodes.reserve(m_modified_nodes.size());
-    for (const auto& v : m_modified_nodes)
-        m_message->modified_nodes.push_back(std::make_pair(v.first, v.second));
+    if (m_message->IsCompact()) {
+        for (const auto& v : m_modified_nodes) {
+            double level = v.second - m_terrain->GetInitNodeLevel(v.first);
+            m_message->modified_nodes.push_back(std::make_pair(v.first, level));
+        }
+    } else {
+        for (const auto& v : m_modified_nodes)
+            m_message->modified_nodes.push_back(std::make_pair(v.first, v.second));
+    }
 }
 
 void SynSCMTerrainAgent::GatherMessages(SynMessageList& messages) {
@@ -101,6 +101,14 @@ class SYN_API SynSCMTerrainAgent : public SynAgent {
     ///
     virtual void SetKey(AgentKey agent_key) override;
 
+    ///@brief Enable compact encoding of the terrain deformation messages sent by this agent
+    /// Modified nodes are sent as run-length coded grid indices and levels relative to the initial (undeformed)
+    /// terrain, quantized with the given resolution. See SynSCMMessage::SetCompactEncoding.
+    ///
+    ///@param resolution quantization step for the node levels (a non-positive value disables compact encoding)
+    ///@param pack if true, additionally pack the encoded data as variable-length integers
+    void SetCompactEncoding(double resolution, bool pack = false) { m_message->SetCompactEncoding(resolution, pack); }
+
   private:
     /// There is no STL default for hashing a pair of ints, but the SCM grid is indexed with integers, so we store diffs
     /// using a map of that format.
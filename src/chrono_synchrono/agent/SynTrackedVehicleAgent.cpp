@@ -116,6 +116,14 @@ void SynTrackedVehicleAgent::Update() {
     m_state->SetState(time, chassis, track_shoes, sprockets, idlers, road_wheels);
 }
 
+bool SynTrackedVehicleAgent::GetLocation(ChVector3d& location) const {
+    if (!m_vehicle)
+        return false;
+
+    location = m_vehicle->GetPos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynTrackedVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::string& filename) {
@@ -119,6 +119,10 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
         m_description->SetNumAssemblyComponents(num_track_shoes, num_sprockets, num_idlers, num_road_wheels);
     }
 
+    ///@brief Get the current location of the vehicle
+    ///
+    virtual bool GetLocation(ChVector3d& location) const override;
+
     ///@brief Set the Agent ID
     ///
     virtual void SetKey(AgentKey agent_key) override;
@@ -78,6 +78,21 @@ void SynWheeledVehicleAgent::InitializeZombie(ChSystem* system) {
     }
 }
 
+bool SynWheeledVehicleAgent::DecodeMessage(std::shared_ptr<SynMessage> message) {
+    if (auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
+        // Reconstruct delta-encoded states from the last keyframe
+        if (state->IsDelta())
+            return m_keyframe && state->Decode(*m_keyframe);
+        if (state->IsKeyframe())
+            m_keyframe = state;
+    }
+    return true;
+}
+
+void SynWheeledVehicleAgent::RequestKeyframe() {
+    m_state->RequestKeyframe();
+}
+
 void SynWheeledVehicleAgent::SynchronizeZombie(std::shared_ptr<SynMessage> message) {
     if (auto state = std::dynamic_pointer_cast<SynWheeledVehicleStateMessage>(message)) {
         m_zombie_body->SetFrameRefToAbs(state->chassis.GetFrame());
@@ -115,6 +130,14 @@ void SynWheeledVehicleAgent::Update() {
     m_state->SetState(time, chassis, wheels);
 }
 
+bool SynWheeledVehicleAgent::GetLocation(ChVector3d& location) const {
+    if (!m_vehicle)
+        return false;
+
+    location = m_vehicle->GetPos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynWheeledVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::string& filename) {
@@ -61,6 +61,16 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///@param message the message to process and is used to update the position of the zombie
     virtual void SynchronizeZombie(std::shared_ptr<SynMessage> message) override;
 
+    ///@brief Reconstruct delta-encoded state messages from the last received keyframe
+    ///
+    ///@param message the received message
+    ///@return false if the message is a delta-encoded state and the keyframe it refers to was not received
+    virtual bool DecodeMessage(std::shared_ptr<SynMessage> message) override;
+
+    ///@brief Send the full state with the next state message
+    ///
+    virtual void RequestKeyframe() override;
+
     ///@brief Update this agent
     /// Typically used to update the state representation of the agent to be distributed to other agents
     ///
@@ -101,6 +111,16 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     ///@param num_wheels number of wheels of the underlying vehicle
     void SetNumWheels(int num_wheels) { m_description->SetNumWheels(num_wheels); }
 
+    ///@brief Enable delta encoding of the state messages of this agent (default: disabled)
+    /// See SynWheeledVehicleStateMessage::SetDeltaEncoding.
+    ///
+    ///@param keyframe_interval number of messages between full state messages
+    void SetDeltaEncoding(int keyframe_interval) { m_state->SetDeltaEncoding(keyframe_interval); }
+
+    ///@brief Get the current location of the vehicle
+    ///
+    virtual bool GetLocation(ChVector3d& location) const override;
+
     ///@brief Set the Agent ID
     ///
     virtual void SetKey(AgentKey agent_key) override;
@@ -128,6 +148,8 @@ class SYN_API SynWheeledVehicleAgent : public SynAgent {
     std::shared_ptr<SynWheeledVehicleDescriptionMessage>
         m_description;  ///< Description for zombie creation on discovery
 
+    std::shared_ptr<SynWheeledVehicleStateMessage> m_keyframe;  ///< last received full state (zombie only)
+
     std::shared_ptr<ChBodyAuxRef> m_zombie_body;              ///< agent's zombie body reference
     std::vector<std::shared_ptr<ChBodyAuxRef>> m_wheel_list;  ///< vector of this agent's zombie wheels
 };
@@ -27,7 +27,7 @@
 namespace chrono {
 namespace synchrono {
 
-SynCommunicator::SynCommunicator() : m_initialized(false) {}
+SynCommunicator::SynCommunicator() : m_initialized(false), m_num_bytes_sent(0), m_num_bytes_received(0) {}
 
 SynCommunicator::~SynCommunicator() {}
 
@@ -39,6 +39,8 @@ void SynCommunicator::Initialize() {
 
 void SynCommunicator::Reset() {
     m_incoming_messages.clear();
+    m_num_bytes_sent = 0;
+    m_num_bytes_received = 0;
 }
 
 void SynCommunicator::AddOutgoingMessages(SynMessageList& messages) {
@@ -58,6 +60,7 @@ void SynCommunicator::AddIncomingMessages(SynMessageList& messages) {
 }
 
 void SynCommunicator::ProcessBuffer(std::vector<uint8_t>& data) {
+    m_num_bytes_received += data.size();
     m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
 }
 
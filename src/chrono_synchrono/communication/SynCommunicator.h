@@ -72,7 +72,7 @@ class SYN_API SynCommunicator {
     // -----------------------------------------------------------------------------------------------
 
     ///@brief Reset the communicator
-    /// Will clear out message buffers
+    /// Will clear out message buffers and byte counters
     ///
     void Reset();
 
@@ -99,11 +99,30 @@ class SYN_API SynCommunicator {
     ///@return SynMessageList the received messages
     virtual SynMessageList& GetMessages() { return m_incoming_messages; }
 
+    ///@brief Set the region occupied by the agents on this node, as a bounding sphere
+    /// Only used by communicators which support interest management (ignored otherwise). The region applies to the
+    /// next call to Synchronize only; if not set, this node exchanges messages with all other nodes.
+    ///
+    ///@param center the center of the bounding sphere
+    ///@param radius the radius of the bounding sphere
+    virtual void SetInterestRegion(const ChVector3d& center, double radius) {}
+
+    ///@brief Get the number of bytes sent since the last reset
+    ///
+    size_t GetNumBytesSent() const { return m_num_bytes_sent; }
+
+    ///@brief Get the number of bytes received since the last reset
+    ///
+    size_t GetNumBytesReceived() const { return m_num_bytes_received; }
+
     // -----------------------------------------------------------------------------------------------
 
   protected:
     bool m_initialized;  ///< whether the communicator has been initialized
 
+    size_t m_num_bytes_sent;      ///< number of bytes sent since the last reset
+    size_t m_num_bytes_received;  ///< number of bytes received since the last reset
+
     SynMessageList m_incoming_messages;           ///< Incoming messages
     SynFlatBuffersManager m_flatbuffers_manager;  ///< flatbuffer manager for this rank
 };
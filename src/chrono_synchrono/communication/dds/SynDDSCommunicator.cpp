@@ -317,8 +317,10 @@ void SynDDSCommunicator::Publish() {
     SynDDSMessage msg;
     msg.data(m_flatbuffers_manager.ToMessageBuffer());
 
-    for (auto publisher : m_publishers)
+    for (auto publisher : m_publishers) {
         publisher->Publish(&msg);
+        m_num_bytes_sent += msg.data().size();
+    }
 
     m_flatbuffers_manager.Reset();
 }
@@ -23,10 +23,17 @@
 
 #include "chrono_synchrono/communication/mpi/SynMPICommunicator.h"
 
+#include <algorithm>
+
 namespace chrono {
 namespace synchrono {
 
-SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
+// Information exchanged by each rank before the messages: message length, interest radius, interest region flag,
+// interest region center (x, y, z), and interest region radius
+static const int info_size = 7;
+
+SynMPICommunicator::SynMPICommunicator(int argc, char* argv[])
+    : m_interest_radius(0), m_has_region(false), m_region_center(VNULL), m_region_radius(0) {
     // mpi initialization
     MPI_Init(&argc, &argv);
     // set rank
@@ -38,6 +45,9 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+
+    m_rank_info.resize(m_num_ranks * info_size);
+    m_requests.reserve(2 * m_num_ranks);
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
@@ -47,22 +57,47 @@ SynMPICommunicator::~SynMPICommunicator() {
     MPI_Finalize();
 }
 
+void SynMPICommunicator::SetInterestRegion(const ChVector3d& center, double radius) {
+    m_has_region = true;
+    m_region_center = center;
+    m_region_radius = radius;
+}
+
+bool SynMPICommunicator::AreInterested(int rank_a, int rank_b) const {
+    const double* info_a = &m_rank_info[rank_a * info_size];
+    const double* info_b = &m_rank_info[rank_b * info_size];
+
+    // Ranks without an interest region exchange messages with everybody
+    if (info_a[2] == 0 || info_b[2] == 0)
+        return true;
+
+    double radius = std::max(info_a[1], info_b[1]);
+    ChVector3d d(info_a[3] - info_b[3], info_a[4] - info_b[4], info_a[5] - info_b[5]);
+    return d.Length() <= radius + info_a[6] + info_b[6];
+}
+
 void SynMPICommunicator::Synchronize() {
     m_flatbuffers_manager.Finish();
 
     int msg_length = m_flatbuffers_manager.GetSize();
 
-    // Get the length of message from each agent
-    MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
-                  m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
-                  MPI_COMM_WORLD);            // Receiving rank and world
+    // Get the length of message and the interest region from each rank
+    double info[info_size] = {(double)msg_length,  m_interest_radius,   m_has_region ? 1.0 : 0.0, m_region_center.x(),
+                              m_region_center.y(), m_region_center.z(), m_region_radius};
+    MPI_Allgather(info, info_size, MPI_DOUBLE,                 // Sending pointer, length, type
+                  m_rank_info.data(), info_size, MPI_DOUBLE,  // Receiving pointer, length, type
+                  MPI_COMM_WORLD);                            // Receiving rank and world
 
-    m_total_length = 0;
+    // Interest management is used only if enabled on all ranks (all ranks reach the same decision)
+    bool use_interest = true;
+    for (int i = 0; i < m_num_ranks; i++)
+        use_interest = use_interest && m_rank_info[i * info_size + 1] > 0;
 
-    // In C++17 this could just be an exclusive scan from std::
-    // Didn't use std::partial_sum since we want m_total_length computed
-    // m_msg_displs is needed by MPI_Gatherv
+    // In interest management mode, only messages from interested ranks are received
+    m_total_length = 0;
     for (int i = 0; i < m_num_ranks; i++) {
+        bool receive = !use_interest || (i != m_rank && AreInterested(m_rank, i));
+        m_msg_lengths[i] = receive ? (int)m_rank_info[i * info_size] : 0;
         m_msg_displs[i] = m_total_length;
         m_total_length += m_msg_lengths[i];
     }
@@ -70,19 +105,47 @@ void SynMPICommunicator::Synchronize() {
     // if (m_rank == 0)
     //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
 
-    m_all_data.reserve(m_total_length);
+    m_all_data.resize(m_total_length);
+
+    if (use_interest) {
+        // Point-to-point exchange with interested ranks
+        m_requests.clear();
+        for (int i = 0; i < m_num_ranks; i++) {
+            if (i == m_rank || !AreInterested(m_rank, i))
+                continue;
+
+            m_requests.push_back(MPI_REQUEST_NULL);
+            MPI_Irecv(m_all_data.data() + m_msg_displs[i], m_msg_lengths[i], MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                      &m_requests.back());
+
+            m_requests.push_back(MPI_REQUEST_NULL);
+            MPI_Isend(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE, i, 0, MPI_COMM_WORLD,
+                      &m_requests.back());
+
+            m_num_bytes_sent += msg_length;
+            m_num_bytes_received += m_msg_lengths[i];
+        }
+
+        MPI_Waitall((int)m_requests.size(), m_requests.data(), MPI_STATUSES_IGNORE);
+    } else {
+        MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
+                       m_all_data.data(), m_msg_lengths, m_msg_displs,
+                       MPI_BYTE,  // Receiving pointer, lengths, displacements, type
+                       MPI_COMM_WORLD);
+
+        m_num_bytes_sent += (size_t)msg_length * (m_num_ranks - 1);
+        m_num_bytes_received += m_total_length - msg_length;
+    }
 
-    MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
-                   m_all_data.data(), m_msg_lengths, m_msg_displs,
-                   MPI_BYTE,  // Receiving pointer, lengths, displacements, type
-                   MPI_COMM_WORLD);
+    // The interest region must be provided again for the next synchronization
+    m_has_region = false;
 
     m_flatbuffers_manager.Reset();
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
     for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
+        if (i != m_rank && m_msg_lengths[i] > 0) {
             std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
                                                              m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
             m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
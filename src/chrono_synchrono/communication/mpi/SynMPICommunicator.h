@@ -83,9 +83,28 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual unsigned int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Set the interest radius (default: 0, interest management disabled)
+    /// If positive on all ranks, messages are exchanged point-to-point, and only between ranks whose interest regions
+    /// (see SetInterestRegion) are within this distance of each other. Ranks which did not set an interest region for
+    /// the current synchronization exchange messages with all other ranks.
+    ///
+    ///@param radius the interest radius
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Set the region occupied by the agents on this rank, as a bounding sphere
+    /// Only used if interest management is enabled. Applies to the next call to Synchronize only.
+    ///
+    ///@param center the center of the bounding sphere
+    ///@param radius the radius of the bounding sphere
+    virtual void SetInterestRegion(const ChVector3d& center, double radius) override;
+
     // -----------------------------------------------------------------------------------------------
 
   private:
+    ///@brief Check whether the two specified ranks exchange messages in interest management mode
+    ///
+    bool AreInterested(int rank_a, int rank_b) const;
+
     int m_rank;
     int m_num_ranks;
 
@@ -94,6 +113,14 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     int* m_msg_lengths;
     int* m_msg_displs;
 
+    double m_interest_radius;    ///< interest radius (interest management disabled if not positive)
+    bool m_has_region;           ///< whether an interest region was set for the next synchronization
+    ChVector3d m_region_center;  ///< center of the interest region of this rank
+    double m_region_radius;      ///< radius of the interest region of this rank
+
+    std::vector<double> m_rank_info;      ///< message length and interest region of all ranks
+    std::vector<MPI_Request> m_requests;  ///< pending point-to-point requests
+
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
 };
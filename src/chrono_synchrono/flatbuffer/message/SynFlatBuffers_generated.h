@@ -873,17 +873,29 @@ namespace WheeledVehicle {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     typedef StateBuilder Builder;
-    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_TIME = 4, VT_CHASSIS = 6, VT_WHEELS = 8 };
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+        VT_TIME = 4,
+        VT_CHASSIS = 6,
+        VT_WHEELS = 8,
+        VT_SEQ = 10,
+        VT_REF_SEQ = 12,
+        VT_DELTA = 14
+    };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const SynFlatBuffers::Pose* chassis() const { return GetPointer<const SynFlatBuffers::Pose*>(VT_CHASSIS); }
     const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels() const {
         return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>*>(VT_WHEELS);
     }
+    uint32_t seq() const { return GetField<uint32_t>(VT_SEQ, 0); }
+    uint32_t ref_seq() const { return GetField<uint32_t>(VT_REF_SEQ, 0); }
+    const flatbuffers::Vector<float>* delta() const { return GetPointer<const flatbuffers::Vector<float>*>(VT_DELTA); }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
                VerifyOffset(verifier, VT_CHASSIS) && verifier.VerifyTable(chassis()) &&
                VerifyOffset(verifier, VT_WHEELS) && verifier.VerifyVector(wheels()) &&
-               verifier.VerifyVectorOfTables(wheels()) && verifier.EndTable();
+               verifier.VerifyVectorOfTables(wheels()) && VerifyField<uint32_t>(verifier, VT_SEQ) &&
+               VerifyField<uint32_t>(verifier, VT_REF_SEQ) && VerifyOffset(verifier, VT_DELTA) &&
+               verifier.VerifyVector(delta()) && verifier.EndTable();
     }
 };
 
@@ -896,6 +908,9 @@ struct StateBuilder {
     void add_wheels(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels) {
         fbb_.AddOffset(State::VT_WHEELS, wheels);
     }
+    void add_seq(uint32_t seq) { fbb_.AddElement<uint32_t>(State::VT_SEQ, seq, 0); }
+    void add_ref_seq(uint32_t ref_seq) { fbb_.AddElement<uint32_t>(State::VT_REF_SEQ, ref_seq, 0); }
+    void add_delta(flatbuffers::Offset<flatbuffers::Vector<float>> delta) { fbb_.AddOffset(State::VT_DELTA, delta); }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -908,9 +923,15 @@ inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<SynFlatBuffers::Pose>>> wheels = 0,
+    uint32_t seq = 0,
+    uint32_t ref_seq = 0,
+    flatbuffers::Offset<flatbuffers::Vector<float>> delta = 0) {
     StateBuilder builder_(_fbb);
     builder_.add_time(time);
+    builder_.add_delta(delta);
+    builder_.add_ref_seq(ref_seq);
+    builder_.add_seq(seq);
     builder_.add_wheels(wheels);
     builder_.add_chassis(chassis);
     return builder_.Finish();
@@ -920,9 +941,13 @@ inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
     flatbuffers::Offset<SynFlatBuffers::Pose> chassis = 0,
-    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels = nullptr) {
+    const std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>>* wheels = nullptr,
+    uint32_t seq = 0,
+    uint32_t ref_seq = 0,
+    const std::vector<float>* delta = nullptr) {
     auto wheels__ = wheels ? _fbb.CreateVector<flatbuffers::Offset<SynFlatBuffers::Pose>>(*wheels) : 0;
-    return SynFlatBuffers::Agent::WheeledVehicle::CreateState(_fbb, time, chassis, wheels__);
+    auto delta__ = delta ? _fbb.CreateVector<float>(*delta) : 0;
+    return SynFlatBuffers::Agent::WheeledVehicle::CreateState(_fbb, time, chassis, wheels__, seq, ref_seq, delta__);
 }
 
 struct Description FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1734,14 +1759,34 @@ namespace SCM {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     typedef StateBuilder Builder;
-    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_TIME = 4, VT_NODES = 6 };
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+        VT_TIME = 4,
+        VT_NODES = 6,
+        VT_RESOLUTION = 8,
+        VT_RUNS = 10,
+        VT_LEVELS = 12,
+        VT_PACKED = 14
+    };
     double time() const { return GetField<double>(VT_TIME, 0.0); }
     const flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>* nodes() const {
         return GetPointer<const flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>*>(VT_NODES);
     }
+    double resolution() const { return GetField<double>(VT_RESOLUTION, 0.0); }
+    const flatbuffers::Vector<int32_t>* runs() const {
+        return GetPointer<const flatbuffers::Vector<int32_t>*>(VT_RUNS);
+    }
+    const flatbuffers::Vector<int16_t>* levels() const {
+        return GetPointer<const flatbuffers::Vector<int16_t>*>(VT_LEVELS);
+    }
+    const flatbuffers::Vector<uint8_t>* packed() const {
+        return GetPointer<const flatbuffers::Vector<uint8_t>*>(VT_PACKED);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
         return VerifyTableStart(verifier) && VerifyField<double>(verifier, VT_TIME) &&
-               VerifyOffset(verifier, VT_NODES) && verifier.VerifyVector(nodes()) && verifier.EndTable();
+               VerifyOffset(verifier, VT_NODES) && verifier.VerifyVector(nodes()) &&
+               VerifyField<double>(verifier, VT_RESOLUTION) && VerifyOffset(verifier, VT_RUNS) &&
+               verifier.VerifyVector(runs()) && VerifyOffset(verifier, VT_LEVELS) && verifier.VerifyVector(levels()) &&
+               VerifyOffset(verifier, VT_PACKED) && verifier.VerifyVector(packed()) && verifier.EndTable();
     }
 };
 
@@ -1753,6 +1798,14 @@ struct StateBuilder {
     void add_nodes(flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>> nodes) {
         fbb_.AddOffset(State::VT_NODES, nodes);
     }
+    void add_resolution(double resolution) { fbb_.AddElement<double>(State::VT_RESOLUTION, resolution, 0.0); }
+    void add_runs(flatbuffers::Offset<flatbuffers::Vector<int32_t>> runs) { fbb_.AddOffset(State::VT_RUNS, runs); }
+    void add_levels(flatbuffers::Offset<flatbuffers::Vector<int16_t>> levels) {
+        fbb_.AddOffset(State::VT_LEVELS, levels);
+    }
+    void add_packed(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed) {
+        fbb_.AddOffset(State::VT_PACKED, packed);
+    }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -1764,9 +1817,17 @@ struct StateBuilder {
 inline flatbuffers::Offset<State> CreateState(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
-    flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>> nodes = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<const SynFlatBuffers::Terrain::SCM::NodeLevel*>> nodes = 0,
+    double resolution = 0.0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> runs = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int16_t>> levels = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> packed = 0) {
     StateBuilder builder_(_fbb);
+    builder_.add_resolution(resolution);
     builder_.add_time(time);
+    builder_.add_packed(packed);
+    builder_.add_levels(levels);
+    builder_.add_runs(runs);
     builder_.add_nodes(nodes);
     return builder_.Finish();
 }
@@ -1774,9 +1835,16 @@ inline flatbuffers::Offset<State> CreateState(
 inline flatbuffers::Offset<State> CreateStateDirect(
     flatbuffers::FlatBufferBuilder& _fbb,
     double time = 0.0,
-    const std::vector<SynFlatBuffers::Terrain::SCM::NodeLevel>* nodes = nullptr) {
+    const std::vector<SynFlatBuffers::Terrain::SCM::NodeLevel>* nodes = nullptr,
+    double resolution = 0.0,
+    const std::vector<int32_t>* runs = nullptr,
+    const std::vector<int16_t>* levels = nullptr,
+    const std::vector<uint8_t>* packed = nullptr) {
     auto nodes__ = nodes ? _fbb.CreateVectorOfStructs<SynFlatBuffers::Terrain::SCM::NodeLevel>(*nodes) : 0;
-    return SynFlatBuffers::Terrain::SCM::CreateState(_fbb, time, nodes__);
+    auto runs__ = runs ? _fbb.CreateVector<int32_t>(*runs) : 0;
+    auto levels__ = levels ? _fbb.CreateVector<int16_t>(*levels) : 0;
+    auto packed__ = packed ? _fbb.CreateVector<uint8_t>(*packed) : 0;
+    return SynFlatBuffers::Terrain::SCM::CreateState(_fbb, time, nodes__, resolution, runs__, levels__, packed__);
 }
 
 }  // namespace SCM
@@ -1839,10 +1907,15 @@ namespace Simulation {
 
 struct State FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     typedef StateBuilder Builder;
-    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_QUIT_SIM = 4 };
+    enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE { VT_QUIT_SIM = 4, VT_KEYFRAME_REQUESTS = 6 };
     bool quit_sim() const { return GetField<uint8_t>(VT_QUIT_SIM, 0) != 0; }
+    const flatbuffers::Vector<int32_t>* keyframe_requests() const {
+        return GetPointer<const flatbuffers::Vector<int32_t>*>(VT_KEYFRAME_REQUESTS);
+    }
     bool Verify(flatbuffers::Verifier& verifier) const {
-        return VerifyTableStart(verifier) && VerifyField<uint8_t>(verifier, VT_QUIT_SIM) && verifier.EndTable();
+        return VerifyTableStart(verifier) && VerifyField<uint8_t>(verifier, VT_QUIT_SIM) &&
+               VerifyOffset(verifier, VT_KEYFRAME_REQUESTS) && verifier.VerifyVector(keyframe_requests()) &&
+               verifier.EndTable();
     }
 };
 
@@ -1853,6 +1926,9 @@ struct StateBuilder {
     void add_quit_sim(bool quit_sim) {
         fbb_.AddElement<uint8_t>(State::VT_QUIT_SIM, static_cast<uint8_t>(quit_sim), 0);
     }
+    void add_keyframe_requests(flatbuffers::Offset<flatbuffers::Vector<int32_t>> keyframe_requests) {
+        fbb_.AddOffset(State::VT_KEYFRAME_REQUESTS, keyframe_requests);
+    }
     explicit StateBuilder(flatbuffers::FlatBufferBuilder& _fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
     flatbuffers::Offset<State> Finish() {
         const auto end = fbb_.EndTable(start_);
@@ -1861,12 +1937,22 @@ struct StateBuilder {
     }
 };
 
-inline flatbuffers::Offset<State> CreateState(flatbuffers::FlatBufferBuilder& _fbb, bool quit_sim = false) {
+inline flatbuffers::Offset<State> CreateState(flatbuffers::FlatBufferBuilder& _fbb,
+                                              bool quit_sim = false,
+                                              flatbuffers::Offset<flatbuffers::Vector<int32_t>> keyframe_requests = 0) {
     StateBuilder builder_(_fbb);
+    builder_.add_keyframe_requests(keyframe_requests);
     builder_.add_quit_sim(quit_sim);
     return builder_.Finish();
 }
 
+inline flatbuffers::Offset<State> CreateStateDirect(flatbuffers::FlatBufferBuilder& _fbb,
+                                                    bool quit_sim = false,
+                                                    const std::vector<int32_t>* keyframe_requests = nullptr) {
+    auto keyframe_requests__ = keyframe_requests ? _fbb.CreateVector<int32_t>(*keyframe_requests) : 0;
+    return SynFlatBuffers::Simulation::CreateState(_fbb, quit_sim, keyframe_requests__);
+}
+
 }  // namespace Simulation
 
 struct Buffer FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
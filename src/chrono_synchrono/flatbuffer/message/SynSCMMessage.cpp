@@ -18,6 +18,10 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "chrono_synchrono/flatbuffer/message/SynSCMMessage.h"
 
 using namespace chrono::vehicle;
@@ -28,8 +32,32 @@ namespace synchrono {
 namespace Terrain = SynFlatBuffers::Terrain;
 namespace SCM = SynFlatBuffers::Terrain::SCM;
 
+// Utilities for packing signed integers as zigzag-encoded variable-length integers (7 bits per byte)
+static void PackVarint(std::vector<uint8_t>& buffer, int64_t value) {
+    uint64_t u = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    while (u >= 0x80) {
+        buffer.push_back(static_cast<uint8_t>(u | 0x80));
+        u >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(u));
+}
+
+static int64_t UnpackVarint(const flatbuffers::Vector<uint8_t>* buffer, flatbuffers::uoffset_t& pos) {
+    uint64_t u = 0;
+    int shift = 0;
+    while (pos < buffer->size() && shift < 64) {
+        uint8_t b = buffer->Get(pos++);
+        u |= static_cast<uint64_t>(b & 0x7f) << shift;
+        if (!(b & 0x80))
+            break;
+        shift += 7;
+    }
+    return static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1);
+}
+
 /// Constructors
-SynSCMMessage::SynSCMMessage(AgentKey source_key, AgentKey destination_key) : SynMessage(source_key, destination_key) {}
+SynSCMMessage::SynSCMMessage(AgentKey source_key, AgentKey destination_key)
+    : SynMessage(source_key, destination_key), m_resolution(0), m_pack(false) {}
 
 void SynSCMMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* message) {
     // System of casts from SynFlatBuffers::Message to SynFlatBuffers::Terrain::SCM::State
@@ -42,13 +70,62 @@ void SynSCMMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* messag
     auto terrain_state = message->message_as_Terrain_State();
     auto state = terrain_state->message_as_SCM_State();
 
-    auto nodes_size = state->nodes()->size();
     modified_nodes.clear();
-    modified_nodes.reserve(nodes_size);
-    for (size_t i = 0; i < nodes_size; i++) {
-        auto fb_node = state->nodes()->Get((flatbuffers::uoffset_t)i);
-        auto node = std::make_pair(ChVector2d(fb_node->x(), fb_node->y()), fb_node->level());
-        modified_nodes.push_back(node);
+    m_resolution = state->resolution();
+
+    if (m_resolution > 0 && state->nodes() && state->nodes()->size() > 0) {
+        // Compact encoding fallback: unquantized relative levels
+        auto nodes_size = state->nodes()->size();
+        modified_nodes.reserve(nodes_size);
+        for (size_t i = 0; i < nodes_size; i++) {
+            auto fb_node = state->nodes()->Get((flatbuffers::uoffset_t)i);
+            auto node = std::make_pair(ChVector2i(fb_node->x(), fb_node->y()), fb_node->level());
+            modified_nodes.push_back(node);
+        }
+    } else if (m_resolution > 0) {
+        // Compact encoding: expand the (x, y, length) runs and dequantize the (relative) levels
+        std::vector<int> runs;
+        std::vector<int> levels;
+        if (state->packed() && state->packed()->size() > 0) {
+            auto packed = state->packed();
+            flatbuffers::uoffset_t pos = 0;
+            auto num_runs = UnpackVarint(packed, pos);
+            int x = 0, y = 0, num_levels = 0;
+            for (int64_t r = 0; r < num_runs && pos < packed->size(); r++) {
+                y += (int)UnpackVarint(packed, pos);
+                x += (int)UnpackVarint(packed, pos);
+                int length = (int)UnpackVarint(packed, pos);
+                runs.insert(runs.end(), {x, y, length});
+                num_levels += length;
+            }
+            int q = 0;
+            for (int i = 0; i < num_levels && pos < packed->size(); i++) {
+                q += (int)UnpackVarint(packed, pos);
+                levels.push_back(q);
+            }
+        } else {
+            if (state->runs())
+                runs.assign(state->runs()->begin(), state->runs()->end());
+            if (state->levels())
+                levels.assign(state->levels()->begin(), state->levels()->end());
+        }
+
+        modified_nodes.reserve(levels.size());
+        size_t k = 0;
+        for (size_t r = 0; r + 2 < runs.size(); r += 3) {
+            for (int i = 0; i < runs[r + 2] && k < levels.size(); i++, k++) {
+                auto node = std::make_pair(ChVector2i(runs[r] + i, runs[r + 1]), levels[k] * m_resolution);
+                modified_nodes.push_back(node);
+            }
+        }
+    } else if (state->nodes()) {
+        auto nodes_size = state->nodes()->size();
+        modified_nodes.reserve(nodes_size);
+        for (size_t i = 0; i < nodes_size; i++) {
+            auto fb_node = state->nodes()->Get((flatbuffers::uoffset_t)i);
+            auto node = std::make_pair(ChVector2d(fb_node->x(), fb_node->y()), fb_node->level());
+            modified_nodes.push_back(node);
+        }
     }
 
     this->time = state->time();
@@ -56,12 +133,72 @@ void SynSCMMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* messag
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynSCMMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
-    std::vector<SCM::NodeLevel> modified_nodes;
-    modified_nodes.reserve(this->modified_nodes.size());
-    for (const auto& node : this->modified_nodes)
-        modified_nodes.push_back(SCM::NodeLevel(node.first.x(), node.first.y(), node.second));
+    flatbuffers::Offset<SCM::State> scm_state;
+
+    if (m_resolution > 0) {
+        // Compact encoding: sort nodes by (y, x) and group consecutive x indices into (x, y, length) runs
+        auto sorted = this->modified_nodes;
+        std::sort(sorted.begin(), sorted.end(), [](const SCMTerrain::NodeLevel& a, const SCMTerrain::NodeLevel& b) {
+            return a.first.y() < b.first.y() || (a.first.y() == b.first.y() && a.first.x() < b.first.x());
+        });
+
+        std::vector<int32_t> runs;
+        std::vector<int16_t> levels;
+        levels.reserve(sorted.size());
+        const double q_max = std::numeric_limits<int16_t>::max();
+        bool overflow = false;
+        for (size_t i = 0; i < sorted.size(); i++) {
+            const auto& ij = sorted[i].first;
+            if (i > 0 && ij.y() == sorted[i - 1].first.y() && ij.x() == sorted[i - 1].first.x() + 1)
+                runs.back()++;
+            else
+                runs.insert(runs.end(), {ij.x(), ij.y(), 1});
+            double q = std::round(sorted[i].second / m_resolution);
+            if (std::abs(q) > q_max) {
+                overflow = true;
+                break;
+            }
+            levels.push_back(static_cast<int16_t>(q));
+        }
 
-    auto scm_state = SCM::CreateStateDirect(builder, time, &modified_nodes);
+        if (overflow) {
+            // Some level cannot be quantized: send the (relative) levels unquantized
+            std::vector<SCM::NodeLevel> modified_nodes;
+            modified_nodes.reserve(this->modified_nodes.size());
+            for (const auto& node : this->modified_nodes)
+                modified_nodes.push_back(SCM::NodeLevel(node.first.x(), node.first.y(), node.second));
+
+            scm_state = SCM::CreateStateDirect(builder, time, &modified_nodes, m_resolution);
+        } else if (m_pack) {
+            // Delta-code run origins and levels, then pack as variable-length integers
+            std::vector<uint8_t> packed;
+            packed.reserve(runs.size() + 2 * levels.size());
+            PackVarint(packed, runs.size() / 3);
+            int x = 0, y = 0;
+            for (size_t r = 0; r < runs.size(); r += 3) {
+                PackVarint(packed, runs[r + 1] - y);
+                PackVarint(packed, runs[r] - x);
+                PackVarint(packed, runs[r + 2]);
+                x = runs[r];
+                y = runs[r + 1];
+            }
+            int q = 0;
+            for (auto level : levels) {
+                PackVarint(packed, level - q);
+                q = level;
+            }
+            scm_state = SCM::CreateStateDirect(builder, time, nullptr, m_resolution, nullptr, nullptr, &packed);
+        } else {
+            scm_state = SCM::CreateStateDirect(builder, time, nullptr, m_resolution, &runs, &levels);
+        }
+    } else {
+        std::vector<SCM::NodeLevel> modified_nodes;
+        modified_nodes.reserve(this->modified_nodes.size());
+        for (const auto& node : this->modified_nodes)
+            modified_nodes.push_back(SCM::NodeLevel(node.first.x(), node.first.y(), node.second));
+
+        scm_state = SCM::CreateStateDirect(builder, time, &modified_nodes);
+    }
 
     auto flatbuffer_state = Terrain::CreateState(builder, Terrain::Type::Type_SCM_State, scm_state.Union());
     auto flatbuffer_message =
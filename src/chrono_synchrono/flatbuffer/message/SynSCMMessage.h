@@ -51,7 +51,29 @@ class SYN_API SynSCMMessage : public SynMessage {
     ///@return FlatBufferMessage the constructed flatbuffer message
     virtual FlatBufferMessage ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const override;
 
+    ///@brief Enable the compact encoding of the modified nodes
+    /// Grid indices are run-length coded and node levels are quantized with the given resolution. With compact
+    /// encoding, the levels in modified_nodes must be relative to the initial (undeformed) node levels.
+    /// Quantized levels are stored as 16-bit integers: the error on a received level is at most resolution/2, for
+    /// relative levels up to 32767 * resolution in magnitude. If any relative level exceeds this range, the message
+    /// falls back to unquantized (still relative) levels, without run-length coding.
+    ///
+    ///@param resolution quantization step for the node levels (a non-positive value disables compact encoding)
+    ///@param pack if true, additionally pack the run-length coded indices and levels as variable-length integers
+    void SetCompactEncoding(double resolution, bool pack = false) {
+        m_resolution = resolution;
+        m_pack = pack;
+    }
+
+    ///@brief Whether the levels in modified_nodes are relative to the initial (undeformed) node levels
+    ///
+    bool IsCompact() const { return m_resolution > 0; }
+
     std::vector<vehicle::SCMTerrain::NodeLevel> modified_nodes;
+
+  private:
+    double m_resolution;  ///< quantization step for compact encoding (disabled if non-positive)
+    bool m_pack;          ///< pack compact encoding as variable-length integers (sender only)
 };
 
 /// @} synchrono_flatbuffer
@@ -19,12 +19,27 @@ void SynSimulationMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message*
     m_source_key = AgentKey(message->source_key());
     m_destination_key = AgentKey(message->destination_key());
 
-    m_quit_sim = message->message_as_Simulation_State()->quit_sim();
+    auto state = message->message_as_Simulation_State();
+    m_quit_sim = state->quit_sim();
+
+    m_keyframe_requests.clear();
+    if (auto requests = state->keyframe_requests()) {
+        for (flatbuffers::uoffset_t i = 0; i + 1 < requests->size(); i += 2)
+            m_keyframe_requests.emplace_back(requests->Get(i), requests->Get(i + 1));
+    }
 }
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynSimulationMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
-    auto flatbuffer_state = Simulation::CreateState(builder, m_quit_sim);
+    // Keyframe requests are sent as (node_id, agent_id) pairs
+    std::vector<int32_t> requests;
+    requests.reserve(2 * m_keyframe_requests.size());
+    for (const auto& key : m_keyframe_requests) {
+        requests.push_back(key.GetNodeID());
+        requests.push_back(key.GetAgentID());
+    }
+
+    auto flatbuffer_state = Simulation::CreateStateDirect(builder, m_quit_sim, requests.empty() ? nullptr : &requests);
     auto flatbuffer_message =
         SynFlatBuffers::CreateMessage(builder, SynFlatBuffers::Type_Simulation_State, flatbuffer_state.Union(),
                                       m_source_key.GetFlatbuffersKey(), m_destination_key.GetFlatbuffersKey());  //
@@ -55,6 +55,8 @@ class SYN_API SynSimulationMessage : public SynMessage {
     // ---------------------------------------------------------------
 
     bool m_quit_sim;  ///< Instruction to end the simulation early
+
+    std::vector<AgentKey> m_keyframe_requests;  ///< Agents asked to send a full state with their next message
 };
 
 /// @} synchrono_flatbuffer
@@ -22,19 +22,94 @@
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
+#include <algorithm>
+
 namespace chrono {
 namespace synchrono {
 
 namespace Agent = SynFlatBuffers::Agent;
 namespace WheeledVehicle = SynFlatBuffers::Agent::WheeledVehicle;
 
+// Number of components in a packed pose (position, orientation and their first and second derivatives)
+static const size_t pose_size = 21;
+
+static void PackPose(const ChFrameMoving<>& frame, double* v) {
+    const auto& p = frame.GetPos();
+    const auto& q = frame.GetRot();
+    const auto& p_dt = frame.GetPosDt();
+    const auto& q_dt = frame.GetRotDt();
+    const auto& p_dtdt = frame.GetPosDt2();
+    const auto& q_dtdt = frame.GetRotDt2();
+    double data[pose_size] = {p.x(),      p.y(),      p.z(),      q.e0(),      q.e1(),      q.e2(),      q.e3(),
+                              p_dt.x(),   p_dt.y(),   p_dt.z(),   q_dt.e0(),   q_dt.e1(),   q_dt.e2(),   q_dt.e3(),
+                              p_dtdt.x(), p_dtdt.y(), p_dtdt.z(), q_dtdt.e0(), q_dtdt.e1(), q_dtdt.e2(), q_dtdt.e3()};
+    std::copy(data, data + pose_size, v);
+}
+
+static void UnpackPose(const double* v, ChFrameMoving<>& frame) {
+    ChQuaternion<> q(v[3], v[4], v[5], v[6]);
+    q.Normalize();
+    frame = ChFrameMoving<>(ChVector3d(v[0], v[1], v[2]), q);
+    frame.SetPosDt(ChVector3d(v[7], v[8], v[9]));
+    frame.SetRotDt(ChQuaternion<>(v[10], v[11], v[12], v[13]));
+    frame.SetPosDt2(ChVector3d(v[14], v[15], v[16]));
+    frame.SetRotDt2(ChQuaternion<>(v[17], v[18], v[19], v[20]));
+}
+
+// Append the single-precision difference between the given pose and the reference pose
+static void EncodePoseDelta(const SynPose& pose, const SynPose& ref, std::vector<float>& delta) {
+    double v[pose_size];
+    double v_ref[pose_size];
+    PackPose(pose.GetFrame(), v);
+    PackPose(ref.GetFrame(), v_ref);
+    for (size_t i = 0; i < pose_size; i++)
+        delta.push_back(static_cast<float>(v[i] - v_ref[i]));
+}
+
+// Reconstruct a pose from the reference pose and the single-precision difference
+static void DecodePoseDelta(const SynPose& ref, const float* delta, SynPose& pose) {
+    double v[pose_size];
+    PackPose(ref.GetFrame(), v);
+    for (size_t i = 0; i < pose_size; i++)
+        v[i] += delta[i];
+    UnpackPose(v, pose.GetFrame());
+}
+
 SynWheeledVehicleStateMessage::SynWheeledVehicleStateMessage(AgentKey source_key, AgentKey destination_key)
-    : SynMessage(source_key, destination_key) {}
+    : SynMessage(source_key, destination_key), m_keyframe_interval(0), m_seq(0), m_ref_seq(0) {}
 
 void SynWheeledVehicleStateMessage::SetState(double time, SynPose chassis, std::vector<SynPose> wheels) {
     this->time = time;
     this->chassis = chassis;
     this->wheels = wheels;
+
+    // Decide whether this state is sent as a keyframe and, if so, record it as reference for subsequent deltas
+    m_seq++;
+    bool keyframe = m_keyframe_interval <= 1 || m_ref_seq == 0 || m_seq - m_ref_seq >= (uint32_t)m_keyframe_interval ||
+                    m_ref_wheels.size() != wheels.size();
+    if (keyframe) {
+        m_ref_seq = m_seq;
+        m_ref_chassis = chassis;
+        m_ref_wheels = wheels;
+    }
+}
+
+bool SynWheeledVehicleStateMessage::Decode(const SynWheeledVehicleStateMessage& keyframe) {
+    if (!IsDelta())
+        return true;
+
+    size_t num_wheels = keyframe.wheels.size();
+    if (!keyframe.IsKeyframe() || keyframe.m_seq != m_ref_seq || m_delta.size() != (num_wheels + 1) * pose_size)
+        return false;
+
+    DecodePoseDelta(keyframe.chassis, m_delta.data(), chassis);
+    wheels.resize(num_wheels);
+    for (size_t i = 0; i < num_wheels; i++)
+        DecodePoseDelta(keyframe.wheels[i], m_delta.data() + (i + 1) * pose_size, wheels[i]);
+
+    m_delta.clear();
+
+    return true;
 }
 
 void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers::Message* message) {
@@ -49,25 +124,50 @@ void SynWheeledVehicleStateMessage::ConvertFromFlatBuffers(const SynFlatBuffers:
     auto state = agent_state->message_as_WheeledVehicle_State();
 
     time = state->time();
-    chassis = SynPose(state->chassis());
+    m_seq = state->seq();
+    m_ref_seq = state->ref_seq();
 
     wheels.clear();
+    m_delta.clear();
+
+    // Delta-encoded state (see Decode)
+    if (state->delta() && state->delta()->size() > 0) {
+        m_delta.assign(state->delta()->begin(), state->delta()->end());
+        return;
+    }
+
+    chassis = SynPose(state->chassis());
     for (auto wheel : (*state->wheels()))
         wheels.emplace_back(wheel);
 }
 
 /// Generate FlatBuffers message from this message's state
 FlatBufferMessage SynWheeledVehicleStateMessage::ConvertToFlatBuffers(flatbuffers::FlatBufferBuilder& builder) const {
-    auto flatbuffer_chassis = this->chassis.ToFlatBuffers(builder);
-
-    std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> flatbuffer_wheels;
-    flatbuffer_wheels.reserve(this->wheels.size());
-    for (const auto& wheel : this->wheels)
-        flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
-
     auto vehicle_type = Agent::Type_WheeledVehicle_State;
-    auto vehicle_state =
-        WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels).Union();
+    flatbuffers::Offset<void> vehicle_state;
+
+    if (m_seq != m_ref_seq) {
+        // Only encode the difference with respect to the last keyframe
+        std::vector<float> delta;
+        delta.reserve((this->wheels.size() + 1) * pose_size);
+        EncodePoseDelta(this->chassis, m_ref_chassis, delta);
+        for (size_t i = 0; i < this->wheels.size(); i++)
+            EncodePoseDelta(this->wheels[i], m_ref_wheels[i], delta);
+
+        vehicle_state =
+            WheeledVehicle::CreateStateDirect(builder, this->time, 0, nullptr, m_seq, m_ref_seq, &delta).Union();
+    } else {
+        auto flatbuffer_chassis = this->chassis.ToFlatBuffers(builder);
+
+        std::vector<flatbuffers::Offset<SynFlatBuffers::Pose>> flatbuffer_wheels;
+        flatbuffer_wheels.reserve(this->wheels.size());
+        for (const auto& wheel : this->wheels)
+            flatbuffer_wheels.push_back(wheel.ToFlatBuffers(builder));
+
+        vehicle_state = WheeledVehicle::CreateStateDirect(builder, this->time, flatbuffer_chassis, &flatbuffer_wheels,
+                                                          m_seq, m_ref_seq)
+                            .Union();
+    }
 
     auto flatbuffer_state = Agent::CreateState(builder, vehicle_type, vehicle_state);
     auto flatbuffer_message =
@@ -60,10 +60,50 @@ class SYN_API SynWheeledVehicleStateMessage : public SynMessage {
     ///@param wheels vector of the vehicle's wheel poses
     void SetState(double time, SynPose chassis, std::vector<SynPose> wheels);
 
+    ///@brief Enable delta encoding of the state (default: disabled)
+    /// A full state (keyframe) is sent every keyframe_interval messages. All other messages only carry the
+    /// single-precision difference with respect to the last keyframe and must be reconstructed with Decode.
+    /// Each state carries a sequence number and the sequence number of the keyframe it refers to (equal for a
+    /// keyframe). Receivers keep the last keyframe of each source; no acknowledgements are sent. A delta that refers
+    /// to a keyframe which was not received (e.g. the receiving node was outside the interest radius) cannot be
+    /// decoded: it is dropped before being distributed and the receiving node requests a keyframe (see
+    /// SynSimulationMessage), which the source sends with its next state.
+    ///
+    ///@param keyframe_interval number of messages between keyframes (a value of 0 or 1 disables delta encoding)
+    void SetDeltaEncoding(int keyframe_interval) { m_keyframe_interval = keyframe_interval; }
+
+    ///@brief Send the next state as a keyframe, regardless of the keyframe interval
+    /// Used when a receiver could not decode a delta message (e.g. it missed the last keyframe).
+    ///
+    void RequestKeyframe() { m_ref_seq = 0; }
+
+    ///@brief Whether this (received) message only carries the difference with respect to a keyframe
+    ///
+    bool IsDelta() const { return !m_delta.empty(); }
+
+    ///@brief Whether this message carries a full state which can be used as reference for subsequent delta messages
+    ///
+    bool IsKeyframe() const { return !IsDelta() && m_seq == m_ref_seq; }
+
+    ///@brief Reconstruct the full state of a delta message from the keyframe it was encoded against
+    ///
+    ///@param keyframe the last received keyframe from the same source
+    ///@return false if the given keyframe is not the reference of this message
+    bool Decode(const SynWheeledVehicleStateMessage& keyframe);
+
     // -------------------------------------------------------------------------------
 
     SynPose chassis;              ///< vehicle's chassis pose
     std::vector<SynPose> wheels;  ///< vector of vehicle's wheels
+
+  private:
+    int m_keyframe_interval;  ///< number of messages between keyframes (sender only)
+    uint32_t m_seq;           ///< sequence number of this state
+    uint32_t m_ref_seq;       ///< sequence number of the reference keyframe
+
+    SynPose m_ref_chassis;              ///< keyframe chassis pose (sender only)
+    std::vector<SynPose> m_ref_wheels;  ///< keyframe wheel poses (sender only)
+    std::vector<float> m_delta;         ///< received differences with respect to the keyframe (receiver only)
 };
 
 // ------------------------------------------------------------------------------------
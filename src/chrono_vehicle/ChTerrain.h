@@ -57,6 +57,13 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector3d& loc, double& height, ChVector3d& normal, float& friction) const;
 
+    /// Return true if the terrain query functions (GetHeight, GetNormal, GetCoefficientFriction, and GetProperties) can
+    /// be called concurrently from multiple threads. This is required for concurrent tire evaluation (see
+    /// ChWheeledVehicle::SetTireNumThreads). Queries are only issued between terrain updates (Synchronize/Advance) and
+    /// must not modify the terrain; any registered height, normal, or friction functors must also be thread-safe.
+    /// The default implementation returns false.
+    virtual bool SupportsConcurrentQueries() const { return false; }
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
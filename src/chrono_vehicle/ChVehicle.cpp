@@ -18,6 +18,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 
 #include "chrono/ChConfig.h"
 
@@ -30,6 +31,7 @@
 #include "chrono_vehicle/ChVehicleVisualSystem.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
 #ifdef CHRONO_HAS_HDF5
     #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -134,6 +136,9 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
             m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
 #endif
             break;
+        case ChVehicleOutput::BINARY:
+            m_output_db = new ChVehicleOutputBinary(out_dir + "/" + out_name + ".bin");
+            break;
     }
 }
 
@@ -153,6 +158,10 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type, std::ostream& out_stream,
             //// TODO
 #endif
             break;
+        case ChVehicleOutput::BINARY:
+            std::cerr << "Binary vehicle output requires a file." << std::endl;
+            m_output = false;
+            break;
     }
 }
 
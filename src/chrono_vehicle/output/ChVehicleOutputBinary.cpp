@@ -0,0 +1,271 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compressed, columnar binary vehicle output database.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChVehicleOutputBinary::ChVehicleOutputBinary(const std::string& filename)
+    : m_filename(filename),
+      m_frame(false),
+      m_changed(false),
+      m_num_elements(0),
+      m_num_quantities(0),
+      m_num_layouts(0) {}
+
+ChVehicleOutputBinary::~ChVehicleOutputBinary() {
+    FinishFrame();
+    if (m_writer && !m_writer->Close())
+        std::cerr << "ChVehicleOutputBinary: error writing " << m_filename << std::endl;
+}
+
+void ChVehicleOutputBinary::FinishFrame() {
+    if (!m_frame)
+        return;
+    m_frame = false;
+
+    // Frame with fewer elements or quantities than the previous one
+    if (m_num_elements != m_elements.size() || m_num_quantities != m_quantities.size()) {
+        m_elements.resize(m_num_elements);
+        m_quantities.resize(m_num_quantities);
+        m_changed = true;
+    }
+
+    if (m_changed) {
+        static const char* vector_components[] = {".x", ".y", ".z"};
+        static const char* quat_components[] = {".e0", ".e1", ".e2", ".e3"};
+        m_columns.clear();
+        for (const auto& q : m_quantities) {
+            std::string name = m_elements[q.element] + q.name;
+            switch (q.size) {
+                case 3:
+                    for (int k = 0; k < 3; k++)
+                        m_columns.push_back(name + vector_components[k]);
+                    break;
+                case 4:
+                    for (int k = 0; k < 4; k++)
+                        m_columns.push_back(name + quat_components[k]);
+                    break;
+                default:
+                    m_columns.push_back(name);
+                    break;
+            }
+        }
+        m_num_layouts++;
+
+        if (m_writer) {
+            m_writer->SetColumns(m_columns);
+        } else {
+            try {
+                // Records can be wide (all subsystems of a vehicle), so size the chunks (about 4 MB) and the ring
+                // buffer (4 chunks) based on the number of columns
+                size_t chunk_size = std::max<size_t>(64, (4 << 20) / (sizeof(double) * m_columns.size()));
+                m_writer = chrono_types::make_unique<utils::ChWriterBinary>(m_filename, m_columns, chunk_size,
+                                                                            4 * chunk_size);
+            } catch (const std::exception& e) {
+                std::cerr << "ChVehicleOutputBinary: " << e.what() << std::endl;
+            }
+        }
+    }
+
+    if (m_writer)
+        m_writer->Write(m_record.data());
+}
+
+void ChVehicleOutputBinary::WriteTime(int frame, double time) {
+    FinishFrame();
+    m_frame = true;
+    m_changed = false;
+    m_num_elements = 0;
+    m_num_quantities = 0;
+    m_record.clear();
+    m_section.clear();
+    m_prefix.clear();
+    AddElement(m_prefix);
+    Add("frame", (double)frame);
+    Add("time", time);
+}
+
+void ChVehicleOutputBinary::WriteSection(const std::string& name) {
+    m_section = name;
+}
+
+void ChVehicleOutputBinary::SetElement(const std::string& type, const ChObj& obj) {
+    m_prefix.assign(m_section).append("/");
+    if (obj.GetName().empty())
+        m_prefix.append(type).append(std::to_string(obj.GetIdentifier()));
+    else
+        m_prefix.append(obj.GetName());
+    m_prefix.append(".");
+    AddElement(m_prefix);
+}
+
+// The layout of a frame is compared with that of the previous frame while it is being collected, reusing the storage
+// of the previous layout, so that no column names are built (and the layout storage is not reallocated) for an unchanged
+// layout.
+void ChVehicleOutputBinary::AddElement(const std::string& prefix) {
+    if (m_num_elements == m_elements.size()) {
+        m_elements.push_back(prefix);
+        m_changed = true;
+    } else if (m_elements[m_num_elements] != prefix) {
+        m_elements[m_num_elements] = prefix;
+        m_changed = true;
+    }
+    m_num_elements++;
+}
+
+void ChVehicleOutputBinary::AddQuantity(const char* quantity, int size) {
+    size_t element = m_num_elements - 1;
+    if (m_num_quantities == m_quantities.size()) {
+        m_quantities.push_back({element, quantity, size});
+        m_changed = true;
+    } else {
+        auto& q = m_quantities[m_num_quantities];
+        if (q.element != element || q.size != size || q.name != quantity) {
+            q.element = element;
+            q.name = quantity;
+            q.size = size;
+            m_changed = true;
+        }
+    }
+    m_num_quantities++;
+}
+
+void ChVehicleOutputBinary::Add(const char* quantity, double val) {
+    m_record.push_back(val);
+    AddQuantity(quantity, 1);
+}
+
+void ChVehicleOutputBinary::Add(const char* quantity, const ChVector3d& val) {
+    m_record.push_back(val.x());
+    m_record.push_back(val.y());
+    m_record.push_back(val.z());
+    AddQuantity(quantity, 3);
+}
+
+void ChVehicleOutputBinary::Add(const char* quantity, const ChQuaterniond& val) {
+    m_record.push_back(val.e0());
+    m_record.push_back(val.e1());
+    m_record.push_back(val.e2());
+    m_record.push_back(val.e3());
+    AddQuantity(quantity, 4);
+}
+
+void ChVehicleOutputBinary::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    for (const auto& body : bodies) {
+        SetElement("body", *body);
+        Add("pos", body->GetPos());
+        Add("rot", body->GetRot());
+        Add("vel", body->GetPosDt());
+        Add("angvel", body->GetAngVelParent());
+        Add("acc", body->GetPosDt2());
+        Add("angacc", body->GetAngAccParent());
+    }
+}
+
+void ChVehicleOutputBinary::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    for (const auto& body : bodies) {
+        SetElement("body", *body);
+        Add("pos", body->GetPos());
+        Add("rot", body->GetRot());
+        Add("vel", body->GetPosDt());
+        Add("angvel", body->GetAngVelParent());
+        Add("acc", body->GetPosDt2());
+        Add("angacc", body->GetAngAccParent());
+        Add("ref_pos", body->GetFrameRefToAbs().GetPos());
+        Add("ref_vel", body->GetFrameRefToAbs().GetPosDt());
+        Add("ref_acc", body->GetFrameRefToAbs().GetPosDt2());
+    }
+}
+
+void ChVehicleOutputBinary::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    for (const auto& marker : markers) {
+        SetElement("marker", *marker);
+        Add("pos", marker->GetAbsCoordsys().pos);
+        Add("vel", marker->GetAbsCoordsysDt().pos);
+        Add("acc", marker->GetAbsCoordsysDt2().pos);
+    }
+}
+
+void ChVehicleOutputBinary::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    for (const auto& shaft : shafts) {
+        SetElement("shaft", *shaft);
+        Add("pos", shaft->GetPos());
+        Add("vel", shaft->GetPosDt());
+        Add("acc", shaft->GetPosDt2());
+        Add("torque", shaft->GetAppliedLoad());
+    }
+}
+
+void ChVehicleOutputBinary::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    for (const auto& joint : joints) {
+        SetElement("joint", *joint);
+        auto reaction = joint->GetReaction2();
+        Add("force", reaction.force);
+        Add("torque", reaction.torque);
+        auto C = joint->GetConstraintViolation();
+        while (m_violation_names.size() < (size_t)C.size())
+            m_violation_names.push_back("violation." + std::to_string(m_violation_names.size()));
+        for (int i = 0; i < C.size(); i++)
+            Add(m_violation_names[i].c_str(), C(i));
+    }
+}
+
+void ChVehicleOutputBinary::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    for (const auto& couple : couples) {
+        SetElement("couple", *couple);
+        Add("pos", couple->GetRelativePos());
+        Add("vel", couple->GetRelativePosDt());
+        Add("acc", couple->GetRelativePosDt2());
+        Add("torque1", couple->GetReaction1());
+        Add("torque2", couple->GetReaction2());
+    }
+}
+
+void ChVehicleOutputBinary::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    for (const auto& spring : springs) {
+        SetElement("spring", *spring);
+        Add("point1", spring->GetPoint1Abs());
+        Add("point2", spring->GetPoint2Abs());
+        Add("length", spring->GetLength());
+        Add("vel", spring->GetVelocity());
+        Add("force", spring->GetForce());
+    }
+}
+
+void ChVehicleOutputBinary::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    for (const auto& spring : springs) {
+        SetElement("spring", *spring);
+        Add("angle", spring->GetAngle());
+        Add("vel", spring->GetVelocity());
+        Add("torque", spring->GetTorque());
+    }
+}
+
+void ChVehicleOutputBinary::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    for (const auto& load : loads) {
+        SetElement("load", *load);
+        Add("force", load->GetForce());
+        Add("torque", load->GetTorque());
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
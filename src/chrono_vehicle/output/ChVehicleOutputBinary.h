@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compressed, columnar binary vehicle output database.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_BINARY_H
+#define CH_VEHICLE_OUTPUT_BINARY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/utils/ChWriterBinary.h"
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Compressed, columnar binary vehicle output database.
+/// Each output frame is collected in a single record which is passed to an asynchronous writer (see
+/// utils::ChWriterBinary), so that compression and file I/O happen on a background thread. Columns are named
+/// "<section>/<element>.<quantity>[.<component>]", e.g. "chassis/body.pos.x". The layout of each frame (elements and
+/// quantities) is compared with that of the previous frame; if it changed (e.g., if output is enabled for additional
+/// subsystems during the simulation), a new layout is started in the file. Use utils::ChReaderBinary to read the
+/// resulting file.
+class CH_VEHICLE_API ChVehicleOutputBinary : public ChVehicleOutput {
+  public:
+    ChVehicleOutputBinary(const std::string& filename);
+    ~ChVehicleOutputBinary();
+
+    /// Number of record layouts written so far.
+    int GetNumLayouts() const { return m_num_layouts; }
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    /// Quantity (with 1, 3, or 4 components) of an element, in the layout of an output frame.
+    struct Quantity {
+        size_t element;
+        std::string name;
+        int size;
+    };
+
+    /// Pass the record of the current frame to the writer (creating the writer after the first frame, and starting a
+    /// new layout if the layout of the frame changed).
+    void FinishFrame();
+
+    /// Start a new element (body, joint, etc.) in the current section.
+    void SetElement(const std::string& type, const ChObj& obj);
+
+    /// Record the column name prefix of the current element in the layout of the current frame.
+    void AddElement(const std::string& prefix);
+
+    /// Record a quantity of the current element in the layout of the current frame.
+    void AddQuantity(const char* quantity, int size);
+
+    void Add(const char* quantity, double val);
+    void Add(const char* quantity, const ChVector3d& val);
+    void Add(const char* quantity, const ChQuaterniond& val);
+
+    std::string m_filename;
+    std::unique_ptr<utils::ChWriterBinary> m_writer;
+    bool m_frame;                         ///< true if a frame was started
+    bool m_changed;                       ///< true if the layout of the current frame differs from the previous one
+    std::vector<std::string> m_elements;  ///< column name prefixes of the elements (layout)
+    std::vector<Quantity> m_quantities;   ///< quantities of the elements (layout)
+    size_t m_num_elements;                ///< number of elements in the current frame
+    size_t m_num_quantities;              ///< number of quantities in the current frame
+    std::vector<std::string> m_columns;   ///< column names
+    std::vector<double> m_record;         ///< values of the current frame
+    std::string m_section;                ///< name of the current section
+    std::string m_prefix;                 ///< column name prefix for the current element
+    int m_num_layouts;
+    std::vector<std::string> m_violation_names;  ///< names of joint constraint violations (built once)
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -57,6 +57,10 @@ class CH_VEHICLE_API FlatTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Return true, as FlatTerrain can be queried concurrently from multiple threads.
+    /// A user-provided friction functor, if any, must also be thread-safe.
+    virtual bool SupportsConcurrentQueries() const override { return true; }
+
   private:
     double m_height;   ///< terrain height
     float m_friction;  ///< contact coefficient of friction
@@ -1075,6 +1075,14 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+bool RigidTerrain::SupportsConcurrentQueries() const {
+    for (const auto& patch : m_patches) {
+        if (patch->m_type != PatchType::BOX)
+            return false;
+    }
+    return true;
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -217,6 +217,11 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Return true if the terrain can be queried concurrently from multiple threads.
+    /// This is the case only if all patches are boxes. Mesh and height-map patches are queried by ray casting into the
+    /// collision system, which is not thread-safe.
+    virtual bool SupportsConcurrentQueries() const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -249,6 +249,11 @@ void SCMTerrain::SetModifiedNodes(const std::vector<NodeLevel>& nodes) {
     m_loader->SetModifiedNodes(nodes);
 }
 
+// Get the initial level of the grid node at the specified grid location.
+double SCMTerrain::GetInitNodeLevel(const ChVector2i& loc) const {
+    return m_loader->GetInitHeight(loc);
+}
+
 bool SCMTerrain::GetContactForceBody(std::shared_ptr<ChBody> body, ChVector3d& force, ChVector3d& torque) const {
     auto itr = m_loader->m_body_forces.find(body.get());
     if (itr == m_loader->m_body_forces.end()) {
@@ -204,6 +204,11 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value of 0.8.
     virtual float GetCoefficientFriction(const ChVector3d& loc) const override;
 
+    /// Return true, as SCMTerrain can be queried concurrently from multiple threads.
+    /// Queries are read-only lookups in the grid of modified nodes, which is only changed during the system dynamics
+    /// update. A user-provided friction functor, if any, must also be thread-safe.
+    virtual bool SupportsConcurrentQueries() const override { return true; }
+
     /// Get SCM information at the node closest to the specified location.
     NodeInfo GetNodeInfo(const ChVector3d& loc) const;
 
@@ -279,6 +284,10 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Modify the level of grid nodes from the given list.
     void SetModifiedNodes(const std::vector<NodeLevel>& nodes);
 
+    /// Get the initial (undeformed) level of the grid node at the specified grid location.
+    /// The returned value is relative to the SCM plane, consistent with the levels in a NodeLevel list.
+    double GetInitNodeLevel(const ChVector2i& loc) const;
+
     /// Return the cummulative contact force on the specified body  (due to interaction with the SCM terrain).
     /// The return value is true if the specified body experiences contact forces and false otherwise.
     /// If contact forces are applied to the body, they are reduced to the body center of mass.
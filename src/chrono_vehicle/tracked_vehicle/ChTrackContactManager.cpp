@@ -16,11 +16,19 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "chrono/physics/ChLoadsBody.h"
+#include "chrono/utils/ChUtils.h"
 
 #include "chrono_vehicle/tracked_vehicle/ChTrackContactManager.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 #include "chrono_vehicle/tracked_vehicle/test_rig/ChTrackTestRig.h"
+#include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeBand.h"
+#include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeSegmented.h"
+#include "chrono_vehicle/tracked_vehicle/track_wheel/ChDoubleTrackWheel.h"
 
 namespace chrono {
 namespace vehicle {
@@ -566,59 +574,441 @@ void ChTrackCustomContact::Update(double mytime, bool update_assets) {
     ChTime = mytime;
 }
 
+// Evaluate the contact forces on the track shoes for all given collisions, in parallel if more than one thread.
+// The second collision model is assumed to be that of the track shoe body.
+template <typename ForceFunction>
+static void EvaluateForces(const std::vector<ChCollisionInfo>& collisions,
+                           std::vector<ChVector3d>& forces,
+                           int num_threads,
+                           ForceFunction compute) {
+    int num_collisions = (int)collisions.size();
+    forces.resize(num_collisions);
+
+    if (num_threads <= 1 || num_collisions < 2) {
+        for (int i = 0; i < num_collisions; i++) {
+            const auto& cInfo = collisions[i];
+            std::shared_ptr<ChBody> body(static_cast<ChBody*>(cInfo.modelA->GetContactable()), [](ChBody*) {});
+            std::shared_ptr<ChBody> shoe_body(static_cast<ChBody*>(cInfo.modelB->GetContactable()), [](ChBody*) {});
+            compute(cInfo, body, shoe_body, forces[i]);
+        }
+        return;
+    }
+
+    int nthreads = std::min(num_threads, num_collisions);
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < num_collisions; i++) {
+        const auto& cInfo = collisions[i];
+        std::shared_ptr<ChBody> body(static_cast<ChBody*>(cInfo.modelA->GetContactable()), [](ChBody*) {});
+        std::shared_ptr<ChBody> shoe_body(static_cast<ChBody*>(cInfo.modelB->GetContactable()), [](ChBody*) {});
+        compute(cInfo, body, shoe_body, forces[i]);
+    }
+}
+
 void ChTrackCustomContact::ApplyForces() {
     // Reset the load list for this load container
     GetLoadList().clear();
 
+    // Generate idler-shoe and wheel-shoe collisions, if not provided by the collision system
+    if (GeneratesCollisions() && m_vehicle) {
+        m_collision_manager->m_collisions_idler.clear();
+        m_collision_manager->m_collisions_wheel.clear();
+        GenerateCollisions(m_vehicle, m_collision_manager->m_collisions_idler, m_collision_manager->m_collisions_wheel);
+    }
+
     ////std::cout << "Idler-shoe collisions:  " << m_collision_manager->m_collisions_idler.size() << std::endl;
     ////std::cout << "Wheel-shoe collisions:  " << m_collision_manager->m_collisions_wheel.size() << std::endl;
     ////std::cout << "Ground-shoe collisions: " << m_collision_manager->m_collisions_ground.size() << std::endl;
 
-    ChVector3d force_shoe;
+    // Contact forces are evaluated first (possibly in parallel), then the corresponding loads are added sequentially.
 
     if (OverridesIdlerContact()) {
-        for (auto& cInfo : m_collision_manager->m_collisions_idler) {
+        const auto& collisions = m_collision_manager->m_collisions_idler;
+        EvaluateForces(collisions, m_forces, m_num_threads,
+                       [this](const ChCollisionInfo& cInfo, std::shared_ptr<ChBody> idler_body,
+                              std::shared_ptr<ChBody> shoe_body, ChVector3d& force_shoe) {
+                           // Call user-provided force calculation
+                           ComputeIdlerContactForce(cInfo, idler_body, shoe_body, force_shoe);
+                       });
+
+        for (size_t i = 0; i < collisions.size(); i++) {
+            const auto& cInfo = collisions[i];
             std::shared_ptr<ChBody> idler_body(static_cast<ChBody*>(cInfo.modelA->GetContactable()), [](ChBody*) {});
             std::shared_ptr<ChBody> shoe_body(static_cast<ChBody*>(cInfo.modelB->GetContactable()), [](ChBody*) {});
 
-            // Call user-provided force calculation
-            ComputeIdlerContactForce(cInfo, idler_body, shoe_body, force_shoe);
-
             // Apply equal and opposite forces on the two bodies (idler and track shoe) in contact
-            Add(chrono_types::make_shared<ChLoadBodyForce>(idler_body, -force_shoe, false, cInfo.vpA, false));
-            Add(chrono_types::make_shared<ChLoadBodyForce>(shoe_body, +force_shoe, false, cInfo.vpB, false));
+            Add(chrono_types::make_shared<ChLoadBodyForce>(idler_body, -m_forces[i], false, cInfo.vpA, false));
+            Add(chrono_types::make_shared<ChLoadBodyForce>(shoe_body, +m_forces[i], false, cInfo.vpB, false));
         }
     }
 
     if (OverridesWheelContact()) {
-        for (auto& cInfo : m_collision_manager->m_collisions_wheel) {
+        const auto& collisions = m_collision_manager->m_collisions_wheel;
+        EvaluateForces(collisions, m_forces, m_num_threads,
+                       [this](const ChCollisionInfo& cInfo, std::shared_ptr<ChBody> wheel_body,
+                              std::shared_ptr<ChBody> shoe_body, ChVector3d& force_shoe) {
+                           // Call user-provided force calculation
+                           ComputeWheelContactForce(cInfo, wheel_body, shoe_body, force_shoe);
+                       });
+
+        for (size_t i = 0; i < collisions.size(); i++) {
+            const auto& cInfo = collisions[i];
             std::shared_ptr<ChBody> wheel_body(static_cast<ChBody*>(cInfo.modelA->GetContactable()), [](ChBody*) {});
             std::shared_ptr<ChBody> shoe_body(static_cast<ChBody*>(cInfo.modelB->GetContactable()), [](ChBody*) {});
 
-            // Call user-provided force calculation
-            ComputeWheelContactForce(cInfo, wheel_body, shoe_body, force_shoe);
-
             // Apply equal and opposite forces on the two bodies (wheel and track shoe) in contact
-            Add(chrono_types::make_shared<ChLoadBodyForce>(wheel_body, -force_shoe, false, cInfo.vpA, false));
-            Add(chrono_types::make_shared<ChLoadBodyForce>(shoe_body, +force_shoe, false, cInfo.vpB, false));
+            Add(chrono_types::make_shared<ChLoadBodyForce>(wheel_body, -m_forces[i], false, cInfo.vpA, false));
+            Add(chrono_types::make_shared<ChLoadBodyForce>(shoe_body, +m_forces[i], false, cInfo.vpB, false));
         }
     }
 
     if (OverridesGroundContact()) {
-        for (auto& cInfo : m_collision_manager->m_collisions_ground) {
+        const auto& collisions = m_collision_manager->m_collisions_ground;
+        EvaluateForces(collisions, m_forces, m_num_threads,
+                       [this](const ChCollisionInfo& cInfo, std::shared_ptr<ChBody> ground_body,
+                              std::shared_ptr<ChBody> shoe_body, ChVector3d& force_shoe) {
+                           // Call user-provided force calculation
+                           ComputeGroundContactForce(cInfo, ground_body, shoe_body, force_shoe);
+                       });
+
+        for (size_t i = 0; i < collisions.size(); i++) {
+            const auto& cInfo = collisions[i];
             std::shared_ptr<ChBody> ground_body(static_cast<ChBody*>(cInfo.modelA->GetContactable()), [](ChBody*) {});
             std::shared_ptr<ChBody> shoe_body(static_cast<ChBody*>(cInfo.modelB->GetContactable()), [](ChBody*) {});
 
-            // Call user-provided force calculation
-            ComputeGroundContactForce(cInfo, ground_body, shoe_body, force_shoe);
-
             // Apply equal and opposite forces on the two bodies (ground and track shoe) in contact
             if (!ground_body->IsFixed()) {
-                Add(chrono_types::make_shared<ChLoadBodyForce>(ground_body, -force_shoe, false, cInfo.vpA, false));
+                Add(chrono_types::make_shared<ChLoadBodyForce>(ground_body, -m_forces[i], false, cInfo.vpA, false));
+            }
+            Add(chrono_types::make_shared<ChLoadBodyForce>(shoe_body, +m_forces[i], false, cInfo.vpB, false));
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+ChTrackAnalyticContact::ChTrackAnalyticContact(bool idler_contact)
+    : m_idler_contact(idler_contact), m_user_patch(false), m_user_guide(false), m_kn(5e6), m_gn(5e3) {}
+
+void ChTrackAnalyticContact::SetShoeContactPatch(const ChVector3d& center, double length, double width) {
+    m_user_patch = true;
+    for (auto side : {LEFT, RIGHT})
+        m_patches[side] = {{center, length / 2, width / 2}};
+}
+
+void ChTrackAnalyticContact::SetShoeGuidePin(const ChVector3d& center, const ChVector3d& size) {
+    m_user_guide = true;
+    for (auto side : {LEFT, RIGHT})
+        m_guides[side] = {{center, size / 2}};
+}
+
+void ChTrackAnalyticContact::SetContactParameters(double kn, double gn) {
+    m_kn = kn;
+    m_gn = gn;
+}
+
+// Check if a shape rotation (relative to the shoe body frame) leaves the shape axes aligned with the shoe frame.
+static bool IsAligned(const ChQuaterniond& q) {
+    ChMatrix33<> rot(q);
+    return std::abs(rot(0, 0)) > 1 - 1e-6 && std::abs(rot(1, 1)) > 1 - 1e-6 && std::abs(rot(2, 2)) > 1 - 1e-6;
+}
+
+std::vector<ChTrackAnalyticContact::ShoePatch> ChTrackAnalyticContact::GetShoePatches(const ChTrackAssembly& track) {
+    std::vector<ShoePatch> patches;
+    if (track.GetNumTrackShoes() == 0)
+        return patches;
+
+    // All track shoes in a track assembly are of the same type
+    auto shoe = track.GetTrackShoe(0);
+    double height = shoe->GetHeight();
+
+    // Use the tops of the collision boxes (aligned with the shoe frame) located at half the shoe height
+    if (auto shoe_seg = std::dynamic_pointer_cast<ChTrackShoeSegmented>(shoe)) {
+        for (const auto& box : shoe_seg->GetGeometry().m_coll_boxes) {
+            if (!IsAligned(box.m_rot))
+                continue;
+            double top = box.m_pos.z() + box.m_dims.z() / 2;
+            if (std::abs(top - height / 2) > 0.01 * height)
+                continue;
+            patches.push_back({ChVector3d(box.m_pos.x(), box.m_pos.y(), top), box.m_dims.x() / 2, box.m_dims.y() / 2});
+        }
+    }
+
+    // Otherwise, use a single patch at half the shoe height, with length equal to the shoe pitch and unbounded width
+    if (patches.empty())
+        patches.push_back({ChVector3d(0, 0, height / 2), shoe->GetPitch() / 2, std::numeric_limits<double>::infinity()});
+
+    return patches;
+}
+
+std::vector<ChTrackAnalyticContact::ShoeGuide> ChTrackAnalyticContact::GetShoeGuides(const ChTrackAssembly& track) {
+    std::vector<ShoeGuide> guides;
+    if (track.GetNumTrackShoes() == 0)
+        return guides;
+
+    // All track shoes in a track assembly are of the same type
+    auto shoe = track.GetTrackShoe(0);
+    ChVector3d pin = shoe->GetLateralContactPoint();
+
+    if (auto shoe_seg = std::dynamic_pointer_cast<ChTrackShoeSegmented>(shoe)) {
+        // Use the collision box (aligned with the shoe frame) centered at the lateral contact point
+        for (const auto& box : shoe_seg->GetGeometry().m_coll_boxes) {
+            if (IsAligned(box.m_rot) && (box.m_pos - pin).Length() < 1e-6) {
+                guides.push_back({box.m_pos, box.m_dims / 2});
+                break;
+            }
+        }
+    } else if (auto shoe_band = std::dynamic_pointer_cast<ChTrackShoeBand>(shoe)) {
+        // Use the guide box
+        guides.push_back({pin, shoe_band->GetGuideBoxDimensions() / 2});
+    }
+
+    return guides;
+}
+
+bool ChTrackAnalyticContact::GeneratesLateralCollisions(const ChTrackAssembly& track) {
+    auto side = track.GetVehicleSide();
+    if (!m_user_guide)
+        m_guides[side] = GetShoeGuides(track);
+    return !m_guides[side].empty();
+}
+
+void ChTrackAnalyticContact::GenerateCollisions(ChTrackedVehicle* vehicle,
+                                                std::vector<ChCollisionInfo>& idler_collisions,
+                                                std::vector<ChCollisionInfo>& wheel_collisions) {
+    for (auto side : {LEFT, RIGHT}) {
+        auto track = vehicle->GetTrackAssembly(side);
+        if (m_patches[side].empty())
+            m_patches[side] = GetShoePatches(*track);
+        if (m_idler_contact)
+            CollideWheel(*track->GetIdlerWheel(), *track, m_patches[side], m_guides[side], idler_collisions);
+        for (size_t i = 0; i < track->GetNumTrackSuspensions(); i++)
+            CollideWheel(*track->GetRoadWheel(i), *track, m_patches[side], m_guides[side], wheel_collisions);
+    }
+}
+
+int ChTrackAnalyticContact::CollideCylinderPatch(const ChVector3d& c,
+                                                 const ChVector3d& a,
+                                                 double R,
+                                                 double hw,
+                                                 const ChFrame<>& shoe_frame,
+                                                 const ShoePatch& patch,
+                                                 ChCollisionInfo* cinfo) {
+    // Quick rejection, based on the cylinder center expressed relative to the patch center
+    ChVector3d c_loc = shoe_frame.TransformPointParentToLocal(c) - patch.center;
+    double r = R + hw;
+    if (c_loc.z() <= 0 || c_loc.z() > r || std::abs(c_loc.x()) > patch.hlength + r ||
+        std::abs(c_loc.y()) > patch.hwidth + r)
+        return 0;
+
+    const auto& rot = shoe_frame.GetRotMat();
+    ChVector3d t = rot.GetAxisX();
+    ChVector3d b = rot.GetAxisY();
+    ChVector3d n = rot.GetAxisZ();
+    ChVector3d p = shoe_frame.TransformPointLocalToParent(patch.center);
+
+    // Radial direction (perpendicular to the wheel axis) pointing towards the patch plane
+    ChVector3d d = a * n.Dot(a) - n;
+    double len = d.Length();
+    if (len < 1e-8)
+        return 0;
+    d /= len;
+
+    // Contact line on the cylinder rim, q(s) = q0 + s * a, with s in [-hw, hw]
+    ChVector3d q0 = c + d * R;
+
+    // Clip the contact line to the patch width
+    double s_min = -hw;
+    double s_max = +hw;
+    double v0 = (q0 - p).Dot(b);
+    double ab = a.Dot(b);
+    if (std::abs(ab) < 1e-8) {
+        if (std::abs(v0) > patch.hwidth)
+            return 0;
+    } else {
+        double s1 = (-patch.hwidth - v0) / ab;
+        double s2 = (+patch.hwidth - v0) / ab;
+        s_min = std::max(s_min, std::min(s1, s2));
+        s_max = std::min(s_max, std::max(s1, s2));
+        if (s_min > s_max)
+            return 0;
+    }
+
+    // Check the two ends of the clipped segment (a single point if the segment is degenerate)
+    double ends[2] = {s_min, s_max};
+    int num_ends = (s_max - s_min > 1e-10) ? 2 : 1;
+    int num_collisions = 0;
+    for (int ie = 0; ie < num_ends; ie++) {
+        ChVector3d q = q0 + a * ends[ie];
+
+        // If beyond the patch length, move the point along the rim to the patch edge
+        double u = (q - p).Dot(t);
+        if (std::abs(u) > patch.hlength) {
+            double du = std::copysign(patch.hlength, u) - u;
+            if (std::abs(du) >= R)
+                continue;
+            q += t * du - d * (R - std::sqrt(R * R - du * du));
+        }
+
+        double dist = (q - p).Dot(n);
+        if (dist >= 0)
+            continue;
+
+        auto& ci = cinfo[num_collisions++];
+        ci.vpA = q;
+        ci.vpB = q - n * dist;
+        ci.vN = -n;
+        ci.distance = dist;
+        ci.eff_radius = R;
+    }
+
+    return num_collisions;
+}
+
+int ChTrackAnalyticContact::CollideCylinderGuide(const ChVector3d& c,
+                                                 const ChVector3d& a,
+                                                 double R,
+                                                 double hw,
+                                                 const ChFrame<>& shoe_frame,
+                                                 const ShoeGuide& guide,
+                                                 ChCollisionInfo* cinfo) {
+    // Quick rejection, based on the cylinder center expressed relative to the guide center
+    ChVector3d c_loc = shoe_frame.TransformPointParentToLocal(c) - guide.center;
+    double r = R + hw;
+    if (std::abs(c_loc.x()) > guide.hdims.x() + r || std::abs(c_loc.y()) > guide.hdims.y() + r ||
+        std::abs(c_loc.z()) > guide.hdims.z() + r)
+        return 0;
+
+    // Only lateral collisions (cylinder axis along the shoe Y axis)
+    double ab = a.Dot(shoe_frame.GetRotMat().GetAxisY());
+    if (std::abs(ab) < nrm_threshold)
+        return 0;
+
+    int num_collisions = 0;
+    for (double sign : {-1.0, +1.0}) {
+        // Point of the guide side face closest to the cylinder center
+        double u = ChClamp(c_loc.x(), -guide.hdims.x(), guide.hdims.x());
+        double w = ChClamp(c_loc.z(), -guide.hdims.z(), guide.hdims.z());
+        ChVector3d p = shoe_frame.TransformPointLocalToParent(guide.center +
+                                                              ChVector3d(u, sign * guide.hdims.y(), w));
+
+        // Check if the point is inside the cylinder
+        ChVector3d cp = p - c;
+        double s = cp.Dot(a);
+        if (std::abs(s) >= hw || (cp - a * s).Length2() >= R * R)
+            continue;
+
+        // The side face collides with the cylinder face facing it; penetration measured along the cylinder axis
+        double sgn = (sign * ab > 0) ? -1.0 : +1.0;
+        double depth = hw - sgn * s;
+
+        auto& ci = cinfo[num_collisions++];
+        ci.vN = a * sgn;
+        ci.vpA = p + ci.vN * depth;
+        ci.vpB = p;
+        ci.distance = -depth;
+        ci.eff_radius = R;
+    }
+
+    return num_collisions;
+}
+
+void ChTrackAnalyticContact::CollideWheel(const ChTrackWheel& wheel,
+                                          const ChTrackAssembly& track,
+                                          const std::vector<ShoePatch>& patches,
+                                          const std::vector<ShoeGuide>& guides,
+                                          std::vector<ChCollisionInfo>& collisions) const {
+    const auto& wheel_body = wheel.GetBody();
+    if (!wheel_body->GetCollisionModel())
+        return;
+
+    // Wheel geometry: one cylinder or two cylinders separated by a gap
+    double R = wheel.GetRadius();
+    double W = wheel.GetWidth();
+    std::vector<std::pair<double, double>> cylinders;  // (offset along wheel axis, half-width)
+    if (auto double_wheel = dynamic_cast<const ChDoubleTrackWheel*>(&wheel)) {
+        double gap = double_wheel->GetGap();
+        cylinders.push_back({+(W + gap) / 4, (W - gap) / 4});
+        cylinders.push_back({-(W + gap) / 4, (W - gap) / 4});
+    } else {
+        cylinders.push_back({0, W / 2});
+    }
+
+    const auto& wheel_frame = wheel_body->GetFrameRefToAbs();
+    ChVector3d a = wheel_frame.GetRotMat().GetAxisY();
+
+    // Each (shoe, cylinder, patch or guide) combination has room for two collisions
+    int num_shoes = (int)track.GetNumTrackShoes();
+    int num_cyl = (int)cylinders.size();
+    int num_patches = (int)patches.size();
+    int num_guides = (int)guides.size();
+    int num_slots = num_cyl * (num_patches + num_guides);
+    std::vector<ChCollisionInfo> pair_collisions(2 * num_shoes * num_slots);
+    std::vector<int> pair_counts(num_shoes * num_slots, 0);
+
+    int nthreads = std::max(1, std::min(m_num_threads, num_shoes));
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < num_shoes; is++) {
+        const auto& shoe_body = track.GetTrackShoe(is)->GetShoeBody();
+        if (!shoe_body->GetCollisionModel())
+            continue;
+
+        const auto& shoe_frame = shoe_body->GetFrameRefToAbs();
+        for (int ic = 0; ic < num_cyl; ic++) {
+            ChVector3d c = wheel_frame.GetPos() + a * cylinders[ic].first;
+            for (int ip = 0; ip < num_patches + num_guides; ip++) {
+                int slot = is * num_slots + ic * (num_patches + num_guides) + ip;
+                auto cinfo = &pair_collisions[2 * slot];
+                int count = (ip < num_patches)
+                                ? CollideCylinderPatch(c, a, R, cylinders[ic].second, shoe_frame, patches[ip], cinfo)
+                                : CollideCylinderGuide(c, a, R, cylinders[ic].second, shoe_frame,
+                                                       guides[ip - num_patches], cinfo);
+                for (int k = 0; k < count; k++) {
+                    cinfo[k].modelA = wheel_body->GetCollisionModel().get();
+                    cinfo[k].modelB = shoe_body->GetCollisionModel().get();
+                    cinfo[k].shapeA = nullptr;
+                    cinfo[k].shapeB = nullptr;
+                }
+                pair_counts[slot] = count;
             }
-            Add(chrono_types::make_shared<ChLoadBodyForce>(shoe_body, +force_shoe, false, cInfo.vpB, false));
         }
     }
+
+    // Collect collisions in a deterministic order
+    for (size_t i = 0; i < pair_counts.size(); i++) {
+        for (int k = 0; k < pair_counts[i]; k++)
+            collisions.push_back(pair_collisions[2 * i + k]);
+    }
+}
+
+void ChTrackAnalyticContact::ComputeIdlerContactForce(const ChCollisionInfo& cinfo,
+                                                      std::shared_ptr<ChBody> idlerBody,
+                                                      std::shared_ptr<ChBody> shoeBody,
+                                                      ChVector3d& forceShoe) {
+    ComputeContactForce(cinfo, forceShoe);
+}
+
+void ChTrackAnalyticContact::ComputeWheelContactForce(const ChCollisionInfo& cinfo,
+                                                      std::shared_ptr<ChBody> wheelBody,
+                                                      std::shared_ptr<ChBody> shoeBody,
+                                                      ChVector3d& forceShoe) {
+    ComputeContactForce(cinfo, forceShoe);
+}
+
+void ChTrackAnalyticContact::ComputeContactForce(const ChCollisionInfo& cinfo, ChVector3d& forceShoe) const {
+    forceShoe = VNULL;
+    if (cinfo.distance >= 0)
+        return;
+
+    // Relative velocity at contact, projected onto the contact normal (positive if separating)
+    auto objA = cinfo.modelA->GetContactable();
+    auto objB = cinfo.modelB->GetContactable();
+    ChVector3d relvel = objB->GetContactPointSpeed(cinfo.vpB) - objA->GetContactPointSpeed(cinfo.vpA);
+    double relvel_n = relvel.Dot(cinfo.vN);
+
+    // Normal spring-damper force (no adhesion)
+    double forceN = m_kn * (-cinfo.distance) - m_gn * relvel_n;
+    if (forceN > 0)
+        forceShoe = forceN * cinfo.vN;
 }
 
 }  // end namespace vehicle
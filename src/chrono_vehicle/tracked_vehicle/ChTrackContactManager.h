@@ -19,7 +19,9 @@
 #ifndef CH_TRACK_CONTACT_MANAGER
 #define CH_TRACK_CONTACT_MANAGER
 
+#include <algorithm>
 #include <list>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChLoadContainer.h"
@@ -41,6 +43,7 @@ namespace vehicle {
 
 class ChTrackedVehicle;
 class ChTrackTestRig;
+class ChTrackAssembly;
 
 // -----------------------------------------------------------------------------
 
@@ -153,8 +156,14 @@ class CH_VEHICLE_API ChTrackCollisionManager : public ChCollisionSystem::Narrowp
 /// Callback interface for user-defined custom contact between road wheels and track shoes.
 class CH_VEHICLE_API ChTrackCustomContact : public ChLoadContainer {
   public:
+    ChTrackCustomContact() : m_collision_manager(nullptr), m_vehicle(nullptr), m_num_threads(1) {}
     virtual ~ChTrackCustomContact() {}
 
+    /// Set the number of threads used to evaluate the custom contact forces (default: 1).
+    /// If more than one thread is used, the Compute***ContactForce functions are called concurrently and must therefore
+    /// be thread-safe.
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(num_threads, 1); }
+
     /// Indicate if overriding contact forces with idlers.
     /// If returning true, the derived class must provide an override of ComputeIdlerContactForce.
     virtual bool OverridesIdlerContact() const { return false; }
@@ -206,16 +215,165 @@ class CH_VEHICLE_API ChTrackCustomContact : public ChLoadContainer {
         throw std::runtime_error("Ground-shoe custom contact force calculation not implemented.");
     }
 
+  protected:
+    /// Indicate if this object generates the idler-shoe and wheel-shoe collisions itself.
+    /// If returning true, the non-lateral collisions reported by the collision system between track shoes and the
+    /// idlers and/or road-wheels with overridden contact are discarded and GenerateCollisions is called instead.
+    virtual bool GeneratesCollisions() const { return false; }
+
+    /// Generate the current idler-shoe and wheel-shoe collisions (only called if GeneratesCollisions returns true).
+    /// In each collision, the first model must be that of the idler or road-wheel body and the second model that of
+    /// the track shoe body.
+    virtual void GenerateCollisions(ChTrackedVehicle* vehicle,                        ///< [in] containing vehicle
+                                    std::vector<ChCollisionInfo>& idler_collisions,  ///< [out] idler-shoe collisions
+                                    std::vector<ChCollisionInfo>& wheel_collisions   ///< [out] wheel-shoe collisions
+    ) {}
+
+    /// Indicate if the collisions generated by this object for the given track assembly include the lateral (guide pin)
+    /// collisions (only called if GeneratesCollisions returns true). If returning true, the collisions between the
+    /// track shoes and the road-wheels (and the idler, if overridden) of this track assembly are disabled in the
+    /// collision system.
+    virtual bool GeneratesLateralCollisions(const ChTrackAssembly& track) { return false; }
+
+    int m_num_threads;  ///< number of threads for collision generation and force evaluation
+
   private:
     virtual void Setup() override;
     virtual void Update(double mytime, bool update_assets = true) override;
     void ApplyForces();
 
     ChTrackCollisionManager* m_collision_manager;
+    ChTrackedVehicle* m_vehicle;
+
+    std::vector<ChVector3d> m_forces;  ///< scratch buffer for contact forces on track shoes
 
     friend class ChTrackedVehicle;
 };
 
+/// Custom contact between track shoes and road-wheels (and optionally idler wheels) with analytic collision detection.
+/// Collisions are computed directly from the known geometry of the track wheels (one or two cylinders) and of the track
+/// shoes (one or more rectangular contact patches, with normal along the shoe Z axis, and a guide pin box). Collision
+/// detection and force evaluation can be performed in parallel. If the guide pins of the track shoes are known, the
+/// collisions between the track shoes and the wheels are disabled in the collision system, so that these pairs are
+/// not processed by the narrow phase at all. Otherwise, the lateral (guide pin) collisions are still detected by the
+/// collision system and processed as regular Chrono contacts, and all other wheel-shoe collisions it reports are
+/// discarded.
+/// The default contact force is a normal-only linear spring-damper force, applied at each contact point (a cylinder
+/// rim line crossing a contact patch generates up to two contact points, at the ends of its clipped segment; a guide
+/// pin side face penetrating a cylinder generates one contact point); a derived class can override
+/// ComputeWheelContactForce and ComputeIdlerContactForce (these must be thread-safe if using multiple threads).
+class CH_VEHICLE_API ChTrackAnalyticContact : public ChTrackCustomContact {
+  public:
+    /// Rectangular contact patch on a track shoe, expressed in the shoe body frame.
+    /// The patch is normal to the shoe Z axis, with its length along the shoe X axis and its width along the Y axis.
+    struct ShoePatch {
+        ChVector3d center;  ///< patch center (on the contact surface), relative to the shoe body frame
+        double hlength;     ///< patch half-length (along the shoe X axis)
+        double hwidth;      ///< patch half-width (along the shoe Y axis)
+    };
+
+    /// Guide pin box on a track shoe, expressed in the shoe body frame (aligned with the shoe body frame).
+    struct ShoeGuide {
+        ChVector3d center;  ///< box center, relative to the shoe body frame
+        ChVector3d hdims;   ///< box half-dimensions
+    };
+
+    ChTrackAnalyticContact(bool idler_contact = false);
+    virtual ~ChTrackAnalyticContact() {}
+
+    /// Set a single contact patch used for all track shoes (center relative to the shoe body frame).
+    /// By default, the contact patches are the tops of the shoe collision boxes located at half the track shoe height
+    /// (for segmented track shoes). If there are no such boxes, a single patch at half the shoe height, with length
+    /// equal to the shoe pitch and unbounded width, is used.
+    void SetShoeContactPatch(const ChVector3d& center, double length, double width);
+
+    /// Set the guide pin box used for all track shoes (center relative to the shoe body frame).
+    /// By default, the guide pin is the shoe collision box centered at the lateral contact point of the track shoe (for
+    /// segmented track shoes) or the guide box of band track shoes. If there is no such box, the lateral collisions
+    /// are left to the collision system. Must be called before enabling this custom contact on the vehicle (see
+    /// ChTrackedVehicle::EnableCustomContact).
+    void SetShoeGuidePin(const ChVector3d& center, const ChVector3d& size);
+
+    /// Set the normal contact stiffness and damping coefficients for the default contact force.
+    /// These coefficients are applied at each contact point (default: kn = 5e6, gn = 5e3).
+    void SetContactParameters(double kn, double gn);
+
+    virtual bool OverridesIdlerContact() const override { return m_idler_contact; }
+    virtual bool OverridesWheelContact() const override { return true; }
+
+    virtual void ComputeIdlerContactForce(const ChCollisionInfo& cinfo,
+                                          std::shared_ptr<ChBody> idlerBody,
+                                          std::shared_ptr<ChBody> shoeBody,
+                                          ChVector3d& forceShoe) override;
+
+    virtual void ComputeWheelContactForce(const ChCollisionInfo& cinfo,
+                                          std::shared_ptr<ChBody> wheelBody,
+                                          std::shared_ptr<ChBody> shoeBody,
+                                          ChVector3d& forceShoe) override;
+
+    /// Collide a wheel cylinder with a track shoe contact patch.
+    /// The contact line on the cylinder (the rim generator closest to the patch plane) is clipped laterally to the
+    /// patch width. If an end of the clipped segment lies beyond the patch length, it is moved along the rim to the
+    /// patch edge. A collision is reported at each end of the segment that penetrates the patch. The collision points
+    /// and normal (from the wheel to the shoe) are expressed in the absolute frame; contactable models are not set.
+    /// Return the number of collisions (0, 1, or 2) written in 'cinfo'.
+    static int CollideCylinderPatch(const ChVector3d& c,          ///< [in] cylinder center
+                                    const ChVector3d& a,          ///< [in] cylinder axis (unit vector)
+                                    double R,                     ///< [in] cylinder radius
+                                    double hw,                    ///< [in] cylinder half-width
+                                    const ChFrame<>& shoe_frame,  ///< [in] shoe body frame
+                                    const ShoePatch& patch,       ///< [in] shoe contact patch
+                                    ChCollisionInfo* cinfo        ///< [out] collisions (room for at least 2)
+    );
+
+    /// Collide a wheel cylinder with a track shoe guide pin.
+    /// Only lateral collisions are considered, between a side face of the guide pin (normal to the shoe Y axis) and
+    /// the flat faces of the cylinder. A collision is reported for each side face whose point closest to the cylinder
+    /// center lies inside the cylinder; the penetration is measured along the cylinder axis. The collision points and
+    /// normal (from the wheel to the shoe) are expressed in the absolute frame; contactable models are not set.
+    /// Return the number of collisions (0, 1, or 2) written in 'cinfo'.
+    static int CollideCylinderGuide(const ChVector3d& c,          ///< [in] cylinder center
+                                    const ChVector3d& a,          ///< [in] cylinder axis (unit vector)
+                                    double R,                     ///< [in] cylinder radius
+                                    double hw,                    ///< [in] cylinder half-width
+                                    const ChFrame<>& shoe_frame,  ///< [in] shoe body frame
+                                    const ShoeGuide& guide,       ///< [in] shoe guide pin
+                                    ChCollisionInfo* cinfo        ///< [out] collisions (room for at least 2)
+    );
+
+  protected:
+    virtual bool GeneratesCollisions() const override { return true; }
+    virtual void GenerateCollisions(ChTrackedVehicle* vehicle,
+                                    std::vector<ChCollisionInfo>& idler_collisions,
+                                    std::vector<ChCollisionInfo>& wheel_collisions) override;
+    virtual bool GeneratesLateralCollisions(const ChTrackAssembly& track) override;
+
+    /// Normal-only spring-damper contact force on the track shoe.
+    void ComputeContactForce(const ChCollisionInfo& cinfo, ChVector3d& forceShoe) const;
+
+  private:
+    /// Get the contact patches of the track shoes of the given track assembly.
+    static std::vector<ShoePatch> GetShoePatches(const ChTrackAssembly& track);
+
+    /// Get the guide pins of the track shoes of the given track assembly (empty if not known).
+    static std::vector<ShoeGuide> GetShoeGuides(const ChTrackAssembly& track);
+
+    /// Append the collisions between the given track wheel and the track shoes of the given track assembly.
+    void CollideWheel(const ChTrackWheel& wheel,
+                      const ChTrackAssembly& track,
+                      const std::vector<ShoePatch>& patches,
+                      const std::vector<ShoeGuide>& guides,
+                      std::vector<ChCollisionInfo>& collisions) const;
+
+    bool m_idler_contact;                 ///< generate idler-shoe contacts
+    bool m_user_patch;                    ///< use the user-specified shoe contact patch
+    bool m_user_guide;                    ///< use the user-specified shoe guide pin
+    std::vector<ShoePatch> m_patches[2];  ///< shoe contact patches (left and right tracks)
+    std::vector<ShoeGuide> m_guides[2];   ///< shoe guide pins (left and right tracks, empty if not generated)
+    double m_kn;                          ///< normal contact stiffness (per contact point)
+    double m_gn;                          ///< normal contact damping (per contact point)
+};
+
 /// @} vehicle_tracked
 
 }  // end namespace vehicle
@@ -330,6 +330,25 @@ void ChTrackedVehicle::EnableCustomContact(std::shared_ptr<ChTrackCustomContact>
 
     // Use the narrow-phase callback mechanism to intercept all collisions between wheels and track shoes
     m_collision_manager = std::shared_ptr<ChTrackCollisionManager>(new ChTrackCollisionManager(this));
+    // If the callback generates its own idler-shoe and wheel-shoe collisions, including the lateral (guide pin) ones,
+    // these pairs are not processed by the collision system at all. Otherwise, they are still processed so that
+    // lateral contacts are generated; the other intercepted collisions are replaced by those generated by the callback.
+    if (callback->GeneratesCollisions()) {
+        auto disable_shoe_collisions = [](const ChTrackWheel& wheel) {
+            if (auto model = wheel.GetBody()->GetCollisionModel())
+                model->DisallowCollisionsWith(TrackedCollisionFamily::SHOES);
+        };
+        for (auto& track : m_tracks) {
+            if (!callback->GeneratesLateralCollisions(*track))
+                continue;
+            if (idler_shoe)
+                disable_shoe_collisions(*track->GetIdlerWheel());
+            if (wheel_shoe) {
+                for (size_t i = 0; i < track->GetNumTrackSuspensions(); i++)
+                    disable_shoe_collisions(*track->GetRoadWheel(i));
+            }
+        }
+    }
     m_collision_manager->m_idler_shoe = idler_shoe;
     m_collision_manager->m_wheel_shoe = wheel_shoe;
     m_collision_manager->m_ground_shoe = ground_shoe;
@@ -337,6 +356,7 @@ void ChTrackedVehicle::EnableCustomContact(std::shared_ptr<ChTrackCustomContact>
 
     // Add the provided callback as a load container to the system
     callback->m_collision_manager = m_collision_manager.get();
+    callback->m_vehicle = this;
     m_system->Add(callback);
 }
 
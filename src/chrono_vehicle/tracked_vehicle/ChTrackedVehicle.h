@@ -125,6 +125,10 @@ class CH_VEHICLE_API ChTrackedVehicle : public ChVehicle {
     /// contact forces are generated by the underlying Chrono contact processing. If enabled, no contact forces are
     /// applied automatically for specified collision types. Instead, these collisions are cached and passed to the
     /// user-supplied callback which must compute the contact force for each individual collision.
+    /// If the callback generates its own idler-shoe and wheel-shoe collisions (see ChTrackAnalyticContact), these pairs
+    /// are removed from the underlying collision system if the callback also generates the lateral (guide pin)
+    /// collisions; otherwise, only the lateral contacts reported by the collision system for these pairs are kept.
+    /// Must be called after the vehicle is initialized.
     void EnableCustomContact(std::shared_ptr<ChTrackCustomContact> callback);
 
     /// Set contacts to be monitored.
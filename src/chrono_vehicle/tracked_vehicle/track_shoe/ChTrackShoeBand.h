@@ -151,6 +151,7 @@ class CH_VEHICLE_API ChTrackShoeBand : public ChTrackShoe {
 
     friend class ChSprocketBand;
     friend class SprocketBandContactCB;
+    friend class ChTrackAnalyticContact;
 };
 
 /// Vector of handles to continuous band track shoe subsystems.
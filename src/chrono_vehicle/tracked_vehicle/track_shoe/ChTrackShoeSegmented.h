@@ -39,6 +39,9 @@ class CH_VEHICLE_API ChTrackShoeSegmented : public ChTrackShoe {
     /// Get the contact material for the track shoe part interacting with the sprocket.
     std::shared_ptr<ChContactMaterial> GetSprocketContactMaterial() const { return m_shoe_sprk_material; }
 
+    /// Get the visualization and collision geometry of the track shoe body.
+    const ChVehicleGeometry& GetGeometry() const { return m_geometry; }
+
   protected:
     ChTrackShoeSegmented(const std::string& name);
 
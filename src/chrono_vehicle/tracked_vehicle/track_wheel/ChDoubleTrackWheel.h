@@ -58,7 +58,6 @@ class CH_VEHICLE_API ChDoubleTrackWheel : public ChTrackWheel {
     /// Remove visualization assets for the track-wheel subsystem.
     virtual void RemoveVisualizationAssets() override final;
 
-  protected:
     /// Return the gap width.
     virtual double GetGap() const = 0;
 };
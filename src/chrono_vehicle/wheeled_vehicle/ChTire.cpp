@@ -19,6 +19,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/physics/ChSystem.h"
@@ -458,5 +459,39 @@ ChVector3d ChTire::EstimateInertia(double tire_width,    // tire width [mm]
     return ChVector3d(Itip_tread + 2 * Itip_sidewall, Irot_tread + 2 * Irot_sidewall, Itip_tread + 2 * Itip_sidewall);
 }
 
+// -----------------------------------------------------------------------------
+// Synchronize and advance a list of tires, possibly concurrently.
+// Each tire only reads the state of its wheel (and queries the terrain) and only writes its own state.
+// -----------------------------------------------------------------------------
+void SynchronizeTires(const ChTireList& tires, double time, const ChTerrain& terrain, int num_threads) {
+    int num_tires = (int)tires.size();
+    int nthreads = terrain.SupportsConcurrentQueries() ? std::min(num_threads, num_tires) : 1;
+
+    if (nthreads <= 1) {
+        for (auto& tire : tires)
+            tire->Synchronize(time, terrain);
+        return;
+    }
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < num_tires; i++)
+        tires[i]->Synchronize(time, terrain);
+}
+
+void AdvanceTires(const ChTireList& tires, double step, int num_threads) {
+    int num_tires = (int)tires.size();
+    int nthreads = std::min(num_threads, num_tires);
+
+    if (nthreads <= 1) {
+        for (auto& tire : tires)
+            tire->Advance(step);
+        return;
+    }
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < num_tires; i++)
+        tires[i]->Advance(step);
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
@@ -274,6 +274,16 @@ class CH_VEHICLE_API ChTire : public ChPart {
 /// Vector of handles to tire subsystems.
 typedef std::vector<std::shared_ptr<ChTire> > ChTireList;
 
+/// Synchronize all tires in the given list.
+/// If num_threads > 1 and the terrain supports concurrent queries (see ChTerrain::SupportsConcurrentQueries), the tires
+/// are processed concurrently. This requires that ChTire::Synchronize only modifies the state of the given tire, which
+/// is the case for all Chrono::Vehicle tire models.
+CH_VEHICLE_API void SynchronizeTires(const ChTireList& tires, double time, const ChTerrain& terrain, int num_threads);
+
+/// Advance the states of all tires in the given list by the specified time step.
+/// If num_threads > 1, the tires are processed concurrently.
+CH_VEHICLE_API void AdvanceTires(const ChTireList& tires, double step, int num_threads);
+
 /// @} vehicle_wheeled_tire
 
 }  // end namespace vehicle
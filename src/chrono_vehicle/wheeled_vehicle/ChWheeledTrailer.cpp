@@ -21,7 +21,7 @@
 namespace chrono {
 namespace vehicle {
 
-ChWheeledTrailer::ChWheeledTrailer(const std::string& name, ChSystem* system) : m_name(name) {}
+ChWheeledTrailer::ChWheeledTrailer(const std::string& name, ChSystem* system) : m_name(name), m_tire_nthreads(1) {}
 
 void ChWheeledTrailer::Initialize(std::shared_ptr<ChChassis> frontChassis) {
     m_chassis->Initialize(frontChassis, WheeledCollisionFamily::CHASSIS);
@@ -67,24 +67,36 @@ void ChWheeledTrailer::SetTireVisualizationType(VisualizationType vis) {
 
 // Synchronize the trailer subsystem at the specified time
 void ChWheeledTrailer::Synchronize(double time, const DriverInputs& driver_inputs, const ChTerrain& terrain) {
+    // Synchronize the trailer tires (concurrently, if so requested and supported by the terrain)
+    SynchronizeTires(GetAttachedTires(), time, terrain, m_tire_nthreads);
+
     // Synchronize the trailer's axle subsystems
-    // (this applies tire forces to suspension spindles and braking input)
-    for (auto axle : m_axles) {
-        for (auto& wheel : axle->GetWheels()) {
-            wheel->GetTire()->Synchronize(time, terrain);
-            axle->Synchronize(time, driver_inputs);
-        }
+    // (this applies tire forces to suspension spindles and braking input).
+    // Each axle is synchronized once, after all tires, as in ChWheeledVehicle. ChAxle::Synchronize empties the spindle
+    // accumulators and then loads the current force of each of its tires, so the spindle forces are the same as when
+    // the axle was synchronized after each of its tires (only the last of those calls had an effect).
+    for (auto& axle : m_axles) {
+        axle->Synchronize(time, driver_inputs);
     }
 }
 
 // Advance state of the trailer subsystem by the specified step
 void ChWheeledTrailer::Advance(double step) {
-    for (auto axle : m_axles) {
+    AdvanceTires(GetAttachedTires(), step, m_tire_nthreads);
+    for (auto& axle : m_axles) {
+        axle->Advance(step);
+    }
+}
+
+const ChTireList& ChWheeledTrailer::GetAttachedTires() {
+    m_tires.clear();
+    for (auto& axle : m_axles) {
         for (auto& wheel : axle->GetWheels()) {
-            wheel->GetTire()->Advance(step);
+            if (wheel->GetTire())
+                m_tires.push_back(wheel->GetTire());
         }
-        axle->Advance(step);
     }
+    return m_tires;
 }
 
 }  // end namespace vehicle
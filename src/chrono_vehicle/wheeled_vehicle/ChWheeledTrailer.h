@@ -22,6 +22,8 @@
 #ifndef CH_WHEELED_TRAILER_H
 #define CH_WHEELED_TRAILER_H
 
+#include <algorithm>
+
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChTerrain.h"
 #include "chrono_vehicle/ChChassis.h"
@@ -96,6 +98,10 @@ class CH_VEHICLE_API ChWheeledTrailer {
                         VisualizationType tire_vis = VisualizationType::PRIMITIVES,
                         ChTire::CollisionType tire_coll = ChTire::CollisionType::SINGLE_POINT);
 
+    /// Set the number of threads used to evaluate the trailer tires (default: 1).
+    /// See ChWheeledVehicle::SetTireNumThreads.
+    void SetTireNumThreads(int num_threads) { m_tire_nthreads = std::max(num_threads, 1); }
+
     /// Update the state of this trailer at the current time.
     /// The trailer system is provided the current driver inputs and a reference to the terrain system.
     void Synchronize(double time,                        ///< [in] current time
@@ -118,6 +124,13 @@ class CH_VEHICLE_API ChWheeledTrailer {
     std::shared_ptr<ChChassisRear> m_chassis;              ///< trailer chassis
     std::shared_ptr<ChChassisConnectorHitch> m_connector;  ///< connector to pulling vehicle
     chrono::vehicle::ChAxleList m_axles;                   ///< list of axle subsystems
+
+  private:
+    /// Collect the tires attached to the trailer wheels.
+    const ChTireList& GetAttachedTires();
+
+    int m_tire_nthreads;  ///< number of threads for tire evaluation
+    ChTireList m_tires;   ///< cache of attached tires
 };
 
 /// @} vehicle_wheeled
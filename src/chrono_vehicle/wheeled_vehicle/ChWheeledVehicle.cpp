@@ -28,10 +28,10 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 ChWheeledVehicle::ChWheeledVehicle(const std::string& name, ChContactMethod contact_method)
-    : ChVehicle(name, contact_method), m_parking_on(false) {}
+    : ChVehicle(name, contact_method), m_parking_on(false), m_tire_nthreads(1) {}
 
 ChWheeledVehicle::ChWheeledVehicle(const std::string& name, ChSystem* system)
-    : ChVehicle(name, system), m_parking_on(false) {}
+    : ChVehicle(name, system), m_parking_on(false), m_tire_nthreads(1) {}
 
 // -----------------------------------------------------------------------------
 // Initialize a tire and attach it to one of the vehicle's wheels.
@@ -90,15 +90,21 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
 }
 
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs, const ChTerrain& terrain) {
-    // Synchronize any associated tires
+    // Synchronize any associated tires (concurrently, if so requested and supported by the terrain)
+    SynchronizeTires(GetAttachedTires(), time, terrain, m_tire_nthreads);
+
+    Synchronize(time, driver_inputs);
+}
+
+const ChTireList& ChWheeledVehicle::GetAttachedTires() {
+    m_tires.clear();
     for (auto& axle : m_axles) {
         for (auto& wheel : axle->GetWheels()) {
             if (wheel->m_tire)
-                wheel->m_tire->Synchronize(time, terrain);
+                m_tires.push_back(wheel->m_tire);
         }
     }
-
-    Synchronize(time, driver_inputs);
+    return m_tires;
 }
 
 // -----------------------------------------------------------------------------
@@ -110,14 +116,11 @@ void ChWheeledVehicle::Advance(double step) {
         m_powertrain_assembly->Advance(step);
     }
 
-    // Advance state of all axles and vehicle tires.
+    // Advance state of all vehicle tires and axles.
     // This is done before advancing the state of the multibody system in order to use wheel states corresponding to
     // current time.
+    AdvanceTires(GetAttachedTires(), step, m_tire_nthreads);
     for (auto& axle : m_axles) {
-        for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
-                wheel->m_tire->Advance(step);
-        }
         axle->Advance(step);
     }
 
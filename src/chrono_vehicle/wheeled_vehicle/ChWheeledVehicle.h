@@ -22,6 +22,8 @@
 #ifndef CH_WHEELED_VEHICLE_H
 #define CH_WHEELED_VEHICLE_H
 
+#include <algorithm>
+
 #include "chrono_vehicle/ChVehicle.h"
 #include "chrono_vehicle/ChTerrain.h"
 #include "chrono_vehicle/wheeled_vehicle/ChSubchassis.h"
@@ -158,6 +160,11 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
     /// This only controls collisions between the chassis and the wheel/tire systems.
     virtual void SetChassisVehicleCollide(bool state) override;
 
+    /// Set the number of threads used to evaluate the vehicle tires (default: 1).
+    /// If more than one thread is specified, tires are synchronized concurrently, provided the terrain supports
+    /// concurrent queries (see ChTerrain::SupportsConcurrentQueries), and advanced concurrently.
+    void SetTireNumThreads(int num_threads) { m_tire_nthreads = std::max(num_threads, 1); }
+
     /// Enable/disable output from the suspension subsystems.
     /// See also ChVehicle::SetOuput.
     void SetSuspensionOutput(int id, bool state);
@@ -273,6 +280,13 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
     ChSteeringList m_steerings;                  ///< list of steering subsystems
     std::shared_ptr<ChDrivelineWV> m_driveline;  ///< driveline subsystem
     bool m_parking_on;                           ///< indicates whether or not parking brake is engaged
+
+  private:
+    /// Collect the tires attached to the vehicle wheels.
+    const ChTireList& GetAttachedTires();
+
+    int m_tire_nthreads;  ///< number of threads for tire evaluation
+    ChTireList m_tires;   ///< cache of attached tires
 };
 
 /// @} vehicle_wheeled
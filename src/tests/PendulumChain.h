@@ -0,0 +1,71 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Pendulum chain model shared by unit and benchmark tests.
+//
+// =============================================================================
+
+#ifndef CH_TESTS_PENDULUM_CHAIN_H
+#define CH_TESTS_PENDULUM_CHAIN_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+/// Add to the system a pendulum chain of n boxes with given length, aligned with the X axis and starting at the given
+/// point. Each box is connected to the previous one (the first one to the ground) by a revolute joint (Z axis).
+/// Return the boxes of the chain.
+inline std::vector<std::shared_ptr<chrono::ChBody>> AddPendulumChain(chrono::ChSystem& sys,
+                                                                     std::shared_ptr<chrono::ChBody> ground,
+                                                                     int n,
+                                                                     double length = 0.25,
+                                                                     const chrono::ChVector3d& origin = chrono::VNULL) {
+    using namespace chrono;
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto prev = ground;
+    for (int i = 0; i < n; i++) {
+        auto body = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 1000.0, false, false);
+        body->SetPos(origin + ChVector3d((i + 0.5) * length, 0, 0));
+        sys.AddBody(body);
+
+        auto revolute = chrono_types::make_shared<ChLinkLockRevolute>();
+        revolute->Initialize(prev, body, ChFrame<>(origin + ChVector3d(i * length, 0, 0)));
+        sys.AddLink(revolute);
+
+        bodies.push_back(body);
+        prev = body;
+    }
+
+    return bodies;
+}
+
+/// Create an NSC system with a single pendulum chain of n boxes (bilateral constraints only).
+inline std::unique_ptr<chrono::ChSystem> CreatePendulumChain(int n) {
+    using namespace chrono;
+
+    auto sys = chrono_types::make_unique<ChSystemNSC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    AddPendulumChain(*sys, ground, n);
+
+    return sys;
+}
+
+#endif
@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the loops over FEA mesh elements.
+// Internal force and Jacobian evaluation over a block of linear tetrahedra,
+// through the ChMesh element loops (elements grouped by type, statically
+// dispatched calls to the element computations) and through a loop of virtual
+// calls to the element functions, all on a single thread.
+//
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a block of n x n x n cubes, each split in 6 tetrahedra, fixed at the bottom face
+static ChSystemSMC* CreateTetraBlock(int n) {
+    auto sys = new ChSystemSMC();
+    sys->SetNumThreads(1);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetAutomaticGravity(false);
+    sys->Add(mesh);
+
+    auto material = chrono_types::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+
+    const double h = 0.1;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int k = 0; k <= n; k++) {
+        for (int j = 0; j <= n; j++) {
+            for (int i = 0; i <= n; i++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(i * h, j * h, k * h));
+                node->SetFixed(k == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+    auto node = [&](int i, int j, int k) { return nodes[(k * (n + 1) + j) * (n + 1) + i]; };
+
+    // Split of the cube with vertices c[0..7] along its main diagonal c[0]-c[7]
+    const int tets[6][4] = {{0, 1, 3, 7}, {0, 1, 5, 7}, {0, 2, 3, 7}, {0, 2, 6, 7}, {0, 4, 5, 7}, {0, 4, 6, 7}};
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                std::shared_ptr<ChNodeFEAxyz> c[8];
+                for (int v = 0; v < 8; v++)
+                    c[v] = node(i + (v & 1), j + ((v >> 1) & 1), k + ((v >> 2) & 1));
+                for (const auto& t : tets) {
+                    auto tet = chrono_types::make_shared<ChElementTetraCorot_4>();
+                    tet->SetNodes(c[t[0]], c[t[1]], c[t[2]], c[t[3]]);
+                    tet->SetMaterial(material);
+                    mesh->AddElement(tet);
+                }
+            }
+        }
+    }
+
+    sys->Setup();
+    sys->Update();
+
+    // Deform the block, so that the corotational elements have non-trivial rotations
+    for (auto& nd : nodes) {
+        auto pos = nd->GetX0();
+        nd->SetPos(pos + ChVector3d(0.1 * pos.z() * pos.z(), 0.05 * pos.x() * pos.z(), -0.02 * pos.z()));
+    }
+    sys->Update();
+
+    return sys;
+}
+
+// Benchmarking fixture: the mesh is created once and shared by all benchmarks
+class ElementLoopsFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State&) override {
+        static ChSystemSMC* sys = CreateTetraBlock(12);
+        mesh = sys->GetMeshes().front();
+        R.setZero(sys->GetNumCoordsVelLevel());
+    }
+
+    std::shared_ptr<ChMesh> mesh;
+    ChVectorDynamic<> R;
+};
+
+BENCHMARK_DEFINE_F(ElementLoopsFixture, InternalForces_Virtual)(benchmark::State& st) {
+    for (auto _ : st) {
+        for (const auto& element : mesh->GetElements())
+            element->EleIntLoadResidual_F(R, 1.0);
+        benchmark::DoNotOptimize(R.data());
+    }
+    st.counters["elements"] = mesh->GetNumElements();
+}
+BENCHMARK_REGISTER_F(ElementLoopsFixture, InternalForces_Virtual)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(ElementLoopsFixture, InternalForces_Mesh)(benchmark::State& st) {
+    for (auto _ : st) {
+        mesh->IntLoadResidual_F(mesh->GetOffset_w(), R, 1.0);
+        benchmark::DoNotOptimize(R.data());
+    }
+    st.counters["elements"] = mesh->GetNumElements();
+}
+BENCHMARK_REGISTER_F(ElementLoopsFixture, InternalForces_Mesh)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(ElementLoopsFixture, Jacobians_Virtual)(benchmark::State& st) {
+    for (auto _ : st) {
+        for (const auto& element : mesh->GetElements())
+            element->LoadKRMMatrices(1.0, 0.1, 0.01);
+    }
+    st.counters["elements"] = mesh->GetNumElements();
+}
+BENCHMARK_REGISTER_F(ElementLoopsFixture, Jacobians_Virtual)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(ElementLoopsFixture, Jacobians_Mesh)(benchmark::State& st) {
+    for (auto _ : st) {
+        mesh->LoadKRMMatrices(1.0, 0.1, 0.01);
+    }
+    st.counters["elements"] = mesh->GetNumElements();
+}
+BENCHMARK_REGISTER_F(ElementLoopsFixture, Jacobians_Mesh)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the matrix-vector products of the system descriptor
+// (Schur complement product and system product, as used by iterative solvers),
+// evaluated serially and in parallel with different numbers of threads.
+// The problem is a packed grid of spheres with NSC frictional contacts.
+//
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// Create a grid of slightly overlapping spheres on a fixed floor and take one step to generate the contacts
+static ChSystemNSC* CreateContactProblem() {
+    const int n = 12;
+    const double radius = 0.5;
+    const double spacing = 0.99;
+
+    auto sys = new ChSystemNSC();
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetSolverType(ChSolver::Type::APGD);
+    sys->GetSolver()->AsIterative()->SetMaxIterations(5);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto floor = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    floor->SetPos(ChVector3d(0, -0.5 + 0.01, 0));
+    floor->SetFixed(true);
+    sys->AddBody(floor);
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            for (int k = 0; k < n; k++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                sphere->SetPos(ChVector3d((i - n / 2) * spacing, radius + j * spacing, (k - n / 2) * spacing));
+                sys->AddBody(sphere);
+            }
+        }
+    }
+
+    sys->DoStepDynamics(1e-3);
+    return sys;
+}
+
+// Benchmarking fixture: the contact problem is created once and shared by all benchmarks
+class DescriptorFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        static ChSystemNSC* sys = CreateContactProblem();
+        descriptor = sys->GetSystemDescriptor().get();
+        int nthreads = (int)st.range(0);
+        descriptor->SetNumThreads(nthreads);
+        descriptor->EnableParallelProducts(nthreads > 1);
+
+        n_q = descriptor->CountActiveVariables();
+        n_c = descriptor->CountActiveConstraints();
+        l = ChVectorDynamic<>::Random(n_c);
+        x = ChVectorDynamic<>::Random(n_q + n_c);
+    }
+
+    ChSystemDescriptor* descriptor;
+    unsigned int n_q;
+    unsigned int n_c;
+    ChVectorDynamic<> l;
+    ChVectorDynamic<> x;
+    ChVectorDynamic<> result;
+};
+
+BENCHMARK_DEFINE_F(DescriptorFixture, SchurComplementProduct)(benchmark::State& st) {
+    for (auto _ : st) {
+        descriptor->SchurComplementProduct(result, l);
+        benchmark::DoNotOptimize(result.data());
+    }
+    st.counters["constraints"] = n_c;
+}
+BENCHMARK_REGISTER_F(DescriptorFixture, SchurComplementProduct)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
+
+BENCHMARK_DEFINE_F(DescriptorFixture, SystemProduct)(benchmark::State& st) {
+    for (auto _ : st) {
+        descriptor->SystemProduct(result, x);
+        benchmark::DoNotOptimize(result.data());
+    }
+    st.counters["constraints"] = n_c;
+}
+BENCHMARK_REGISTER_F(DescriptorFixture, SystemProduct)
+    ->Unit(benchmark::kMicrosecond)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime();
@@ -0,0 +1,229 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Regression benchmarks for the combinations of solver and timestepper types,
+// over a set of standard problems of increasing size:
+//  - rigid_chain:  pendulum chain of N bodies connected by revolute joints
+//  - granular_nsc: pile of N spheres in a box, NSC contact
+//  - granular_smc: pile of N spheres in a box, SMC contact
+//  - fea_beam:     cantilever beam with N Euler beam elements
+// For each problem, all valid combinations (e.g., only complementarity solvers
+// for NSC contact, only linear solvers for FEA) are benchmarked.
+//
+// Benchmarks are named <problem>/<solver>/<timestepper>/<N> and report per-step
+// counters (see utils::ChBenchmarkStats): times of the simulation phases [ms],
+// solver and nonlinear iterations, residual of the last solve, problem size.
+// Use the Google benchmark options for selecting benchmarks and generating
+// machine-readable output, e.g.:
+//   btest_CH_regression --benchmark_filter=rigid_chain/.*/HHT
+//                       --benchmark_out=results.json --benchmark_out_format=json
+//
+// =============================================================================
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "tests/PendulumChain.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+// Number of simulation steps in each benchmark iteration
+static const int num_steps = 10;
+
+// Problem class: model factory (for a given size), step size, number of steps for hot start, and valid combinations
+// of solver and timestepper types
+struct Problem {
+    struct Methods {
+        std::vector<ChSolver::Type> solvers;
+        std::vector<ChTimestepper::Type> timesteppers;
+    };
+
+    std::string name;
+    std::function<std::unique_ptr<ChSystem>(int)> create;
+    std::vector<int> sizes;
+    double step;
+    int num_warmup_steps;
+    std::vector<Methods> methods;
+};
+
+static const std::vector<ChSolver::Type> vi_solvers = {
+    ChSolver::Type::PSOR,    ChSolver::Type::PSSOR, ChSolver::Type::PJACOBI, ChSolver::Type::PMINRES,
+    ChSolver::Type::BARZILAIBORWEIN, ChSolver::Type::APGD,  ChSolver::Type::ADMM};
+
+static const std::vector<ChSolver::Type> linear_solvers = {ChSolver::Type::SPARSE_LU, ChSolver::Type::SPARSE_QR,
+                                                           ChSolver::Type::GMRES, ChSolver::Type::MINRES,
+                                                           ChSolver::Type::BICGSTAB};
+
+static const std::vector<ChTimestepper::Type> vi_timesteppers = {ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED,
+                                                                 ChTimestepper::Type::EULER_IMPLICIT_PROJECTED};
+
+static const std::vector<ChTimestepper::Type> implicit_timesteppers = {
+    ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED, ChTimestepper::Type::EULER_IMPLICIT,
+    ChTimestepper::Type::TRAPEZOIDAL,               ChTimestepper::Type::TRAPEZOIDAL_LINEARIZED,
+    ChTimestepper::Type::HHT,                       ChTimestepper::Type::NEWMARK};
+
+static const std::vector<ChTimestepper::Type> explicit_timesteppers = {
+    ChTimestepper::Type::EULER_EXPLICIT, ChTimestepper::Type::HEUN, ChTimestepper::Type::RUNGEKUTTA45,
+    ChTimestepper::Type::LEAPFROG};
+
+// -----------------------------------------------------------------------------
+
+// Pile of N spheres falling in a box, with NSC or SMC contact
+static std::unique_ptr<ChSystem> CreateGranularPile(int n, ChContactMethod method) {
+    std::unique_ptr<ChSystem> sys;
+    std::shared_ptr<ChContactMaterial> mat;
+    if (method == ChContactMethod::NSC) {
+        sys = chrono_types::make_unique<ChSystemNSC>();
+        mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    } else {
+        sys = chrono_types::make_unique<ChSystemSMC>();
+        mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    }
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    mat->SetFriction(0.4f);
+
+    // Container: 8x8 spheres per layer
+    double radius = 0.05;
+    double spacing = 2.2 * radius;
+    int m = 8;
+    double width = m * spacing + 2 * radius;
+    double height = (n / (m * m) + 1) * spacing + 0.5;
+    double thickness = 0.1;
+
+    auto add_wall = [&](const ChVector3d& size, const ChVector3d& pos) {
+        auto wall = chrono_types::make_shared<ChBodyEasyBox>(size.x(), size.y(), size.z(), 1000.0, false, true, mat);
+        wall->SetPos(pos);
+        wall->SetFixed(true);
+        sys->AddBody(wall);
+    };
+    add_wall(ChVector3d(width, width, thickness), ChVector3d(0, 0, -thickness / 2));
+    add_wall(ChVector3d(thickness, width, height), ChVector3d(-(width + thickness) / 2, 0, height / 2));
+    add_wall(ChVector3d(thickness, width, height), ChVector3d(+(width + thickness) / 2, 0, height / 2));
+    add_wall(ChVector3d(width, thickness, height), ChVector3d(0, -(width + thickness) / 2, height / 2));
+    add_wall(ChVector3d(width, thickness, height), ChVector3d(0, +(width + thickness) / 2, height / 2));
+
+    // Spheres on a regular lattice (slightly perturbed)
+    for (int i = 0; i < n; i++) {
+        int layer = i / (m * m);
+        int ix = (i % (m * m)) % m;
+        int iy = (i % (m * m)) / m;
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 2000.0, false, true, mat);
+        sphere->SetPos(ChVector3d((ix - 0.5 * (m - 1)) * spacing + 0.01 * radius * (layer % 3),
+                                  (iy - 0.5 * (m - 1)) * spacing, radius + layer * spacing));
+        sys->AddBody(sphere);
+    }
+
+    return sys;
+}
+
+// Cantilever beam of N Euler beam elements, under gravity
+static std::unique_ptr<ChSystem> CreateBeam(int n) {
+    auto sys = chrono_types::make_unique<ChSystemSMC>();
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto mesh = chrono_types::make_shared<fea::ChMesh>();
+    sys->Add(mesh);
+
+    auto section = chrono_types::make_shared<fea::ChBeamSectionEulerEasyRectangular>(0.02, 0.02, 2e9, 0.8e9, 1000.0);
+    fea::ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, n, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), ChVector3d(0, 1, 0));
+    builder.GetLastBeamNodes().front()->SetFixed(true);
+
+    return sys;
+}
+
+// -----------------------------------------------------------------------------
+
+static const std::vector<Problem> problems = {
+    {"rigid_chain",
+     CreatePendulumChain,
+     {8, 32, 128},
+     1e-3,
+     10,
+     {{vi_solvers, vi_timesteppers}, {linear_solvers, implicit_timesteppers}, {linear_solvers, explicit_timesteppers}}},
+    {"granular_nsc",
+     [](int n) { return CreateGranularPile(n, ChContactMethod::NSC); },
+     {64, 256, 1024},
+     2e-3,
+     50,
+     {{vi_solvers, vi_timesteppers}}},
+    {"granular_smc",
+     [](int n) { return CreateGranularPile(n, ChContactMethod::SMC); },
+     {64, 256, 1024},
+     5e-4,
+     200,
+     {{linear_solvers, {ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED, ChTimestepper::Type::HHT}}}},
+    {"fea_beam",
+     CreateBeam,
+     {8, 32, 128},
+     1e-3,
+     10,
+     {{linear_solvers, implicit_timesteppers}}},
+};
+
+// -----------------------------------------------------------------------------
+
+static void RunProblem(benchmark::State& st,
+                       const Problem& problem,
+                       int size,
+                       ChSolver::Type solver_type,
+                       ChTimestepper::Type timestepper_type) {
+    auto sys = problem.create(size);
+    utils::SetSolverAndTimestepper(*sys, solver_type, timestepper_type);
+
+    for (int i = 0; i < problem.num_warmup_steps; i++)
+        sys->DoStepDynamics(problem.step);
+
+    utils::ChBenchmarkStats stats;
+    for (auto _ : st) {
+        for (int i = 0; i < num_steps; i++) {
+            sys->DoStepDynamics(problem.step);
+            stats.Accumulate(*sys);
+        }
+    }
+    stats.Report(*sys, st);
+}
+
+static bool RegisterProblems() {
+    for (const auto& problem : problems) {
+        for (const auto& methods : problem.methods) {
+            for (auto solver_type : methods.solvers) {
+                for (auto timestepper_type : methods.timesteppers) {
+                    for (int size : problem.sizes) {
+                        std::string name = problem.name + "/" + utils::GetSolverTypeName(solver_type) + "/" +
+                                           utils::GetTimestepperTypeName(timestepper_type) + "/" +
+                                           std::to_string(size);
+                        benchmark::RegisterBenchmark(name.c_str(), RunProblem, problem, size, solver_type,
+                                                     timestepper_type)
+                            ->Unit(benchmark::kMillisecond);
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static const bool registered = RegisterProblems();
@@ -93,6 +93,12 @@ bool parallel_tracks = false;
 // Rank for run-time visualization
 int vis_rank = -1;
 
+// Quantization step for compact SCM messages (0: full-precision node levels)
+double scm_resolution = 0;
+
+// Pack compact SCM messages as variable-length integers
+bool scm_pack = false;
+
 // =============================================================================
 
 // Forward declares for straight forward helper functions
@@ -141,6 +147,8 @@ int main(int argc, char* argv[]) {
     nthreads = cli.GetAsType<int>("nthreads");
     wheel_patches = cli.GetAsType<bool>("wheel_patches");
     parallel_tracks = cli.GetAsType<bool>("parallel_tracks");
+    scm_resolution = cli.GetAsType<double>("resolution");
+    scm_pack = cli.GetAsType<bool>("pack");
 
     chrono_collsys = cli.GetAsType<bool>("csys");
 #ifndef CHRONO_COLLISION
@@ -160,6 +168,11 @@ int main(int argc, char* argv[]) {
     if (node_id == 0) {
         std::cout << "Collision system: " << (chrono_collsys ? "Chrono" : "Bullet") << std::endl;
         std::cout << "Num SCM threads: " << nthreads << std::endl;
+        std::cout << "SCM messages:    ";
+        if (scm_resolution > 0)
+            std::cout << "compact (resolution " << scm_resolution << (scm_pack ? ", packed)" : ")") << std::endl;
+        else
+            std::cout << "full precision" << std::endl;
     }
 
     // Change SynChronoManager settings
@@ -311,6 +324,7 @@ int main(int argc, char* argv[]) {
     // Create an SCMTerrainAgent and add it to the SynChrono manager
     auto scm = chrono_types::make_shared<SCMTerrain>(terrain);
     auto terrain_agent = chrono_types::make_shared<SynSCMTerrainAgent>(scm);
+    terrain_agent->SetCompactEncoding(scm_resolution, scm_pack);
     syn_manager.AddAgent(terrain_agent);
 
     // Initialzie the SynChrono manager
@@ -372,6 +386,13 @@ int main(int argc, char* argv[]) {
                 double rtf = timer() / end_time;
                 double* all_rtf = new double[num_nodes];
                 MPI_Gather(&rtf, 1, MPI_DOUBLE, all_rtf, 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+                // Average communication volume per synchronization (heartbeat), summed over all ranks
+                double num_syncs = std::max(1.0, std::floor(end_time / heartbeat));
+                double bytes[2] = {syn_manager.GetTotalBytesSent() / num_syncs,
+                                   syn_manager.GetTotalBytesReceived() / num_syncs};
+                double all_bytes[2];
+                MPI_Reduce(bytes, all_bytes, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
                 if (node_id == 0) {
                     std::string fname = "stats_" + std::to_string(num_nodes) + "_" + std::to_string(nthreads) + ".out";
                     std::ofstream ofile(fname, std::ios_base::app);
@@ -383,9 +404,11 @@ int main(int argc, char* argv[]) {
 
                     cout << endl;
                     cout << "stop timer at (s): " << end_time << endl;
-                    cout << "elapsed time (s):  " << timer() << endl;
+                    cout << "wall time (s):     " << timer() << endl;
                     cout << "chrono solver (s): " << chrono_step << endl;
                     cout << "RTF:               " << rtf << endl;
+                    cout << "bytes sent/step:   " << all_bytes[0] << "  (all ranks)" << endl;
+                    cout << "bytes recv/step:   " << all_bytes[1] << "  (all ranks)" << endl;
                     cout << "\n[" << node_id << "] SCM stats for last step:" << endl;
                     terrain.PrintStepStatistics(cout);
                     cout << "\n[" << node_id << "] Chrono stats for last step:" << endl;
@@ -462,6 +485,10 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<bool>("Test", "p,parallel_tracks", "Initialize vehicles on parallel tracks (false: criss-cross)",
                         std::to_string(parallel_tracks));
     cli.AddOption<int>("Test", "v,vis", "Run-time visualization rank", std::to_string(vis_rank));
+    cli.AddOption<double>("Test", "r,resolution", "Quantization step for compact SCM messages (0: full precision)",
+                          std::to_string(scm_resolution));
+    cli.AddOption<bool>("Test", "z,pack", "Pack compact SCM messages as variable-length integers",
+                        std::to_string(scm_pack));
 }
 
 void PrintStepStatistics(std::ostream& os, const ChSystem& sys) {
@@ -0,0 +1,111 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark for the CPU ray tracing backend.
+// A 32-channel spinning lidar (360 deg, 0.2 deg horizontal resolution) mounted
+// on a moving cart scans a scene of static and moving objects. For increasing
+// numbers of threads, report the average render time of a scan and the scan
+// rate that could be sustained in real time (target: 10 Hz).
+//
+// =============================================================================
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChConstants.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "chrono_sensor/cpu/ChCpuSensorManager.h"
+
+using namespace chrono;
+using namespace chrono::sensor;
+
+// Render num_scans lidar scans with the given number of threads and return the average time per scan [s]
+double RunScans(int num_threads, unsigned int sample_radius, int num_scans) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(VNULL);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(200, 200, 0.1, 1000, true, false);
+    ground->SetPos(ChVector3d(0, 0, -0.05));
+    ground->SetFixed(true);
+    sys.Add(ground);
+
+    // Rows of static cylinders and boxes along the road
+    for (int i = 0; i < 200; i++) {
+        auto post = chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Z, 0.2, 3, 1000, true, false);
+        post->SetPos(ChVector3d(-50 + 0.5 * i, (i % 2) ? 6 : -6, 1.5));
+        post->SetFixed(true);
+        sys.Add(post);
+
+        auto block = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 2 + (i % 5), 1000, true, false);
+        block->SetPos(ChVector3d(-50 + 0.5 * i, (i % 2) ? -12 : 12, 1 + 0.5 * (i % 5)));
+        block->SetFixed(true);
+        sys.Add(block);
+    }
+
+    // Moving spheres (traffic)
+    for (int i = 0; i < 50; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.8, 1000, true, false);
+        ball->SetPos(ChVector3d(-40 + 1.6 * i, (i % 2) ? 3 : -3, 0.8));
+        ball->SetPosDt(ChVector3d((i % 2) ? -5 : 5, 0, 0));
+        sys.Add(ball);
+    }
+
+    auto cart = chrono_types::make_shared<ChBodyEasyBox>(2, 1, 1, 1000, false, false);
+    cart->SetPos(ChVector3d(0, 0, 1.5));
+    cart->SetPosDt(ChVector3d(10, 0, 0));
+    sys.Add(cart);
+
+    // 32-channel lidar at 10 Hz
+    float update_rate = 10;
+    ChCpuSensorManager manager(&sys);
+    manager.SetNumThreads(num_threads);
+    auto lidar = chrono_types::make_shared<ChCpuLidarSensor>(
+        cart, update_rate, ChFrame<>(ChVector3d(0, 0, 1)), 1800, 32, (float)CH_2PI, (float)(15 * CH_DEG_TO_RAD),
+        (float)(-25 * CH_DEG_TO_RAD), 100.f, ChCpuLidarSensor::BeamShape::RECTANGULAR, sample_radius);
+    manager.AddSensor(lidar);
+
+    double step_size = 1e-2;
+    double render_time = 0;
+    while (lidar->GetNumLaunches() < (unsigned int)num_scans) {
+        auto start = std::chrono::high_resolution_clock::now();
+        manager.Update();
+        auto end = std::chrono::high_resolution_clock::now();
+        render_time += std::chrono::duration<double>(end - start).count();
+        sys.DoStepDynamics(step_size);
+    }
+
+    return render_time / num_scans;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "Copyright (c) 2026 projectchrono.org\nChrono version: " << CHRONO_VERSION << std::endl;
+
+    int num_procs = ChOMP::GetNumProcs();
+    int num_scans = 20;
+
+    for (unsigned int sample_radius : {1u, 2u}) {
+        unsigned int rays_per_beam = (2 * sample_radius - 1) * (2 * sample_radius - 1);
+        std::cout << "\nLidar 1800 x 32 beams, " << rays_per_beam << " ray(s) per beam" << std::endl;
+        std::cout << "threads  time/scan [ms]  max rate [Hz]" << std::endl;
+        for (int num_threads = 1; num_threads <= num_procs; num_threads *= 2) {
+            double scan_time = RunScans(num_threads, sample_radius, num_scans);
+            std::cout << std::setw(7) << num_threads << std::setw(16) << std::fixed << std::setprecision(2)
+                      << 1e3 * scan_time << std::setw(15) << 1 / scan_time << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -20,10 +20,12 @@
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/driver/ChPathFollowerDriver.h"
 #include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/tracked_vehicle/ChTrackContactManager.h"
 #include "chrono_vehicle/utils/ChVehiclePath.h"
 
 #include "chrono_models/vehicle/m113/M113.h"
@@ -38,7 +40,7 @@ using namespace chrono::vehicle::m113;
 
 // =============================================================================
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT = false>
 class M113AccTest : public utils::ChBenchmarkTest {
   public:
     M113AccTest();
@@ -60,8 +62,8 @@ class M113AccTest : public utils::ChBenchmarkTest {
     double m_step;
 };
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::M113AccTest() : m_step(1e-3) {
     DrivelineTypeTV driveline_type = DrivelineTypeTV::SIMPLE;
     BrakeType brake_type = BrakeType::SIMPLE;
     ChContactMethod contact_method = ChContactMethod::NSC;
@@ -84,6 +86,13 @@ M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
     m_m113->SetInitPosition(ChCoordsys<>(ChVector3d(-250 + 5, 0, 1.1), ChQuaternion<>(1, 0, 0, 0)));
     m_m113->Initialize();
 
+    // Optionally, use analytic wheel-shoe contact (evaluated in parallel)
+    if (ANALYTIC_CONTACT) {
+        auto contact = chrono_types::make_shared<ChTrackAnalyticContact>();
+        contact->SetNumThreads(ChOMP::GetNumProcs());
+        m_m113->GetVehicle().EnableCustomContact(contact);
+    }
+
     m_m113->SetChassisVisualizationType(VisualizationType::NONE);
     m_m113->SetSprocketVisualizationType(VisualizationType::PRIMITIVES);
     m_m113->SetIdlerVisualizationType(VisualizationType::PRIMITIVES);
@@ -127,15 +136,15 @@ M113AccTest<EnumClass, SHOE_TYPE>::M113AccTest() : m_step(1e-3) {
     m_shoeR.resize(m_m113->GetVehicle().GetNumTrackShoes(RIGHT));
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-M113AccTest<EnumClass, SHOE_TYPE>::~M113AccTest() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::~M113AccTest() {
     delete m_m113;
     delete m_terrain;
     delete m_driver;
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-void M113AccTest<EnumClass, SHOE_TYPE>::ExecuteStep() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+void M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::ExecuteStep() {
     double time = m_m113->GetVehicle().GetChTime();
 
     if (time < 0.5) {
@@ -158,8 +167,8 @@ void M113AccTest<EnumClass, SHOE_TYPE>::ExecuteStep() {
     m_m113->Advance(m_step);
 }
 
-template <typename EnumClass, EnumClass SHOE_TYPE>
-void M113AccTest<EnumClass, SHOE_TYPE>::SimulateVis() {
+template <typename EnumClass, EnumClass SHOE_TYPE, bool ANALYTIC_CONTACT>
+void M113AccTest<EnumClass, SHOE_TYPE, ANALYTIC_CONTACT>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     auto vis = chrono_types::make_shared<ChTrackedVehicleVisualSystemIrrlicht>();
     vis->AttachVehicle(&m_m113->GetVehicle());
@@ -190,9 +199,11 @@ void M113AccTest<EnumClass, SHOE_TYPE>::SimulateVis() {
 // NOTE: trick to prevent erros in expanding macros due to types that contain a comma.
 typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN> sp_test_type;
 typedef M113AccTest<TrackShoeType, TrackShoeType::DOUBLE_PIN> dp_test_type;
+typedef M113AccTest<TrackShoeType, TrackShoeType::SINGLE_PIN, true> sp_analytic_test_type;
 
 CH_BM_SIMULATION_LOOP(M113Acc_SP, sp_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_LOOP(M113Acc_DP, dp_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113Acc_SP_analytic, sp_analytic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 
 // =============================================================================
 
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the per-frame cost of vehicle output (ASCII vs. binary).
+// Each frame writes the states of a set of bodies and shafts, split in sections
+// as for a vehicle with several subsystems.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <benchmark/benchmark.h>
+
+#include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Benchmarking fixture: create the bodies and shafts of the output sections
+class OutputFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        const int num_sections = 10;
+        const int num_bodies = 8;
+        const int num_shafts = 4;
+        for (int is = 0; is < num_sections; is++) {
+            std::vector<std::shared_ptr<ChBody>> bodies;
+            for (int ib = 0; ib < num_bodies; ib++) {
+                auto body = chrono_types::make_shared<ChBody>();
+                body->SetName("body_" + std::to_string(ib));
+                body->SetPos(ChVector3d(is, ib, 0.5));
+                body->SetPosDt(ChVector3d(10, 0, 0));
+                bodies.push_back(body);
+            }
+            std::vector<std::shared_ptr<ChShaft>> shafts;
+            for (int ih = 0; ih < num_shafts; ih++) {
+                auto shaft = chrono_types::make_shared<ChShaft>();
+                shaft->SetName("shaft_" + std::to_string(ih));
+                shafts.push_back(shaft);
+            }
+            m_sections.push_back("section_" + std::to_string(is));
+            m_bodies.push_back(bodies);
+            m_shafts.push_back(shafts);
+        }
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        m_sections.clear();
+        m_bodies.clear();
+        m_shafts.clear();
+    }
+
+    // Output one frame, after a small change of the body and shaft states
+    void Output(ChVehicleOutput& database, int frame) {
+        double time = frame * 1e-3;
+        database.WriteTime(frame, time);
+        for (size_t is = 0; is < m_sections.size(); is++) {
+            for (auto& body : m_bodies[is])
+                body->SetPos(body->GetPos() + ChVector3d(1e-2, 0, 0));
+            for (auto& shaft : m_shafts[is])
+                shaft->SetPos(time * 100);
+            database.WriteSection(m_sections[is]);
+            database.WriteBodies(m_bodies[is]);
+            database.WriteShafts(m_shafts[is]);
+        }
+    }
+
+    std::vector<std::string> m_sections;
+    std::vector<std::vector<std::shared_ptr<ChBody>>> m_bodies;
+    std::vector<std::vector<std::shared_ptr<ChShaft>>> m_shafts;
+};
+
+BENCHMARK_DEFINE_F(OutputFixture, ASCII)(benchmark::State& st) {
+    const std::string filename = "btest_VEH_output.txt";
+    {
+        ChVehicleOutputASCII database(filename);
+        int frame = 0;
+        for (auto _ : st)
+            Output(database, frame++);
+    }
+    st.SetItemsProcessed(st.iterations());
+    std::remove(filename.c_str());
+}
+BENCHMARK_REGISTER_F(OutputFixture, ASCII)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(OutputFixture, BINARY)(benchmark::State& st) {
+    const std::string filename = "btest_VEH_output.bin";
+    {
+        ChVehicleOutputBinary database(filename);
+        int frame = 0;
+        for (auto _ : st)
+            Output(database, frame++);
+    }
+    st.SetItemsProcessed(st.iterations());
+    std::remove(filename.c_str());
+}
+BENCHMARK_REGISTER_F(OutputFixture, BINARY)->Unit(benchmark::kMicrosecond);
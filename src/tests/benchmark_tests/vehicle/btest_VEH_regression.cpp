@@ -0,0 +1,175 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Regression benchmarks for the combinations of solver and timestepper types,
+// for N HMMWV vehicles driving on rigid terrain (all vehicles in one system):
+//  - vehicle_tmeasy: TMEasy tires (no tire contact), SMC contact method
+//  - vehicle_rigid:  rigid tires, NSC contact
+// See btest_CH_regression for the naming of the benchmarks and the reported
+// counters. Use the Google benchmark options for machine-readable output.
+//
+// =============================================================================
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// =============================================================================
+
+// Number of simulation steps in each benchmark iteration
+static const int num_steps = 10;
+
+// Step size and number of steps for hot start
+static const double step_size = 2e-3;
+static const int num_warmup_steps = 250;
+
+// Numbers of vehicles
+static const std::vector<int> sizes = {1, 2, 4};
+
+// Vehicles driving side by side on rigid terrain, with constant throttle
+class VehicleTest {
+  public:
+    VehicleTest(int num_vehicles, TireModelType tire_type, ChContactMethod method);
+
+    ChSystem& GetSystem() { return *m_system; }
+    void ExecuteStep();
+
+  private:
+    std::unique_ptr<ChSystem> m_system;
+    std::unique_ptr<RigidTerrain> m_terrain;
+    std::vector<std::unique_ptr<HMMWV_Full>> m_vehicles;
+};
+
+VehicleTest::VehicleTest(int num_vehicles, TireModelType tire_type, ChContactMethod method) {
+    std::shared_ptr<ChContactMaterial> patch_mat;
+    if (method == ChContactMethod::NSC) {
+        m_system = chrono_types::make_unique<ChSystemNSC>();
+        patch_mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    } else {
+        m_system = chrono_types::make_unique<ChSystemSMC>();
+        patch_mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    }
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    patch_mat->SetFriction(0.9f);
+    patch_mat->SetRestitution(0.01f);
+
+    m_terrain = chrono_types::make_unique<RigidTerrain>(m_system.get());
+    m_terrain->AddPatch(patch_mat, CSYSNORM, 400, 20 + 4.0 * num_vehicles);
+    m_terrain->Initialize();
+
+    for (int i = 0; i < num_vehicles; i++) {
+        auto vehicle = chrono_types::make_unique<HMMWV_Full>(m_system.get());
+        vehicle->SetInitPosition(ChCoordsys<>(ChVector3d(-150, 4.0 * (i - 0.5 * (num_vehicles - 1)), 1.0), QUNIT));
+        vehicle->SetEngineType(EngineModelType::SHAFTS);
+        vehicle->SetTransmissionType(TransmissionModelType::AUTOMATIC_SHAFTS);
+        vehicle->SetDriveType(DrivelineTypeWV::AWD);
+        vehicle->SetTireType(tire_type);
+        vehicle->SetTireStepSize(step_size);
+        vehicle->Initialize();
+        m_vehicles.push_back(std::move(vehicle));
+    }
+}
+
+void VehicleTest::ExecuteStep() {
+    double time = m_system->GetChTime();
+
+    DriverInputs inputs;
+    inputs.m_steering = 0;
+    inputs.m_throttle = time < 0.5 ? 0 : 0.5;
+    inputs.m_braking = 0;
+    inputs.m_clutch = 0;
+
+    m_terrain->Synchronize(time);
+    for (auto& vehicle : m_vehicles)
+        vehicle->Synchronize(time, inputs, *m_terrain);
+
+    // The vehicles do not own the system: advance their tires, then the system containing all vehicles
+    m_terrain->Advance(step_size);
+    for (auto& vehicle : m_vehicles)
+        vehicle->Advance(step_size);
+    m_system->DoStepDynamics(step_size);
+}
+
+// =============================================================================
+
+static void RunVehicle(benchmark::State& st,
+                       int num_vehicles,
+                       TireModelType tire_type,
+                       ChContactMethod method,
+                       ChSolver::Type solver_type,
+                       ChTimestepper::Type timestepper_type) {
+    VehicleTest test(num_vehicles, tire_type, method);
+    utils::SetSolverAndTimestepper(test.GetSystem(), solver_type, timestepper_type);
+
+    for (int i = 0; i < num_warmup_steps; i++)
+        test.ExecuteStep();
+
+    utils::ChBenchmarkStats stats;
+    for (auto _ : st) {
+        for (int i = 0; i < num_steps; i++) {
+            test.ExecuteStep();
+            stats.Accumulate(test.GetSystem());
+        }
+    }
+    stats.Report(test.GetSystem(), st);
+}
+
+static void Register(const std::string& problem,
+                     TireModelType tire_type,
+                     ChContactMethod method,
+                     const std::vector<ChSolver::Type>& solvers,
+                     const std::vector<ChTimestepper::Type>& timesteppers) {
+    for (auto solver_type : solvers) {
+        for (auto timestepper_type : timesteppers) {
+            for (int size : sizes) {
+                std::string name = problem + "/" + utils::GetSolverTypeName(solver_type) + "/" +
+                                   utils::GetTimestepperTypeName(timestepper_type) + "/" + std::to_string(size);
+                benchmark::RegisterBenchmark(name.c_str(), RunVehicle, size, tire_type, method, solver_type,
+                                             timestepper_type)
+                    ->Unit(benchmark::kMillisecond);
+            }
+        }
+    }
+}
+
+static bool RegisterProblems() {
+    std::vector<ChSolver::Type> vi_solvers = {ChSolver::Type::PSOR, ChSolver::Type::BARZILAIBORWEIN,
+                                              ChSolver::Type::APGD, ChSolver::Type::ADMM};
+    std::vector<ChSolver::Type> linear_solvers = {ChSolver::Type::SPARSE_LU, ChSolver::Type::SPARSE_QR,
+                                                  ChSolver::Type::GMRES, ChSolver::Type::MINRES};
+    std::vector<ChTimestepper::Type> vi_timesteppers = {ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED,
+                                                        ChTimestepper::Type::EULER_IMPLICIT_PROJECTED};
+    std::vector<ChTimestepper::Type> implicit_timesteppers = {ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED,
+                                                              ChTimestepper::Type::EULER_IMPLICIT,
+                                                              ChTimestepper::Type::HHT};
+
+    Register("vehicle_tmeasy", TireModelType::TMEASY, ChContactMethod::SMC, linear_solvers, implicit_timesteppers);
+    Register("vehicle_tmeasy", TireModelType::TMEASY, ChContactMethod::SMC, vi_solvers, vi_timesteppers);
+    Register("vehicle_rigid", TireModelType::RIGID, ChContactMethod::NSC, vi_solvers, vi_timesteppers);
+
+    return true;
+}
+
+static const bool registered = RegisterProblems();
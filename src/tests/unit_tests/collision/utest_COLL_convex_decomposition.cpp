@@ -0,0 +1,217 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the convex decomposition driver and its cache of results
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono/collision/ChConvexDecomposition.h"
+#include "chrono/core/ChGlobal.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Add the 12 triangles of an axis-aligned box (outward normals) to a triangle soup
+void AddBox(ChTriangleMeshSoup& mesh, const ChVector3d& center, const ChVector3d& hlen) {
+    ChVector3d v[8];
+    for (int i = 0; i < 8; i++)
+        v[i] = center + ChVector3d(i & 1 ? hlen.x() : -hlen.x(), i & 2 ? hlen.y() : -hlen.y(),
+                                   i & 4 ? hlen.z() : -hlen.z());
+    const int faces[12][3] = {{0, 2, 1}, {1, 2, 3}, {4, 5, 6}, {5, 7, 6}, {0, 1, 4}, {1, 5, 4},
+                              {2, 6, 3}, {3, 6, 7}, {0, 4, 2}, {2, 4, 6}, {1, 3, 5}, {3, 7, 5}};
+    for (const auto& f : faces)
+        mesh.AddTriangle(v[f[0]], v[f[1]], v[f[2]]);
+}
+
+void CheckEqual(const ChConvexDecompositionCache::HullList& a, const ChConvexDecompositionCache::HullList& b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t h = 0; h < a.size(); h++) {
+        ASSERT_EQ(a[h].vertices.size(), b[h].vertices.size());
+        ASSERT_EQ(a[h].faces.size(), b[h].faces.size());
+        for (size_t i = 0; i < a[h].vertices.size(); i++)
+            ASSERT_TRUE(a[h].vertices[i].Equals(b[h].vertices[i]));
+        for (size_t i = 0; i < a[h].faces.size(); i++)
+            ASSERT_TRUE(a[h].faces[i] == b[h].faces[i]);
+    }
+}
+
+class ConvexDecompositionTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        box = chrono_types::make_shared<ChTriangleMeshSoup>();
+        AddBox(*box, ChVector3d(0, 0, 0), ChVector3d(1, 0.5, 0.25));
+
+        two_boxes = chrono_types::make_shared<ChTriangleMeshSoup>();
+        AddBox(*two_boxes, ChVector3d(-2, 0, 0), ChVector3d(0.5, 0.5, 0.5));
+        AddBox(*two_boxes, ChVector3d(+2, 0, 0), ChVector3d(0.5, 0.5, 0.5));
+
+        fan = ChTriangleMeshConnected::CreateFromWavefrontFile(GetChronoDataFile("models/fan2.obj"), false, false);
+        ASSERT_TRUE(fan);
+
+        cache_dir = "convex_decomposition_cache";
+    }
+
+    std::shared_ptr<ChTriangleMeshSoup> box;
+    std::shared_ptr<ChTriangleMeshSoup> two_boxes;
+    std::shared_ptr<ChTriangleMeshConnected> fan;
+    std::string cache_dir;
+};
+
+TEST_F(ConvexDecompositionTest, convex_mesh) {
+    // A convex mesh is decomposed in a single hull with the mesh vertices (repeated vertices fused)
+    ChConvexDecompositionCache cache;
+    ChConvexDecompositionCache::HullList hulls;
+    ASSERT_TRUE(cache.Decompose(*box, hulls));
+    ASSERT_EQ(hulls.size(), 1);
+    ASSERT_EQ(hulls[0].vertices.size(), 8);
+    ASSERT_EQ(hulls[0].faces.size(), 12);
+    for (const auto& v : hulls[0].vertices) {
+        ASSERT_NEAR(std::abs(v.x()), 1.0, 1e-6);
+        ASSERT_NEAR(std::abs(v.y()), 0.5, 1e-6);
+        ASSERT_NEAR(std::abs(v.z()), 0.25, 1e-6);
+    }
+
+    // Same results as the decomposition class
+    ChConvexDecompositionHACDv2 decomposition;
+    decomposition.SetVerbose(false);
+    decomposition.AddTriangleMesh(*box);
+    decomposition.SetParameters();
+    decomposition.ComputeConvexDecomposition();
+    ASSERT_EQ(decomposition.GetHullCount(), 1);
+    ChConvexDecomposition::Hull hull;
+    ASSERT_TRUE(decomposition.GetConvexHullResult(0, hull));
+    CheckEqual(hulls, {hull});
+}
+
+TEST_F(ConvexDecompositionTest, split_components) {
+    ChConvexDecompositionCache cache;
+    cache.SetSplitComponents(true);
+    ChConvexDecompositionCache::HullList hulls;
+    ASSERT_TRUE(cache.Decompose(*two_boxes, hulls));
+
+    // One hull per box, in the order of the components in the mesh
+    ASSERT_EQ(hulls.size(), 2);
+    for (size_t h = 0; h < 2; h++) {
+        ASSERT_EQ(hulls[h].vertices.size(), 8);
+        for (const auto& v : hulls[h].vertices)
+            ASSERT_NEAR(v.x(), h == 0 ? -2.0 : 2.0, 0.5 + 1e-6);
+    }
+}
+
+TEST_F(ConvexDecompositionTest, parallel_batch) {
+    std::vector<std::shared_ptr<ChTriangleMesh>> meshes = {fan, box, two_boxes, fan};
+
+    // Serial decomposition of each mesh
+    std::vector<ChConvexDecompositionCache::HullList> serial(meshes.size());
+    for (size_t i = 0; i < meshes.size(); i++) {
+        ChConvexDecompositionCache cache;
+        cache.SetNumThreads(1);
+        ASSERT_TRUE(cache.Decompose(*meshes[i], serial[i]));
+    }
+    ASSERT_GT(serial[0].size(), 1);
+
+    // Parallel decomposition of the batch: the duplicate mesh is decomposed only once
+    ChConvexDecompositionCache cache;
+    cache.SetNumThreads(4);
+    std::vector<ChConvexDecompositionCache::HullList> parallel;
+    ASSERT_TRUE(cache.Decompose(meshes, parallel));
+    ASSERT_EQ(parallel.size(), meshes.size());
+    ASSERT_EQ(cache.GetNumCacheMisses(), 3);
+    ASSERT_EQ(cache.GetNumCacheHits(), 1);
+    for (size_t i = 0; i < meshes.size(); i++)
+        CheckEqual(serial[i], parallel[i]);
+
+    // All meshes are now in the memory cache
+    ASSERT_TRUE(cache.Decompose(meshes, parallel));
+    ASSERT_EQ(cache.GetNumCacheMisses(), 3);
+    ASSERT_EQ(cache.GetNumCacheHits(), 5);
+}
+
+TEST_F(ConvexDecompositionTest, cache_key) {
+    ChConvexDecompositionCache cache;
+    uint64_t key = cache.ComputeKey(*box);
+    ASSERT_EQ(key, cache.ComputeKey(*box));
+    ASSERT_NE(key, cache.ComputeKey(*two_boxes));
+
+    // The key depends on the decomposition settings
+    cache.SetParameters(256, 256, 32);
+    ASSERT_NE(key, cache.ComputeKey(*box));
+    cache.SetParameters();
+    cache.SetSplitComponents(true);
+    ASSERT_NE(key, cache.ComputeKey(*box));
+    cache.SetSplitComponents(false);
+    ASSERT_EQ(key, cache.ComputeKey(*box));
+
+    // ...and on the mesh vertices
+    ChTriangleMeshSoup moved;
+    AddBox(moved, ChVector3d(0, 0, 1e-12), ChVector3d(1, 0.5, 0.25));
+    ASSERT_NE(key, cache.ComputeKey(moved));
+}
+
+TEST_F(ConvexDecompositionTest, disk_cache) {
+    std::vector<std::shared_ptr<ChTriangleMesh>> meshes = {fan, two_boxes};
+
+    // Decompose and write the cache files
+    std::vector<ChConvexDecompositionCache::HullList> hulls1;
+    std::vector<uint64_t> keys;
+    {
+        ChConvexDecompositionCache cache;
+        cache.SetCacheDirectory(cache_dir);
+        ASSERT_TRUE(filesystem::path(cache_dir).is_directory());
+        ASSERT_TRUE(cache.Decompose(meshes, hulls1));
+        ASSERT_EQ(cache.GetNumCacheMisses(), 2);
+        for (const auto& mesh : meshes) {
+            keys.push_back(cache.ComputeKey(*mesh));
+            ASSERT_TRUE(filesystem::path(cache.GetCacheFilename(keys.back())).is_file());
+        }
+    }
+
+    // A new cache object finds all results on disk
+    ChConvexDecompositionCache cache;
+    cache.SetCacheDirectory(cache_dir);
+    std::vector<ChConvexDecompositionCache::HullList> hulls2;
+    ASSERT_TRUE(cache.Decompose(meshes, hulls2));
+    ASSERT_EQ(cache.GetNumCacheMisses(), 0);
+    ASSERT_EQ(cache.GetNumCacheHits(), 2);
+    for (size_t i = 0; i < meshes.size(); i++)
+        CheckEqual(hulls1[i], hulls2[i]);
+
+    // Cache files with a different key or truncated are rejected
+    std::string filename = cache.GetCacheFilename(keys[0]);
+    ChConvexDecompositionCache::HullList hulls;
+    ASSERT_TRUE(ChConvexDecompositionCache::ReadHulls(filename, keys[0], hulls));
+    ASSERT_FALSE(ChConvexDecompositionCache::ReadHulls(filename, keys[0] + 1, hulls));
+    {
+        std::ifstream ifile(filename, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(ifile)), std::istreambuf_iterator<char>());
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile.write(content.data(), content.size() - 8);
+    }
+    ASSERT_FALSE(ChConvexDecompositionCache::ReadHulls(filename, keys[0], hulls));
+
+    // A corrupted cache file is regenerated
+    cache.ClearMemoryCache();
+    ASSERT_TRUE(cache.Decompose(meshes, hulls2));
+    ASSERT_EQ(cache.GetNumCacheMisses(), 1);
+    ASSERT_EQ(cache.GetNumCacheHits(), 1);
+    CheckEqual(hulls1[0], hulls2[0]);
+    ASSERT_TRUE(ChConvexDecompositionCache::ReadHulls(filename, keys[0], hulls));
+
+    for (auto key : keys)
+        std::remove(cache.GetCacheFilename(key).c_str());
+}
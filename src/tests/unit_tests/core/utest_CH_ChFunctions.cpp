@@ -15,11 +15,18 @@
 // Unit test for ChFunctions
 //
 // =============================================================================
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "chrono/functions/ChFunctionLambda.h"
 #include "chrono/functions/ChFunctionInterp.h"
+#include "chrono/functions/ChFunctionConst.h"
+#include "chrono/functions/ChFunctionRamp.h"
+#include "chrono/functions/ChFunctionSine.h"
+#include "chrono/functions/ChFunctionPoly.h"
+#include "chrono/functions/ChFunctionPoly345.h"
 #include "chrono/utils/ChConstants.h"
 
 using namespace chrono;
@@ -108,3 +115,111 @@ TEST(ChFunctionInterp, interp1_extrap) {
 //    fun_table_ovr.AddPoint(0.0, 2.7);
 //    EXPECT_NO_THROW(fun_table_ovr.AddPoint(0.0, 0.3, true));
 //}
+
+TEST(ChFunctionInterp, uniform_table) {
+    // Same points, added in order (uniform spacing detected) and out of order
+    ChFunctionInterp fun_ordered;
+    ChFunctionInterp fun_shuffled;
+    int n = 41;
+    for (int i = 0; i < n; i++)
+        fun_ordered.AddPoint(-1.0 + 0.05 * i, std::sin(-1.0 + 0.05 * i));
+    for (int i = 0; i < n; i++) {
+        int k = (7 * i) % n;
+        fun_shuffled.AddPoint(-1.0 + 0.05 * k, std::sin(-1.0 + 0.05 * k));
+    }
+    ASSERT_TRUE(fun_ordered.IsUniform());
+    ASSERT_TRUE(fun_shuffled.IsUniform());
+
+    for (int j = 0; j <= 400; j++) {
+        double x = -1.1 + 0.0055 * j;
+        double x0 = std::min(std::max(x, -1.0), 1.0 - 1e-12);
+        int i = std::min((int)std::floor((x0 + 1.0) / 0.05), n - 2);
+        double xa = -1.0 + 0.05 * i;
+        double xb = -1.0 + 0.05 * (i + 1);
+        double der = (std::sin(xb) - std::sin(xa)) / (xb - xa);
+        double val = x <= -1.0 ? std::sin(-1.0) : (x >= 1.0 ? std::sin(1.0) : std::sin(xa) + der * (x - xa));
+        ASSERT_NEAR(fun_ordered.GetVal(x), val, 1e-12);
+        ASSERT_DOUBLE_EQ(fun_ordered.GetVal(x), fun_shuffled.GetVal(x));
+        ASSERT_DOUBLE_EQ(fun_ordered.GetDer(x), fun_shuffled.GetDer(x));
+    }
+
+    // At a table point, the derivative is that of the interval to the right
+    ASSERT_NEAR(fun_ordered.GetDer(0.0), (std::sin(0.05) - std::sin(0.0)) / 0.05, 1e-12);
+
+    // A point off the uniform grid switches to the binary search
+    fun_shuffled.AddPoint(0.025, std::sin(0.025));
+    ASSERT_FALSE(fun_shuffled.IsUniform());
+    ASSERT_NEAR(fun_shuffled.GetVal(0.01), std::sin(0.025) * 0.01 / 0.025, 1e-12);
+    ASSERT_NEAR(fun_shuffled.GetVal(0.5), fun_ordered.GetVal(0.5), 1e-12);
+}
+
+TEST(ChFunctionInterp, batch_and_concurrent_evaluation) {
+    ChFunctionInterp fun_table;
+    fun_table.SetExtrapolate(true);
+    for (int i = 0; i < 100; i++) {
+        double x = 0.1 * i + 0.01 * (i % 3);
+        fun_table.AddPoint(x, std::cos(x));
+    }
+    ASSERT_FALSE(fun_table.IsUniform());
+
+    int n = 10000;
+    ChVectorDynamic<> x(n);
+    for (int k = 0; k < n; k++)
+        x(k) = -1.0 + 12.0 * std::fmod(0.618034 * k, 1.0);
+
+    ChVectorDynamic<> val(n);
+    ChVectorDynamic<> der(n);
+    fun_table.GetValBatch(x, val);
+    fun_table.GetDerBatch(x, der);
+
+    // Concurrent evaluation of the same function (scattered x values)
+    std::vector<double> val_mt(n);
+    std::vector<double> der_mt(n);
+#pragma omp parallel for num_threads(4)
+    for (int k = 0; k < n; k++) {
+        val_mt[k] = fun_table.GetVal(x(k));
+        der_mt[k] = fun_table.GetDer(x(k));
+    }
+
+    for (int k = 0; k < n; k++) {
+        ASSERT_EQ(val(k), fun_table.GetVal(x(k)));
+        ASSERT_EQ(der(k), fun_table.GetDer(x(k)));
+        ASSERT_EQ(val_mt[k], val(k));
+        ASSERT_EQ(der_mt[k], der(k));
+    }
+}
+
+TEST(ChFunction, batch_evaluation) {
+    int n = 1001;
+    ChVectorDynamic<> x(n);
+    for (int i = 0; i < n; i++)
+        x(i) = -1.0 + 4.0 * i / (n - 1);
+
+    std::vector<std::shared_ptr<ChFunction>> funs;
+    funs.push_back(chrono_types::make_shared<ChFunctionConst>(2.5));
+    funs.push_back(chrono_types::make_shared<ChFunctionRamp>(0.3, -1.2));
+    funs.push_back(chrono_types::make_shared<ChFunctionSine>(1.5, 0.7, 0.2));
+    auto poly = chrono_types::make_shared<ChFunctionPoly>();
+    poly->SetCoefficients({0.5, -1.0, 2.0, 0.25});
+    funs.push_back(poly);
+    funs.push_back(chrono_types::make_shared<ChFunctionPoly345>(1.2, 1.5));
+    funs.push_back(chrono_types::make_shared<ChFunctionLambda>());
+    std::static_pointer_cast<ChFunctionLambda>(funs.back())->SetFunction([](double x) { return x * x; });
+
+    ChVectorDynamic<> y(n);
+    for (const auto& f : funs) {
+        for (int der = 0; der <= 2; der++) {
+            f->GetDerNBatch(x, y, der);
+            for (int i = 0; i < n; i++)
+                ASSERT_NEAR(y(i), f->GetDerN(x(i), der), 1e-12 * (1 + std::abs(y(i))));
+        }
+    }
+
+    // Batch evaluation over a strided view, as used by SampleUpToDerN
+    ChMatrixDynamic<> data = funs[2]->SampleUpToDerN(0.0, 1.0, 0.01, 2);
+    for (int i = 0; i < data.rows(); i++) {
+        ASSERT_NEAR(data(i, 1), funs[2]->GetVal(data(i, 0)), 1e-12);
+        ASSERT_NEAR(data(i, 2), funs[2]->GetDer(data(i, 0)), 1e-12);
+        ASSERT_NEAR(data(i, 3), funs[2]->GetDer2(data(i, 0)), 1e-12);
+    }
+}
@@ -0,0 +1,203 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for the recording of timing events (ChTrace) and for the
+// instrumentation of the simulation phases and physics items in ChSystem
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/utils/ChTrace.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// Find the summary of the events with given category and name (nullptr if none)
+static const ChTrace::Summary* FindSummary(const std::vector<ChTrace::Summary>& summary,
+                                           const std::string& category,
+                                           const std::string& name) {
+    for (const auto& s : summary) {
+        if (s.category == category && s.name == name)
+            return &s;
+    }
+    return nullptr;
+}
+
+TEST(ChTrace, record) {
+    ChTrace trace(12);
+
+    // Nothing is recorded while disabled
+    {
+        ChTraceScope scope(&trace, "disabled", "test");
+    }
+    ASSERT_EQ(trace.GetNumEvents(), 0);
+    ASSERT_EQ(trace.GetNumThreads(), 0);
+
+    trace.Enable(true);
+    for (int i = 0; i < 5; i++) {
+        ChTraceScope outer(&trace, "outer", "test");
+        ChTraceScope inner(&trace, "inner", "test");
+    }
+    ASSERT_EQ(trace.GetNumEvents(), 10);
+    ASSERT_EQ(trace.GetNumThreads(), 1);
+
+    // Inner events are nested in outer events
+    auto events = trace.GetEvents(0);
+    ASSERT_EQ(events.size(), 10);
+    for (int i = 0; i < 5; i++) {
+        const auto& inner = events[2 * i];
+        const auto& outer = events[2 * i + 1];
+        ASSERT_STREQ(inner.name, "inner");
+        ASSERT_STREQ(outer.name, "outer");
+        ASSERT_GE(inner.start, outer.start);
+        ASSERT_LE(inner.start + inner.duration, outer.start + outer.duration);
+    }
+
+    auto summary = trace.GetSummary();
+    ASSERT_EQ(summary.size(), 2);
+    ASSERT_EQ(summary[0].name, "outer");
+    ASSERT_EQ(summary[0].count, 5);
+    ASSERT_GE(summary[0].total, summary[1].total);
+
+    // Events are dropped when the buffer is full
+    for (int i = 0; i < 5; i++)
+        trace.Record("extra", "test", trace.Now(), 0);
+    ASSERT_EQ(trace.GetNumEvents(), 12);
+    ASSERT_EQ(trace.GetNumDroppedEvents(), 3);
+
+    trace.Clear();
+    ASSERT_EQ(trace.GetNumEvents(), 0);
+    ASSERT_EQ(trace.GetNumDroppedEvents(), 0);
+}
+
+TEST(ChTrace, threads) {
+    const int num_threads = 4;
+    const int num_events = 1000;
+
+    ChTrace trace;
+    trace.Enable(true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&trace]() {
+            for (int i = 0; i < num_events; i++) {
+                ChTraceScope scope(&trace, "work", "test");
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(trace.GetNumThreads(), num_threads);
+    ASSERT_EQ(trace.GetNumEvents(), num_threads * num_events);
+    for (int t = 0; t < num_threads; t++)
+        ASSERT_EQ(trace.GetEvents(t).size(), num_events);
+
+    auto summary = trace.GetSummary();
+    ASSERT_EQ(summary.size(), 1);
+    ASSERT_EQ(summary[0].count, num_threads * num_events);
+}
+
+TEST(ChTrace, system) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000.0, false, false);
+    body->SetPos(ChVector3d(1, 0, 0));
+    sys.AddBody(body);
+
+    auto link = chrono_types::make_shared<ChLinkLockRevolute>();
+    link->Initialize(ground, body, ChFrame<>());
+    sys.AddLink(link);
+
+    auto shaft = chrono_types::make_shared<ChShaft>();
+    sys.AddShaft(shaft);
+
+    // No recording unless enabled
+    ASSERT_EQ(sys.GetTrace(), nullptr);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(sys.GetTrace(), nullptr);
+
+    // Phases and item categories
+    sys.EnableTrace(true);
+    for (int i = 0; i < 10; i++)
+        sys.DoStepDynamics(1e-3);
+
+    auto trace = sys.GetTrace();
+    ASSERT_NE(trace, nullptr);
+    auto summary = trace->GetSummary();
+    auto step = FindSummary(summary, "system", "Step");
+    ASSERT_NE(step, nullptr);
+    ASSERT_EQ(step->count, 10);
+    ASSERT_NE(FindSummary(summary, "system", "ComputeCollisions"), nullptr);
+    ASSERT_NE(FindSummary(summary, "system", "Update"), nullptr);
+    ASSERT_NE(FindSummary(summary, "solver", "SolverSolve"), nullptr);
+    ASSERT_NE(FindSummary(summary, "bodies", "Update"), nullptr);
+    ASSERT_NE(FindSummary(summary, "links", "Update"), nullptr);
+    ASSERT_NE(FindSummary(summary, "shafts", "Update"), nullptr);
+    ASSERT_NE(FindSummary(summary, "contacts", "Update"), nullptr);
+    ASSERT_EQ(FindSummary(summary, ChTrace::ItemsCategory(), "chrono::ChBodyEasyBox"), nullptr);
+
+    // The step spans all other events
+    for (const auto& s : summary) {
+        if (s.category != "system" || s.name != "Step")
+            ASSERT_LE(s.max, step->max);
+    }
+
+    // Individual items
+    trace->Clear();
+    sys.EnableTrace(true, true);
+    sys.DoStepDynamics(1e-3);
+    summary = trace->GetSummary();
+    ASSERT_NE(FindSummary(summary, ChTrace::ItemsCategory(), "chrono::ChBodyEasyBox"), nullptr);
+    ASSERT_NE(FindSummary(summary, ChTrace::ItemsCategory(), "chrono::ChLinkLockRevolute"), nullptr);
+    ASSERT_NE(FindSummary(summary, ChTrace::ItemsCategory(), "chrono::ChShaft"), nullptr);
+
+    std::ostringstream os;
+    trace->PrintSummary(os);
+    ASSERT_NE(os.str().find("chrono::ChLinkLockRevolute"), std::string::npos);
+
+    // Chrome trace output
+    std::string filename = "utest_CH_trace.json";
+    ASSERT_TRUE(trace->WriteChromeTrace(filename));
+    std::ifstream file(filename);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string json = buffer.str();
+    file.close();
+    std::remove(filename.c_str());
+    ASSERT_EQ(json.find("{\"traceEvents\":["), 0);
+    ASSERT_NE(json.find("\"name\":\"Step\",\"cat\":\"system\",\"ph\":\"X\""), std::string::npos);
+    ASSERT_NE(json.find("\"name\":\"chrono::ChBodyEasyBox\""), std::string::npos);
+    ASSERT_NE(json.find("\"thread_name\""), std::string::npos);
+
+    // No recording once disabled
+    size_t num_events = trace->GetNumEvents();
+    sys.EnableTrace(false);
+    sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(trace->GetNumEvents(), num_events);
+}
@@ -0,0 +1,226 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for loading ChTriangleMeshConnected from Wavefront OBJ files and
+// from binary mesh cache files.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+
+using namespace chrono;
+
+// Compare two meshes, element by element
+static void CompareMeshes(const ChTriangleMeshConnected& m1, const ChTriangleMeshConnected& m2) {
+    ASSERT_EQ(m1.m_vertices.size(), m2.m_vertices.size());
+    ASSERT_EQ(m1.m_normals.size(), m2.m_normals.size());
+    ASSERT_EQ(m1.m_UV.size(), m2.m_UV.size());
+    ASSERT_EQ(m1.m_face_v_indices.size(), m2.m_face_v_indices.size());
+    ASSERT_EQ(m1.m_face_n_indices.size(), m2.m_face_n_indices.size());
+    ASSERT_EQ(m1.m_face_uv_indices.size(), m2.m_face_uv_indices.size());
+    for (size_t i = 0; i < m1.m_vertices.size(); i++)
+        ASSERT_TRUE(m1.m_vertices[i] == m2.m_vertices[i]);
+    for (size_t i = 0; i < m1.m_normals.size(); i++)
+        ASSERT_TRUE(m1.m_normals[i] == m2.m_normals[i]);
+    for (size_t i = 0; i < m1.m_UV.size(); i++)
+        ASSERT_TRUE(m1.m_UV[i] == m2.m_UV[i]);
+    for (size_t i = 0; i < m1.m_face_v_indices.size(); i++)
+        ASSERT_TRUE(m1.m_face_v_indices[i] == m2.m_face_v_indices[i]);
+    for (size_t i = 0; i < m1.m_face_n_indices.size(); i++)
+        ASSERT_TRUE(m1.m_face_n_indices[i] == m2.m_face_n_indices[i]);
+    for (size_t i = 0; i < m1.m_face_uv_indices.size(); i++)
+        ASSERT_TRUE(m1.m_face_uv_indices[i] == m2.m_face_uv_indices[i]);
+}
+
+// Write a grid of n x n quads (2 triangles each), using relative indices for the faces
+static void WriteGridFile(const std::string& filename, int n, double height) {
+    std::ofstream ofile(filename);
+    ofile << "# grid\no grid\n";
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            ofile << "v " << 0.1 * i << " " << 0.1 * j << " " << height * ((i + j) % 3) << "\n";
+            ofile << "vt " << (double)i / n << " " << (double)j / n << "\n";
+        }
+        if (i == 0)
+            continue;
+        // faces between row i-1 and row i (the last 2*(n+1) vertices)
+        for (int j = 0; j < n; j++) {
+            int a = -2 * (n + 1) + j;
+            int b = -(n + 1) + j;
+            ofile << "f " << a << "/" << a << " " << b << "/" << b << " " << b + 1 << "/" << b + 1 << "\n";
+            ofile << "f " << a << "/" << a << " " << b + 1 << "/" << b + 1 << " " << a + 1 << "/" << a + 1 << "\n";
+        }
+    }
+}
+
+TEST(ChTriangleMeshConnected, obj_parser) {
+    std::string filename = "utest_CH_trimesh_parser.obj";
+    {
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile << "# test file\r\n"
+              << "mtllib none.mtl\r\n"
+              << "v 0 0 0\r\n"
+              << "v 1.5 0 0\r\n"
+              << "v 0 2.5e0 0   \r\n"
+              << "  v 0 0 -3\r\n"
+              << "vn 0 0 1\r\n"
+              << "vn 1 0 0\r\n"
+              << "vt 0.25 0.75\r\n"
+              << "g group1\r\n"
+              << "usemtl none\r\n"
+              << "s 1\r\n"
+              << "f 1//1 2//1 3//1\r\n"
+              << "f -4/1/2 -1/1/2 -3/1/2 # comment\r\n"
+              << "f 2 4 3\r\n";
+    }
+
+    ChTriangleMeshConnected mesh;
+    ASSERT_TRUE(mesh.LoadWavefrontMesh(filename, true, true));
+    ASSERT_EQ(mesh.GetNumVertices(), 4);
+    ASSERT_EQ(mesh.GetNumNormals(), 2);
+    ASSERT_EQ(mesh.GetNumTriangles(), 3);
+    ASSERT_EQ(mesh.m_UV.size(), 1);
+    ASSERT_TRUE(mesh.m_vertices[2] == ChVector3d(0, 2.5, 0));
+    ASSERT_TRUE(mesh.m_vertices[3] == ChVector3d(0, 0, -3));
+    ASSERT_TRUE(mesh.m_face_v_indices[0] == ChVector3i(0, 1, 2));
+    ASSERT_TRUE(mesh.m_face_v_indices[1] == ChVector3i(0, 3, 1));
+    ASSERT_TRUE(mesh.m_face_v_indices[2] == ChVector3i(1, 3, 2));
+    ASSERT_TRUE(mesh.m_face_n_indices[0] == ChVector3i(0, 0, 0));
+    ASSERT_TRUE(mesh.m_face_n_indices[1] == ChVector3i(1, 1, 1));
+    ASSERT_TRUE(mesh.m_face_n_indices[2] == ChVector3i(-1, -1, -1));
+    ASSERT_TRUE(mesh.m_face_uv_indices[0] == ChVector3i(-1, -1, -1));
+    ASSERT_TRUE(mesh.m_face_uv_indices[1] == ChVector3i(0, 0, 0));
+    ASSERT_EQ(mesh.GetFileName(), filename);
+
+    // Without normals and UV
+    ASSERT_TRUE(mesh.LoadWavefrontMesh(filename, false, false));
+    ASSERT_EQ(mesh.GetNumNormals(), 0);
+    ASSERT_EQ(mesh.m_face_n_indices.size(), 0);
+    ASSERT_EQ(mesh.m_face_uv_indices.size(), 0);
+
+    // Polygonal faces are triangulated by the fallback loader
+    {
+        std::ofstream ofile(filename);
+        ofile << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nf 1 2 3 4\n";
+    }
+    ASSERT_TRUE(mesh.LoadWavefrontMesh(filename, true, false));
+    ASSERT_EQ(mesh.GetNumVertices(), 4);
+    ASSERT_EQ(mesh.GetNumTriangles(), 2);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChTriangleMeshConnected, obj_parser_data_files) {
+    // Triangles must match those loaded by tinyobjloader (through ChTriangleMeshSoup)
+    for (const auto& name : {"models/sphere.obj", "models/feeder_bowl.obj", "models/fixedterrain.obj"}) {
+        auto filename = GetChronoDataFile(name);
+        auto mesh = ChTriangleMeshConnected::CreateFromWavefrontFile(filename, true, true);
+        auto soup = ChTriangleMeshSoup::CreateFromWavefrontFile(filename);
+        ASSERT_TRUE(mesh);
+        ASSERT_TRUE(soup);
+        ASSERT_EQ(mesh->GetNumTriangles(), soup->GetNumTriangles());
+        for (unsigned int i = 0; i < mesh->GetNumTriangles(); i++) {
+            auto t1 = mesh->GetTriangle(i);
+            auto t2 = soup->GetTriangle(i);
+            ASSERT_TRUE(t1.p1 == t2.p1 && t1.p2 == t2.p2 && t1.p3 == t2.p3);
+        }
+    }
+}
+
+TEST(ChTriangleMeshConnected, large_obj_file) {
+    // Large enough file to be parsed in several chunks, with relative indices
+    std::string filename = "utest_CH_trimesh_grid.obj";
+    int n = 300;
+    WriteGridFile(filename, n, 0.5);
+
+    ChTriangleMeshConnected mesh;
+    ASSERT_TRUE(mesh.LoadWavefrontMesh(filename, true, true));
+    ASSERT_EQ(mesh.GetNumVertices(), (n + 1) * (n + 1));
+    ASSERT_EQ(mesh.m_UV.size(), (n + 1) * (n + 1));
+    ASSERT_EQ(mesh.GetNumTriangles(), 2 * n * n);
+    for (int i = 1; i <= n; i++) {
+        for (int j = 0; j < n; j++) {
+            int a = (i - 1) * (n + 1) + j;
+            int b = i * (n + 1) + j;
+            int k = 2 * ((i - 1) * n + j);
+            ASSERT_TRUE(mesh.m_face_v_indices[k] == ChVector3i(a, b, b + 1));
+            ASSERT_TRUE(mesh.m_face_v_indices[k + 1] == ChVector3i(a, b + 1, a + 1));
+            ASSERT_TRUE(mesh.m_face_uv_indices[k] == mesh.m_face_v_indices[k]);
+        }
+    }
+
+    // Neighboring triangles in the grid
+    std::vector<std::array<int, 4>> tri_map;
+    ASSERT_TRUE(mesh.ComputeNeighbouringTriangleMap(tri_map));
+    int k = 2 * (5 * n + 7);  // lower triangle of an interior quad
+    ASSERT_EQ(tri_map[k][0], k);
+    ASSERT_EQ(tri_map[k][1], k - 1);          // edge a-b, shared with the upper triangle of the previous quad
+    ASSERT_EQ(tri_map[k][2], k + 2 * n + 1);  // edge b-(b+1), shared with the quad in the next row
+    ASSERT_EQ(tri_map[k][3], k + 1);          // diagonal, shared with the upper triangle of the quad
+    ASSERT_EQ(tri_map[0][1], -1);             // boundary edge
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChTriangleMeshConnected, binary_cache) {
+    std::string filename = "utest_CH_trimesh_cache.obj";
+    std::string cache_filename = "utest_CH_trimesh_cache.bin";
+    std::remove(cache_filename.c_str());
+    WriteGridFile(filename, 40, 0.5);
+
+    ChTriangleMeshConnected mesh_ref;
+    ASSERT_TRUE(mesh_ref.LoadWavefrontMesh(filename, true, true));
+    std::vector<std::array<int, 4>> tri_map_ref;
+    mesh_ref.ComputeNeighbouringTriangleMap(tri_map_ref);
+
+    // First load writes the cache, second load reads it
+    for (int pass = 0; pass < 2; pass++) {
+        ChTriangleMeshConnected mesh;
+        std::vector<std::array<int, 4>> tri_map;
+        ASSERT_TRUE(mesh.LoadWavefrontMeshCached(filename, cache_filename, true, true, &tri_map));
+        CompareMeshes(mesh, mesh_ref);
+        ASSERT_TRUE(tri_map == tri_map_ref);
+        ASSERT_EQ(mesh.GetFileName(), filename);
+    }
+
+    // The cache is not used for a different file content or different options
+    WriteGridFile(filename, 40, 0.25);
+    ChTriangleMeshConnected mesh_mod;
+    ASSERT_TRUE(mesh_mod.LoadWavefrontMeshCached(filename, cache_filename, true, true));
+    ASSERT_EQ(mesh_mod.m_vertices[1].z(), 0.25);
+    ASSERT_TRUE(mesh_mod.LoadWavefrontMeshCached(filename, cache_filename, true, false));
+    ASSERT_EQ(mesh_mod.m_UV.size(), 0);
+
+    // Explicit cache files
+    ASSERT_TRUE(mesh_ref.WriteBinaryCache(cache_filename, false));
+    ChTriangleMeshConnected mesh;
+    std::vector<std::array<int, 4>> tri_map;
+    ASSERT_TRUE(mesh.LoadBinaryCache(cache_filename, &tri_map));
+    CompareMeshes(mesh, mesh_ref);
+    ASSERT_TRUE(tri_map == tri_map_ref);
+
+    // Invalid cache files are rejected
+    ASSERT_FALSE(mesh.LoadBinaryCache(filename));
+    ASSERT_FALSE(mesh.LoadBinaryCache("utest_CH_trimesh_missing.bin"));
+
+    std::remove(filename.c_str());
+    std::remove(cache_filename.c_str());
+}
@@ -0,0 +1,301 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for the asynchronous binary output writer and reader
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <thread>
+
+#include "chrono/utils/ChWriterBinary.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// Test columns: smooth signal, constant, counter, random values, and special values
+static const std::vector<std::string> columns = {"time", "sine", "constant", "frame", "noise", "special"};
+
+static std::vector<double> MakeRecord(int i, std::mt19937& gen) {
+    static const double special[] = {0.0, -0.0, std::numeric_limits<double>::infinity(),
+                                     std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::denorm_min(),
+                                     -1e300};
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    double t = i * 1e-3;
+    return {t, std::sin(10 * t), 9.81, (double)i, dist(gen), special[i % 6]};
+}
+
+static void CheckColumns(ChReaderBinary& reader, int num_records) {
+    ASSERT_EQ(reader.GetNumColumns(), columns.size());
+    ASSERT_EQ(reader.GetColumnNames(), columns);
+    ASSERT_EQ(reader.GetNumRecords(), num_records);
+
+    std::vector<std::vector<double>> values;
+    for (size_t c = 0; c < columns.size(); c++)
+        values.push_back(reader.GetColumn(c));
+
+    std::mt19937 gen(42);
+    for (int i = 0; i < num_records; i++) {
+        auto record = MakeRecord(i, gen);
+        for (size_t c = 0; c < columns.size(); c++) {
+            // Bitwise comparison (lossless compression)
+            ASSERT_EQ(std::memcmp(&values[c][i], &record[c], sizeof(double)), 0) << "record " << i << " column " << c;
+        }
+    }
+}
+
+TEST(ChWriterBinary, ring_buffer) {
+    const size_t record_size = 3;
+    const size_t num_records = 200000;
+    ChRingBufferSPSC buffer(record_size, 100);
+    ASSERT_EQ(buffer.GetCapacity(), 128);
+
+    // Concurrent producer and consumer
+    std::thread producer([&]() {
+        double record[record_size];
+        for (size_t i = 0; i < num_records; i++) {
+            record[0] = (double)i;
+            record[1] = 2.0 * i;
+            record[2] = -1.0 * i;
+            while (!buffer.Push(record))
+                std::this_thread::yield();
+        }
+    });
+
+    std::vector<double> records(32 * record_size);
+    size_t next = 0;
+    bool ok = true;
+    while (next < num_records) {
+        size_t n = buffer.Pop(records.data(), 32);
+        for (size_t k = 0; k < n; k++, next++) {
+            ok &= records[k * record_size + 0] == (double)next;
+            ok &= records[k * record_size + 1] == 2.0 * next;
+            ok &= records[k * record_size + 2] == -1.0 * next;
+        }
+        if (n == 0)
+            std::this_thread::yield();
+    }
+    producer.join();
+
+    ASSERT_TRUE(ok);
+    ASSERT_EQ(buffer.GetSize(), 0);
+}
+
+TEST(ChWriterBinary, write_read) {
+    const std::string filename = "utest_writer_binary.bin";
+    const int num_records = 10000;
+
+    uint64_t num_bytes;
+    {
+        ChWriterBinary writer(filename, columns, 1000);
+        std::mt19937 gen(42);
+        for (int i = 0; i < num_records; i++)
+            ASSERT_TRUE(writer.Write(MakeRecord(i, gen)));
+        ASSERT_TRUE(writer.Close());
+        ASSERT_FALSE(writer.IsOpen());
+        ASSERT_EQ(writer.GetNumWritten(), num_records);
+        ASSERT_EQ(writer.GetNumDropped(), 0);
+        num_bytes = writer.GetNumBytes();
+    }
+
+    // Smooth and constant columns compress well, so the file is smaller than the raw data
+    ASSERT_LT(num_bytes, 0.6 * num_records * columns.size() * sizeof(double));
+
+    ChReaderBinary reader(filename);
+    CheckColumns(reader, num_records);
+    ASSERT_EQ(reader.GetColumnIndex("frame"), 3);
+    ASSERT_EQ(reader.GetColumnIndex("unknown"), -1);
+    ASSERT_EQ(reader.GetColumn("frame")[123], 123.0);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChWriterBinary, flush) {
+    const std::string filename = "utest_writer_binary_flush.bin";
+
+    ChWriterBinary writer(filename, columns, 1000);
+    std::mt19937 gen(42);
+    for (int i = 0; i < 2500; i++)
+        writer.Write(MakeRecord(i, gen));
+
+    // After a flush, all records (including a partial chunk) can be read while the writer is still open
+    writer.Flush();
+    ASSERT_EQ(writer.GetNumWritten(), 2500);
+    {
+        ChReaderBinary reader(filename);
+        CheckColumns(reader, 2500);
+    }
+
+    for (int i = 2500; i < 3000; i++)
+        writer.Write(MakeRecord(i, gen));
+    writer.Close();
+    {
+        ChReaderBinary reader(filename);
+        CheckColumns(reader, 3000);
+    }
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChWriterBinary, truncated_file) {
+    const std::string filename = "utest_writer_binary_truncated.bin";
+    {
+        ChWriterBinary writer(filename, columns, 100);
+        std::mt19937 gen(42);
+        for (int i = 0; i < 250; i++)
+            writer.Write(MakeRecord(i, gen));
+    }
+
+    // Remove the end of the file: the incomplete last chunk is ignored
+    std::string content;
+    {
+        std::ifstream ifile(filename, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(ifile), std::istreambuf_iterator<char>());
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile.write(content.data(), content.size() - 10);
+    }
+    {
+        ChReaderBinary reader(filename);
+        CheckColumns(reader, 200);
+    }
+
+    // Invalid header
+    {
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile << "not a binary output file";
+    }
+    ASSERT_THROW(ChReaderBinary reader(filename), std::runtime_error);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChWriterBinary, layout_change) {
+    const std::string filename = "utest_writer_binary_layout.bin";
+
+    // Second layout: one column removed, one added, one reordered
+    const std::vector<std::string> columns2 = {"time", "extra", "sine", "constant", "frame", "special"};
+    {
+        ChWriterBinary writer(filename, columns, 100);
+        std::mt19937 gen(42);
+        for (int i = 0; i < 150; i++)
+            writer.Write(MakeRecord(i, gen));
+        writer.SetColumns(columns2);
+        ASSERT_EQ(writer.GetNumColumns(), columns2.size());
+        for (int i = 150; i < 200; i++) {
+            auto record = MakeRecord(i, gen);
+            ASSERT_TRUE(writer.Write({record[0], -1.0 * i, record[1], record[2], record[3], record[5]}));
+        }
+        ASSERT_TRUE(writer.Close());
+        ASSERT_EQ(writer.GetNumWritten(), 200);
+    }
+
+    ChReaderBinary reader(filename);
+    ASSERT_EQ(reader.GetNumLayouts(), 2);
+    ASSERT_EQ(reader.GetNumRecords(), 200);
+    std::vector<std::string> all_columns = columns;
+    all_columns.push_back("extra");
+    ASSERT_EQ(reader.GetColumnNames(), all_columns);
+
+    // Columns missing from a layout read as NaN
+    auto frame = reader.GetColumn("frame");
+    auto noise = reader.GetColumn("noise");
+    auto extra = reader.GetColumn("extra");
+    for (int i = 0; i < 200; i++) {
+        ASSERT_EQ(frame[i], (double)i);
+        ASSERT_EQ(std::isnan(noise[i]), i >= 150);
+        if (i < 150)
+            ASSERT_TRUE(std::isnan(extra[i]));
+        else
+            ASSERT_EQ(extra[i], -1.0 * i);
+    }
+
+    std::remove(filename.c_str());
+}
+
+#ifdef __linux__
+TEST(ChWriterBinary, write_error) {
+    // Writing to /dev/full always fails (no space left on device)
+    ChWriterBinary writer("/dev/full", columns, 100);
+    std::mt19937 gen(42);
+    for (int i = 0; i < 1000; i++)
+        writer.Write(MakeRecord(i, gen));
+    ASSERT_FALSE(writer.Flush());
+    ASSERT_TRUE(writer.HasFailed());
+    ASSERT_FALSE(writer.Write(MakeRecord(1000, gen)));
+    ASSERT_FALSE(writer.Close());
+    ASSERT_LT(writer.GetNumWritten(), 1000);
+}
+#endif
+
+TEST(ChWriterBinary, drop_policy) {
+    const std::string filename = "utest_writer_binary_drop.bin";
+
+    // A tiny buffer cannot absorb a burst of records, so some are dropped (but none are lost silently)
+    ChWriterBinary writer(filename, {"value"}, 1, 2);
+    writer.SetOverflowPolicy(ChWriterBinary::OverflowPolicy::DROP);
+    int num_queued = 0;
+    for (int i = 0; i < 100000; i++) {
+        double value = i;
+        if (writer.Write(&value))
+            num_queued++;
+    }
+    writer.Close();
+    ASSERT_EQ(num_queued + writer.GetNumDropped(), 100000);
+    ASSERT_EQ(writer.GetNumWritten(), num_queued);
+
+    ChReaderBinary reader(filename);
+    ASSERT_EQ(reader.GetNumRecords(), num_queued);
+    auto values = reader.GetColumn("value");
+    for (size_t i = 1; i < values.size(); i++)
+        ASSERT_LT(values[i - 1], values[i]);
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChWriterBinary, bodies) {
+    const std::string filename = "utest_writer_binary_bodies.bin";
+
+    auto body1 = chrono_types::make_shared<ChBody>();
+    body1->SetName("chassis");
+    auto body2 = chrono_types::make_shared<ChBody>();
+    {
+        ChWriterBodiesBinary writer(filename, {body1, body2}, true);
+        for (int i = 0; i < 100; i++) {
+            body1->SetPos(ChVector3d(i, 0, 1));
+            body2->SetRot(QuatFromAngleZ(0.01 * i));
+            body2->SetAngVelLocal(ChVector3d(0, 0, 1));
+            writer.Write(i * 0.1);
+        }
+    }
+
+    ChReaderBinary reader(filename);
+    ASSERT_EQ(reader.GetNumColumns(), 1 + 2 * 13);
+    ASSERT_EQ(reader.GetNumRecords(), 100);
+    auto time = reader.GetColumn("time");
+    auto x = reader.GetColumn("chassis.pos.x");
+    auto e3 = reader.GetColumn("body1.rot.e3");
+    auto wz = reader.GetColumn("body1.angvel.z");
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(time[i], i * 0.1);
+        ASSERT_EQ(x[i], (double)i);
+        ASSERT_EQ(e3[i], QuatFromAngleZ(0.01 * i).e3());
+        ASSERT_NEAR(wz[i], 1.0, 1e-12);
+    }
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test the Newton matrix update strategies of the implicit timesteppers on a
+// stiff FEA problem (ANCF cable pendulum falling under gravity).
+// Reusing the Newton matrix across steps (JacobianUpdate::AUTOMATIC) must
+// require fewer solver setups than updating it at every step, with results
+// matching those obtained with the default strategy.
+//
+// =============================================================================
+
+#include <iostream>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+using JacobianUpdate = ChImplicitIterativeTimestepper::JacobianUpdate;
+
+const double step_size = 1e-3;
+const int num_steps = 500;
+
+// ANCF cable pinned at one end, released from a horizontal configuration
+class CablePendulum {
+  public:
+    CablePendulum(ChTimestepper::Type type, JacobianUpdate method) {
+        auto mesh = chrono_types::make_shared<ChMesh>();
+
+        auto section = chrono_types::make_shared<ChBeamSectionCable>();
+        section->SetDiameter(0.015);
+        section->SetYoungModulus(0.01e9);
+
+        auto ground = chrono_types::make_shared<ChBody>();
+        ground->SetFixed(true);
+        m_system.Add(ground);
+
+        ChBuilderCableANCF builder;
+        builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0));
+        m_tip = builder.GetLastBeamNodes().back();
+
+        auto pin = chrono_types::make_shared<ChLinkNodeFrame>();
+        pin->Initialize(builder.GetLastBeamNodes().front(), ground);
+        m_system.Add(pin);
+
+        m_system.Add(mesh);
+
+        m_system.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+        m_system.SetTimestepperType(type);
+
+        m_integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(m_system.GetTimestepper());
+        m_integrator->SetJacobianUpdateMethod(method);
+        m_integrator->SetMaxIters(20);
+        m_integrator->SetAbsTolerances(1e-8);
+        if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(m_system.GetTimestepper()))
+            hht->SetStepControl(false);
+    }
+
+    void Simulate(int steps, double step) {
+        for (int i = 0; i < steps; i++)
+            m_system.DoStepDynamics(step);
+    }
+
+    ChSystemSMC& GetSystem() { return m_system; }
+    ChVector3d GetTipPos() const { return m_tip->GetPos(); }
+    std::shared_ptr<ChImplicitIterativeTimestepper> GetIntegrator() const { return m_integrator; }
+
+  private:
+    ChSystemSMC m_system;
+    std::shared_ptr<ChNodeFEAxyzD> m_tip;
+    std::shared_ptr<ChImplicitIterativeTimestepper> m_integrator;
+};
+
+static void TestReuse(ChTimestepper::Type type,
+                      JacobianUpdate ref_method = JacobianUpdate::EVERY_STEP,
+                      int steps = num_steps) {
+    CablePendulum ref(type, ref_method);
+    ref.Simulate(steps, step_size);
+
+    CablePendulum model(type, JacobianUpdate::AUTOMATIC);
+    model.Simulate(steps, step_size);
+
+    double setups_ref = ref.GetIntegrator()->GetNumSetupCallsPerStep();
+    double setups = model.GetIntegrator()->GetNumSetupCallsPerStep();
+    std::cout << "Solver setups per step:  reference " << setups_ref << "  AUTOMATIC " << setups << std::endl;
+    std::cout << "Tip position:  reference " << ref.GetTipPos() << "  AUTOMATIC " << model.GetTipPos() << std::endl;
+
+    ASSERT_EQ(ref.GetIntegrator()->GetNumStepsTotal(), steps);
+    ASSERT_EQ(model.GetIntegrator()->GetNumStepsTotal(), steps);
+    ASSERT_GE(setups_ref, 1.0);
+    ASSERT_LT(setups, 0.5 * setups_ref);
+    ASSERT_NEAR((model.GetTipPos() - ref.GetTipPos()).Length(), 0.0, 1e-3);
+}
+
+TEST(ChTimestepperHHT, jacobian_reuse) {
+    TestReuse(ChTimestepper::Type::HHT);
+}
+
+TEST(ChTimestepperEulerImplicit, jacobian_reuse) {
+    TestReuse(ChTimestepper::Type::EULER_IMPLICIT);
+}
+
+// The (non-dissipative) trapezoidal scheme needs many Newton iterations on this stiff problem: compare against full
+// Newton, over the initial part of the motion only
+TEST(ChTimestepperTrapezoidal, jacobian_reuse) {
+    TestReuse(ChTimestepper::Type::TRAPEZOIDAL, JacobianUpdate::EVERY_ITERATION, 100);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_invalidation) {
+    CablePendulum model(ChTimestepper::Type::HHT, JacobianUpdate::AUTOMATIC);
+    auto integrator = model.GetIntegrator();
+
+    // First step: no Newton matrix available
+    model.Simulate(1, step_size);
+    ASSERT_GE(integrator->GetNumSetupCalls(), 1);
+    model.Simulate(1, step_size);
+    ASSERT_EQ(integrator->GetNumSetupCalls(), 0);
+
+    // A change in step size requires a new Newton matrix
+    model.Simulate(1, step_size / 2);
+    ASSERT_GE(integrator->GetNumSetupCalls(), 1);
+    model.Simulate(1, step_size / 2);
+    ASSERT_EQ(integrator->GetNumSetupCalls(), 0);
+
+    // A solver setup from a different analysis requires a new Newton matrix
+    model.GetSystem().DoAssembly(AssemblyLevel::FULL);
+    model.Simulate(1, step_size / 2);
+    ASSERT_GE(integrator->GetNumSetupCalls(), 1);
+
+    // Limit on the number of steps over which the Newton matrix is reused
+    integrator->SetJacobianMaxAge(2);
+    integrator->ResetStatistics();
+    model.Simulate(9, step_size / 2);
+    ASSERT_GE(integrator->GetNumSetupCallsTotal(), 3);
+}
@@ -0,0 +1,235 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test grouping of FEA mesh elements by concrete type.
+// A mesh with interleaved element types (some with specialized loops, some
+// using the generic virtual dispatch) must produce the same internal forces as
+// a direct loop over all elements.
+// The same holds for mass matrix products, lumped masses, and element
+// Jacobians.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementBar.h"
+#include "chrono/fea/ChElementSpring.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChNodeFEAxyz.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Element type without specialized loops in ChMesh
+class CustomBar : public ChElementBar {};
+
+TEST(ChMesh, element_buckets) {
+    ChSystemSMC sys;
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetAutomaticGravity(false);
+    sys.Add(mesh);
+
+    int num_nodes = 31;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i < num_nodes; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(0.1 * i, 0.01 * (i % 3), 0));
+        node->SetMass(0.1);
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    nodes[0]->SetFixed(true);
+
+    for (int i = 0; i < num_nodes - 1; i++) {
+        std::shared_ptr<ChElementBase> element;
+        switch (i % 3) {
+            case 0: {
+                auto bar = chrono_types::make_shared<ChElementBar>();
+                bar->SetNodes(nodes[i], nodes[i + 1]);
+                bar->SetArea(1e-4);
+                bar->SetYoungModulus(2e8);
+                element = bar;
+                break;
+            }
+            case 1: {
+                auto bar = chrono_types::make_shared<CustomBar>();
+                bar->SetNodes(nodes[i], nodes[i + 1]);
+                bar->SetArea(2e-4);
+                bar->SetYoungModulus(1e8);
+                element = bar;
+                break;
+            }
+            case 2: {
+                auto spring = chrono_types::make_shared<ChElementSpring>();
+                spring->SetNodes(nodes[i], nodes[i + 1]);
+                spring->SetSpringCoefficient(1e4);
+                spring->SetDampingCoefficient(10);
+                element = spring;
+                break;
+            }
+        }
+        mesh->AddElement(element);
+    }
+
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    for (int i = 0; i < 10; i++)
+        sys.DoStepDynamics(1e-4);
+
+    // Check element groups
+    auto stats = mesh->GetElementBucketStats();
+    ASSERT_EQ(stats.size(), 3);
+    unsigned int num_elements = 0;
+    unsigned int num_specialized = 0;
+    for (const auto& s : stats) {
+        EXPECT_EQ(s.num_elements, (unsigned int)(num_nodes - 1) / 3);
+        num_elements += s.num_elements;
+        if (s.specialized)
+            num_specialized++;
+    }
+    EXPECT_EQ(num_elements, mesh->GetNumElements());
+    EXPECT_EQ(num_specialized, 2);
+
+    // Compare mesh internal forces with a direct loop over elements
+    ChVectorDynamic<> R_mesh(sys.GetNumCoordsVelLevel());
+    R_mesh.setZero();
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_mesh, 1.0);
+
+    ChVectorDynamic<> R_ref(sys.GetNumCoordsVelLevel());
+    R_ref.setZero();
+    for (const auto& element : mesh->GetElements())
+        element->EleIntLoadResidual_F(R_ref, 1.0);
+
+    double err = (R_mesh - R_ref).lpNorm<Eigen::Infinity>();
+    double scale = std::max(1.0, R_ref.lpNorm<Eigen::Infinity>());
+    EXPECT_LT(err / scale, 1e-12);
+
+    // Compare mass matrix products and lumped masses with direct loops over nodes and elements
+    ChVectorDynamic<> w(sys.GetNumCoordsVelLevel());
+    for (int i = 0; i < w.size(); i++)
+        w(i) = 0.1 * (i % 7) - 0.3;
+
+    R_mesh.setZero();
+    mesh->IntLoadResidual_Mv(mesh->GetOffset_w(), R_mesh, w, 0.5);
+    ChVectorDynamic<> Md_mesh(sys.GetNumCoordsVelLevel());
+    Md_mesh.setZero();
+    double err_mesh = 0;
+    mesh->IntLoadLumpedMass_Md(mesh->GetOffset_w(), Md_mesh, err_mesh, 0.5);
+
+    R_ref.setZero();
+    ChVectorDynamic<> Md_ref(sys.GetNumCoordsVelLevel());
+    Md_ref.setZero();
+    double err_ref = 0;
+    for (const auto& node : nodes) {
+        if (!node->IsFixed()) {
+            node->NodeIntLoadResidual_Mv(node->NodeGetOffsetVelLevel(), R_ref, w, 0.5);
+            node->NodeIntLoadLumpedMass_Md(node->NodeGetOffsetVelLevel(), Md_ref, err_ref, 0.5);
+        }
+    }
+    for (const auto& element : mesh->GetElements()) {
+        element->EleIntLoadResidual_Mv(R_ref, w, 0.5);
+        element->EleIntLoadLumpedMass_Md(Md_ref, err_ref, 0.5);
+    }
+
+    EXPECT_LT((R_mesh - R_ref).lpNorm<Eigen::Infinity>(), 1e-12);
+    EXPECT_LT((Md_mesh - Md_ref).lpNorm<Eigen::Infinity>(), 1e-12);
+    EXPECT_NEAR(err_mesh, err_ref, 1e-12);
+
+    // Compare the element KRM blocks with the element matrices evaluated through virtual calls
+    mesh->LoadKRMMatrices(1.0, 0.1, 0.01);
+    for (const auto& element : mesh->GetElements()) {
+        auto generic = std::static_pointer_cast<ChElementGeneric>(element);
+        ChMatrixDynamic<> H(element->GetNumCoordsPosLevel(), element->GetNumCoordsPosLevel());
+        element->ComputeKRMmatricesGlobal(H, 1.0, 0.1, 0.01);
+        double scale_H = std::max(1.0, H.lpNorm<Eigen::Infinity>());
+        EXPECT_LT((generic->Kstiffness().GetMatrix() - H).lpNorm<Eigen::Infinity>() / scale_H, 1e-12);
+    }
+}
+
+TEST(ChMesh, element_buckets_rebuild) {
+    ChSystemSMC sys;
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetAutomaticGravity(false);
+    sys.Add(mesh);
+
+    int num_nodes = 11;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i < num_nodes; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector3d(0.1 * i, 0.01 * (i % 2), 0));
+        node->SetMass(0.1);
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    nodes[0]->SetFixed(true);
+
+    for (int i = 0; i < num_nodes - 1; i++) {
+        auto bar = chrono_types::make_shared<ChElementBar>();
+        bar->SetNodes(nodes[i], nodes[i + 1]);
+        bar->SetArea(1e-4);
+        bar->SetYoungModulus(2e8);
+        mesh->AddElement(bar);
+    }
+
+    // Element groups are built at initialization
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.DoStepDynamics(1e-4);
+
+    auto stats = mesh->GetElementBucketStats();
+    ASSERT_EQ(stats.size(), 1);
+    EXPECT_EQ(stats[0].num_elements, (unsigned int)(num_nodes - 1));
+
+    // Add elements of new types after the groups were built
+    for (int i = 0; i < num_nodes - 2; i += 2) {
+        auto spring = chrono_types::make_shared<ChElementSpring>();
+        spring->SetNodes(nodes[i], nodes[i + 2]);
+        spring->SetSpringCoefficient(1e4);
+        spring->SetDampingCoefficient(10);
+        mesh->AddElement(spring);
+    }
+    auto custom = chrono_types::make_shared<CustomBar>();
+    custom->SetNodes(nodes[0], nodes[num_nodes - 1]);
+    custom->SetArea(1e-4);
+    custom->SetYoungModulus(1e8);
+    mesh->AddElement(custom);
+
+    for (int i = 0; i < 5; i++)
+        sys.DoStepDynamics(1e-4);
+
+    // All elements must be accounted for in the rebuilt groups
+    stats = mesh->GetElementBucketStats();
+    ASSERT_EQ(stats.size(), 3);
+    unsigned int num_elements = 0;
+    for (const auto& s : stats)
+        num_elements += s.num_elements;
+    EXPECT_EQ(num_elements, mesh->GetNumElements());
+
+    ChVectorDynamic<> R_mesh(sys.GetNumCoordsVelLevel());
+    R_mesh.setZero();
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_mesh, 1.0);
+
+    ChVectorDynamic<> R_ref(sys.GetNumCoordsVelLevel());
+    R_ref.setZero();
+    for (const auto& element : mesh->GetElements())
+        element->EleIntLoadResidual_F(R_ref, 1.0);
+
+    double err = (R_mesh - R_ref).lpNorm<Eigen::Infinity>();
+    double scale = std::max(1.0, R_ref.lpNorm<Eigen::Infinity>());
+    EXPECT_LT(err / scale, 1e-12);
+
+    // Removing all elements empties the groups
+    mesh->ClearElements();
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_mesh, 1.0);
+    EXPECT_TRUE(mesh->GetElementBucketStats().empty());
+}
@@ -0,0 +1,162 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test the preconditioners of the iterative linear solvers on a saddle-point
+// problem: ANCF cables connected to rigid bodies through joints.
+// The results obtained with MINRES and GMRES with each preconditioner are
+// compared with those of a direct sparse solver, and the iteration counts are
+// compared with those obtained with the diagonal preconditioner.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChLinkNodeFrame.h"
+#include "chrono/fea/ChLinkNodeSlopeFrame.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+using PreconditionerType = ChIterativeSolverLS::PreconditionerType;
+
+// Cable fixed at one end, with a rigid box attached at the other end (position and direction constraints)
+class Model {
+  public:
+    Model(std::shared_ptr<ChSolver> solver) {
+        auto mesh = chrono_types::make_shared<ChMesh>();
+
+        auto section = chrono_types::make_shared<ChBeamSectionCable>();
+        section->SetDiameter(0.015);
+        section->SetYoungModulus(0.01e9);
+
+        auto ground = chrono_types::make_shared<ChBody>();
+        ground->SetFixed(true);
+        m_system.Add(ground);
+
+        ChBuilderCableANCF builder;
+        builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0));
+
+        auto hinge = chrono_types::make_shared<ChLinkNodeFrame>();
+        hinge->Initialize(builder.GetLastBeamNodes().front(), ground);
+        m_system.Add(hinge);
+
+        m_box = chrono_types::make_shared<ChBodyEasyBox>(0.2, 0.04, 0.04, 1000);
+        m_box->SetPos(builder.GetLastBeamNodes().back()->GetPos() + ChVector3d(0.1, 0, 0));
+        m_system.Add(m_box);
+
+        auto constraint_pos = chrono_types::make_shared<ChLinkNodeFrame>();
+        constraint_pos->Initialize(builder.GetLastBeamNodes().back(), m_box);
+        m_system.Add(constraint_pos);
+
+        auto constraint_dir = chrono_types::make_shared<ChLinkNodeSlopeFrame>();
+        constraint_dir->Initialize(builder.GetLastBeamNodes().back(), m_box);
+        constraint_dir->SetDirectionInAbsoluteCoords(ChVector3d(1, 0, 0));
+        m_system.Add(constraint_dir);
+
+        m_system.Add(mesh);
+
+        m_system.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+        m_system.SetSolver(solver);
+    }
+
+    ChSystemSMC& GetSystem() { return m_system; }
+    std::shared_ptr<ChBodyEasyBox> GetBox() const { return m_box; }
+
+  private:
+    ChSystemSMC m_system;
+    std::shared_ptr<ChBodyEasyBox> m_box;
+};
+
+const double step_size = 0.002;
+const int num_steps = 200;
+
+// Simulate with the given iterative solver, compare with the direct solver, and return the total number of iterations
+static int Simulate(std::shared_ptr<ChIterativeSolverLS> solver, PreconditionerType type) {
+    solver->SetPreconditioner(type);
+    solver->SetMaxIterations(500);
+    solver->SetTolerance(1e-12);
+    Model model(solver);
+
+    auto direct = chrono_types::make_shared<ChSolverSparseQR>();
+    Model reference(direct);
+
+    int iterations = 0;
+    for (int i = 0; i < num_steps; i++) {
+        model.GetSystem().DoStepDynamics(step_size);
+        reference.GetSystem().DoStepDynamics(step_size);
+        iterations += solver->GetIterations();
+    }
+
+    auto p = model.GetBox()->GetPos();
+    auto p_ref = reference.GetBox()->GetPos();
+    EXPECT_NEAR((p - p_ref).Length(), 0.0, 1e-5);
+    EXPECT_NEAR(std::abs(model.GetBox()->GetRot().Dot(reference.GetBox()->GetRot())), 1.0, 1e-8);
+
+    return iterations;
+}
+
+TEST(ChIterativeSolverLS, preconditioners_MINRES) {
+    int it_diag = Simulate(chrono_types::make_shared<ChSolverMINRES>(), PreconditionerType::DIAGONAL);
+    int it_block = Simulate(chrono_types::make_shared<ChSolverMINRES>(), PreconditionerType::BLOCK_JACOBI);
+    int it_schur = Simulate(chrono_types::make_shared<ChSolverMINRES>(), PreconditionerType::CONSTRAINT_BLOCK);
+    int it_ildlt = Simulate(chrono_types::make_shared<ChSolverMINRES>(), PreconditionerType::ILDLT);
+    ASSERT_LT(it_block, it_diag);
+    ASSERT_LT(it_schur, it_block);
+    ASSERT_LT(it_ildlt, it_diag);
+}
+
+TEST(ChIterativeSolverLS, preconditioners_GMRES) {
+    int it_diag = Simulate(chrono_types::make_shared<ChSolverGMRES>(), PreconditionerType::DIAGONAL);
+    int it_block = Simulate(chrono_types::make_shared<ChSolverGMRES>(), PreconditionerType::BLOCK_JACOBI);
+    int it_schur = Simulate(chrono_types::make_shared<ChSolverGMRES>(), PreconditionerType::CONSTRAINT_BLOCK);
+    int it_ildlt = Simulate(chrono_types::make_shared<ChSolverGMRES>(), PreconditionerType::ILDLT);
+    ASSERT_LT(it_block, it_diag);
+    ASSERT_LT(it_schur, it_block);
+    ASSERT_LT(it_ildlt, it_diag);
+}
+
+TEST(ChIterativeSolverLS, preconditioner_reuse) {
+    auto solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetPreconditionerReuse(4);
+    int iterations = Simulate(solver, PreconditionerType::ILDLT);
+    ASSERT_GT(iterations, 0);
+
+    // One solver setup per step (linearized integrator): the preconditioner is updated every 5 steps
+    ASSERT_EQ(solver->GetNumPreconditionerUpdates(), num_steps / 5);
+}
+
+TEST(ChIterativeSolverLS, preconditioner_update_per_step) {
+    auto solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetPreconditioner(PreconditionerType::ILDLT);
+    solver->SetMaxIterations(500);
+    solver->SetTolerance(1e-12);
+    solver->SetPreconditionerReuse(1000);
+    Model model(solver);
+    model.GetSystem().SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT);
+
+    // Newton integrator: several solver setups per step, with one preconditioner update at the start of each step
+    int num_setups = 0;
+    for (int i = 0; i < 20; i++) {
+        solver->ForcePreconditionerUpdate();
+        model.GetSystem().DoStepDynamics(step_size);
+        num_setups += model.GetSystem().GetSolverSetupCount();
+    }
+    ASSERT_GT(num_setups, 20);
+    ASSERT_EQ(solver->GetNumPreconditionerUpdates(), 20);
+}
@@ -0,0 +1,287 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the explicit (WCSPH) solver on a small dam break problem.
+// The water column collapses under gravity for a fixed number of steps and the
+// following are checked:
+// - no particle is lost and all particle states are finite;
+// - the results do not depend on the number of OpenMP threads (CPU backend);
+// - the front position and the kinetic energy of the fluid match the reference
+//   values of the backend (CUDA or CPU) of the Chrono::FSI library the test is
+//   linked with;
+// - the front does not move faster than the ideal (Ritter) dam break front.
+//
+// When both backends are built (CUDA available), this test is built once for
+// each backend. The CPU test writes its final particle states (--output) and the
+// CUDA test compares its own results with them, particle by particle (--compare).
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+
+#include "chrono_fsi/ChSystemFsi.h"
+
+#include "chrono_thirdparty/cxxopts/ChCLI.h"
+
+// Chrono namespaces
+using namespace chrono;
+using namespace chrono::fsi;
+
+//------------------------------------------------------------------
+// dimensions of the container and of the initial water column
+//------------------------------------------------------------------
+double bxDim = 1.2;
+double byDim = 0.1;
+double bzDim = 0.6;
+
+double fxDim = 0.3;
+double fyDim = 0.1;
+double fzDim = 0.3;
+
+double spacing = 0.02;
+double step_size = 5e-5;
+int num_steps = 400;
+
+//------------------------------------------------------------------
+// Reference values at the end of the simulation and relative tolerances, per backend.
+//
+// CPU: recorded with the CPU backend. The CPU results do not depend on the number of threads (checked below), so the
+// tolerance only has to cover differences in floating point code generation between compilers and platforms (FMA
+// contraction, vectorized math functions). Relative perturbations of 1e-14 of the initial particle positions change the
+// front and the kinetic energy by less than 1e-13 (relative) over the simulated interval, in which the flow is still
+// smooth; the tolerance of 1e-4 leaves a large margin.
+//
+// CUDA: the GPU results depend on the order of the atomic accumulations, which is not reproducible. No values were
+// recorded separately with the CUDA backend; the CPU values are used, with a tolerance that also covers the
+// accumulation order and the GPU math library. When both backends are built, the particle by particle comparison
+// with the CPU results (--compare) is the stricter consistency check.
+//------------------------------------------------------------------
+#ifdef CHRONO_FSI_USE_CUDA
+const char* backend = "CUDA";
+double front_ref = 0.30309105;
+double kinetic_energy_ref = 0.00770179;
+const double rel_Tol = 1.0e-3;
+#else
+const char* backend = "CPU";
+double front_ref = 0.30309105;
+double kinetic_energy_ref = 0.00770179;
+const double rel_Tol = 1.0e-4;
+#endif
+
+// Tolerance for the comparison of the particle states of different backends, relative to the initial spacing (for the
+// positions) and to the velocity scale sqrt(g * H) of the dam break (for the velocities)
+const double backend_Tol = 1.0e-3;
+
+//------------------------------------------------------------------
+// Results of a dam break simulation
+//------------------------------------------------------------------
+struct DamBreakResult {
+    size_t num_fluid;                    // number of fluid particles
+    std::vector<ChVector3d> positions;   // positions of the fluid particles
+    std::vector<ChVector3d> velocities;  // velocities of the fluid particles
+    double time;                         // simulation time
+};
+
+//------------------------------------------------------------------
+// Run the dam break with the given number of OpenMP threads
+//------------------------------------------------------------------
+DamBreakResult RunDamBreak(int num_threads) {
+    ChOMP::SetNumThreads(num_threads);
+
+    // Create a physical system and a corresponding FSI system
+    ChSystemSMC sysMBS;
+    ChSystemFsi sysFSI(&sysMBS);
+
+    // Initialize the parameters using an input JSON file and refine the resolution
+    sysFSI.ReadParametersFromFile(GetChronoDataFile("fsi/input_json/demo_FSI_DamBreak_Explicit.json"));
+    sysFSI.SetInitialSpacing(spacing);
+    sysFSI.SetKernelLength(spacing);
+    sysFSI.SetStepSize(step_size);
+    sysFSI.SetMaxStepSize(step_size);
+    sysFSI.SetVerbose(false);
+
+    // Periodic boundary condition in the Y direction
+    ChVector3d cMin(-bxDim / 2 - 10.0 * spacing, -byDim / 2 - spacing / 2, -2.0 * bzDim);
+    ChVector3d cMax(bxDim / 2 + 10.0 * spacing, byDim / 2 + spacing / 2, 2.0 * bzDim);
+    sysFSI.SetBoundaries(cMin, cMax);
+
+    // Create the water column at the left end of the container, with hydrostatic initial pressure
+    chrono::utils::ChGridSampler<> sampler(spacing);
+    ChVector3d boxCenter(-bxDim / 2 + fxDim / 2, 0.0, fzDim / 2);
+    ChVector3d boxHalfDim(fxDim / 2, fyDim / 2, fzDim / 2);
+    std::vector<ChVector3d> points = sampler.SampleBox(boxCenter, boxHalfDim);
+    double gz = std::abs(sysFSI.GetGravitationalAcceleration().z());
+    for (const auto& p : points) {
+        auto pre_ini = sysFSI.GetDensity() * gz * (-p.z() + fzDim);
+        auto rho_ini = sysFSI.GetDensity() + pre_ini / (sysFSI.GetSoundSpeed() * sysFSI.GetSoundSpeed());
+        sysFSI.AddSPHParticle(p, rho_ini, pre_ini, sysFSI.GetViscosity());
+    }
+
+    // Container walls with BCE markers
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    ground->EnableCollision(false);
+    sysMBS.AddBody(ground);
+    sysFSI.AddBoxContainerBCE(ground,                                         //
+                              ChFrame<>(ChVector3d(0, 0, bzDim / 2), QUNIT),  //
+                              ChVector3d(bxDim, byDim, bzDim),                //
+                              ChVector3i(2, 0, -1));
+
+    sysFSI.Initialize();
+
+    for (int i = 0; i < num_steps; i++)
+        sysFSI.DoStepDynamics_FSI();
+
+    // Fluid particles are stored first
+    DamBreakResult result;
+    result.num_fluid = points.size();
+    result.positions = sysFSI.GetParticlePositions();
+    result.velocities = sysFSI.GetParticleVelocities();
+    result.positions.resize(result.num_fluid);
+    result.velocities.resize(result.num_fluid);
+    result.time = sysFSI.GetSimTime();
+
+    return result;
+}
+
+//------------------------------------------------------------------
+// Write the fluid particle states to a file and read them back
+//------------------------------------------------------------------
+bool WriteResult(const DamBreakResult& res, const std::string& filename) {
+    std::ofstream file(filename);
+    file.precision(17);
+    file << res.num_fluid << " " << res.time << "\n";
+    for (size_t i = 0; i < res.num_fluid; i++) {
+        const auto& p = res.positions[i];
+        const auto& v = res.velocities[i];
+        file << p.x() << " " << p.y() << " " << p.z() << " " << v.x() << " " << v.y() << " " << v.z() << "\n";
+    }
+    return file.good();
+}
+
+bool ReadResult(const std::string& filename, DamBreakResult& res) {
+    std::ifstream file(filename);
+    file >> res.num_fluid >> res.time;
+    res.positions.resize(res.num_fluid);
+    res.velocities.resize(res.num_fluid);
+    for (size_t i = 0; i < res.num_fluid; i++) {
+        double px, py, pz, vx, vy, vz;
+        file >> px >> py >> pz >> vx >> vy >> vz;
+        res.positions[i] = ChVector3d(px, py, pz);
+        res.velocities[i] = ChVector3d(vx, vy, vz);
+    }
+    return !file.fail();
+}
+
+// ===============================
+int main(int argc, char* argv[]) {
+    ChCLI cli(argv[0]);
+    cli.AddOption<std::string>("Test", "o,output", "Write the final fluid particle states to this file", "");
+    cli.AddOption<std::string>("Test", "c,compare", "Compare with the particle states in this file (other backend)",
+                               "");
+    if (!cli.Parse(argc, argv, true))
+        return 1;
+    auto output_file = cli.GetAsType<std::string>("output");
+    auto compare_file = cli.GetAsType<std::string>("compare");
+
+    printf("\n  Chrono::FSI backend: %s\n", backend);
+
+    auto res1 = RunDamBreak(1);
+
+    // Check that all particle states are finite
+    for (size_t i = 0; i < res1.num_fluid; i++) {
+        const auto& p = res1.positions[i];
+        const auto& v = res1.velocities[i];
+        if (!(std::isfinite(p.x()) && std::isfinite(p.y()) && std::isfinite(p.z()) && std::isfinite(v.x()) &&
+              std::isfinite(v.y()) && std::isfinite(v.z()))) {
+            printf("\n particle %zu has a non-finite state\n", i);
+            return 1;
+        }
+    }
+
+#ifndef CHRONO_FSI_USE_CUDA
+    // Compare the results obtained with different numbers of threads
+    int num_threads = std::max(ChOMP::GetNumProcs(), 4);
+    auto resN = RunDamBreak(num_threads);
+    double max_diff = 0;
+    for (size_t i = 0; i < res1.num_fluid; i++) {
+        max_diff = std::max(max_diff, (res1.positions[i] - resN.positions[i]).Length());
+        max_diff = std::max(max_diff, (res1.velocities[i] - resN.velocities[i]).Length());
+    }
+    printf("  max difference 1 vs %d threads = %g\n", num_threads, max_diff);
+    if (max_diff > 1e-10) {
+        printf("\n results depend on the number of threads\n");
+        return 1;
+    }
+#endif
+
+    // Front position (relative to the left wall) and kinetic energy per unit mass
+    double front = 0;
+    double kinetic_energy = 0;
+    for (size_t i = 0; i < res1.num_fluid; i++) {
+        front = std::max(front, res1.positions[i].x() + bxDim / 2);
+        kinetic_energy += 0.5 * res1.velocities[i].Length2();
+    }
+    kinetic_energy /= res1.num_fluid;
+    printf("  time = %g  front = %.8f  kinetic energy = %.8f\n", res1.time, front, kinetic_energy);
+
+    // The front cannot be faster than the ideal dam break front
+    double front_max = fxDim + 2 * std::sqrt(9.81 * fzDim) * res1.time;
+    if (front <= fxDim || front > front_max) {
+        printf("\n front position %g outside of [%g, %g]\n", front, fxDim, front_max);
+        return 1;
+    }
+
+    if (std::abs(front - front_ref) > rel_Tol * front_ref ||
+        std::abs(kinetic_energy - kinetic_energy_ref) > rel_Tol * kinetic_energy_ref) {
+        printf("\n mismatch with %s reference values: front = %.8f (%.8f), kinetic energy = %.8f (%.8f)\n", backend,
+               front, front_ref, kinetic_energy, kinetic_energy_ref);
+        return 1;
+    }
+
+    if (!output_file.empty() && !WriteResult(res1, output_file)) {
+        printf("\n cannot write %s\n", output_file.c_str());
+        return 1;
+    }
+
+    // Compare with the results of the other backend
+    if (!compare_file.empty()) {
+        DamBreakResult res;
+        if (!ReadResult(compare_file, res) || res.num_fluid != res1.num_fluid) {
+            printf("\n cannot read %s or different number of particles\n", compare_file.c_str());
+            return 1;
+        }
+        double vel_scale = std::sqrt(9.81 * fzDim);
+        double max_pos_diff = 0;
+        double max_vel_diff = 0;
+        for (size_t i = 0; i < res1.num_fluid; i++) {
+            max_pos_diff = std::max(max_pos_diff, (res1.positions[i] - res.positions[i]).Length());
+            max_vel_diff = std::max(max_vel_diff, (res1.velocities[i] - res.velocities[i]).Length());
+        }
+        printf("  max difference with %s: position = %g  velocity = %g\n", compare_file.c_str(), max_pos_diff,
+               max_vel_diff);
+        if (max_pos_diff > backend_Tol * spacing || max_vel_diff > backend_Tol * vel_scale) {
+            printf("\n results differ from those in %s\n", compare_file.c_str());
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for a granular column settling in a closed box. The test runs the same
+// setup with one and with several threads (relevant for the OpenMP CPU
+// backend, where the kernels are distributed over OpenMP threads) and checks
+// the settled state against bounds derived from the geometry of the problem.
+//
+// The force accumulation uses atomic floating point additions (on both the
+// CUDA and the CPU backend), so the particle trajectories are not
+// reproducible. The test therefore only checks aggregate quantities of the
+// settled packing: the lowest particles rest on the floor, the column has
+// collapsed to a packed bed, and about a third of the particles lie above a
+// plane three diameters over the floor.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/core/ChGlobal.h"
+#include "chrono/utils/ChOpenMP.h"
+#include "chrono_gpu/physics/ChSystemGpu.h"
+
+using namespace chrono;
+using namespace chrono::gpu;
+
+const float radius = 0.5f;
+const float box = 6.f;
+const float floor_z = -2 * box;  // bottom of the box
+const int num_particles = 150;
+
+struct SettlingResult {
+    float max_z;
+    float min_z;
+    float fraction_above;  // fraction of particles above the plane 3 diameters over the floor
+    float KE;
+};
+
+static SettlingResult SettleColumn(int num_threads) {
+    ChOMP::SetNumThreads(num_threads);
+
+    float density = 2.5f;
+
+    ChSystemGpu gpu_sys(radius, density, ChVector3f(box, box, 4 * box));
+    gpu_sys.SetGravitationalAcceleration(ChVector3d(0, 0, -980));
+    gpu_sys.SetFrictionMode(CHGPU_FRICTION_MODE::MULTI_STEP);
+    gpu_sys.SetTimeIntegrator(CHGPU_TIME_INTEGRATOR::CENTERED_DIFFERENCE);
+
+    gpu_sys.SetKn_SPH2SPH(1e6);
+    gpu_sys.SetKn_SPH2WALL(1e6);
+    gpu_sys.SetGn_SPH2SPH(1e4);
+    gpu_sys.SetGn_SPH2WALL(1e4);
+    gpu_sys.SetKt_SPH2SPH(5e5);
+    gpu_sys.SetKt_SPH2WALL(5e5);
+    gpu_sys.SetGt_SPH2SPH(50);
+    gpu_sys.SetGt_SPH2WALL(50);
+    gpu_sys.SetStaticFrictionCoeff_SPH2SPH(0.5f);
+    gpu_sys.SetStaticFrictionCoeff_SPH2WALL(0.5f);
+    gpu_sys.SetPsiFactors(32, 16);
+
+    // Regular lattice of spheres, slightly perturbed so that the column collapses
+    std::vector<ChVector3f> pos;
+    for (int k = 0; k < 6; k++) {
+        for (int j = 0; j < 5; j++) {
+            for (int i = 0; i < 5; i++) {
+                float dx = 0.05f * std::sin(1.0f + i + 3 * j + 7 * k);
+                float dy = 0.05f * std::cos(2.0f + 5 * i + j + 3 * k);
+                pos.push_back(ChVector3f(-2.2f + 1.1f * i + dx, -2.2f + 1.1f * j + dy, -2 * box + 1.f + 2.2f * k));
+            }
+        }
+    }
+    gpu_sys.SetParticles(pos);
+
+    float step_size = 5e-5f;
+    gpu_sys.SetFixedStepSize(step_size);
+    gpu_sys.SetBDFixed(true);
+    gpu_sys.Initialize();
+
+    gpu_sys.AdvanceSimulation(0.5f);
+
+    SettlingResult res;
+    res.max_z = gpu_sys.GetMaxParticleZ();
+    res.min_z = gpu_sys.GetMinParticleZ();
+    res.fraction_above = (float)gpu_sys.GetNumParticleAboveZ(floor_z + 6 * radius) / num_particles;
+    res.KE = gpu_sys.GetParticlesKineticEnergy();
+
+    return res;
+}
+
+// Check the settled packing.
+// The 150 particles (diameter 1) fill a 6 x 6 box base. A random packing, with a solid fraction between 0.5 (loose,
+// reduced by the walls of this narrow box) and 0.64, has a height of 3.4 to 4.4 diameters; the column (initially 11
+// diameters high) must have collapsed to it.
+static void CheckSettled(const SettlingResult& res) {
+    ASSERT_EQ(res.max_z, res.max_z);  // not NaN
+
+    // Lowest particles rest on the floor (overlap with the wall below 20% of the radius)
+    EXPECT_GT(res.min_z, floor_z + 0.8f * radius);
+    EXPECT_LT(res.min_z, floor_z + radius);
+
+    // Top of the packed bed: between 3 and 6 diameters over the floor
+    EXPECT_GT(res.max_z, floor_z + 6 * radius);
+    EXPECT_LT(res.max_z, floor_z + 12 * radius);
+
+    // Between 10% and 50% of the particles above 3 diameters (12% to 32% for a uniform bed of 3.4 to 4.4 diameters)
+    EXPECT_GT(res.fraction_above, 0.1f);
+    EXPECT_LT(res.fraction_above, 0.5f);
+
+    // At rest (kinetic energy small compared to the initial potential energy, of order 1e6)
+    EXPECT_LT(res.KE, 10);
+}
+
+TEST(gpuSettling, settled) {
+    auto res = SettleColumn(1);
+    CheckSettled(res);
+}
+
+TEST(gpuSettling, threads) {
+    auto res1 = SettleColumn(1);
+    auto res4 = SettleColumn(4);
+    CheckSettled(res4);
+
+    // Different force summation orders lead to different packings, with the same statistics
+    EXPECT_NEAR(res1.max_z, res4.max_z, 2 * radius);
+    EXPECT_NEAR(res1.min_z, res4.min_z, 0.1f * radius);
+    EXPECT_NEAR(res1.fraction_above, res4.fraction_above, 0.1f);
+}
@@ -35,6 +35,7 @@
 
 #include "chrono_modal/ChModalAssembly.h"
 
+#include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/solver/ChDirectSolverLScomplex.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
@@ -161,3 +162,104 @@ TEST(ChGeneralizedEigenvalueSolverKrylovSchur, BeamFixBody) {
     Eigen::saveMarketVector(eigvals, out_dir + testname + "_eigvals_CHRONO.txt");
     ASSERT_NEAR((eigvals_MATLAB - eigvals).cwiseQuotient(eigvals).lpNorm<Eigen::Infinity>(), 0, tolerance);
 }
+
+TEST(ChModalSolveUndamped, ConcurrentSpans) {
+    /*
+     * Cantilever beam, modes computed from the assembled M, K, Cq matrices with:
+     * - the default factorization (reference)
+     * - a Chrono direct sparse solver for the shift&invert factorization
+     * - multiple overlapping frequency spans, solved sequentially and in parallel
+     */
+
+    ChSystemNSC sys;
+    auto assembly = chrono_types::make_shared<ChModalAssembly>();
+    sys.Add(assembly);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    assembly->Add(mesh);
+    mesh->SetAutomaticGravity(false);
+
+    auto section = chrono_types::make_shared<ChBeamSectionEulerAdvanced>();
+    section->SetDensity(1000);
+    section->SetYoungModulus(100.e6);
+    section->SetShearModulusFromPoisson(0.31);
+    section->SetAsRectangularSection(0.05, 0.3);
+
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0, 0), ChVector3d(6, 0, 0), ChVector3d(0, 1, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    assembly->Add(ground);
+    auto root = chrono_types::make_shared<ChLinkMateFix>();
+    root->Initialize(builder.GetLastBeamNodes().front(), ground);
+    assembly->Add(root);
+
+    sys.Setup();
+    sys.Update();
+
+    ChSparseMatrix M, K, Cq;
+    assembly->GetSubassemblyMassMatrix(&M);
+    assembly->GetSubassemblyStiffnessMatrix(&K);
+    assembly->GetSubassemblyConstraintJacobianMatrix(&Cq);
+
+    ChMatrixDynamic<std::complex<double>> eigvects;
+    ChVectorDynamic<std::complex<double>> eigvals;
+
+    // Reference: lower 16 modes, single span, default factorization
+    ChVectorDynamic<double> freq_ref;
+    ChGeneralizedEigenvalueSolverKrylovSchur eigen_solver;
+    ChModalSolveUndamped modal_solver_ref(16, 1e-5, 500, 1e-10, false, eigen_solver);
+    ASSERT_EQ(modal_solver_ref.Solve(M, K, Cq, eigvects, eigvals, freq_ref), 16);
+
+    // Same problem, factorization with a Chrono direct solver
+    ChVectorDynamic<double> freq_lu;
+    ChSolverSparseLU lu_solver;
+    ChGeneralizedEigenvalueSolverKrylovSchur eigen_solver_lu(&lu_solver);
+    ChModalSolveUndamped modal_solver_lu(16, 1e-5, 500, 1e-10, false, eigen_solver_lu);
+    ASSERT_EQ(modal_solver_lu.Solve(M, K, Cq, eigvects, eigvals, freq_lu), 16);
+    ASSERT_NEAR((freq_lu - freq_ref).cwiseQuotient(freq_ref).lpNorm<Eigen::Infinity>(), 0, 1e-6);
+
+    // Multiple overlapping spans, with a cloned Chrono direct solver per span when run in parallel
+    std::vector<ChModalSolveUndamped::ChFreqSpan> spans = {{6, 1e-5}, {6, freq_ref[4]}, {6, freq_ref[8]}};
+
+    ChSolverSparseQR qr_solver;
+    ChGeneralizedEigenvalueSolverKrylovSchur eigen_solver_qr(&qr_solver);
+    std::unique_ptr<ChGeneralizedEigenvalueSolver> eigen_solver_clone(eigen_solver_qr.Clone());
+    ASSERT_TRUE(eigen_solver_clone != nullptr);
+
+    std::vector<const ChGeneralizedEigenvalueSolver*> solvers = {&eigen_solver, &eigen_solver_qr};
+    for (auto solver : solvers) {
+        ChModalSolveUndamped modal_solver_spans(spans, 500, 1e-10, false, *solver);
+
+        ChVectorDynamic<double> freq_seq;
+        modal_solver_spans.num_threads = 1;
+        int n_seq = modal_solver_spans.Solve(M, K, Cq, eigvects, eigvals, freq_seq);
+
+        ChVectorDynamic<double> freq_par;
+        modal_solver_spans.num_threads = 4;
+        int n_par = modal_solver_spans.Solve(M, K, Cq, eigvects, eigvals, freq_par);
+
+        // parallel and sequential runs merge the spans in the same way
+        ASSERT_GE(n_seq, 6);
+        ASSERT_EQ(n_par, n_seq);
+        ASSERT_NEAR((freq_par - freq_seq).cwiseQuotient(freq_seq).lpNorm<Eigen::Infinity>(), 0, 1e-8);
+
+        // all modes are in increasing order and match the reference ones (up to the highest reference frequency)
+        for (int i = 0; i < n_par; i++) {
+            if (i > 0)
+                ASSERT_GE(freq_par[i], freq_par[i - 1]);
+            if (freq_par[i] > freq_ref[15] * (1 + 1e-6))
+                continue;
+            double min_err = (freq_ref.array() - freq_par[i]).abs().minCoeff();
+            ASSERT_NEAR(min_err / freq_par[i], 0, 1e-6);
+        }
+
+        // the lower span is not affected by the others
+        ASSERT_NEAR((freq_par.head(6) - freq_ref.head(6)).cwiseQuotient(freq_ref.head(6)).lpNorm<Eigen::Infinity>(), 0,
+                    1e-6);
+    }
+
+    // timers of the clones used by the parallel runs are added to the original eigensolver
+    ASSERT_GT(eigen_solver_qr.GetTimeEigenSolver(), 0);
+}
@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for recomputing the modal reduction of a ChModalAssembly.
+// A cantilever beam is reduced, then reduced again in the same configuration
+// (the factorization of K_IIc must be reused) and, after a few steps under a
+// tip load, in the deformed configuration (the modal coordinates must be
+// re-initialized so that the internal nodes do not jump).
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "chrono_modal/ChModalAssembly.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::modal;
+using namespace chrono::fea;
+
+TEST(ChModalAssembly, rereduction) {
+    ChSystemNSC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+
+    auto qr_solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(qr_solver);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto assembly = chrono_types::make_shared<ChModalAssembly>();
+    assembly->SetReductionType(ChModalAssembly::ReductionType::CRAIG_BAMPTON);
+    assembly->SetInternalNodesUpdate(true);
+    assembly->SetUseStaticCorrection(false);
+    assembly->SetModalAutomaticGravity(false);
+    sys.Add(assembly);
+
+    auto mesh_internal = chrono_types::make_shared<ChMesh>();
+    assembly->AddInternal(mesh_internal);
+    auto mesh_boundary = chrono_types::make_shared<ChMesh>();
+    assembly->Add(mesh_boundary);
+    mesh_internal->SetAutomaticGravity(false);
+    mesh_boundary->SetAutomaticGravity(false);
+
+    auto section = chrono_types::make_shared<ChBeamSectionEulerAdvanced>();
+    section->SetDensity(1000);
+    section->SetYoungModulus(100e6);
+    section->SetShearModulusFromPoisson(0.31);
+    section->SetAsRectangularSection(0.05, 0.3);
+
+    double beam_L = 6;
+    auto node_A = chrono_types::make_shared<ChNodeFEAxyzrot>();
+    mesh_boundary->AddNode(node_A);
+    auto node_B = chrono_types::make_shared<ChNodeFEAxyzrot>(ChFrame<>(ChVector3d(beam_L, 0, 0)));
+    mesh_boundary->AddNode(node_B);
+
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh_internal, section, 8, node_A, node_B, ChVector3d(0, 1, 0));
+    auto node_mid = builder.GetLastBeamNodes()[4];
+
+    auto root = chrono_types::make_shared<ChLinkMateFix>();
+    root->Initialize(node_A, ground);
+    sys.AddLink(root);
+
+    sys.Setup();
+    sys.Update();
+
+    ChGeneralizedEigenvalueSolverKrylovSchur eigen_solver;
+    auto modes_settings = ChModalSolveUndamped(4, 1e-5, 500, 1e-10, false, eigen_solver);
+
+    // First reduction
+    assembly->DoModalReduction(modes_settings);
+    ASSERT_EQ(assembly->GetNumCoordinatesModal(), 4);
+    EXPECT_EQ(assembly->GetNumAnalyzeCallsKIIc(), 1);
+    EXPECT_EQ(assembly->GetNumFactorizeCallsKIIc(), 1);
+    double norm_M = assembly->GetModalMassMatrix().norm();
+    double norm_K = assembly->GetModalStiffnessMatrix().norm();
+
+    // Reduce again, in the same configuration: K_IIc is unchanged and its factorization is reused
+    assembly->DoModalReduction(modes_settings);
+    ASSERT_EQ(assembly->GetNumCoordinatesModal(), 4);
+    EXPECT_EQ(assembly->GetNumAnalyzeCallsKIIc(), 1);
+    EXPECT_EQ(assembly->GetNumFactorizeCallsKIIc(), 1);
+    EXPECT_NEAR(assembly->GetModalMassMatrix().norm(), norm_M, 1e-8 * norm_M);
+    EXPECT_NEAR(assembly->GetModalStiffnessMatrix().norm(), norm_K, 1e-8 * norm_K);
+    EXPECT_LT(assembly->GetModalCoordinatesPosLevel().lpNorm<Eigen::Infinity>(), 1e-8);
+
+    // Deform the beam with a tip load
+    node_B->SetForce(ChVector3d(0, -20, 0));
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+
+    ChVector3d tip_pos = node_B->GetPos();
+    ChVector3d mid_pos = node_mid->GetPos();
+    double mid_defl = (mid_pos - node_mid->GetX0().GetPos()).Length();
+    ASSERT_GT(mid_defl, 1e-6);
+
+    // Reduce again, in the deformed configuration: K_IIc has the same sparsity pattern but different values
+    assembly->DoModalReduction(modes_settings);
+    EXPECT_EQ(assembly->GetNumAnalyzeCallsKIIc(), 1);
+    EXPECT_EQ(assembly->GetNumFactorizeCallsKIIc(), 2);
+
+    // Boundary nodes are not affected; internal nodes are recovered from the re-initialized modal coordinates
+    sys.Update();
+    EXPECT_NEAR((node_B->GetPos() - tip_pos).Length(), 0, 1e-12);
+    EXPECT_NEAR((node_mid->GetPos() - mid_pos).Length(), 0, 0.05 * mid_defl);
+
+    // The simulation continues with the new modal basis
+    for (int i = 0; i < 50; i++)
+        sys.DoStepDynamics(1e-3);
+    EXPECT_TRUE(node_B->GetPos().eigen().allFinite());
+    EXPECT_LT((node_B->GetPos() - tip_pos).Length(), 10 * (tip_pos - node_B->GetX0().GetPos()).Length() + 1e-6);
+}
@@ -0,0 +1,253 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for allocation-free steady-state stepping: once the number of
+// contacts has stabilized, a step with an iterative VI solver and a linearized
+// timestepper must not perform any heap allocation.
+// Heap allocations are counted by interposing the C allocation functions
+// (supported with glibc only; the test is skipped on other platforms).
+//
+// =============================================================================
+
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerSMC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "tests/PendulumChain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// -----------------------------------------------------------------------------
+
+static std::atomic<bool> counting(false);
+static std::atomic<size_t> num_allocations(0);
+
+static inline void RecordAllocation() {
+    if (counting)
+        num_allocations++;
+}
+
+#if defined(__GLIBC__)
+    #define CH_COUNT_ALLOCATIONS
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t num, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+
+// All heap allocations (including operator new and Eigen aligned allocations) end up in these functions
+void* malloc(size_t size) {
+    RecordAllocation();
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t num, size_t size) {
+    RecordAllocation();
+    return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    RecordAllocation();
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) {
+    RecordAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) {
+    RecordAllocation();
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** ptr, size_t alignment, size_t size) {
+    RecordAllocation();
+    *ptr = __libc_memalign(alignment, size);
+    return *ptr ? 0 : ENOMEM;
+}
+}
+#endif
+
+// Return the number of heap allocations performed in the given number of steps
+static size_t CountAllocations(ChSystem& sys, double step, int num_steps) {
+    num_allocations = 0;
+    counting = true;
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step);
+    counting = false;
+    return num_allocations;
+}
+
+// -----------------------------------------------------------------------------
+
+// Layer of N x N spheres resting on a fixed box
+static std::unique_ptr<ChSystem> CreateSphereLayer(int n, ChContactMethod method) {
+    std::unique_ptr<ChSystem> sys;
+    std::shared_ptr<ChContactMaterial> mat;
+    if (method == ChContactMethod::NSC) {
+        sys = chrono_types::make_unique<ChSystemNSC>();
+        mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    } else {
+        sys = chrono_types::make_unique<ChSystemSMC>();
+        mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    }
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    mat->SetFriction(0.4f);
+
+    double radius = 0.05;
+    double spacing = 2.2 * radius;
+    double width = n * spacing + 2 * radius;
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(width, width, 0.1, 1000.0, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.05));
+    ground->SetFixed(true);
+    sys->AddBody(ground);
+
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 2000.0, false, true, mat);
+            sphere->SetPos(ChVector3d((ix - 0.5 * (n - 1)) * spacing, (iy - 0.5 * (n - 1)) * spacing, radius));
+            sys->AddBody(sphere);
+        }
+    }
+
+    return sys;
+}
+
+// -----------------------------------------------------------------------------
+
+class AllocationTest : public ::testing::TestWithParam<std::tuple<ChSolver::Type, ChTimestepper::Type>> {
+  protected:
+    void Configure(ChSystem& sys) {
+        sys.SetSolverType(std::get<0>(GetParam()));
+        sys.SetTimestepperType(std::get<1>(GetParam()));
+        sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+    }
+};
+
+TEST_P(AllocationTest, rigid_chain) {
+#ifndef CH_COUNT_ALLOCATIONS
+    GTEST_SKIP() << "allocation counting not supported on this platform";
+#endif
+    auto sys = CreatePendulumChain(16);
+    Configure(*sys);
+
+    // The first steps size the workspaces of the system, solver, and timestepper
+    for (int i = 0; i < 10; i++)
+        sys->DoStepDynamics(1e-3);
+
+    ASSERT_EQ(CountAllocations(*sys, 1e-3, 20), 0);
+}
+
+TEST_P(AllocationTest, contact_nsc) {
+#ifndef CH_COUNT_ALLOCATIONS
+    GTEST_SKIP() << "allocation counting not supported on this platform";
+#endif
+    auto sys = CreateSphereLayer(6, ChContactMethod::NSC);
+    Configure(*sys);
+
+    // Settle, until the number of contacts is constant
+    // (contacts with the ground and between neighboring spheres, within the collision envelope)
+    for (int i = 0; i < 100; i++)
+        sys->DoStepDynamics(2e-3);
+    unsigned int num_contacts = sys->GetNumContacts();
+    ASSERT_GE(num_contacts, 36);
+
+    ASSERT_EQ(CountAllocations(*sys, 2e-3, 20), 0);
+    ASSERT_EQ(sys->GetNumContacts(), num_contacts);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChSystem,
+                         AllocationTest,
+                         ::testing::Combine(::testing::Values(ChSolver::Type::PSOR,
+                                                              ChSolver::Type::PJACOBI,
+                                                              ChSolver::Type::APGD,
+                                                              ChSolver::Type::BARZILAIBORWEIN),
+                                            ::testing::Values(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED,
+                                                              ChTimestepper::Type::EULER_IMPLICIT_PROJECTED)));
+
+// Contacts released when the number of contacts drops are reused when it grows again
+TEST(ChSystem, contact_reuse) {
+#ifndef CH_COUNT_ALLOCATIONS
+    GTEST_SKIP() << "allocation counting not supported on this platform";
+#endif
+    auto sys = CreateSphereLayer(4, ChContactMethod::SMC);
+    for (int i = 0; i < 200; i++)
+        sys->DoStepDynamics(5e-4);
+    ASSERT_EQ(sys->GetNumContacts(), 16);
+
+    // Lift all spheres (no contacts), then put them back
+    auto& bodies = sys->GetBodies();
+    std::vector<ChVector3d> positions;
+    for (auto& body : bodies)
+        positions.push_back(body->GetPos());
+    for (auto& body : bodies)
+        if (!body->IsFixed())
+            body->SetPos(body->GetPos() + ChVector3d(0, 0, 1));
+    sys->DoStepDynamics(5e-4);
+    ASSERT_EQ(sys->GetNumContacts(), 0);
+
+    // Direct call to ComputeCollisions (sizes the profiling data for this call path)
+    sys->ComputeCollisions();
+    ASSERT_EQ(sys->GetNumContacts(), 0);
+
+    for (size_t i = 0; i < bodies.size(); i++)
+        bodies[i]->SetPos(positions[i]);
+    num_allocations = 0;
+    counting = true;
+    sys->ComputeCollisions();
+    counting = false;
+    ASSERT_EQ(sys->GetNumContacts(), 16);
+    ASSERT_EQ(num_allocations, 0);
+}
+
+// Cached contact forces are kept only for objects currently in contact (e.g., not for removed bodies)
+TEST(ChSystem, contact_forces_cache) {
+    auto sys = CreateSphereLayer(4, ChContactMethod::SMC);
+    auto container = std::dynamic_pointer_cast<ChContactContainerSMC>(sys->GetContactContainer());
+    ASSERT_TRUE(container);
+
+    for (int i = 0; i < 200; i++)
+        sys->DoStepDynamics(5e-4);
+    ASSERT_EQ(sys->GetNumContacts(), 16);
+    ASSERT_EQ(container->GetNumContactForces(), 17);  // ground and spheres
+
+    // Remove half of the spheres
+    auto bodies = sys->GetBodies();
+    for (size_t i = 1; i < bodies.size(); i += 2)
+        sys->RemoveBody(bodies[i]);
+    sys->DoStepDynamics(5e-4);
+    ASSERT_EQ(sys->GetNumContacts(), 8);
+    ASSERT_EQ(container->GetNumContactForces(), 9);
+    ASSERT_EQ(container->GetContactableForce(bodies[1].get()), VNULL);
+
+    // Lift the remaining spheres
+    for (auto& body : sys->GetBodies())
+        if (!body->IsFixed())
+            body->SetPos(body->GetPos() + ChVector3d(0, 0, 1));
+    sys->DoStepDynamics(5e-4);
+    ASSERT_EQ(sys->GetNumContacts(), 0);
+    ASSERT_EQ(container->GetNumContactForces(), 0);
+}
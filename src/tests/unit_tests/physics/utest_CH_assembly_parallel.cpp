@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the parallel processing of bodies and links in ChAssembly.
+// A set of pendulum chains (revolute joints, springs, motors) is
+// simulated with different numbers of threads and the results are compared.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/physics/ChLinkTSDA.h"
+
+#include "tests/PendulumChain.h"
+
+using namespace chrono;
+
+// Simulate the chains and return the final body states
+static std::vector<double> SimulateChains(int num_threads, bool parallel_update) {
+    const int num_chains = 10;
+    const int num_links = 40;
+    const double length = 0.2;
+
+    ChSystemNSC sys;
+    sys.SetNumThreads(num_threads, 1, 1);
+    sys.EnableParallelUpdate(parallel_update);
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(50);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int ic = 0; ic < num_chains; ic++) {
+        ChVector3d origin(0, ic * 1.0, 0);
+        auto bodies = AddPendulumChain(sys, ground, num_links, length, origin);
+
+        // Springs acting on the same bodies as the joints
+        auto prev = ground;
+        for (int il = 0; il < num_links; il++) {
+            ChVector3d joint_pos = origin + ChVector3d(il * length, 0, 0);
+            auto spring = chrono_types::make_shared<ChLinkTSDA>();
+            spring->Initialize(prev, bodies[il], false, joint_pos + ChVector3d(0, 0, 0.1),
+                               joint_pos + ChVector3d(length, 0, 0.1));
+            spring->SetSpringCoefficient(100);
+            spring->SetDampingCoefficient(1);
+            sys.AddLink(spring);
+            prev = bodies[il];
+        }
+
+        // Motor at the end of each chain
+        auto motor = chrono_types::make_shared<ChLinkMotorRotationSpeed>();
+        motor->Initialize(ground, prev, ChFrame<>(origin + ChVector3d(num_links * length, 0, 0), QUNIT));
+        motor->SetSpeedFunction(chrono_types::make_shared<ChFunctionConst>(1.0));
+        sys.AddLink(motor);
+    }
+
+    for (int i = 0; i < 100; i++)
+        sys.DoStepDynamics(1e-3);
+
+    std::vector<double> states;
+    for (const auto& body : sys.GetBodies()) {
+        for (int k = 0; k < 3; k++) {
+            states.push_back(body->GetPos()[k]);
+            states.push_back(body->GetPosDt()[k]);
+        }
+    }
+    for (const auto& link : sys.GetLinks()) {
+        for (int k = 0; k < 3; k++)
+            states.push_back(link->GetReaction2().force[k]);
+    }
+    return states;
+}
+
+TEST(ChAssembly, parallel_update) {
+    // Parallel processing of the assembly items is opt-in
+    ChSystemNSC sys;
+    ASSERT_FALSE(sys.GetAssembly().IsParallelUpdateEnabled());
+
+    auto serial = SimulateChains(1, true);
+    auto serial_N = SimulateChains(4, false);
+    auto parallel_2 = SimulateChains(2, true);
+    auto parallel_4 = SimulateChains(4, true);
+
+    ASSERT_EQ(serial.size(), serial_N.size());
+    ASSERT_EQ(serial.size(), parallel_2.size());
+    ASSERT_EQ(serial.size(), parallel_4.size());
+
+    double max_diff = 0;
+    for (size_t i = 0; i < serial.size(); i++) {
+        ASSERT_TRUE(std::isfinite(serial[i]));
+        // Disabling parallel processing recovers the serial results
+        ASSERT_EQ(serial[i], serial_N[i]);
+        // Parallel results do not depend on the number of threads
+        ASSERT_EQ(parallel_2[i], parallel_4[i]);
+        max_diff = std::max(max_diff, std::abs(serial[i] - parallel_4[i]) / (1 + std::abs(serial[i])));
+    }
+
+    // Parallel and serial results only differ by the order of the load summations
+    ASSERT_LT(max_diff, 1e-8);
+}
@@ -0,0 +1,182 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for the parallel matrix-vector products of the system descriptor.
+// The Schur complement product and the system (KKT) product are evaluated
+// serially and in parallel (with different numbers of threads) for a random
+// problem with many constraints sharing the same variables, and the results
+// are compared.
+// =============================================================================
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "chrono/solver/ChConstraintTwoBodies.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesBodyOwnMass.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Random problem: bodies connected by many scalar constraints (as in a dense pile of contacting bodies), with an
+// optional set of KRM blocks coupling pairs of bodies.
+class DescriptorProblem {
+  public:
+    DescriptorProblem(int num_bodies, int num_constraints, int num_krm) : gen(42) {
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::uniform_int_distribution<int> body(0, num_bodies - 1);
+
+        for (int i = 0; i < num_bodies; i++) {
+            auto var = std::make_unique<ChVariablesBodyOwnMass>();
+            var->SetBodyMass(1.0 + 0.5 * dist(gen));
+            ChMatrix33<> inertia(ChVector3d(0.2 + 0.1 * dist(gen), 0.3, 0.4 + 0.1 * dist(gen)));
+            var->SetBodyInertia(inertia);
+            // Some fixed bodies
+            var->SetDisabled(i % 17 == 0);
+            variables.push_back(std::move(var));
+        }
+
+        for (int i = 0; i < num_constraints; i++) {
+            int a = body(gen);
+            int b = (a + 1 + body(gen) % (num_bodies - 1)) % num_bodies;
+            auto constr = std::make_unique<ChConstraintTwoBodies>();
+            constr->SetVariables(variables[a].get(), variables[b].get());
+            for (int k = 0; k < 6; k++) {
+                constr->Get_Cq_a()(k) = dist(gen);
+                constr->Get_Cq_b()(k) = dist(gen);
+            }
+            constr->SetComplianceTerm(i % 3 == 0 ? 1e-3 : 0.0);
+            constr->Update_auxiliary();
+            constraints.push_back(std::move(constr));
+        }
+
+        for (int i = 0; i < num_krm; i++) {
+            int a = body(gen);
+            int b = (a + 1 + body(gen) % (num_bodies - 1)) % num_bodies;
+            auto krm = std::make_unique<ChKRMBlock>();
+            krm->SetVariables({variables[a].get(), variables[b].get()});
+            ChMatrixDynamic<> K = ChMatrixDynamic<>::Random(12, 12);
+            krm->GetMatrix() = K + K.transpose();
+            krm_blocks.push_back(std::move(krm));
+        }
+    }
+
+    void Inject(ChSystemDescriptor& descriptor) {
+        descriptor.BeginInsertion();
+        for (auto& constr : constraints)
+            descriptor.InsertConstraint(constr.get());
+        for (auto& var : variables)
+            descriptor.InsertVariables(var.get());
+        for (auto& krm : krm_blocks)
+            descriptor.InsertKRMBlock(krm.get());
+        descriptor.EndInsertion();
+    }
+
+    ChVectorDynamic<> RandomVector(int n) {
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        ChVectorDynamic<> v(n);
+        for (int i = 0; i < n; i++)
+            v(i) = dist(gen);
+        return v;
+    }
+
+    std::mt19937 gen;
+    std::vector<std::unique_ptr<ChVariablesBodyOwnMass>> variables;
+    std::vector<std::unique_ptr<ChConstraintTwoBodies>> constraints;
+    std::vector<std::unique_ptr<ChKRMBlock>> krm_blocks;
+};
+
+TEST(ChSystemDescriptor, schur_product) {
+    DescriptorProblem problem(300, 2000, 0);
+    ChSystemDescriptor descriptor;
+    problem.Inject(descriptor);
+
+    int n_c = (int)descriptor.CountActiveConstraints();
+    ASSERT_EQ(n_c, 2000);
+    auto l = problem.RandomVector(n_c);
+
+    // Disable some constraints
+    std::vector<bool> enabled(n_c);
+    for (int i = 0; i < n_c; i++)
+        enabled[i] = (i % 7 != 0);
+
+    ChVectorDynamic<> result_serial;
+    ChVectorDynamic<> result_serial_enabled;
+    descriptor.EnableParallelProducts(false);
+    descriptor.SetNumThreads(4);
+    descriptor.SchurComplementProduct(result_serial, l);
+    descriptor.SchurComplementProduct(result_serial_enabled, l, &enabled);
+
+    descriptor.EnableParallelProducts(true);
+    for (int nthreads : {2, 3, 4}) {
+        descriptor.SetNumThreads(nthreads);
+        ChVectorDynamic<> result;
+        descriptor.SchurComplementProduct(result, l);
+        ASSERT_EQ(result.size(), n_c);
+        ASSERT_NEAR((result - result_serial).lpNorm<Eigen::Infinity>(), 0.0, 1e-12 * result_serial.norm());
+
+        descriptor.SchurComplementProduct(result, l, &enabled);
+        ASSERT_NEAR((result - result_serial_enabled).lpNorm<Eigen::Infinity>(), 0.0,
+                    1e-12 * result_serial_enabled.norm());
+        for (int i = 0; i < n_c; i += 7)
+            ASSERT_EQ(result(i), 0.0);
+
+        // Repeated evaluations give identical results
+        ChVectorDynamic<> result2;
+        descriptor.SchurComplementProduct(result2, l, &enabled);
+        ASSERT_EQ(result, result2);
+    }
+}
+
+TEST(ChSystemDescriptor, system_product) {
+    DescriptorProblem problem(300, 2000, 100);
+    ChSystemDescriptor descriptor;
+    problem.Inject(descriptor);
+    descriptor.SetMassFactor(0.5);
+
+    int n = (int)(descriptor.CountActiveVariables() + descriptor.CountActiveConstraints());
+    auto x = problem.RandomVector(n);
+
+    ChVectorDynamic<> result_serial;
+    descriptor.EnableParallelProducts(false);
+    descriptor.SetNumThreads(4);
+    descriptor.SystemProduct(result_serial, x);
+
+    descriptor.EnableParallelProducts(true);
+    for (int nthreads : {2, 3, 4}) {
+        descriptor.SetNumThreads(nthreads);
+        ChVectorDynamic<> result;
+        descriptor.SystemProduct(result, x);
+        ASSERT_EQ(result.size(), n);
+        ASSERT_NEAR((result - result_serial).lpNorm<Eigen::Infinity>(), 0.0, 1e-12 * result_serial.norm());
+    }
+}
+
+TEST(ChSystemDescriptor, small_problem_serial) {
+    // Below the size threshold, the products are always evaluated serially (identical results)
+    DescriptorProblem problem(10, 50, 5);
+    ChSystemDescriptor descriptor;
+    problem.Inject(descriptor);
+
+    int n = (int)(descriptor.CountActiveVariables() + descriptor.CountActiveConstraints());
+    auto x = problem.RandomVector(n);
+
+    ChVectorDynamic<> result_serial;
+    descriptor.SystemProduct(result_serial, x);
+
+    descriptor.SetNumThreads(4);
+    ChVectorDynamic<> result;
+    descriptor.SystemProduct(result, x);
+    ASSERT_EQ(result, result_serial);
+}
@@ -0,0 +1,204 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for the Jacobian evaluation of ChExternalDynamics:
+// - full and colored finite differences (given or detected sparsity pattern),
+//   serial and parallel, are compared with the analytical Jacobian;
+// - Jacobian reuse across solver setups reduces the number of Jacobian
+//   evaluations without changing the results significantly.
+// The test problem is a nonlinear 1D heat conduction model (stiff ODE with a
+// tridiagonal Jacobian).
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChExternalDynamics.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Nonlinear heat conduction in a rod with n segments:
+//   dT_i/dt = k * (T_{i-1} - 2 T_i + T_{i+1}) - c * T_i^2 + q(t)
+class HeatODE : public ChExternalDynamics {
+  public:
+    HeatODE(int n, bool analytical, bool pattern)
+        : m_n(n), m_analytical(analytical), m_pattern(pattern), m_k(400.0), m_c(0.1) {}
+
+    void SetNumSegments(int n) { m_n = n; }
+
+    virtual unsigned int GetNumStates() const override { return m_n; }
+    virtual bool IsStiff() const override { return true; }
+
+    virtual void SetInitialConditions(ChVectorDynamic<>& y0) override {
+        for (int i = 0; i < m_n; i++)
+            y0(i) = 1.0 + std::sin(3.0 * i / m_n);
+    }
+
+    virtual void CalculateRHS(double time, const ChVectorDynamic<>& y, ChVectorDynamic<>& rhs) override {
+        for (int i = 0; i < m_n; i++) {
+            double left = (i > 0) ? y(i - 1) : 0.0;
+            double right = (i < m_n - 1) ? y(i + 1) : 0.0;
+            rhs(i) = m_k * (left - 2 * y(i) + right) - m_c * y(i) * y(i) + std::cos(time);
+        }
+    }
+
+    virtual bool CalculateJac(double time,
+                              const ChVectorDynamic<>& y,
+                              const ChVectorDynamic<>& rhs,
+                              ChMatrixDynamic<>& J) override {
+        if (!m_analytical)
+            return false;
+        for (int i = 0; i < m_n; i++) {
+            J(i, i) = -2 * m_k - 2 * m_c * y(i);
+            if (i > 0)
+                J(i, i - 1) = m_k;
+            if (i < m_n - 1)
+                J(i, i + 1) = m_k;
+        }
+        return true;
+    }
+
+    virtual bool CalculateJacPattern(ChMatrixDynamic<bool>& pattern) override {
+        if (!m_pattern)
+            return false;
+        for (int i = 0; i < m_n; i++) {
+            for (int j = std::max(0, i - 1); j <= std::min(m_n - 1, i + 1); j++)
+                pattern(i, j) = true;
+        }
+        return true;
+    }
+
+    using ChExternalDynamics::ComputeJac;
+    using ChExternalDynamics::Update;
+
+  private:
+    int m_n;
+    bool m_analytical;
+    bool m_pattern;
+    double m_k;
+    double m_c;
+};
+
+const int num_states = 200;
+
+// Compute the Jacobian of the heat model at its initial state
+static ChMatrixDynamic<> ComputeJac(std::shared_ptr<HeatODE> ode, ChSystem& sys) {
+    sys.Add(ode);
+    ode->Initialize();
+    ode->Update(0.5);
+    ode->ComputeJac(0.5);
+    return ode->GetJac();
+}
+
+TEST(ChExternalDynamics, colored_jacobian) {
+    ChSystemSMC sys;
+    sys.SetNumThreads(4);
+
+    auto ode_ref = chrono_types::make_shared<HeatODE>(num_states, true, false);
+    auto J_ref = ComputeJac(ode_ref, sys);
+    ASSERT_EQ(ode_ref->GetNumJacRHSEvaluations(), 0);
+
+    // Full finite differences: one RHS evaluation per state
+    auto ode_full = chrono_types::make_shared<HeatODE>(num_states, false, false);
+    auto J_full = ComputeJac(ode_full, sys);
+    ASSERT_EQ(ode_full->GetNumJacRHSEvaluations(), num_states);
+    ASSERT_NEAR((J_full - J_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-3);
+
+    // Colored finite differences with given pattern: 3 colors for a tridiagonal Jacobian
+    auto ode_pattern = chrono_types::make_shared<HeatODE>(num_states, false, true);
+    ode_pattern->EnableColoredJac(true);
+    auto J_pattern = ComputeJac(ode_pattern, sys);
+    ASSERT_EQ(ode_pattern->GetNumJacColors(), 3);
+    ASSERT_EQ(ode_pattern->GetNumJacRHSEvaluations(), 3);
+    ASSERT_NEAR((J_pattern - J_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-3);
+
+    // Colored finite differences with detected pattern: full evaluation first, colored afterwards
+    auto ode_detect = chrono_types::make_shared<HeatODE>(num_states, false, false);
+    ode_detect->EnableColoredJac(true);
+    auto J_detect = ComputeJac(ode_detect, sys);
+    ASSERT_EQ(ode_detect->GetNumJacColors(), 3);
+    ode_detect->ComputeJac(0.5);
+    ASSERT_EQ(ode_detect->GetNumJacRHSEvaluations(), num_states + 3);
+    ASSERT_NEAR((ode_detect->GetJac() - J_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-3);
+    ASSERT_EQ(ode_detect->GetJac(), J_pattern);
+
+    // Parallel evaluation gives identical results
+    auto ode_parallel = chrono_types::make_shared<HeatODE>(num_states, false, true);
+    ode_parallel->EnableColoredJac(true);
+    ode_parallel->EnableParallelJac(true);
+    ASSERT_EQ(ComputeJac(ode_parallel, sys), J_pattern);
+
+    auto ode_parallel_full = chrono_types::make_shared<HeatODE>(num_states, false, false);
+    ode_parallel_full->EnableParallelJac(true);
+    ASSERT_EQ(ComputeJac(ode_parallel_full, sys), J_full);
+}
+
+// Re-initializing with a different number of states discards the detected sparsity pattern
+TEST(ChExternalDynamics, reinitialize) {
+    ChSystemSMC sys;
+
+    auto ode = chrono_types::make_shared<HeatODE>(num_states, false, false);
+    ode->EnableColoredJac(true);
+    ComputeJac(ode, sys);
+    ASSERT_EQ(ode->GetNumJacColors(), 3);
+
+    auto ode_ref = chrono_types::make_shared<HeatODE>(num_states / 2, true, false);
+    auto J_ref = ComputeJac(ode_ref, sys);
+
+    ode->SetNumSegments(num_states / 2);
+    ode->Initialize();
+    ASSERT_EQ(ode->GetNumJacColors(), 0);
+    ode->Update(0.5);
+    ode->ComputeJac(0.5);
+    ASSERT_EQ(ode->GetNumJacColors(), 3);
+    ASSERT_EQ(ode->GetJac().rows(), num_states / 2);
+    ASSERT_NEAR((ode->GetJac() - J_ref).lpNorm<Eigen::Infinity>(), 0.0, 1e-3);
+}
+
+// Simulate the heat model with an implicit integrator and return the final states
+static ChVectorDynamic<> Simulate(std::shared_ptr<HeatODE> ode, ChTimestepper::Type type) {
+    ChSystemSMC sys;
+    sys.Add(ode);
+    ode->Initialize();
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    sys.SetTimestepperType(type);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper())) {
+        hht->SetAlpha(-0.2);
+        hht->SetMaxIters(100);
+        hht->SetAbsTolerances(1e-5);
+    }
+
+    while (sys.GetChTime() < 0.5)
+        sys.DoStepDynamics(1e-2);
+
+    return ode->GetStates();
+}
+
+TEST(ChExternalDynamics, jacobian_reuse) {
+    for (auto type : {ChTimestepper::Type::EULER_IMPLICIT, ChTimestepper::Type::HHT}) {
+        auto ode = chrono_types::make_shared<HeatODE>(50, false, true);
+        ode->EnableColoredJac(true);
+        auto y = Simulate(ode, type);
+
+        auto ode_reuse = chrono_types::make_shared<HeatODE>(50, false, true);
+        ode_reuse->EnableColoredJac(true);
+        ode_reuse->SetJacReuse(10, 0.1);
+        auto y_reuse = Simulate(ode_reuse, type);
+
+        ASSERT_LT(ode_reuse->GetNumJacEvaluations(), ode->GetNumJacEvaluations());
+        ASSERT_NEAR((y - y_reuse).lpNorm<Eigen::Infinity>(), 0.0, 1e-4 * y.lpNorm<Eigen::Infinity>());
+    }
+}
@@ -0,0 +1,175 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for multirate integration with ChMultirateSubsystem.
+// - A driven shaft is connected through a stiff torsional spring to a flywheel.
+//   The fast spring-flywheel subsystem is sub-cycled inside the steps of the
+//   system containing the driven shaft, and the results are compared with
+//   those of a monolithic simulation using the small step size.
+// - A hydraulic actuator between two bodies is sub-cycled and compared with a
+//   stand-alone simulation of the actuator using the small step size.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChMultirateSubsystem.h"
+#include "chrono/physics/ChShaftsTorsionSpring.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/functions/ChFunctionSine.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const double J_driven = 1.0;
+const double J_proxy = 1e-3;
+const double J_flywheel = 0.1;
+const double torque = 10.0;
+const double stiffness = 1e4;
+const double damping = 20.0;
+
+const double t_end = 1.0;
+const double step_macro = 5e-3;
+const int num_substeps = 10;
+
+static std::shared_ptr<ChShaft> AddShaft(ChSystem& sys, double J) {
+    auto shaft = chrono_types::make_shared<ChShaft>();
+    shaft->SetInertia(J);
+    sys.Add(shaft);
+    return shaft;
+}
+
+static void AddSpring(ChSystem& sys, std::shared_ptr<ChShaft> shaft1, std::shared_ptr<ChShaft> shaft2) {
+    auto spring = chrono_types::make_shared<ChShaftsTorsionSpring>();
+    spring->Initialize(shaft1, shaft2);
+    spring->SetTorsionalStiffness(stiffness);
+    spring->SetTorsionalDamping(damping);
+    sys.Add(spring);
+}
+
+TEST(ChMultirateSubsystem, shafts) {
+    // Monolithic reference (proxy inertia lumped with the driven shaft)
+    ChSystemNSC sys_ref;
+    auto driven_ref = AddShaft(sys_ref, J_driven + J_proxy);
+    auto flywheel_ref = AddShaft(sys_ref, J_flywheel);
+    AddSpring(sys_ref, driven_ref, flywheel_ref);
+    driven_ref->SetAppliedLoad(torque);
+
+    while (sys_ref.GetChTime() < t_end - 1e-10)
+        sys_ref.DoStepDynamics(step_macro / num_substeps);
+
+    // Multirate: the spring and flywheel are in the fast subsystem
+    ChSystemNSC sys;
+    auto driven = AddShaft(sys, J_driven);
+    driven->SetAppliedLoad(torque);
+
+    auto subsystem = chrono_types::make_shared<ChSystemNSC>();
+    auto proxy = AddShaft(*subsystem, J_proxy);
+    auto flywheel = AddShaft(*subsystem, J_flywheel);
+    AddSpring(*subsystem, proxy, flywheel);
+
+    auto multirate = chrono_types::make_shared<ChMultirateSubsystem>(subsystem);
+    multirate->SetNumSubsteps(num_substeps);
+    multirate->AddShaftCoupling(driven, proxy);
+    sys.Add(multirate);
+
+    // Take one more step, as the subsystem is advanced at the beginning of a step
+    int num_steps = (int)std::round(t_end / step_macro);
+    for (int i = 0; i <= num_steps; i++)
+        sys.DoStepDynamics(step_macro);
+
+    ASSERT_NEAR(multirate->GetSubsystemTime(), t_end, 1e-10);
+    ASSERT_NEAR(subsystem->GetChTime(), t_end, 1e-10);
+    ASSERT_EQ(multirate->GetNumSubstepsTotal(), num_steps * num_substeps);
+
+    // Subsystem shaft follows the driven shaft
+    ASSERT_NEAR(proxy->GetPos(), driven->GetPos() - driven->GetPosDt() * step_macro, 1e-2);
+
+    // Overall motion matches the monolithic solution
+    double omega_ref = torque * t_end / (J_driven + J_proxy + J_flywheel);
+    ASSERT_NEAR(flywheel_ref->GetPosDt(), omega_ref, 1e-2 * omega_ref);
+    ASSERT_NEAR(flywheel->GetPosDt(), flywheel_ref->GetPosDt(), 2e-2 * omega_ref);
+    ASSERT_NEAR(proxy->GetPosDt(), driven_ref->GetPosDt(), 2e-2 * omega_ref);
+
+    // Coupling torque balances the flywheel inertia
+    double torque_ref = -torque * (J_flywheel + J_proxy) / (J_driven + J_proxy + J_flywheel);
+    ASSERT_NEAR(multirate->GetShaftCouplingTorque(0), torque_ref, 0.1 * std::abs(torque_ref));
+}
+
+// Create a system with a stand-alone hydraulic actuator
+static std::shared_ptr<ChHydraulicActuator3> CreateActuator(ChSystem& sys) {
+    auto actuator = chrono_types::make_shared<ChHydraulicActuator3>();
+    actuator->SetInputFunction(chrono_types::make_shared<ChFunctionSine>(1.0, 5.0));
+    actuator->Cylinder().SetInitialChamberLengths(0.221, 0.221);
+    actuator->Cylinder().SetInitialChamberPressures(3.3e6, 4.4e6);
+    actuator->DirectionalValve().SetInitialSpoolPosition(0);
+    actuator->SetActuatorInitialLength(0.5);
+    actuator->Initialize();
+    sys.Add(actuator);
+
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT);
+    auto integrator = std::static_pointer_cast<ChTimestepperEulerImplicit>(sys.GetTimestepper());
+    integrator->SetMaxIters(50);
+    integrator->SetAbsTolerances(1e-4, 1e2);
+
+    return actuator;
+}
+
+TEST(ChMultirateSubsystem, actuator) {
+    const double step = 1e-3;
+    const int num_steps = 20;
+
+    // Stand-alone actuator at fixed length, with small step size
+    ChSystemSMC sys_ref;
+    auto actuator_ref = CreateActuator(sys_ref);
+    std::vector<double> force_ref;
+    for (int i = 0; i < num_steps * num_substeps; i++) {
+        actuator_ref->SetActuatorLength(0.5, 0.0);
+        sys_ref.DoStepDynamics(step);
+        force_ref.push_back(actuator_ref->GetActuatorForce());
+    }
+
+    // Actuator between two fixed bodies, sub-cycled
+    ChSystemNSC sys;
+    auto body1 = chrono_types::make_shared<ChBody>();
+    body1->SetFixed(true);
+    sys.Add(body1);
+    auto body2 = chrono_types::make_shared<ChBody>();
+    body2->SetPos(ChVector3d(0.5, 0, 0));
+    body2->SetFixed(true);
+    sys.Add(body2);
+
+    auto subsystem = chrono_types::make_shared<ChSystemSMC>();
+    auto actuator = CreateActuator(*subsystem);
+
+    auto multirate = chrono_types::make_shared<ChMultirateSubsystem>(subsystem);
+    multirate->SetNumSubsteps(num_substeps);
+    multirate->AddActuatorCoupling(actuator, body1, body2, true, ChVector3d(0, 0, 0), ChVector3d(0, 0, 0));
+    sys.Add(multirate);
+
+    for (int i = 0; i <= num_steps; i++)
+        sys.DoStepDynamics(step * num_substeps);
+
+    ASSERT_NEAR(subsystem->GetChTime(), sys_ref.GetChTime(), 1e-10);
+    ASSERT_NEAR(actuator->GetActuatorForce(), force_ref.back(), 1e-6 * std::abs(force_ref.back()));
+
+    // Coupling force is the average actuator force over the last macro step
+    double force_avg = 0;
+    for (int i = 0; i < num_substeps; i++)
+        force_avg += force_ref[force_ref.size() - 1 - i] / num_substeps;
+    ASSERT_NEAR(multirate->GetActuatorCouplingForce(0), force_avg, 1e-6 * std::abs(force_avg));
+}
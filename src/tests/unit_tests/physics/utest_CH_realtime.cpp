@@ -0,0 +1,228 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for real-time stepping: deadline tracking in ChRealtimeStepTimer,
+// collision detection interval, and deadline scheduling with degradation of the
+// simulation fidelity in ChRealtimeStepper.
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "chrono/core/ChRealtimeStep.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChRealtimeStepper.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChIterativeSolver.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Callback counting the collision detection passes
+class CollisionCounter : public ChSystem::CustomCollisionCallback {
+  public:
+    CollisionCounter() : count(0) {}
+    virtual void OnCustomCollision(ChSystem* sys) override { count++; }
+    int count;
+};
+
+// Simulated clock, advanced explicitly (waiting for a deadline advances the clock to that deadline)
+class ManualClock : public ChRealtimeStepper::Clock {
+  public:
+    ManualClock() : time(0) {}
+    virtual double GetTime() override { return time; }
+    virtual void WaitUntil(double t) override {
+        time = std::max(time.load(), t);
+        std::this_thread::yield();
+    }
+    std::atomic<double> time;
+};
+
+// Callback simulating an expensive step (e.g., communication with hardware in the loop)
+class SlowStep : public ChRealtimeStepper::StepCallback {
+  public:
+    SlowStep(std::shared_ptr<ManualClock> clock) : clock(clock), delay(0), count(0) {}
+    virtual void OnStep(ChSystem* sys) override {
+        count++;
+        clock->time = clock->time + delay;
+    }
+    std::shared_ptr<ManualClock> clock;
+    double delay;
+    std::atomic<int> count;
+};
+
+// Spheres falling on a fixed box
+static void CreateModel(ChSystem& sys) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+        sphere->SetPos(ChVector3d(0.5 * i, 0, 0.1));
+        sys.AddBody(sphere);
+    }
+}
+
+TEST(ChRealtimeStepTimer, deadlines) {
+    ChRealtimeStepTimer timer;
+
+    // Step completed in time
+    ASSERT_TRUE(timer.Spin(0.01));
+
+    // Step exceeding its deadline
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_FALSE(timer.Spin(1e-3));
+
+    ASSERT_EQ(timer.GetNumSteps(), 2);
+    ASSERT_EQ(timer.GetNumMissedDeadlines(), 1);
+    ASSERT_GT(timer.GetMaxOverrun(), 3e-3);
+
+    timer.ResetStats();
+    ASSERT_EQ(timer.GetNumMissedDeadlines(), 0);
+}
+
+TEST(ChSystem, collision_interval) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+    auto counter = chrono_types::make_shared<CollisionCounter>();
+    sys.RegisterCustomCollisionCallback(counter);
+
+    for (int i = 0; i < 10; i++)
+        sys.DoStepDynamics(1e-3);
+    ASSERT_EQ(counter->count, 10);
+    ASSERT_EQ(sys.GetNumContacts(), 4);
+
+    // Contacts are reused in the steps without collision detection
+    sys.SetCollisionDetectionInterval(3);
+    counter->count = 0;
+    for (int i = 0; i < 9; i++) {
+        sys.DoStepDynamics(1e-3);
+        ASSERT_EQ(sys.GetNumContacts(), 4);
+    }
+    ASSERT_EQ(counter->count, 3);
+}
+
+TEST(ChRealtimeStepper, degradation) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+    sys.SetSolverType(ChSolver::Type::PSOR);
+    sys.GetSolver()->AsIterative()->SetMaxIterations(80);
+
+    double step = 5e-3;
+    ChRealtimeStepper stepper(&sys, step);
+    stepper.GetSettings().min_solver_iterations = 10;
+    stepper.GetSettings().max_collision_interval = 3;
+    stepper.GetSettings().recover_steps = 2;
+
+    auto clock = chrono_types::make_shared<ManualClock>();
+    auto slow = chrono_types::make_shared<SlowStep>(clock);
+    stepper.SetClock(clock);
+    stepper.SetStepCallback(slow);
+
+    // Initialization sizes the system descriptor without advancing the system
+    stepper.Initialize();
+    ASSERT_EQ(sys.GetChTime(), 0);
+    ASSERT_EQ(sys.GetNumSteps(), 0);
+    ASSERT_EQ(sys.GetBodies()[1]->GetPos().z(), 0.1);
+    ASSERT_EQ(sys.GetSystemDescriptor()->GetConstraints().size(), sys.GetNumConstraints());
+    ASSERT_GT(sys.GetSystemDescriptor()->GetConstraints().capacity(), sys.GetNumConstraints());
+
+    // Solver iterations halved 3 times (80 -> 10), then collision interval increased 2 times (1 -> 3)
+    ASSERT_EQ(stepper.GetMaxLevel(), 5);
+
+    // Steps at risk degrade the fidelity by one level each, down to the maximum level
+    slow->delay = 0.9 * step;
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(stepper.DoStep());
+        ASSERT_EQ(stepper.GetStats().level, i + 1);
+    }
+    ASSERT_EQ(sys.GetSolver()->AsIterative()->GetMaxIterations(), 10);
+    ASSERT_EQ(sys.GetCollisionDetectionInterval(), 1);
+
+    // Steps which miss their deadline are counted
+    slow->delay = 2 * step;
+    for (int i = 0; i < 5; i++)
+        ASSERT_FALSE(stepper.DoStep());
+    auto stats = stepper.GetStats();
+    ASSERT_EQ(stats.num_steps, 8);
+    ASSERT_EQ(stats.num_missed, 5);
+    ASSERT_EQ(stats.level, 5);
+    ASSERT_DOUBLE_EQ(stats.max_step_time, 2 * step);
+    ASSERT_EQ(sys.GetSolver()->AsIterative()->GetMaxIterations(), 10);
+    ASSERT_EQ(sys.GetCollisionDetectionInterval(), 3);
+    ASSERT_NEAR(sys.GetChTime(), 8 * step, 1e-12);
+
+    // Steps without enough slack do not restore the fidelity
+    slow->delay = 0.6 * step;
+    for (int i = 0; i < 4; i++)
+        ASSERT_TRUE(stepper.DoStep());
+    ASSERT_EQ(stepper.GetStats().level, 5);
+
+    // Steps with enough slack restore the nominal fidelity, one level every 2 steps
+    slow->delay = 0.1 * step;
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(stepper.DoStep());
+        ASSERT_EQ(stepper.GetStats().level, 5 - (i + 1) / 2);
+    }
+    stats = stepper.GetStats();
+    ASSERT_EQ(stats.num_steps, 22);
+    ASSERT_EQ(stats.num_missed, 5);
+    ASSERT_EQ(stats.level, 0);
+    ASSERT_EQ(sys.GetSolver()->AsIterative()->GetMaxIterations(), 80);
+    ASSERT_EQ(sys.GetCollisionDetectionInterval(), 1);
+}
+
+TEST(ChRealtimeStepper, thread) {
+    ChSystemNSC sys;
+    CreateModel(sys);
+
+    double step = 2e-3;
+    ChRealtimeStepper stepper(&sys, step);
+    auto clock = chrono_types::make_shared<ManualClock>();
+    auto slow = chrono_types::make_shared<SlowStep>(clock);
+    stepper.SetClock(clock);
+    stepper.SetStepCallback(slow);
+
+    stepper.Start();
+    ASSERT_TRUE(stepper.IsRunning());
+    while (slow->count < 10)
+        std::this_thread::yield();
+
+    // Access the system while stepping is suspended
+    double time;
+    int count;
+    {
+        auto lock = stepper.Lock();
+        time = sys.GetChTime();
+        count = slow->count;
+    }
+    ASSERT_GE(count, 10);
+    ASSERT_NEAR(time, count * step, 1e-9);
+
+    stepper.Stop();
+    ASSERT_FALSE(stepper.IsRunning());
+
+    // Each step waits for its deadline, so the simulation keeps pace with the clock
+    auto stats = stepper.GetStats();
+    ASSERT_EQ(stats.num_steps, slow->count);
+    ASSERT_EQ(stats.num_missed, 0);
+    ASSERT_NEAR(sys.GetChTime(), clock->time, 1e-9);
+}
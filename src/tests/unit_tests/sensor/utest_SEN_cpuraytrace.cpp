@@ -0,0 +1,242 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the CPU ray tracing backend (lidar, depth camera, and radar).
+// Also check that changes in the scene are detected, and that a refit top-level
+// BVH gives the same results as a rebuilt one.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChConstants.h"
+
+#include "chrono_sensor/cpu/ChCpuSensorManager.h"
+
+using namespace chrono;
+using namespace sensor;
+
+class CpuRayTraceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        // Wall (1 m thick) with its front face 10 m ahead of the sensors
+        wall = chrono_types::make_shared<ChBodyEasyBox>(1, 20, 20, 1000, true, false);
+        wall->SetPos(ChVector3d(10.5, 0, 0));
+        wall->SetFixed(true);
+        sys.Add(wall);
+
+        base = chrono_types::make_shared<ChBody>();
+        base->SetFixed(true);
+        sys.Add(base);
+    }
+
+    ChSystemNSC sys;
+    std::shared_ptr<ChBodyEasyBox> wall;
+    std::shared_ptr<ChBody> base;
+};
+
+TEST_F(CpuRayTraceTest, lidar) {
+    const unsigned int w = 900;
+    const unsigned int h = 16;
+    ChCpuSensorManager manager(&sys);
+    auto lidar = chrono_types::make_shared<ChCpuLidarSensor>(base, 10.f, ChFrame<>(), w, h, (float)CH_2PI, 0.2f,
+                                                             -0.2f, 100.f);
+    manager.AddSensor(lidar);
+    manager.Update();
+
+    auto di = lidar->GetDIBuffer();
+    ASSERT_TRUE(di);
+    ASSERT_EQ(di->Width, w);
+    ASSERT_EQ(di->Height, h);
+
+    // Beams in the middle column point forward and hit the wall at normal (horizontal) incidence
+    for (unsigned int j = 0; j < h; j++) {
+        float phi = j * 0.4f / (h - 1) - 0.2f;
+        const auto& beam = di->Buffer[j * w + w / 2];
+        EXPECT_NEAR(beam.range, 10 / std::cos(phi), 1e-2);
+        EXPECT_NEAR(beam.intensity, std::cos(phi), 1e-2);
+    }
+
+    // Beams in the first column point backward and return nothing
+    EXPECT_EQ(di->Buffer[0].range, 0);
+    EXPECT_EQ(di->Buffer[0].intensity, 0);
+
+    // Moving the wall is picked up at the next update
+    wall->SetPos(ChVector3d(5.5, 0, 0));
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_EQ(lidar->GetNumLaunches(), 2);
+    EXPECT_NEAR(lidar->GetDIBuffer()->Buffer[w / 2].range, 5 / std::cos(0.2), 1e-2);
+}
+
+TEST_F(CpuRayTraceTest, depth_camera) {
+    const unsigned int w = 64;
+    const unsigned int h = 48;
+    ChCpuSensorManager manager(&sys);
+    auto camera = chrono_types::make_shared<ChCpuDepthCamera>(base, 10.f, ChFrame<>(), w, h, 1.0f, 50.f);
+    manager.AddSensor(camera);
+    manager.Update();
+
+    auto depth = camera->GetDepthBuffer();
+    ASSERT_TRUE(depth);
+    EXPECT_NEAR(depth->Buffer[(h / 2) * w + w / 2].depth, 10, 1e-2);
+
+    // Depth increases away from the image center
+    EXPECT_GT(depth->Buffer[0].depth, depth->Buffer[(h / 2) * w + w / 2].depth);
+
+    // Nothing behind the camera
+    camera->SetOffsetPose(ChFrame<>(VNULL, QuatFromAngleZ(CH_PI)));
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_EQ(camera->GetDepthBuffer()->Buffer[0].depth, 50);
+}
+
+TEST_F(CpuRayTraceTest, lidar_samples) {
+    // Multi-sample beams, with the samples not reduced (input of ChFilterLidarReduce in a filter graph)
+    const unsigned int w = 90;
+    const unsigned int h = 4;
+    const unsigned int sample_radius = 2;
+    ChCpuSensorManager manager(&sys);
+    auto lidar = chrono_types::make_shared<ChCpuLidarSensor>(base, 10.f, ChFrame<>(), w, h, (float)CH_2PI, 0.1f,
+                                                             -0.1f, 100.f, ChCpuLidarSensor::BeamShape::RECTANGULAR,
+                                                             sample_radius);
+    lidar->SetReduceBeams(false);
+    manager.AddSensor(lidar);
+    manager.Update();
+
+    auto di = lidar->GetDIBuffer();
+    ASSERT_TRUE(di);
+    ASSERT_EQ(di->Width, w * 3);
+    ASSERT_EQ(di->Height, h * 3);
+    EXPECT_FALSE(lidar->GetPointCloud());
+
+    // All samples of a forward beam hit the wall
+    for (unsigned int j = 0; j < 3 * h; j++) {
+        for (unsigned int i = 3 * (w / 2); i < 3 * (w / 2) + 3; i++)
+            EXPECT_NEAR(di->Buffer[j * 3 * w + i].range, 10, 0.1);
+    }
+}
+
+TEST_F(CpuRayTraceTest, radar) {
+    const unsigned int w = 20;
+    const unsigned int h = 10;
+    ChCpuSensorManager manager(&sys);
+    auto radar =
+        chrono_types::make_shared<ChCpuRadarSensor>(base, 10.f, ChFrame<>(), w, h, 0.5f, 0.2f, 100.f);
+    manager.AddSensor(radar);
+
+    // Wall approaching the radar
+    wall->SetFixed(false);
+    sys.SetGravitationalAcceleration(VNULL);
+    wall->SetPosDt(ChVector3d(-2, 0, 0));
+    manager.Update();
+
+    auto returns = radar->GetRadarBuffer();
+    ASSERT_TRUE(returns);
+    ASSERT_EQ(returns->Width, w);
+    ASSERT_EQ(returns->Height, h);
+    EXPECT_EQ(returns->Beam_return_count, (int)(w * h));
+
+    const auto& ret = returns->Buffer[(h / 2) * w + w / 2];
+    EXPECT_NEAR(ret.range * std::cos(ret.azimuth), 10, 0.1);
+    EXPECT_NEAR(ret.doppler_velocity[0], -2, 1e-5);
+    EXPECT_NEAR(ret.doppler_velocity[1], 0, 1e-5);
+    EXPECT_GT(ret.amplitude, 0.9);
+
+    // No Doppler velocity for returns from a static object
+    wall->SetPosDt(VNULL);
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_EQ(radar->GetRadarBuffer()->Buffer[(h / 2) * w + w / 2].doppler_velocity[0], 0);
+}
+
+TEST_F(CpuRayTraceTest, scene_changes) {
+    const unsigned int w = 64;
+    const unsigned int h = 48;
+    ChCpuSensorManager manager(&sys);
+    auto camera = chrono_types::make_shared<ChCpuDepthCamera>(base, 10.f, ChFrame<>(), w, h, 1.0f, 50.f);
+    manager.AddSensor(camera);
+    manager.Update();
+    EXPECT_NEAR(camera->GetDepthBuffer()->Buffer[(h / 2) * w + w / 2].depth, 10, 1e-2);
+    EXPECT_FALSE(manager.GetScene().IsOutdated());
+
+    // A body added in front of the wall is picked up at the next update, without explicit reconstruction
+    auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, true, false);
+    box->SetPos(ChVector3d(4.5, 0, 0));
+    box->SetFixed(true);
+    sys.Add(box);
+    EXPECT_TRUE(manager.GetScene().IsOutdated());
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_NEAR(camera->GetDepthBuffer()->Buffer[(h / 2) * w + w / 2].depth, 4, 1e-2);
+
+    // Hiding the shape of the box is also detected
+    box->GetVisualShape(0)->SetVisible(false);
+    EXPECT_TRUE(manager.GetScene().IsOutdated());
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_NEAR(camera->GetDepthBuffer()->Buffer[(h / 2) * w + w / 2].depth, 10, 1e-2);
+}
+
+TEST_F(CpuRayTraceTest, tlas_refit) {
+    // Spheres in a grid in front of the wall
+    std::vector<std::shared_ptr<ChBodyEasySphere>> spheres;
+    for (int iy = -5; iy <= 5; iy++) {
+        for (int iz = -5; iz <= 5; iz++) {
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, true, false);
+            sphere->SetPos(ChVector3d(5, 0.6 * iy, 0.6 * iz));
+            sphere->SetFixed(true);
+            sys.Add(sphere);
+            spheres.push_back(sphere);
+        }
+    }
+
+    const unsigned int w = 128;
+    const unsigned int h = 128;
+    ChCpuSensorManager manager(&sys);
+    manager.GetScene().SetRebuildThreshold(1e6f);
+    auto camera = chrono_types::make_shared<ChCpuDepthCamera>(base, 10.f, ChFrame<>(), w, h, 1.5f, 50.f);
+    manager.AddSensor(camera);
+    manager.Update();
+    EXPECT_EQ(manager.GetScene().GetNumTLASBuilds(), 1);
+
+    // Shuffle the spheres: the top-level BVH is only refit
+    for (size_t k = 0; k < spheres.size(); k++) {
+        size_t l = (7 * k + 3) % spheres.size();
+        spheres[k]->SetPos(ChVector3d(4 + 0.01 * (double)k, 0.6 * (double)(l % 11) - 3, 0.6 * (double)(l / 11) - 3));
+    }
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_EQ(manager.GetScene().GetNumTLASBuilds(), 1);
+    auto refit = camera->GetDepthBuffer();
+
+    // Same image with a rebuilt scene
+    ChCpuSensorManager manager_rebuilt(&sys);
+    auto camera_rebuilt = chrono_types::make_shared<ChCpuDepthCamera>(base, 10.f, ChFrame<>(), w, h, 1.5f, 50.f);
+    manager_rebuilt.AddSensor(camera_rebuilt);
+    manager_rebuilt.Update();
+    auto rebuilt = camera_rebuilt->GetDepthBuffer();
+    for (unsigned int k = 0; k < w * h; k++)
+        ASSERT_EQ(refit->Buffer[k].depth, rebuilt->Buffer[k].depth);
+
+    // With a lower threshold, the degraded hierarchy is rebuilt
+    manager.GetScene().SetRebuildThreshold(1.2f);
+    for (size_t k = 0; k < spheres.size(); k++) {
+        size_t l = (13 * k + 5) % spheres.size();
+        spheres[k]->SetPos(ChVector3d(4, 0.6 * (double)(l % 11) - 3, 0.6 * (double)(l / 11) - 3));
+    }
+    sys.DoStepDynamics(0.1);
+    manager.Update();
+    EXPECT_EQ(manager.GetScene().GetNumTLASBuilds(), 2);
+}
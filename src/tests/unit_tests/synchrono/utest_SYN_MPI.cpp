@@ -34,6 +34,7 @@ using namespace synchrono;
 
 int rank;
 int num_ranks;
+std::shared_ptr<SynMPICommunicator> communicator;
 
 // Define our own main here to handle the MPI setup
 int main(int argc, char* argv[]) {
@@ -41,7 +42,7 @@ int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 
     // Create the MPI communicator and the manager
-    auto communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
+    communicator = chrono_types::make_shared<SynMPICommunicator>(argc, argv);
     rank = communicator->GetRank();
     num_ranks = communicator->GetNumRanks();
     SynChronoManager syn_manager(rank, num_ranks, communicator);
@@ -102,4 +103,111 @@ TEST(SynChrono, SynChronoInit) {
 
     delete[] msg_lengths;
     delete[] msg_displs;
-}
\ No newline at end of file
+}
+
+// Exchange one state message per rank, with the interest region of each rank at the given location.
+// Return the source keys of the received messages.
+static std::vector<AgentKey> ExchangeStates(const ChVector3d& location) {
+    auto state = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(rank, 1), AgentKey());
+    state->SetState(0.1, SynPose(location, QUNIT), std::vector<SynPose>(4, SynPose(location, QUNIT)));
+
+    SynMessageList messages = {state};
+    communicator->AddOutgoingMessages(messages);
+    communicator->SetInterestRegion(location, 1.0);
+    communicator->Synchronize();
+
+    std::vector<AgentKey> sources;
+    for (auto& message : communicator->GetMessages())
+        sources.push_back(message->GetSourceKey());
+    communicator->Reset();
+
+    return sources;
+}
+
+TEST(SynChrono, InterestManagement) {
+    communicator->SetInterestRadius(10);
+
+    // All ranks far apart: nothing is received
+    auto sources = ExchangeStates(ChVector3d(100.0 * rank, 0, 0));
+    EXPECT_TRUE(sources.empty());
+
+    // Ranks 0 and 1 within the interest radius, all other ranks far apart
+    ChVector3d location = rank < 2 ? ChVector3d(5.0 * rank, 0, 0) : ChVector3d(100.0 * rank, 0, 0);
+    sources = ExchangeStates(location);
+    if (rank < 2 && num_ranks > 1) {
+        ASSERT_EQ(sources.size(), (size_t)1);
+        EXPECT_EQ(sources[0], AgentKey(1 - rank, 1));
+    } else {
+        EXPECT_TRUE(sources.empty());
+    }
+
+    // Interest management disabled: messages from all other ranks are received
+    communicator->SetInterestRadius(0);
+    sources = ExchangeStates(ChVector3d(100.0 * rank, 0, 0));
+    EXPECT_EQ(sources.size(), (size_t)(num_ranks - 1));
+
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+// Serialize the given state message and read it back into a new message
+static std::shared_ptr<SynWheeledVehicleStateMessage> RoundTrip(const SynWheeledVehicleStateMessage& state) {
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(state.ConvertToFlatBuffers(builder));
+
+    auto received = chrono_types::make_shared<SynWheeledVehicleStateMessage>(AgentKey(), AgentKey());
+    received->ConvertFromFlatBuffers(flatbuffers::GetRoot<SynFlatBuffers::Message>(builder.GetBufferPointer()));
+    return received;
+}
+
+static SynPose TestPose(double t, double offset) {
+    SynPose pose(ChVector3d(10 * t + offset, 2 * t, 0.5), QuatFromAngleZ(0.3 * t + offset));
+    pose.GetFrame().SetPosDt(ChVector3d(10, 2, 0));
+    return pose;
+}
+
+TEST(SynChrono, DeltaEncoding) {
+    SynWheeledVehicleStateMessage state(AgentKey(rank, 1), AgentKey());
+    state.SetDeltaEncoding(4);
+
+    std::shared_ptr<SynWheeledVehicleStateMessage> first_keyframe;
+    std::shared_ptr<SynWheeledVehicleStateMessage> keyframe;
+    for (int k = 0; k < 10; k++) {
+        double t = 0.01 * k;
+        std::vector<SynPose> wheels = {TestPose(t, 1), TestPose(t, 2), TestPose(t, 3), TestPose(t, 4)};
+        state.SetState(t, TestPose(t, 0), wheels);
+
+        auto received = RoundTrip(state);
+
+        // A keyframe every 4 messages, deltas in between
+        bool is_keyframe = (k % 4 == 0);
+        ASSERT_EQ(received->IsKeyframe(), is_keyframe);
+        ASSERT_EQ(received->IsDelta(), !is_keyframe);
+
+        if (is_keyframe) {
+            keyframe = received;
+            if (!first_keyframe)
+                first_keyframe = received;
+        } else {
+            ASSERT_TRUE(received->Decode(*keyframe));
+        }
+
+        // The reconstructed state matches the sent state (up to the single precision of the differences)
+        ASSERT_EQ(received->wheels.size(), wheels.size());
+        EXPECT_NEAR((received->chassis.GetFrame().GetPos() - state.chassis.GetFrame().GetPos()).Length(), 0, 1e-6);
+        EXPECT_NEAR((received->chassis.GetFrame().GetRot() - state.chassis.GetFrame().GetRot()).Length(), 0, 1e-6);
+        for (size_t i = 0; i < wheels.size(); i++)
+            EXPECT_NEAR((received->wheels[i].GetFrame().GetPos() - wheels[i].GetFrame().GetPos()).Length(), 0, 1e-6);
+    }
+
+    // A receiver which missed the last keyframe cannot decode the deltas until it requests a new keyframe
+    state.SetState(0.5, TestPose(0.5, 0), std::vector<SynPose>(4, TestPose(0.5, 1)));
+    auto received = RoundTrip(state);
+    ASSERT_TRUE(received->IsDelta());
+    EXPECT_FALSE(received->Decode(*first_keyframe));
+
+    state.RequestKeyframe();
+    state.SetState(0.51, TestPose(0.51, 0), std::vector<SynPose>(4, TestPose(0.51, 1)));
+    received = RoundTrip(state);
+    EXPECT_TRUE(received->IsKeyframe());
+    EXPECT_NEAR((received->chassis.GetFrame().GetPos() - state.chassis.GetFrame().GetPos()).Length(), 0, 1e-12);
+}
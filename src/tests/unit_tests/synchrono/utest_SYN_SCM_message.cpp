@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the encodings of SynSCMMessage.
+// Modified SCM nodes are serialized and read back with the default encoding,
+// with the compact (run-length coded, quantized) encoding, packed and
+// unpacked, and with relative levels too large for the quantized encoding.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono_synchrono/flatbuffer/message/SynSCMMessage.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::synchrono;
+
+// Modified nodes on a few grid rows, with gaps, in no particular order
+static std::vector<SCMTerrain::NodeLevel> TestNodes() {
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    for (int y = 5; y >= -3; y -= 2) {
+        for (int x = -10; x < 20; x++) {
+            if (x % 7 == 3)
+                continue;
+            nodes.push_back(std::make_pair(ChVector2i(x, y), -0.05 * std::sin(0.3 * x + 0.7 * y)));
+        }
+    }
+    return nodes;
+}
+
+// Serialize the given message and read it back into a new message
+static SynSCMMessage RoundTrip(const SynSCMMessage& message, size_t& size) {
+    flatbuffers::FlatBufferBuilder builder;
+    builder.Finish(message.ConvertToFlatBuffers(builder));
+    size = builder.GetSize();
+
+    SynSCMMessage received;
+    received.ConvertFromFlatBuffers(flatbuffers::GetRoot<SynFlatBuffers::Message>(builder.GetBufferPointer()));
+    return received;
+}
+
+// Check that the received nodes match the sent nodes (in any order), with the given tolerance on levels
+static void CheckNodes(const std::vector<SCMTerrain::NodeLevel>& sent,
+                       const std::vector<SCMTerrain::NodeLevel>& received,
+                       double tolerance) {
+    auto less = [](const SCMTerrain::NodeLevel& a, const SCMTerrain::NodeLevel& b) {
+        return a.first.y() < b.first.y() || (a.first.y() == b.first.y() && a.first.x() < b.first.x());
+    };
+    auto sent_sorted = sent;
+    auto received_sorted = received;
+    std::sort(sent_sorted.begin(), sent_sorted.end(), less);
+    std::sort(received_sorted.begin(), received_sorted.end(), less);
+
+    ASSERT_EQ(sent_sorted.size(), received_sorted.size());
+    for (size_t i = 0; i < sent_sorted.size(); i++) {
+        ASSERT_EQ(sent_sorted[i].first, received_sorted[i].first);
+        ASSERT_NEAR(sent_sorted[i].second, received_sorted[i].second, tolerance);
+    }
+}
+
+TEST(SynSCMMessage, default_encoding) {
+    SynSCMMessage message;
+    message.time = 1.5;
+    message.modified_nodes = TestNodes();
+
+    size_t size;
+    auto received = RoundTrip(message, size);
+    EXPECT_FALSE(received.IsCompact());
+    EXPECT_EQ(received.time, message.time);
+    CheckNodes(message.modified_nodes, received.modified_nodes, 0);
+}
+
+TEST(SynSCMMessage, compact_encoding) {
+    double resolution = 1e-4;
+
+    SynSCMMessage message;
+    message.modified_nodes = TestNodes();
+
+    size_t size_default;
+    RoundTrip(message, size_default);
+
+    // Run-length coded indices and quantized levels, unpacked and packed
+    for (bool pack : {false, true}) {
+        message.SetCompactEncoding(resolution, pack);
+
+        size_t size;
+        auto received = RoundTrip(message, size);
+        EXPECT_TRUE(received.IsCompact());
+        CheckNodes(message.modified_nodes, received.modified_nodes, resolution / 2 + 1e-12);
+        EXPECT_LT(size, size_default);
+    }
+}
+
+TEST(SynSCMMessage, compact_encoding_overflow) {
+    double resolution = 1e-4;
+
+    SynSCMMessage message;
+    message.modified_nodes = TestNodes();
+    message.modified_nodes[3].second = 40000 * resolution;
+
+    // The relative levels are sent unquantized
+    for (bool pack : {false, true}) {
+        message.SetCompactEncoding(resolution, pack);
+
+        size_t size;
+        auto received = RoundTrip(message, size);
+        EXPECT_TRUE(received.IsCompact());
+        CheckNodes(message.modified_nodes, received.modified_nodes, 0);
+    }
+}
@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test concurrent evaluation of wheeled vehicle and trailer tires.
+// An HMMWV (with and without the Ultra-Tow trailer) is driven on rigid flat
+// terrain with constant driver inputs; tire forces obtained with one and with
+// four tire threads must be identical. Also check that, after synchronization,
+// each trailer spindle carries exactly the force of its own tire.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledTrailer.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Simulate the HMMWV (and optionally the trailer) and return the history of all tire forces.
+static std::vector<TerrainForce> Simulate(int num_threads, bool add_trailer) {
+    WheeledVehicle vehicle(vehicle::GetDataFile("hmmwv/vehicle/HMMWV_Vehicle.json"), ChContactMethod::SMC);
+    vehicle.Initialize(ChCoordsys<>(ChVector3d(0, 0, 0.5), QUNIT));
+    vehicle.GetChassis()->SetFixed(false);
+
+    auto engine = ReadEngineJSON(vehicle::GetDataFile("hmmwv/powertrain/HMMWV_EngineShafts.json"));
+    auto transmission =
+        ReadTransmissionJSON(vehicle::GetDataFile("hmmwv/powertrain/HMMWV_AutomaticTransmissionShafts.json"));
+    vehicle.InitializePowertrain(chrono_types::make_shared<ChPowertrainAssembly>(engine, transmission));
+
+    for (auto& axle : vehicle.GetAxles()) {
+        for (auto& wheel : axle->GetWheels()) {
+            auto tire = ReadTireJSON(vehicle::GetDataFile("hmmwv/tire/HMMWV_TMeasyTire.json"));
+            vehicle.InitializeTire(tire, wheel, VisualizationType::NONE);
+        }
+    }
+    vehicle.SetTireNumThreads(num_threads);
+
+    auto system = vehicle.GetSystem();
+
+    std::shared_ptr<WheeledTrailer> trailer;
+    if (add_trailer) {
+        trailer = chrono_types::make_shared<WheeledTrailer>(system, vehicle::GetDataFile("ultra_tow/UT_Trailer.json"));
+        trailer->Initialize(vehicle.GetChassis());
+        for (auto& axle : trailer->GetAxles()) {
+            for (auto& wheel : axle->GetWheels()) {
+                auto tire = ReadTireJSON(vehicle::GetDataFile("ultra_tow/UT_TMeasyTire.json"));
+                trailer->InitializeTire(tire, wheel, VisualizationType::NONE);
+            }
+        }
+        trailer->SetTireNumThreads(num_threads);
+    }
+
+    system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    RigidTerrain terrain(system, vehicle::GetDataFile("terrain/RigidPlane.json"));
+    terrain.Initialize();
+    EXPECT_TRUE(terrain.SupportsConcurrentQueries());
+
+    DriverInputs driver_inputs = {0.3, 0.5, 0.0, 0.0};
+
+    std::vector<TerrainForce> forces;
+    double step_size = 2e-3;
+    for (int frame = 0; frame < 500; frame++) {
+        double time = system->GetChTime();
+
+        vehicle.Synchronize(time, driver_inputs, terrain);
+        if (add_trailer)
+            trailer->Synchronize(time, driver_inputs, terrain);
+        terrain.Synchronize(time);
+
+        for (auto& axle : vehicle.GetAxles()) {
+            for (auto& wheel : axle->GetWheels())
+                forces.push_back(wheel->GetTire()->ReportTireForce(&terrain));
+        }
+
+        if (add_trailer) {
+            // Each spindle must carry the force of its own tire, applied once.
+            for (auto& axle : trailer->GetAxles()) {
+                for (auto& wheel : axle->GetWheels()) {
+                    auto tire_force = wheel->GetTire()->ReportTireForce(&terrain);
+                    EXPECT_NEAR((wheel->GetSpindle()->GetAccumulatedForce() - tire_force.force).Length(), 0, 1e-8);
+                    forces.push_back(tire_force);
+                }
+            }
+        }
+
+        vehicle.Advance(step_size);
+        if (add_trailer)
+            trailer->Advance(step_size);
+        terrain.Advance(step_size);
+    }
+
+    return forces;
+}
+
+static void CompareForces(const std::vector<TerrainForce>& forces_1, const std::vector<TerrainForce>& forces_n) {
+    ASSERT_EQ(forces_1.size(), forces_n.size());
+    double max_force = 0;
+    for (size_t i = 0; i < forces_1.size(); i++) {
+        ASSERT_EQ(forces_1[i].force, forces_n[i].force) << "tire force " << i;
+        ASSERT_EQ(forces_1[i].moment, forces_n[i].moment) << "tire moment " << i;
+        max_force = std::max(max_force, forces_1[i].force.Length());
+    }
+    // The vehicle is in contact with the terrain (the comparison is not trivial)
+    ASSERT_GT(max_force, 1000.0);
+}
+
+TEST(ChWheeledVehicle, tire_threads) {
+    auto forces_1 = Simulate(1, false);
+    auto forces_4 = Simulate(4, false);
+    CompareForces(forces_1, forces_4);
+}
+
+TEST(ChWheeledTrailer, tire_threads) {
+    auto forces_1 = Simulate(1, true);
+    auto forces_4 = Simulate(4, true);
+    CompareForces(forces_1, forces_4);
+}
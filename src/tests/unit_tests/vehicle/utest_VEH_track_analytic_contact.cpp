@@ -0,0 +1,216 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for the analytic wheel-shoe contact (ChTrackAnalyticContact).
+// The collision between a road-wheel cylinder and a track shoe contact patch
+// (with the dimensions of the M113 shoe pad) is checked for a centered wheel,
+// for a wheel partially off the patch (lateral clipping and longitudinal edge
+// contact), and for a wheel not in contact. Lateral collisions between the
+// wheel and a shoe guide pin are checked. The default contact force is checked
+// against the spring-damper formula.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/physics/ChBody.h"
+
+#include "chrono_vehicle/tracked_vehicle/ChTrackContactManager.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// M113 road-wheel (one of the two cylinders) and shoe pad (top face at half the shoe height)
+static const double R = 0.305;
+static const double hw = 0.065;
+static const ChTrackAnalyticContact::ShoePatch patch = {ChVector3d(0, 0, 0.03), 0.05, 0.09};
+
+TEST(ChTrackAnalyticContact, centered) {
+    ChFrame<> shoe_frame;
+    ChVector3d a(0, 1, 0);
+    ChVector3d c(0, 0, 0.03 + R - 0.002);
+
+    ChCollisionInfo cinfo[2];
+    int num = ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo);
+    ASSERT_EQ(num, 2);
+
+    // One contact point at each end of the cylinder rim line, on the patch surface
+    EXPECT_NEAR(cinfo[0].vpA.y(), -hw, 1e-12);
+    EXPECT_NEAR(cinfo[1].vpA.y(), +hw, 1e-12);
+    for (int k = 0; k < 2; k++) {
+        EXPECT_NEAR(cinfo[k].distance, -0.002, 1e-12);
+        EXPECT_NEAR((cinfo[k].vN - ChVector3d(0, 0, -1)).Length(), 0, 1e-12);
+        EXPECT_NEAR(cinfo[k].vpA.x(), 0, 1e-12);
+        EXPECT_NEAR(cinfo[k].vpA.z(), 0.028, 1e-12);
+        EXPECT_NEAR(cinfo[k].vpB.z(), 0.03, 1e-12);
+    }
+}
+
+TEST(ChTrackAnalyticContact, lateral_clipping) {
+    ChFrame<> shoe_frame;
+    ChVector3d a(0, 1, 0);
+
+    // Wheel partially off the patch: the rim line is clipped to the patch width
+    ChVector3d c(0, 0.07, 0.03 + R - 0.002);
+    ChCollisionInfo cinfo[2];
+    int num = ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo);
+    ASSERT_EQ(num, 2);
+    EXPECT_NEAR(cinfo[0].vpA.y(), 0.07 - hw, 1e-12);
+    EXPECT_NEAR(cinfo[1].vpA.y(), patch.hwidth, 1e-12);
+
+    // Wheel completely off the patch
+    c = ChVector3d(0, 0.09 + hw + 0.001, 0.03 + R - 0.002);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo), 0);
+}
+
+TEST(ChTrackAnalyticContact, longitudinal_edge) {
+    ChFrame<> shoe_frame;
+    ChVector3d a(0, 1, 0);
+
+    // Lowest rim point beyond the patch end: contact at the patch edge, with reduced penetration
+    double dx = 0.03;
+    ChVector3d c(patch.hlength + dx, 0, 0.03 + R - 0.002);
+    ChCollisionInfo cinfo[2];
+    int num = ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo);
+    ASSERT_EQ(num, 2);
+    double depth = 0.002 - (R - std::sqrt(R * R - dx * dx));
+    for (int k = 0; k < 2; k++) {
+        EXPECT_NEAR(cinfo[k].vpA.x(), patch.hlength, 1e-12);
+        EXPECT_NEAR(cinfo[k].vpB.x(), patch.hlength, 1e-12);
+        EXPECT_NEAR(cinfo[k].distance, -depth, 1e-12);
+    }
+
+    // Far enough beyond the patch end that the rim clears the edge
+    c = ChVector3d(patch.hlength + 0.05, 0, 0.03 + R - 0.002);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo), 0);
+}
+
+TEST(ChTrackAnalyticContact, no_contact) {
+    ChFrame<> shoe_frame;
+    ChVector3d a(0, 1, 0);
+    ChCollisionInfo cinfo[2];
+
+    // Wheel above the patch
+    ChVector3d c(0, 0, 0.03 + R + 0.001);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo), 0);
+
+    // Wheel center below the patch surface
+    c = ChVector3d(0, 0, 0.02);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, shoe_frame, patch, cinfo), 0);
+}
+
+TEST(ChTrackAnalyticContact, frame_invariance) {
+    // The lateral clipping case, with the shoe and the wheel moved by the same arbitrary frame
+    ChFrame<> X(ChVector3d(1, -2, 0.5), QuatFromAngleAxis(0.7, ChVector3d(1, 2, 3).GetNormalized()));
+    ChVector3d a = X.TransformDirectionLocalToParent(ChVector3d(0, 1, 0));
+    ChVector3d c_loc(0.02, 0.07, 0.03 + R - 0.002);
+    ChVector3d c = X.TransformPointLocalToParent(c_loc);
+
+    ChCollisionInfo cinfo_ref[2];
+    ChCollisionInfo cinfo[2];
+    int num_ref = ChTrackAnalyticContact::CollideCylinderPatch(c_loc, ChVector3d(0, 1, 0), R, hw, ChFrame<>(), patch,
+                                                               cinfo_ref);
+    int num = ChTrackAnalyticContact::CollideCylinderPatch(c, a, R, hw, X, patch, cinfo);
+    ASSERT_EQ(num_ref, 2);
+    ASSERT_EQ(num, num_ref);
+    for (int k = 0; k < num; k++) {
+        EXPECT_NEAR(cinfo[k].distance, cinfo_ref[k].distance, 1e-12);
+        EXPECT_NEAR((cinfo[k].vpA - X.TransformPointLocalToParent(cinfo_ref[k].vpA)).Length(), 0, 1e-12);
+        EXPECT_NEAR((cinfo[k].vpB - X.TransformPointLocalToParent(cinfo_ref[k].vpB)).Length(), 0, 1e-12);
+        EXPECT_NEAR((cinfo[k].vN - X.TransformDirectionLocalToParent(cinfo_ref[k].vN)).Length(), 0, 1e-12);
+    }
+}
+
+TEST(ChTrackAnalyticContact, force) {
+    double kn = 2e6;
+    double gn = 4e3;
+    auto contact = chrono_types::make_shared<ChTrackAnalyticContact>();
+    contact->SetContactParameters(kn, gn);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    auto wheel = chrono_types::make_shared<ChBody>();
+    wheel->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 1, 1, 1));
+    wheel->SetPos(ChVector3d(0, 0, 0.03 + R - 0.002));
+    wheel->SetPosDt(ChVector3d(0.5, 0, -0.1));
+    auto shoe = chrono_types::make_shared<ChBody>();
+    shoe->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeBox>(mat, 1, 1, 1));
+    shoe->SetPosDt(ChVector3d(0, 0, 0.2));
+
+    ChCollisionInfo cinfo[2];
+    int num = ChTrackAnalyticContact::CollideCylinderPatch(wheel->GetPos(), ChVector3d(0, 1, 0), R, hw, ChFrame<>(),
+                                                           patch, cinfo);
+    ASSERT_EQ(num, 2);
+
+    for (int k = 0; k < num; k++) {
+        cinfo[k].modelA = wheel->GetCollisionModel().get();
+        cinfo[k].modelB = shoe->GetCollisionModel().get();
+        ChVector3d force;
+        contact->ComputeWheelContactForce(cinfo[k], wheel, shoe, force);
+
+        // Approach velocity along the normal is 0.3 (tangential velocity does not contribute)
+        double forceN = kn * 0.002 + gn * 0.3;
+        EXPECT_NEAR((force - ChVector3d(0, 0, -forceN)).Length(), 0, 1e-8);
+    }
+
+    // Separating fast enough: no adhesion force
+    shoe->SetPosDt(ChVector3d(0, 0, -5));
+    ChVector3d force;
+    contact->ComputeWheelContactForce(cinfo[0], wheel, shoe, force);
+    EXPECT_EQ(force, VNULL);
+}
+
+// Guide pin at the center of the shoe (side faces at y = +-0.02, top face at z = 0.13)
+static const ChTrackAnalyticContact::ShoeGuide guide = {ChVector3d(0, 0, 0.08), ChVector3d(0.04, 0.02, 0.05)};
+
+TEST(ChTrackAnalyticContact, guide_lateral) {
+    ChFrame<> shoe_frame;
+    ChVector3d a(0, 1, 0);
+
+    // Wheel resting on the pad, its inner face penetrating the +Y side face of the guide
+    ChVector3d c(0, 0.02 + hw - 0.003, 0.03 + R);
+    ChCollisionInfo cinfo[2];
+    int num = ChTrackAnalyticContact::CollideCylinderGuide(c, a, R, hw, shoe_frame, guide, cinfo);
+    ASSERT_EQ(num, 1);
+    EXPECT_NEAR(cinfo[0].distance, -0.003, 1e-12);
+    EXPECT_NEAR((cinfo[0].vN - ChVector3d(0, -1, 0)).Length(), 0, 1e-12);
+    EXPECT_NEAR(cinfo[0].vpA.y(), 0.017, 1e-12);
+    EXPECT_NEAR(cinfo[0].vpB.y(), 0.02, 1e-12);
+    EXPECT_NEAR(cinfo[0].vpB.z(), 0.13, 1e-12);
+
+    // Same collision, mirrored, with the wheel axis reversed
+    c.y() = -c.y();
+    num = ChTrackAnalyticContact::CollideCylinderGuide(c, -a, R, hw, shoe_frame, guide, cinfo);
+    ASSERT_EQ(num, 1);
+    EXPECT_NEAR(cinfo[0].distance, -0.003, 1e-12);
+    EXPECT_NEAR((cinfo[0].vN - ChVector3d(0, 1, 0)).Length(), 0, 1e-12);
+    EXPECT_NEAR(cinfo[0].vpB.y(), -0.02, 1e-12);
+}
+
+TEST(ChTrackAnalyticContact, guide_no_contact) {
+    ChFrame<> shoe_frame;
+    ChVector3d a(0, 1, 0);
+    ChCollisionInfo cinfo[2];
+
+    // Wheel clear of the guide
+    ChVector3d c(0, 0.02 + hw + 0.001, 0.03 + R);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderGuide(c, a, R, hw, shoe_frame, guide, cinfo), 0);
+
+    // Wheel above the guide
+    c = ChVector3d(0, 0.02 + hw - 0.003, 0.13 + R + 0.001);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderGuide(c, a, R, hw, shoe_frame, guide, cinfo), 0);
+
+    // Wheel axis not lateral
+    c = ChVector3d(0, 0.02 + hw - 0.003, 0.03 + R);
+    EXPECT_EQ(ChTrackAnalyticContact::CollideCylinderGuide(c, ChVector3d(1, 0, 0), R, hw, shoe_frame, guide, cinfo),
+              0);
+}